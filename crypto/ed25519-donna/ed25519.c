@@ -225,6 +225,67 @@ ed25519_publickey_ext(const ed25519_secret_key extsk, ed25519_public_key pk) {
 	ge25519_pack(pk, &A);
 }
 
+void
+ed25519_sign_stream_init(ed25519_sign_stream_context *ctx, const ed25519_secret_key sk) {
+	ed25519_extsk(ctx->extsk, sk);
+
+	/* r = H(aExt[32..64], m) */
+	ed25519_hash_init(&ctx->hash);
+	ed25519_hash_update(&ctx->hash, ctx->extsk + 32, 32);
+}
+
+void
+ed25519_sign_stream_update(ed25519_sign_stream_context *ctx, const unsigned char *m, size_t mlen) {
+	ed25519_hash_update(&ctx->hash, m, mlen);
+}
+
+void
+ed25519_sign_stream_rewind(ed25519_sign_stream_context *ctx) {
+	bignum256modm r = {0};
+	ge25519 ALIGN(16) R = {0};
+	ed25519_public_key pk = {0};
+	hash_512bits hashr = {0};
+
+	ed25519_hash_final(&ctx->hash, hashr);
+	expand256_modm(r, hashr, 64);
+	memzero(&hashr, sizeof(hashr));
+
+	/* R = rB */
+	ge25519_scalarmult_base_niels(&R, ge25519_niels_base_multiples, r);
+	ge25519_pack(ctx->R, &R);
+	contract256_modm(ctx->r, r);
+	memzero(&r, sizeof(r));
+
+	/* A = aB */
+	ed25519_publickey_ext(ctx->extsk, pk);
+
+	/* H(R,A,m) */
+	ed25519_hash_init(&ctx->hash);
+	ed25519_hash_update(&ctx->hash, ctx->R, 32);
+	ed25519_hash_update(&ctx->hash, pk, 32);
+}
+
+void
+ed25519_sign_stream_final(ed25519_sign_stream_context *ctx, ed25519_signature RS) {
+	bignum256modm r = {0}, S = {0}, a = {0};
+	hash_512bits hram = {0};
+
+	ed25519_hash_final(&ctx->hash, hram);
+	expand256_modm(S, hram, 64);
+
+	/* S = (r + H(R,A,m)a) mod L */
+	expand256_modm(a, ctx->extsk, 32);
+	mul256_modm(S, S, a);
+	memzero(&a, sizeof(a));
+	expand_raw256_modm(r, ctx->r);
+	add256_modm(S, S, r);
+	memzero(&r, sizeof(r));
+
+	memcpy(RS, ctx->R, 32);
+	contract256_modm(RS + 32, S);
+	memzero(ctx, sizeof(*ctx));
+}
+
 int
 ed25519_cosi_combine_publickeys(ed25519_public_key res, CONST ed25519_public_key *pks, size_t n) {
 	size_t i = 0;
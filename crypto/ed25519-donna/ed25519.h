@@ -2,6 +2,7 @@
 #define ED25519_H
 
 #include "options.h"
+#include "sha2.h"
 
 #if defined(__cplusplus)
 extern "C" {
@@ -24,6 +25,24 @@ void ed25519_sign_ext(const unsigned char *m, size_t mlen, const ed25519_secret_
 
 int ed25519_scalarmult(ed25519_public_key res, const ed25519_secret_key sk, const ed25519_public_key pk);
 
+/*
+	Signs a message that is read twice instead of being held in memory:
+	init, update with the whole message, rewind, update with the same
+	message again, final. The caller must make sure both passes see the
+	same bytes, otherwise the signature leaks the secret key.
+*/
+typedef struct {
+	SHA512_CTX hash;
+	unsigned char extsk[64];
+	unsigned char r[32];
+	unsigned char R[32];
+} ed25519_sign_stream_context;
+
+void ed25519_sign_stream_init(ed25519_sign_stream_context *ctx, const ed25519_secret_key sk);
+void ed25519_sign_stream_update(ed25519_sign_stream_context *ctx, const unsigned char *m, size_t mlen);
+void ed25519_sign_stream_rewind(ed25519_sign_stream_context *ctx);
+void ed25519_sign_stream_final(ed25519_sign_stream_context *ctx, ed25519_signature RS);
+
 void curve25519_scalarmult(curve25519_key mypublic, const curve25519_key secret, const curve25519_key basepoint);
 void curve25519_scalarmult_basepoint(curve25519_key mypublic, const curve25519_key secret);
 
@@ -6637,6 +6637,53 @@ START_TEST(test_ed25519) {
 }
 END_TEST
 
+START_TEST(test_ed25519_sign_stream) {
+  ed25519_secret_key sk;
+  ed25519_signature sig, sig_stream;
+  ed25519_sign_stream_context ctx;
+  uint8_t msg[1000];
+
+  memcpy(sk,
+         fromhex(
+             "26c76712d89d906e6672dafa614c42e5cb1caac8c6568e4d2493087db51f0d36"),
+         32);
+  for (size_t i = 0; i < sizeof(msg); i++) {
+    msg[i] = i * 7;
+  }
+
+  static const size_t lengths[] = {0, 1, 32, 127, 128, 1000};
+  static const size_t steps[] = {1, 13, 64, 1000};
+  for (size_t l = 0; l < sizeof(lengths) / sizeof(*lengths); l++) {
+    size_t len = lengths[l];
+    ed25519_sign(msg, len, sk, sig);
+    for (size_t s = 0; s < sizeof(steps) / sizeof(*steps); s++) {
+      ed25519_sign_stream_init(&ctx, sk);
+      for (int pass = 0; pass < 2; pass++) {
+        for (size_t off = 0; off < len; off += steps[s]) {
+          size_t n = len - off < steps[s] ? len - off : steps[s];
+          ed25519_sign_stream_update(&ctx, msg + off, n);
+        }
+        if (pass == 0) {
+          ed25519_sign_stream_rewind(&ctx);
+        }
+      }
+      ed25519_sign_stream_final(&ctx, sig_stream);
+      ck_assert_mem_eq(sig_stream, sig, 64);
+    }
+  }
+
+  // a second pass over different data gives a different signature
+  ed25519_sign_stream_init(&ctx, sk);
+  ed25519_sign_stream_update(&ctx, msg, 32);
+  ed25519_sign_stream_rewind(&ctx);
+  ed25519_sign_stream_update(&ctx, msg + 1, 32);
+  ed25519_sign_stream_final(&ctx, sig_stream);
+  ed25519_public_key pk;
+  ed25519_publickey(sk, pk);
+  ck_assert_int_ne(ed25519_sign_open(msg, 32, pk, sig_stream), 0);
+}
+END_TEST
+
 // test vectors from
 // https://raw.githubusercontent.com/NemProject/nem-test-vectors/master/2.test-sign.dat
 START_TEST(test_ed25519_keccak) {
@@ -9660,6 +9707,7 @@ Suite *test_suite(void) {
 
   tc = tcase_create("ed25519");
   tcase_add_test(tc, test_ed25519);
+  tcase_add_test(tc, test_ed25519_sign_stream);
   suite_add_tcase(s, tc);
 
   tc = tcase_create("ed25519_keccak");
@@ -111,17 +111,34 @@ void oledRefresh(void) {
 
   static uint32_t data[OLED_HEIGHT][OLED_WIDTH];
 
-  for (size_t i = 0; i < OLED_BUFSIZE; i++) {
-    int x = (OLED_BUFSIZE - 1 - i) % OLED_WIDTH;
-    int y = (OLED_BUFSIZE - 1 - i) / OLED_WIDTH * 8 + 7;
+  /* Only convert and upload the parts that changed since the last refresh */
+  OledSpan spans[OLED_HEIGHT / 8];
+  oledTakeDirtySpans(spans);
 
-    for (uint8_t shift = 0; shift < 8; shift++, y--) {
-      bool set = (buffer[i] >> shift) & 1;
-      data[y][x] = set ? 0xFFFFFFFF : 0xFF000000;
+  for (int page = 0; page < OLED_HEIGHT / 8; page++) {
+    if (spans[page].first > spans[page].last) {
+      continue;
     }
+    for (int c = spans[page].first; c <= spans[page].last; c++) {
+      size_t i = page * OLED_WIDTH + c;
+      int x = (OLED_BUFSIZE - 1 - i) % OLED_WIDTH;
+      int y = (OLED_BUFSIZE - 1 - i) / OLED_WIDTH * 8 + 7;
+
+      for (uint8_t shift = 0; shift < 8; shift++, y--) {
+        bool set = (buffer[i] >> shift) & 1;
+        data[y][x] = set ? 0xFFFFFFFF : 0xFF000000;
+      }
+    }
+
+    SDL_Rect rect;
+    rect.x = OLED_WIDTH - 1 - spans[page].last;
+    rect.y = (OLED_HEIGHT / 8 - 1 - page) * 8;
+    rect.w = spans[page].last - spans[page].first + 1;
+    rect.h = 8;
+    SDL_UpdateTexture(texture, &rect, &data[rect.y][rect.x],
+                      OLED_WIDTH * sizeof(uint32_t));
   }
 
-  SDL_UpdateTexture(texture, NULL, data, OLED_WIDTH * sizeof(uint32_t));
   SDL_RenderCopy(renderer, texture, NULL, &dstrect);
   SDL_RenderPresent(renderer);
 
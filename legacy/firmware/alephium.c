@@ -1,27 +1,74 @@
 #include "alephium.h"
 #include "alephium/alph_layout.h"
+#include "chunk_signer.h"
 
 #define MAX_ALEPHIUM_DATA_SIZE 20480
 static uint8_t alephium_data_buffer[MAX_ALEPHIUM_DATA_SIZE]
     __attribute__((section(".secMessageSection")));
-static size_t alephium_data_left = 0;
-static size_t alephium_data_total_size = 0;
+static size_t alephium_data_size = 0;
 static AlephiumTxRequest msg_tx_request;
 static uint32_t alephium_address_n[8] = {0};
 static uint32_t alephium_address_n_count = 0;
 static HDNode global_node;
+static ChunkSigner alph_signer = {.name = "Alephium"};
 
 bool alephium_get_address(const AlephiumGetAddress *msg,
                           AlephiumAddress *resp) {
   return alph_get_address(msg, resp);
 }
 
+static void alephium_buffer_data(const uint8_t *data, size_t size) {
+  memcpy(alephium_data_buffer + alephium_data_size, data, size);
+  alephium_data_size += size;
+}
+
+static void alephium_finish_tx(void) {
+  if (alephium_data_buffer[2] == 1) {
+    alephium_send_request_bytecode();
+    return;
+  }
+  AlephiumDecodedTx decoded_tx;
+  AlephiumError err = decode_alephium_tx(alephium_data_buffer,
+                                         alephium_data_size, &decoded_tx);
+  if (err != ALEPHIUM_OK) {
+    fsm_sendFailure(FailureType_Failure_DataError,
+                    "Failed to decode transaction");
+    alephium_signing_abort();
+    return;
+  }
+  AlephiumSignedTx resp = {0};
+  alephium_process_decoded_tx(&decoded_tx, NULL, 0, &resp);
+
+  if (resp.signature.size == 64) {
+    msg_write(MessageType_MessageType_AlephiumSignedTx, &resp);
+  } else {
+    fsm_sendFailure(FailureType_Failure_ProcessError,
+                    "Failed to generate signature");
+  }
+}
+
+// The buffered data and the node outlive the chunk session, the bytecode
+// request that may follow it still needs them.
+static const ChunkSignerOps alephium_signer_ops = {
+    .max_length = MAX_ALEPHIUM_DATA_SIZE,
+    .update = alephium_buffer_data,
+    .request = alephium_send_request_chunk,
+    .finish = alephium_finish_tx,
+};
+
 void alephium_sign_tx(const HDNode *node, const AlephiumSignTx *msg) {
-  char log_buffer[1024];
+  uint32_t data_length = msg->data_initial_chunk.size;
+  if (msg->has_data_length && msg->data_length > data_length) {
+    data_length = msg->data_length;
+  }
+  chunk_signer_init(&alph_signer, &alephium_signer_ops);
+  if (!chunk_signer_set_length(&alph_signer, data_length,
+                               msg->data_initial_chunk.size)) {
+    return;
+  }
+
   memcpy(&global_node, node, sizeof(HDNode));
-  alephium_data_total_size = msg->data_initial_chunk.size;
-  memcpy(alephium_data_buffer, msg->data_initial_chunk.bytes,
-         msg->data_initial_chunk.size);
+  alephium_data_size = 0;
   alephium_address_n_count = msg->address_n_count;
   if (alephium_address_n_count > 8) {
     alephium_address_n_count = 8;
@@ -29,47 +76,13 @@ void alephium_sign_tx(const HDNode *node, const AlephiumSignTx *msg) {
   memcpy(alephium_address_n, msg->address_n,
          alephium_address_n_count * sizeof(uint32_t));
 
-  if (msg->has_data_length && msg->data_length > 0 &&
-      msg->data_length > msg->data_initial_chunk.size) {
-    alephium_data_total_size = msg->data_length;
-    alephium_data_left =
-        alephium_data_total_size - msg->data_initial_chunk.size;
-    snprintf(log_buffer, sizeof(log_buffer),
-             "Requesting more data chunks, total size: %zu, data left: %zu",
-             (size_t)alephium_data_total_size, (size_t)alephium_data_left);
-    alephium_send_request_chunk();
-  } else {
-    if (alephium_data_buffer[2] == 1) {
-      alephium_send_request_bytecode();
-      return;
-    }
-    AlephiumDecodedTx decoded_tx;
-    AlephiumError err = decode_alephium_tx(
-        alephium_data_buffer, alephium_data_total_size, &decoded_tx);
-    if (err != ALEPHIUM_OK) {
-      fsm_sendFailure(FailureType_Failure_DataError,
-                      "Failed to decode transaction");
-      alephium_signing_abort();
-      return;
-    }
-    AlephiumSignedTx resp = {0};
-    alephium_process_decoded_tx(&decoded_tx, NULL, 0, &resp);
-
-    if (resp.signature.size == 64) {
-      msg_write(MessageType_MessageType_AlephiumSignedTx, &resp);
-    } else {
-      fsm_sendFailure(FailureType_Failure_ProcessError,
-                      "Failed to generate signature");
-    }
-
-    layoutHome();
-  }
+  chunk_signer_start(&alph_signer, msg->data_initial_chunk.bytes,
+                     msg->data_initial_chunk.size);
 }
 
-void alephium_send_request_chunk(void) {
+void alephium_send_request_chunk(uint32_t size) {
   msg_tx_request.has_data_length = true;
-  msg_tx_request.data_length =
-      alephium_data_left <= 1024 ? alephium_data_left : 1024;
+  msg_tx_request.data_length = size;
   msg_write(MessageType_MessageType_AlephiumTxRequest, &msg_tx_request);
 }
 
@@ -85,76 +98,18 @@ void alephium_send_request_bytecode(void) {
 }
 
 void alephium_signing_txack(const AlephiumTxAck *tx) {
-  char debug_msg[256];
-
-  if (alephium_data_left == 0) {
-    fsm_sendFailure(FailureType_Failure_UnexpectedMessage,
-                    "Not in Alephium signing mode");
-    layoutHome();
-    return;
-  }
-
-  if (tx->data_chunk.size > alephium_data_left) {
-    fsm_sendFailure(FailureType_Failure_DataError, "Too much data");
-    alephium_signing_abort();
-    return;
-  }
-
-  if (alephium_data_left > 0 && tx->data_chunk.size == 0) {
-    fsm_sendFailure(FailureType_Failure_DataError, "Empty data chunk received");
-    alephium_signing_abort();
-    return;
-  }
-
-  memcpy(alephium_data_buffer + (alephium_data_total_size - alephium_data_left),
-         tx->data_chunk.bytes, tx->data_chunk.size);
-  alephium_data_left -= tx->data_chunk.size;
-
-  snprintf(debug_msg, sizeof(debug_msg), "Received data chunk size: %zu",
-           (size_t)tx->data_chunk.size);
-  snprintf(debug_msg, sizeof(debug_msg), "Data left after receiving chunk: %zu",
-           (size_t)alephium_data_left);
-
-  if (alephium_data_left > 0) {
-    alephium_send_request_chunk();
-  } else {
-    if (alephium_data_buffer[2] == 1) {
-      alephium_send_request_bytecode();
-      return;
-    }
-
-    AlephiumDecodedTx decoded_tx;
-    AlephiumError err = decode_alephium_tx(
-        alephium_data_buffer, alephium_data_total_size, &decoded_tx);
-    if (err != ALEPHIUM_OK) {
-      fsm_sendFailure(FailureType_Failure_DataError,
-                      "Failed to decode transaction");
-      alephium_signing_abort();
-      return;
-    }
-
-    AlephiumSignedTx resp = {0};
-    alephium_process_decoded_tx(&decoded_tx, NULL, 0, &resp);
-    if (resp.signature.size == 64) {
-      msg_write(MessageType_MessageType_AlephiumSignedTx, &resp);
-    } else {
-      fsm_sendFailure(FailureType_Failure_ProcessError,
-                      "Failed to generate signature");
-    }
-
-    layoutHome();
-  }
+  chunk_signer_txack(&alph_signer, tx->data_chunk.bytes, tx->data_chunk.size);
 }
 
 void alephium_handle_bytecode_ack(const AlephiumBytecodeAck *msg) {
   if (msg->bytecode_data.size > 0) {
     size_t remove_length = msg->bytecode_data.size;
-    if (remove_length > alephium_data_total_size) {
+    if (remove_length > alephium_data_size) {
       fsm_sendFailure(FailureType_Failure_DataError, "Invalid remove_length");
       layoutHome();
       return;
     }
-    size_t remove_bytecode_data_size = alephium_data_total_size - remove_length;
+    size_t remove_bytecode_data_size = alephium_data_size - remove_length;
 
     if (remove_bytecode_data_size == 0) {
       fsm_sendFailure(FailureType_Failure_DataError,
@@ -263,8 +218,8 @@ void hex_string_to_decimal_string(const char *hex, char *decimal,
 void alephium_signing_abort(void) {
   memset(alephium_data_buffer, 0, sizeof(alephium_data_buffer));
   memset(&global_node, 0, sizeof(HDNode));
-  alephium_data_left = 0;
-  alephium_data_total_size = 0;
+  alephium_data_size = 0;
+  chunk_signer_abort(&alph_signer);
   layoutHome();
 }
 
@@ -443,7 +398,7 @@ void alephium_process_decoded_tx(const AlephiumDecodedTx *decoded_tx,
   }
 
   uint8_t hash[32];
-  blake2b(alephium_data_buffer, alephium_data_total_size, hash, sizeof(hash));
+  blake2b(alephium_data_buffer, alephium_data_size, hash, sizeof(hash));
   uint8_t signature[64];
   uint8_t v;
   int ret = hdnode_sign_digest(&global_node, hash, signature, &v, NULL);
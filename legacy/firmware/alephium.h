@@ -26,7 +26,7 @@
 bool alephium_get_address(const AlephiumGetAddress *msg, AlephiumAddress *resp);
 void alephium_sign_tx(const HDNode *node, const AlephiumSignTx *msg);
 void alephium_signing_txack(const AlephiumTxAck *tx);
-void alephium_send_request_chunk(void);
+void alephium_send_request_chunk(uint32_t size);
 void alephium_handle_bytecode_ack(const AlephiumBytecodeAck *msg);
 void alephium_send_request_bytecode(void);
 void alephium_signing_abort(void);
@@ -9,6 +9,7 @@
 #define FIXARR_15 0x9f
 #define FIXSTR_0 0xa0
 #define FIXSTR_31 0xbf
+#define NIL 0xc0
 #define BOOL_FALSE 0xc2
 #define BOOL_TRUE 0xc3
 
@@ -21,6 +22,14 @@
 #define UINT32 0xce
 #define UINT64 0xcf
 
+#define FLOAT32 0xca
+#define FLOAT64 0xcb
+
+#define INT8 0xd0
+#define INT16 0xd1
+#define INT32 0xd2
+#define INT64 0xd3
+
 #define STR8 0xd9
 #define STR16 0xda
 #define STR32 0xdb
@@ -31,4 +40,6 @@
 #define MAP16 0xde
 #define MAP32 0xdf
 
+#define NEGFIXINT_0 0xe0
+
 #endif
@@ -146,14 +146,14 @@ static parser_error_t parser_printCommonParams(const parser_tx_t *parser_tx_obj,
     case IDX_COMMON_GEN_HASH:
       snprintf(outKey, outKeyLen, "Genesis hash");
       base64_encode((const char *)parser_tx_obj->genesisHash,
-                    sizeof(parser_tx_obj->genesisHash), buff, sizeof(buff));
+                    HASH_SIZE, buff, sizeof(buff));
       pageString(outVal, outValLen, buff, pageIdx, pageCount);
       return parser_ok;
 
     case IDX_COMMON_GROUP_ID:
       snprintf(outKey, outKeyLen, "Group ID");
       base64_encode((const char *)parser_tx_obj->groupID,
-                    sizeof(parser_tx_obj->groupID), buff, sizeof(buff));
+                    HASH_SIZE, buff, sizeof(buff));
       pageString(outVal, outValLen, buff, pageIdx, pageCount);
       return parser_ok;
 
@@ -233,14 +233,14 @@ static parser_error_t parser_printTxKeyreg(const txn_keyreg *keyreg,
   switch (displayIdx) {
     case IDX_KEYREG_VOTE_PK:
       snprintf(outKey, outKeyLen, "Vote PK");
-      base64_encode((const char *)keyreg->votepk, sizeof(keyreg->votepk), buff,
+      base64_encode((const char *)keyreg->votepk, ACCT_SIZE, buff,
                     sizeof(buff));
       pageString(outVal, outValLen, buff, pageIdx, pageCount);
       return parser_ok;
 
     case IDX_KEYREG_VRF_PK:
       snprintf(outKey, outKeyLen, "VRF PK");
-      base64_encode((const char *)keyreg->vrfpk, sizeof(keyreg->vrfpk), buff,
+      base64_encode((const char *)keyreg->vrfpk, ACCT_SIZE, buff,
                     sizeof(buff));
       pageString(outVal, outValLen, buff, pageIdx, pageCount);
       return parser_ok;
@@ -248,8 +248,8 @@ static parser_error_t parser_printTxKeyreg(const txn_keyreg *keyreg,
     case IDX_KEYREG_SPRF_PK: {
       snprintf(outKey, outKeyLen, "SPRF PK");
       char tmpBuff[90];
-      base64_encode((const char *)keyreg->sprfkey, sizeof(keyreg->sprfkey),
-                    tmpBuff, sizeof(tmpBuff));
+      base64_encode((const char *)keyreg->sprfkey, SPRF_KEY_SIZE, tmpBuff,
+                    sizeof(tmpBuff));
       pageString(outVal, outValLen, tmpBuff, pageIdx, pageCount);
       return parser_ok;
     }
@@ -473,30 +473,29 @@ static parser_error_t parser_printTxAssetConfig(
     case IDX_CONFIG_METADATA_HASH:
       snprintf(outKey, outKeyLen, "Metadata hash");
       base64_encode((const char *)asset_config->params.metadata_hash,
-                    sizeof(asset_config->params.metadata_hash), buff,
-                    sizeof(buff));
+                    HASH_SIZE, buff, sizeof(buff));
       pageString(outVal, outValLen, buff, pageIdx, pageCount);
       return parser_ok;
 
     case IDX_CONFIG_MANAGER:
       snprintf(outKey, outKeyLen, "Manager");
-      return _toStringAddress((uint8_t *)asset_config->params.manager, outVal,
-                              outValLen, pageIdx, pageCount);
+      return _toStringAddress(asset_config->params.manager, outVal, outValLen,
+                              pageIdx, pageCount);
 
     case IDX_CONFIG_RESERVE:
       snprintf(outKey, outKeyLen, "Reserve");
-      return _toStringAddress((uint8_t *)asset_config->params.reserve, outVal,
-                              outValLen, pageIdx, pageCount);
+      return _toStringAddress(asset_config->params.reserve, outVal, outValLen,
+                              pageIdx, pageCount);
 
     case IDX_CONFIG_FREEZER:
       snprintf(outKey, outKeyLen, "Freezer");
-      return _toStringAddress((uint8_t *)asset_config->params.freeze, outVal,
-                              outValLen, pageIdx, pageCount);
+      return _toStringAddress(asset_config->params.freeze, outVal, outValLen,
+                              pageIdx, pageCount);
 
     case IDX_CONFIG_CLAWBACK:
       snprintf(outKey, outKeyLen, "Clawback");
-      return _toStringAddress((uint8_t *)asset_config->params.clawback, outVal,
-                              outValLen, pageIdx, pageCount);
+      return _toStringAddress(asset_config->params.clawback, outVal, outValLen,
+                              pageIdx, pageCount);
 
     default:
       break;
@@ -573,10 +572,12 @@ static parser_error_t parser_printTxApplication(
       const uint8_t tmpIdx = (displayIdx - application->num_foreign_apps -
                               application->num_foreign_assets) -
                              IDX_FOREIGN_APP;
-      uint8_t account[ACCT_SIZE] = {0};
+      if (tmpIdx >= application->num_accounts) {
+        return parser_unexpected_number_items;
+      }
       snprintf(outKey, outKeyLen, "Account %d", tmpIdx);
-      CHECK_ERROR(_getAccount(ctx, account, tmpIdx, application->num_accounts))
-      if (!encodePubKey((uint8_t *)buff, sizeof(buff), account)) {
+      if (!encodePubKey((uint8_t *)buff, sizeof(buff),
+                        application->accounts[tmpIdx])) {
         return parser_unexpected_buffer_end;
       }
       pageString(outVal, outValLen, buff, pageIdx, pageCount);
@@ -588,12 +589,11 @@ static parser_error_t parser_printTxApplication(
           (displayIdx - application->num_foreign_apps -
            application->num_foreign_assets - application->num_accounts) -
           IDX_FOREIGN_APP;
+      if (tmpIdx >= application->num_app_args) {
+        return parser_unexpected_number_items;
+      }
       snprintf(outKey, outKeyLen, "App arg %d", tmpIdx);
-      uint8_t *app_args_ptr = NULL;
-      CHECK_ERROR(_getAppArg(ctx, &app_args_ptr,
-                             &application->app_args_len[tmpIdx], tmpIdx,
-                             MAX_ARGLEN, MAX_ARG))
-      b64hash_data((unsigned char *)app_args_ptr,
+      b64hash_data(application->app_args[tmpIdx],
                    application->app_args_len[tmpIdx], buff, sizeof(buff));
       pageString(outVal, outValLen, buff, pageIdx, pageCount);
       return parser_ok;
@@ -611,15 +611,15 @@ static parser_error_t parser_printTxApplication(
 
     case IDX_APPROVE:
       snprintf(outKey, outKeyLen, "Apprv");
-      b64hash_data((unsigned char *)application->aprog, application->aprog_len,
-                   buff, sizeof(buff));
+      b64hash_data(application->aprog, application->aprog_len, buff,
+                   sizeof(buff));
       pageString(outVal, outValLen, buff, pageIdx, pageCount);
       return parser_ok;
 
     case IDX_CLEAR:
       snprintf(outKey, outKeyLen, "Clear");
-      b64hash_data((unsigned char *)application->cprog, application->cprog_len,
-                   buff, sizeof(buff));
+      b64hash_data(application->cprog, application->cprog_len, buff,
+                   sizeof(buff));
       pageString(outVal, outValLen, buff, pageIdx, pageCount);
       return parser_ok;
 
@@ -26,8 +26,8 @@ char* encodePubKey(uint8_t* buffer, uint16_t bufferLen,
                        bufferLen, BASE32_ALPHABET_RFC4648);
 }
 
-parser_error_t b64hash_data(unsigned char* data, size_t data_len, char* b64hash,
-                            size_t b64hashLen) {
+parser_error_t b64hash_data(const unsigned char* data, size_t data_len,
+                            char* b64hash, size_t b64hashLen) {
   unsigned char hash[32];
   // Hash program and b64 encode for display
   SHA256_CTX ctx;
@@ -61,7 +61,7 @@ parser_error_t _toStringBalance(uint64_t* amount, uint8_t decimalPlaces,
   return parser_ok;
 }
 
-parser_error_t _toStringAddress(uint8_t* address, char* outValue,
+parser_error_t _toStringAddress(const uint8_t* address, char* outValue,
                                 uint16_t outValueLen, uint8_t pageIdx,
                                 uint8_t* pageCount) {
   if (all_zero_key(address)) {
@@ -116,15 +116,15 @@ parser_error_t _toStringSchema(const state_schema* schema, char* outValue,
 
 bool is_opt_in_tx(parser_tx_t* tx_obj) {
   if (tx_obj->type == TX_ASSET_XFER && tx_obj->asset_xfer.amount == 0 &&
-      tx_obj->asset_xfer.id != 0 &&
+      tx_obj->asset_xfer.id != 0 && tx_obj->asset_xfer.sender != NULL &&
       memcmp(tx_obj->asset_xfer.receiver, tx_obj->asset_xfer.sender,
-             sizeof(tx_obj->asset_xfer.receiver)) == 0) {
+             ACCT_SIZE) == 0) {
     return true;
   }
   return false;
 }
 
-bool all_zero_key(uint8_t* buff) {
+bool all_zero_key(const uint8_t* buff) {
   for (int i = 0; i < 32; i++) {
     if (buff[i] != 0) {
       return false;
@@ -12,6 +12,18 @@ static uint8_t tx_num_items;
 static uint8_t itemArray[MAX_ITEM_ARRAY] = {0};
 static uint8_t itemIndex = 0;
 
+// Offsets of the top level keys and their values, recorded by a single walk
+// over the transaction map so that field lookups never rescan the buffer.
+#define MAX_TX_KEYS 48
+#define MAX_MSGPACK_DEPTH 8
+typedef struct {
+  uint16_t key;
+  uint16_t value;
+  uint8_t keyLen;
+} tx_key_t;
+static tx_key_t txKeys[MAX_TX_KEYS];
+static uint8_t txKeysLen = 0;
+
 DEC_READFIX_UNSIGNED(8);
 DEC_READFIX_UNSIGNED(16);
 DEC_READFIX_UNSIGNED(32);
@@ -33,6 +45,7 @@ parser_error_t parser_init_context(parser_context_t *ctx, const uint8_t *buffer,
   num_items = 0;
   common_num_items = 0;
   tx_num_items = 0;
+  txKeysLen = 0;
 
   if (bufferSize == 0 || buffer == NULL) {
     // Not available, use defaults
@@ -224,34 +237,6 @@ parser_error_t _readInteger(parser_context_t *c, uint64_t *value) {
   return parser_ok;
 }
 
-parser_error_t _readBinFixed(parser_context_t *c, uint8_t *buff,
-                             uint16_t bufferLen) {
-  uint8_t binType = 0;
-  uint8_t binLen = 0;
-  CHECK_ERROR(_readUInt8(c, &binType))
-  switch (binType) {
-    case BIN8: {
-      CHECK_ERROR(_readUInt8(c, &binLen))
-      break;
-    }
-    case BIN16:
-    case BIN32: {
-      return parser_msgpack_bin_type_not_supported;
-      break;
-    }
-    default: {
-      return parser_msgpack_bin_type_expected;
-      break;
-    }
-  }
-
-  if (binLen != bufferLen) {
-    return parser_msgpack_bin_unexpected_size;
-  }
-  CHECK_ERROR(_readBytes(c, buff, bufferLen))
-  return parser_ok;
-}
-
 static parser_error_t _readBinSize(parser_context_t *c, uint16_t *binSize) {
   uint8_t binType = 0;
   CHECK_ERROR(_readUInt8(c, &binType))
@@ -313,38 +298,20 @@ static parser_error_t _verifyBin(parser_context_t *c, uint16_t *buffer_len,
   return parser_ok;
 }
 
-static parser_error_t _readBin(parser_context_t *c, uint8_t *buff,
-                               uint16_t *bufferLen, uint16_t bufferMaxSize) {
-  uint8_t binType = 0;
-  uint16_t binLen = 0;
-  CHECK_ERROR(_readUInt8(c, &binType))
-  switch (binType) {
-    case BIN8: {
-      uint8_t tmp = 0;
-      CHECK_ERROR(_readUInt8(c, &tmp))
-      binLen = (uint16_t)tmp;
-      break;
-    }
-    case BIN16: {
-      CHECK_ERROR(_readUInt16(c, &binLen))
-      break;
-    }
-    case BIN32: {
-      return parser_msgpack_bin_type_not_supported;
-      break;
-    }
-    default: {
-      return parser_msgpack_bin_type_expected;
-      break;
-    }
-  }
+static parser_error_t _readBinView(parser_context_t *c, const uint8_t **view,
+                                   uint16_t *viewLen, uint16_t maxLen) {
+  CHECK_ERROR(_verifyBin(c, viewLen, maxLen))
+  *view = c->buffer + c->offset - *viewLen;
+  return parser_ok;
+}
 
-  if (binLen > bufferMaxSize) {
+static parser_error_t _readBinFixedView(parser_context_t *c,
+                                        const uint8_t **view, uint16_t size) {
+  uint16_t viewLen = 0;
+  CHECK_ERROR(_readBinView(c, view, &viewLen, size))
+  if (viewLen != size) {
     return parser_msgpack_bin_unexpected_size;
   }
-
-  *bufferLen = binLen;
-  CHECK_ERROR(_readBytes(c, buff, *bufferLen))
   return parser_ok;
 }
 
@@ -436,40 +403,39 @@ static parser_error_t _readAssetParams(parser_context_t *c,
 
     if (strncmp((char *)key, KEY_APARAMS_METADATA_HASH,
                 strlen(KEY_APARAMS_METADATA_HASH)) == 0) {
-      CHECK_ERROR(_readBinFixed(c, asset_config->params.metadata_hash,
-                                sizeof(asset_config->params.metadata_hash)))
+      CHECK_ERROR(
+          _readBinFixedView(c, &asset_config->params.metadata_hash, HASH_SIZE))
       available_params[IDX_CONFIG_METADATA_HASH] = IDX_CONFIG_METADATA_HASH;
       continue;
     }
 
     if (strncmp((char *)key, KEY_APARAMS_MANAGER,
                 strlen(KEY_APARAMS_MANAGER)) == 0) {
-      CHECK_ERROR(_readBinFixed(c, asset_config->params.manager,
-                                sizeof(asset_config->params.manager)))
+      CHECK_ERROR(
+          _readBinFixedView(c, &asset_config->params.manager, ACCT_SIZE))
       available_params[IDX_CONFIG_MANAGER] = IDX_CONFIG_MANAGER;
       continue;
     }
 
     if (strncmp((char *)key, KEY_APARAMS_RESERVE,
                 strlen(KEY_APARAMS_RESERVE)) == 0) {
-      CHECK_ERROR(_readBinFixed(c, asset_config->params.reserve,
-                                sizeof(asset_config->params.reserve)))
+      CHECK_ERROR(
+          _readBinFixedView(c, &asset_config->params.reserve, ACCT_SIZE))
       available_params[IDX_CONFIG_RESERVE] = IDX_CONFIG_RESERVE;
       continue;
     }
 
     if (strncmp((char *)key, KEY_APARAMS_FREEZE, strlen(KEY_APARAMS_FREEZE)) ==
         0) {
-      CHECK_ERROR(_readBinFixed(c, asset_config->params.freeze,
-                                sizeof(asset_config->params.freeze)))
+      CHECK_ERROR(_readBinFixedView(c, &asset_config->params.freeze, ACCT_SIZE))
       available_params[IDX_CONFIG_FREEZER] = IDX_CONFIG_FREEZER;
       continue;
     }
 
     if (strncmp((char *)key, KEY_APARAMS_CLAWBACK,
                 strlen(KEY_APARAMS_CLAWBACK)) == 0) {
-      CHECK_ERROR(_readBinFixed(c, asset_config->params.clawback,
-                                sizeof(asset_config->params.clawback)))
+      CHECK_ERROR(
+          _readBinFixedView(c, &asset_config->params.clawback, ACCT_SIZE))
       available_params[IDX_CONFIG_CLAWBACK] = IDX_CONFIG_CLAWBACK;
       continue;
     }
@@ -520,86 +486,31 @@ static parser_error_t _readAssetParams(parser_context_t *c,
   return parser_ok;
 }
 
-parser_error_t _verifyAppArgs(parser_context_t *c, uint16_t args_len[],
-                              uint8_t *args_array_len, size_t max_array_len) {
+static parser_error_t _readAppArgs(parser_context_t *c, const uint8_t *args[],
+                                   uint16_t args_len[], uint8_t *args_array_len,
+                                   uint8_t max_array_len) {
   CHECK_ERROR(_readArraySize(c, args_array_len))
   if (*args_array_len > max_array_len) {
     return parser_msgpack_array_too_big;
   }
 
   for (uint8_t i = 0; i < *args_array_len; i++) {
-    CHECK_ERROR(_verifyBin(c, &args_len[i], MAX_ARGLEN))
-  }
-
-  return parser_ok;
-}
-
-parser_error_t _getAppArg(parser_context_t *c, uint8_t **args,
-                          uint16_t *args_len, uint8_t args_idx,
-                          uint16_t max_args_len, uint8_t max_array_len) {
-  uint8_t tmp_array_len = 0;
-  CHECK_ERROR(_findKey(c, KEY_APP_ARGS))
-  CHECK_ERROR(_readArraySize(c, &tmp_array_len))
-
-  if (tmp_array_len > max_array_len || args_idx >= tmp_array_len) {
-    return parser_unexpected_number_items;
-  }
-
-  for (uint8_t i = 0; i < args_idx + 1; i++) {
-    CHECK_ERROR(_verifyBin(c, args_len, max_args_len))
-  }
-  (*args) = (uint8_t *)(c->buffer + c->offset - *args_len);
-  return parser_ok;
-}
-
-parser_error_t _readAppArgs(parser_context_t *c, uint8_t args[][MAX_ARGLEN],
-                            size_t args_len[], size_t *argsSize,
-                            size_t maxArgs) {
-  uint8_t tmpFIX = 0;
-  CHECK_ERROR(_readArraySize(c, &tmpFIX))
-  *argsSize = tmpFIX;
-
-  if (*argsSize > maxArgs) {
-    return parser_msgpack_array_too_big;
-  }
-
-  for (size_t i = 0; i < *argsSize; i++) {
-    CHECK_ERROR(_readBin(c, args[i], (uint16_t *)&args_len[i], MAX_ARGLEN))
+    CHECK_ERROR(_readBinView(c, &args[i], &args_len[i], MAX_ARGLEN))
   }
 
   return parser_ok;
 }
 
-parser_error_t _readAccountsSize(parser_context_t *c, uint8_t *numAccounts,
-                                 uint8_t maxAccounts) {
-  CHECK_ERROR(_readArraySize(c, numAccounts))
-  if (*numAccounts > maxAccounts) {
+static parser_error_t _readAccounts(parser_context_t *c,
+                                    const uint8_t *accounts[],
+                                    uint8_t *num_accounts,
+                                    uint8_t maxNumAccounts) {
+  CHECK_ERROR(_readArraySize(c, num_accounts))
+  if (*num_accounts > maxNumAccounts) {
     return parser_msgpack_array_too_big;
   }
-  return parser_ok;
-}
-
-parser_error_t _getAccount(parser_context_t *c, uint8_t *account,
-                           uint8_t account_idx, uint8_t num_accounts) {
-  uint8_t tmp_num_accounts = 0;
-  CHECK_ERROR(_findKey(c, KEY_APP_ACCOUNTS))
-  CHECK_ERROR(_readAccountsSize(c, &tmp_num_accounts, num_accounts))
-  if (tmp_num_accounts != num_accounts || account_idx >= num_accounts) {
-    return parser_unexpected_number_items;
-  }
-  // Read until we get the right account index
-  for (uint8_t i = 0; i < account_idx + 1; i++) {
-    CHECK_ERROR(_readBinFixed(c, account, ACCT_SIZE))
-  }
-  return parser_ok;
-}
-
-parser_error_t _verifyAccounts(parser_context_t *c, uint8_t *num_accounts,
-                               uint8_t maxNumAccounts) {
-  uint8_t tmpBuf[ACCT_SIZE] = {0};
-  CHECK_ERROR(_readAccountsSize(c, num_accounts, maxNumAccounts))
   for (uint8_t i = 0; i < *num_accounts; i++) {
-    CHECK_ERROR(_readBinFixed(c, tmpBuf, sizeof(tmpBuf)))
+    CHECK_ERROR(_readBinFixedView(c, &accounts[i], ACCT_SIZE))
   }
   return parser_ok;
 }
@@ -636,46 +547,29 @@ parser_error_t _readArrayU64(parser_context_t *c, uint64_t elements[],
 }
 
 static parser_error_t _readTxType(parser_context_t *c, parser_tx_t *v) {
-  uint8_t buff[100] = {0};
-  uint8_t buffLen = sizeof(buff);
   uint8_t typeStr[50] = {0};
-  uint8_t typeStrLen = sizeof(typeStr);
   uint16_t currentOffset = c->offset;
-  c->offset = 0;
-
-  for (size_t offset = 0; offset < c->bufferLen; offset++) {
-    if (_readString(c, buff, buffLen) == parser_ok) {
-      if (strncmp((char *)buff, KEY_COMMON_TYPE, sizeof(KEY_COMMON_TYPE)) ==
-          0) {
-        if (_readString(c, typeStr, typeStrLen) == parser_ok) {
-          if (strncmp((char *)typeStr, KEY_TX_PAY, sizeof(KEY_TX_PAY)) == 0) {
-            v->type = TX_PAYMENT;
-            break;
-          } else if (strncmp((char *)typeStr, KEY_TX_KEYREG,
-                             sizeof(KEY_TX_KEYREG)) == 0) {
-            v->type = TX_KEYREG;
-            break;
-          } else if (strncmp((char *)typeStr, KEY_TX_ASSET_XFER,
-                             sizeof(KEY_TX_ASSET_XFER)) == 0) {
-            v->type = TX_ASSET_XFER;
-            break;
-          } else if (strncmp((char *)typeStr, KEY_TX_ASSET_FREEZE,
-                             sizeof(KEY_TX_ASSET_FREEZE)) == 0) {
-            v->type = TX_ASSET_FREEZE;
-            break;
-          } else if (strncmp((char *)typeStr, KEY_TX_ASSET_CONFIG,
-                             sizeof(KEY_TX_ASSET_CONFIG)) == 0) {
-            v->type = TX_ASSET_CONFIG;
-            break;
-          } else if (strncmp((char *)typeStr, KEY_TX_APPLICATION,
-                             sizeof(KEY_TX_APPLICATION)) == 0) {
-            v->type = TX_APPLICATION;
-            break;
-          }
-        }
-      }
+
+  if (_findKey(c, KEY_COMMON_TYPE) == parser_ok &&
+      _readString(c, typeStr, sizeof(typeStr)) == parser_ok) {
+    if (strncmp((char *)typeStr, KEY_TX_PAY, sizeof(KEY_TX_PAY)) == 0) {
+      v->type = TX_PAYMENT;
+    } else if (strncmp((char *)typeStr, KEY_TX_KEYREG,
+                       sizeof(KEY_TX_KEYREG)) == 0) {
+      v->type = TX_KEYREG;
+    } else if (strncmp((char *)typeStr, KEY_TX_ASSET_XFER,
+                       sizeof(KEY_TX_ASSET_XFER)) == 0) {
+      v->type = TX_ASSET_XFER;
+    } else if (strncmp((char *)typeStr, KEY_TX_ASSET_FREEZE,
+                       sizeof(KEY_TX_ASSET_FREEZE)) == 0) {
+      v->type = TX_ASSET_FREEZE;
+    } else if (strncmp((char *)typeStr, KEY_TX_ASSET_CONFIG,
+                       sizeof(KEY_TX_ASSET_CONFIG)) == 0) {
+      v->type = TX_ASSET_CONFIG;
+    } else if (strncmp((char *)typeStr, KEY_TX_APPLICATION,
+                       sizeof(KEY_TX_APPLICATION)) == 0) {
+      v->type = TX_APPLICATION;
     }
-    c->offset = offset + 1;
   }
 
   if (v->type == TX_UNKNOWN) {
@@ -691,11 +585,11 @@ static parser_error_t _readTxCommonParams(parser_context_t *c, parser_tx_t *v) {
   common_num_items = 0;
 
   CHECK_ERROR(_findKey(c, KEY_COMMON_SENDER))
-  CHECK_ERROR(_readBinFixed(c, v->sender, sizeof(v->sender)))
+  CHECK_ERROR(_readBinFixedView(c, &v->sender, ACCT_SIZE))
   DISPLAY_ITEM(IDX_COMMON_SENDER, 1, common_num_items)
 
   if (_findKey(c, KEY_COMMON_REKEY) == parser_ok) {
-    CHECK_ERROR(_readBinFixed(c, v->rekey, sizeof(v->rekey)))
+    CHECK_ERROR(_readBinFixedView(c, &v->rekey, ACCT_SIZE))
     DISPLAY_ITEM(IDX_COMMON_REKEY_TO, 1, common_num_items)
   }
 
@@ -711,11 +605,11 @@ static parser_error_t _readTxCommonParams(parser_context_t *c, parser_tx_t *v) {
   }
 
   CHECK_ERROR(_findKey(c, KEY_COMMON_GEN_HASH))
-  CHECK_ERROR(_readBinFixed(c, v->genesisHash, sizeof(v->genesisHash)))
+  CHECK_ERROR(_readBinFixedView(c, &v->genesisHash, HASH_SIZE))
   // DISPLAY_ITEM(IDX_COMMON_GEN_HASH, 1, common_num_items)
 
   if (_findKey(c, KEY_COMMON_GROUP_ID) == parser_ok) {
-    CHECK_ERROR(_readBinFixed(c, v->groupID, sizeof(v->groupID)))
+    CHECK_ERROR(_readBinFixedView(c, &v->groupID, HASH_SIZE))
     DISPLAY_ITEM(IDX_COMMON_GROUP_ID, 1, common_num_items)
   }
 
@@ -737,30 +631,161 @@ static parser_error_t _readTxCommonParams(parser_context_t *c, parser_tx_t *v) {
   return parser_ok;
 }
 
-parser_error_t _findKey(parser_context_t *c, const char *key) {
-  uint8_t buff[100] = {0};
-  uint8_t buffLen = sizeof(buff);
-  uint16_t currentOffset = c->offset;
-  c->offset = 0;
-  for (size_t offset = 0; offset < c->bufferLen; offset++) {
-    if (_readString(c, buff, buffLen) == parser_ok) {
-      if (strlen((char *)buff) == strlen(key) &&
-          strncmp((char *)buff, key, strlen(key)) == 0) {
-        return parser_ok;
+static parser_error_t _readStrSize(parser_context_t *c, uint16_t *strLen) {
+  uint8_t byte = 0;
+  CHECK_ERROR(_readUInt8(c, &byte))
+
+  switch (getMsgPackType(byte)) {
+    case FIXSTR_0:
+      *strLen = byte - FIXSTR_0;
+      break;
+
+    case STR8: {
+      uint8_t tmp = 0;
+      CHECK_ERROR(_readUInt8(c, &tmp))
+      *strLen = tmp;
+      break;
+    }
+
+    case STR16:
+    case STR32:
+      return parser_msgpack_str_type_not_supported;
+
+    default:
+      return parser_msgpack_str_type_expected;
+  }
+  return parser_ok;
+}
+
+// Steps over one value of any type, including nested arrays and maps.
+static parser_error_t _skipValue(parser_context_t *c, uint8_t depth) {
+  uint8_t byte = 0;
+  uint16_t size = 0;
+  uint32_t items = 0;
+
+  if (depth > MAX_MSGPACK_DEPTH) {
+    return parser_unexpected_value;
+  }
+  CHECK_ERROR(_readUInt8(c, &byte))
+
+  if (byte <= FIXINT_127 || byte >= NEGFIXINT_0) {
+    return parser_ok;
+  }
+  if (byte >= FIXMAP_0 && byte <= FIXMAP_15) {
+    items = 2 * (byte - FIXMAP_0);
+  } else if (byte >= FIXARR_0 && byte <= FIXARR_15) {
+    items = byte - FIXARR_0;
+  } else if (byte >= FIXSTR_0 && byte <= FIXSTR_31) {
+    size = byte - FIXSTR_0;
+  } else {
+    switch (byte) {
+      case NIL:
+      case BOOL_FALSE:
+      case BOOL_TRUE:
+        break;
+      case UINT8:
+      case INT8:
+        size = 1;
+        break;
+      case UINT16:
+      case INT16:
+        size = 2;
+        break;
+      case UINT32:
+      case INT32:
+      case FLOAT32:
+        size = 4;
+        break;
+      case UINT64:
+      case INT64:
+      case FLOAT64:
+        size = 8;
+        break;
+      case BIN8:
+      case STR8: {
+        uint8_t tmp = 0;
+        CHECK_ERROR(_readUInt8(c, &tmp))
+        size = tmp;
+        break;
       }
+      case BIN16:
+      case STR16:
+        CHECK_ERROR(_readUInt16(c, &size))
+        break;
+      case ARR16: {
+        uint16_t tmp = 0;
+        CHECK_ERROR(_readUInt16(c, &tmp))
+        items = tmp;
+        break;
+      }
+      case MAP16: {
+        uint16_t tmp = 0;
+        CHECK_ERROR(_readUInt16(c, &tmp))
+        items = 2 * (uint32_t)tmp;
+        break;
+      }
+      default:
+        // 32 bit lengths and extension types never appear in transactions
+        return parser_msgpack_unexpected_type;
+    }
+  }
+
+  CHECK_ERROR(_verifyBytes(c, size))
+  for (uint32_t i = 0; i < items; i++) {
+    CHECK_ERROR(_skipValue(c, depth + 1))
+  }
+  return parser_ok;
+}
+
+static parser_error_t _indexKeys(parser_context_t *c, uint16_t keyLen) {
+  if (keyLen > MAX_TX_KEYS) {
+    return parser_unexpected_number_items;
+  }
+
+  txKeysLen = 0;
+  for (uint16_t i = 0; i < keyLen; i++) {
+    uint16_t strLen = 0;
+    CHECK_ERROR(_readStrSize(c, &strLen))
+    const uint16_t key = c->offset;
+    CHECK_ERROR(_verifyBytes(c, strLen))
+
+    for (uint8_t j = 0; j < txKeysLen; j++) {
+      if (txKeys[j].keyLen == strLen &&
+          memcmp(c->buffer + txKeys[j].key, c->buffer + key, strLen) == 0) {
+        return parser_duplicated_field;
+      }
+    }
+
+    txKeys[txKeysLen].key = key;
+    txKeys[txKeysLen].keyLen = (uint8_t)strLen;
+    txKeys[txKeysLen].value = c->offset;
+    txKeysLen++;
+    CHECK_ERROR(_skipValue(c, 0))
+  }
+
+  // Everything that gets signed must have been parsed
+  if (c->offset != c->bufferLen) {
+    return parser_unexpected_characters;
+  }
+  return parser_ok;
+}
+
+parser_error_t _findKey(parser_context_t *c, const char *key) {
+  const size_t keyLen = strlen(key);
+  for (uint8_t i = 0; i < txKeysLen; i++) {
+    if (txKeys[i].keyLen == keyLen &&
+        memcmp(c->buffer + txKeys[i].key, key, keyLen) == 0) {
+      c->offset = txKeys[i].value;
+      return parser_ok;
     }
-    c->offset = offset + 1;
   }
-  // Return buffer to previous offset if key is not found
-  c->offset = currentOffset;
   return parser_no_data;
 }
 
 static parser_error_t _readTxPayment(parser_context_t *c, parser_tx_t *v) {
   tx_num_items = 0;
   CHECK_ERROR(_findKey(c, KEY_PAY_RECEIVER))
-  CHECK_ERROR(
-      _readBinFixed(c, v->payment.receiver, sizeof(v->payment.receiver)))
+  CHECK_ERROR(_readBinFixedView(c, &v->payment.receiver, ACCT_SIZE))
   DISPLAY_ITEM(IDX_PAYMENT_RECEIVER, 1, tx_num_items)
 
   v->payment.amount = 0;
@@ -770,7 +795,7 @@ static parser_error_t _readTxPayment(parser_context_t *c, parser_tx_t *v) {
   DISPLAY_ITEM(IDX_PAYMENT_AMOUNT, 1, tx_num_items)
 
   if (_findKey(c, KEY_PAY_CLOSE) == parser_ok) {
-    CHECK_ERROR(_readBinFixed(c, v->payment.close, sizeof(v->payment.close)))
+    CHECK_ERROR(_readBinFixedView(c, &v->payment.close, ACCT_SIZE))
     DISPLAY_ITEM(IDX_PAYMENT_CLOSE_TO, 1, tx_num_items)
   }
 
@@ -780,17 +805,17 @@ static parser_error_t _readTxPayment(parser_context_t *c, parser_tx_t *v) {
 static parser_error_t _readTxKeyreg(parser_context_t *c, parser_tx_t *v) {
   tx_num_items = 0;
   if (_findKey(c, KEY_VOTE_PK) == parser_ok) {
-    CHECK_ERROR(_readBinFixed(c, v->keyreg.votepk, sizeof(v->keyreg.votepk)))
+    CHECK_ERROR(_readBinFixedView(c, &v->keyreg.votepk, ACCT_SIZE))
     DISPLAY_ITEM(IDX_KEYREG_VOTE_PK, 1, tx_num_items)
   }
 
   if (_findKey(c, KEY_VRF_PK) == parser_ok) {
-    CHECK_ERROR(_readBinFixed(c, v->keyreg.vrfpk, sizeof(v->keyreg.vrfpk)))
+    CHECK_ERROR(_readBinFixedView(c, &v->keyreg.vrfpk, ACCT_SIZE))
     DISPLAY_ITEM(IDX_KEYREG_VRF_PK, 1, tx_num_items)
   }
 
   if (_findKey(c, KEY_SPRF_PK) == parser_ok) {
-    CHECK_ERROR(_readBinFixed(c, v->keyreg.sprfkey, sizeof(v->keyreg.sprfkey)))
+    CHECK_ERROR(_readBinFixedView(c, &v->keyreg.sprfkey, SPRF_KEY_SIZE))
     DISPLAY_ITEM(IDX_KEYREG_SPRF_PK, 1, tx_num_items)
   }
 
@@ -831,19 +856,16 @@ static parser_error_t _readTxAssetXfer(parser_context_t *c, parser_tx_t *v) {
   DISPLAY_ITEM(IDX_XFER_AMOUNT, 1, tx_num_items)
 
   CHECK_ERROR(_findKey(c, KEY_XFER_RECEIVER))
-  CHECK_ERROR(
-      _readBinFixed(c, v->asset_xfer.receiver, sizeof(v->asset_xfer.receiver)))
+  CHECK_ERROR(_readBinFixedView(c, &v->asset_xfer.receiver, ACCT_SIZE))
   DISPLAY_ITEM(IDX_XFER_DESTINATION, 1, tx_num_items)
 
   if (_findKey(c, KEY_XFER_SENDER) == parser_ok) {
-    CHECK_ERROR(
-        _readBinFixed(c, v->asset_xfer.sender, sizeof(v->asset_xfer.sender)))
+    CHECK_ERROR(_readBinFixedView(c, &v->asset_xfer.sender, ACCT_SIZE))
     DISPLAY_ITEM(IDX_XFER_SOURCE, 1, tx_num_items)
   }
 
   if (_findKey(c, KEY_XFER_CLOSE) == parser_ok) {
-    CHECK_ERROR(
-        _readBinFixed(c, v->asset_xfer.close, sizeof(v->asset_xfer.close)))
+    CHECK_ERROR(_readBinFixedView(c, &v->asset_xfer.close, ACCT_SIZE))
     DISPLAY_ITEM(IDX_XFER_CLOSE, 1, tx_num_items)
   }
 
@@ -857,8 +879,7 @@ static parser_error_t _readTxAssetFreeze(parser_context_t *c, parser_tx_t *v) {
   DISPLAY_ITEM(IDX_FREEZE_ASSET_ID, 1, tx_num_items)
 
   CHECK_ERROR(_findKey(c, KEY_FREEZE_ACCOUNT))
-  CHECK_ERROR(_readBinFixed(c, v->asset_freeze.account,
-                            sizeof(v->asset_freeze.account)))
+  CHECK_ERROR(_readBinFixedView(c, &v->asset_freeze.account, ACCT_SIZE))
   DISPLAY_ITEM(IDX_FREEZE_ACCOUNT, 1, tx_num_items)
 
   if (_findKey(c, KEY_FREEZE_FLAG) == parser_ok) {
@@ -918,7 +939,8 @@ static parser_error_t _readTxApplication(parser_context_t *c, parser_tx_t *v) {
   }
 
   if (_findKey(c, KEY_APP_ACCOUNTS) == parser_ok) {
-    CHECK_ERROR(_verifyAccounts(c, &application->num_accounts, MAX_ACCT))
+    CHECK_ERROR(_readAccounts(c, application->accounts,
+                              &application->num_accounts, MAX_ACCT))
     DISPLAY_ITEM(IDX_ACCOUNTS, application->num_accounts, tx_num_items)
   }
 
@@ -929,8 +951,9 @@ static parser_error_t _readTxApplication(parser_context_t *c, parser_tx_t *v) {
   }
 
   if (_findKey(c, KEY_APP_ARGS) == parser_ok) {
-    CHECK_ERROR(_verifyAppArgs(c, application->app_args_len,
-                               &application->num_app_args, MAX_ARG))
+    CHECK_ERROR(_readAppArgs(c, application->app_args,
+                             application->app_args_len,
+                             &application->num_app_args, MAX_ARG))
     DISPLAY_ITEM(IDX_APP_ARGS, application->num_app_args, tx_num_items)
   }
 
@@ -953,40 +976,20 @@ static parser_error_t _readTxApplication(parser_context_t *c, parser_tx_t *v) {
   }
 
   if (_findKey(c, KEY_APP_APROG_LEN) == parser_ok) {
-    CHECK_ERROR(_readBin(c, application->aprog, &application->aprog_len,
-                         sizeof(application->aprog)))
+    CHECK_ERROR(_readBinView(c, &application->aprog, &application->aprog_len,
+                             c->bufferLen))
     DISPLAY_ITEM(IDX_APPROVE, 1, tx_num_items)
   }
 
   if (_findKey(c, KEY_APP_CPROG_LEN) == parser_ok) {
-    CHECK_ERROR(_readBin(c, application->cprog, &application->cprog_len,
-                         sizeof(application->cprog)))
+    CHECK_ERROR(_readBinView(c, &application->cprog, &application->cprog_len,
+                             c->bufferLen))
     DISPLAY_ITEM(IDX_CLEAR, 1, tx_num_items)
   }
 
   return parser_ok;
 }
 
-parser_error_t _readArray_args(parser_context_t *c, uint8_t args[][MAX_ARGLEN],
-                               size_t args_len[], uint8_t *argsSize,
-                               uint8_t maxArgs) {
-  uint8_t byte = 0;
-  CHECK_ERROR(_readUInt8(c, &byte))
-  if (byte < FIXARR_0 || byte > FIXARR_15) {
-    return parser_msgpack_array_unexpected_size;
-  }
-  *argsSize = byte - FIXARR_0;
-
-  if (*argsSize > maxArgs) {
-    return parser_msgpack_array_too_big;
-  }
-
-  for (size_t i = 0; i < *argsSize; i++) {
-    CHECK_ERROR(_readBin(c, args[i], (uint16_t *)&args_len[i], sizeof(args[0])))
-  }
-  return parser_ok;
-}
-
 parser_error_t _read(parser_context_t *c, parser_tx_t *v) {
   uint16_t keyLen = 0;
   CHECK_ERROR(initializeItemArray())
@@ -995,6 +998,7 @@ parser_error_t _read(parser_context_t *c, parser_tx_t *v) {
   if (keyLen > UINT8_MAX) {
     return parser_unexpected_number_items;
   }
+  CHECK_ERROR(_indexKeys(c, keyLen))
 
   // Read Tx type
   CHECK_ERROR(_readTxType(c, v))
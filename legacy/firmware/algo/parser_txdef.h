@@ -100,11 +100,11 @@ typedef struct {
   char unitname[9];
   char assetname[33];
   char url[97];
-  uint8_t metadata_hash[32];
-  uint8_t manager[32];
-  uint8_t reserve[32];
-  uint8_t freeze[32];
-  uint8_t clawback[32];
+  const uint8_t *metadata_hash;
+  const uint8_t *manager;
+  const uint8_t *reserve;
+  const uint8_t *freeze;
+  const uint8_t *clawback;
 } asset_params;
 
 typedef struct {
@@ -114,6 +114,8 @@ typedef struct {
 
 #define MAX_ACCT 4
 #define ACCT_SIZE 32
+#define HASH_SIZE 32
+#define SPRF_KEY_SIZE 64
 
 #define ACCT_FOREIGN_LIMIT 8
 
@@ -121,20 +123,19 @@ typedef struct {
 #define MAX_ARGLEN 2048
 #define MAX_FOREIGN_APPS 8
 #define MAX_FOREIGN_ASSETS 8
-#define MAX_APPROV_LEN 128
-#define MAX_CLEAR_LEN 32
 
 // TXs structs
+// Byte fields point into the parsed buffer, which must outlive the tx.
 typedef struct {
-  uint8_t receiver[32];
+  const uint8_t *receiver;
   uint64_t amount;
-  uint8_t close[32];
+  const uint8_t *close;
 } txn_payment;
 
 typedef struct {
-  uint8_t votepk[32];
-  uint8_t vrfpk[32];
-  uint8_t sprfkey[64];
+  const uint8_t *votepk;
+  const uint8_t *vrfpk;
+  const uint8_t *sprfkey;
   uint64_t voteFirst;
   uint64_t voteLast;
   uint64_t keyDilution;
@@ -144,14 +145,14 @@ typedef struct {
 typedef struct {
   uint64_t id;
   uint64_t amount;
-  uint8_t sender[32];
-  uint8_t receiver[32];
-  uint8_t close[32];
+  const uint8_t *sender;
+  const uint8_t *receiver;
+  const uint8_t *close;
 } txn_asset_xfer;
 
 typedef struct {
   uint64_t id;
-  uint8_t account[32];
+  const uint8_t *account;
   uint8_t flag;
 } txn_asset_freeze;
 
@@ -172,9 +173,11 @@ typedef struct {
   state_schema local_schema;
   state_schema global_schema;
 
-  uint8_t aprog[MAX_APPROV_LEN];
-  uint8_t cprog[MAX_CLEAR_LEN];
+  const uint8_t *aprog;
+  const uint8_t *cprog;
+  const uint8_t *app_args[MAX_ARG];
   uint16_t app_args_len[MAX_ARG];
+  const uint8_t *accounts[MAX_ACCT];
 
   uint64_t foreign_apps[MAX_FOREIGN_APPS];
   uint64_t foreign_assets[MAX_FOREIGN_ASSETS];
@@ -194,14 +197,14 @@ typedef struct {
   tx_type_e type;
   uint32_t accountId;
 
-  uint8_t sender[32];
-  uint8_t rekey[32];
+  const uint8_t *sender;
+  const uint8_t *rekey;
   uint64_t fee;
   uint64_t firstValid;
   uint64_t lastValid;
   char genesisID[32];
-  uint8_t genesisHash[32];
-  uint8_t groupID[32];
+  const uint8_t *genesisHash;
+  const uint8_t *groupID;
 
   uint16_t note_len;
 } parser_tx_t;
@@ -129,9 +129,14 @@ scan_key:
 
 bool algorand_sign_tx(const AlgorandSignTx *msg, const HDNode *node,
                       AlgorandSignedTx *resp) {
-  const char *error_msg =
-      tx_parse(msg->raw_tx.bytes + 2,  // 'TX' is prepended to input buffer
-               msg->raw_tx.size);
+  const char *error_msg = NULL;
+  if (msg->raw_tx.size < 2) {
+    error_msg = "Tx too short";
+  } else {
+    error_msg =
+        tx_parse(msg->raw_tx.bytes + 2,  // 'TX' is prepended to input buffer
+                 msg->raw_tx.size - 2);
+  }
   if (error_msg) {
     fsm_sendFailure(FailureType_Failure_DataError, "Tx invalid");
     layoutHome();
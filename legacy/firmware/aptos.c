@@ -1,6 +1,7 @@
 
 #include "aptos.h"
 #include <string.h>
+#include "ed25519_replay.h"
 #include "fsm.h"
 #include "gettext.h"
 #include "layout2.h"
@@ -18,6 +19,11 @@ static const uint8_t APTOS_RAW_TX_PREFIX[32] = {
 
 static const char *MESSAGE_PREFIX = "APTOS\n";
 
+static bool aptos_signing = false;
+static uint32_t data_total, data_left;
+static uint8_t pubkey[32];
+static AptosTxRequest msg_tx_request;
+
 void aptos_get_address_from_public_key(const uint8_t *public_key,
                                        char *address) {
   uint8_t buf[SIZE_PUBKEY] = {0};
@@ -46,16 +52,13 @@ void aptos_sign_tx(const AptosSignTx *msg, const HDNode *node,
     return;
   }
 
-  uint8_t buf[sizeof(AptosSignTx_raw_tx_t) + 32];
-  memcpy(buf, APTOS_RAW_TX_PREFIX, 32);
-  memcpy(buf + 32, msg->raw_tx.bytes, msg->raw_tx.size);
-#if EMULATOR
-  ed25519_sign(buf, msg->raw_tx.size + 32, node->private_key,
-               resp->signature.bytes);
-#else
-  hdnode_sign(node, buf, msg->raw_tx.size + 32, 0, resp->signature.bytes, NULL,
-              NULL);
-#endif
+  if (!ed25519_replay_sign_prefixed(node, APTOS_RAW_TX_PREFIX, 32,
+                                    msg->raw_tx.bytes, msg->raw_tx.size,
+                                    resp->signature.bytes)) {
+    fsm_sendFailure(FailureType_Failure_ProcessError, "Signing failed");
+    layoutHome();
+    return;
+  }
   memcpy(resp->public_key.bytes, node->public_key + 1, 32);
   resp->signature.size = 64;
   resp->public_key.size = 32;
@@ -113,3 +116,126 @@ void aptos_sign_message(const AptosSignMessage *msg, const HDNode *node,
   resp->signature.size = 64;
   msg_write(MessageType_MessageType_AptosMessageSignature, resp);
 }
+
+void aptos_signing_abort(void) {
+  if (aptos_signing) {
+    ed25519_replay_clear(ED25519_REPLAY_APTOS);
+    layoutHome();
+    aptos_signing = false;
+  }
+}
+
+static void send_request_chunk(void) {
+  msg_tx_request.has_data_length = true;
+  msg_tx_request.data_length = data_left <= 1024 ? data_left : 1024;
+  msg_tx_request.has_data_offset = true;
+  msg_tx_request.data_offset = data_total - data_left;
+  msg_write(MessageType_MessageType_AptosTxRequest, &msg_tx_request);
+}
+
+// Starts a pass over the transaction, the signed message is prefixed.
+static bool start_pass(void) {
+  data_left = data_total;
+  return ed25519_replay_update(ED25519_REPLAY_APTOS, APTOS_RAW_TX_PREFIX, 32);
+}
+
+static void send_signature(void) {
+  AptosSignedTx tx = {0};
+
+  if (!ed25519_replay_final(ED25519_REPLAY_APTOS, tx.signature.bytes)) {
+    fsm_sendFailure(FailureType_Failure_DataError, "Transaction data changed");
+    aptos_signing_abort();
+    return;
+  }
+  memcpy(tx.public_key.bytes, pubkey, 32);
+  tx.signature.size = 64;
+  tx.public_key.size = 32;
+  msg_write(MessageType_MessageType_AptosSignedTx, &tx);
+  aptos_signing_abort();
+}
+
+static void process_chunk_end(void) {
+  if (data_left > 0) {
+    send_request_chunk();
+  } else if (ed25519_replay_pass(ED25519_REPLAY_APTOS) == 1) {
+    // read the transaction again for the second signing pass
+    if (!ed25519_replay_rewind(ED25519_REPLAY_APTOS) || !start_pass()) {
+      fsm_sendFailure(FailureType_Failure_ProcessError, "Signing failed");
+      aptos_signing_abort();
+      return;
+    }
+    send_request_chunk();
+  } else {
+    send_signature();
+  }
+}
+
+static bool hash_data(const uint8_t *buf, size_t size) {
+  if (!ed25519_replay_update(ED25519_REPLAY_APTOS, buf, size)) {
+    fsm_sendFailure(FailureType_Failure_ProcessError, "Signing failed");
+    return false;
+  }
+  data_left -= size;
+  return true;
+}
+
+void aptos_signing_init(const AptosSignTx *msg, const HDNode *node) {
+  char address[67] = {0};
+
+  aptos_signing = true;
+  aptos_get_address_from_public_key(node->public_key + 1, address);
+
+  if (msg->data_initial_chunk.size > msg->data_length ||
+      msg->data_length > UINT32_MAX - 32) {
+    fsm_sendFailure(FailureType_Failure_DataError, "Invalid data length");
+    aptos_signing_abort();
+    return;
+  }
+  // right after the derivation, the SE signs with the key derived last
+  if (!ed25519_replay_init(ED25519_REPLAY_APTOS, node, 32 + msg->data_length)) {
+    fsm_sendFailure(FailureType_Failure_ProcessError, "Signing failed");
+    aptos_signing_abort();
+    return;
+  }
+  if (!layoutBlindSign(
+          "Aptos", false, NULL, address, msg->data_initial_chunk.bytes,
+          msg->data_initial_chunk.size, NULL, NULL, NULL, NULL, NULL, NULL)) {
+    fsm_sendFailure(FailureType_Failure_ActionCancelled,
+                    "Signing cancelled by user");
+    aptos_signing_abort();
+    return;
+  }
+
+  memcpy(pubkey, node->public_key + 1, 32);
+  data_total = msg->data_length;
+  if (!start_pass() ||
+      !hash_data(msg->data_initial_chunk.bytes, msg->data_initial_chunk.size)) {
+    aptos_signing_abort();
+    return;
+  }
+  process_chunk_end();
+}
+
+void aptos_signing_txack(const AptosTxAck *tx) {
+  if (!aptos_signing) {
+    fsm_sendFailure(FailureType_Failure_UnexpectedMessage,
+                    "Not in aptos signing mode");
+    layoutHome();
+    return;
+  }
+  if (tx->data_chunk.size > data_left) {
+    fsm_sendFailure(FailureType_Failure_DataError, "Too much data");
+    aptos_signing_abort();
+    return;
+  }
+  if (tx->data_chunk.size == 0) {
+    fsm_sendFailure(FailureType_Failure_DataError, "Empty data chunk received");
+    aptos_signing_abort();
+    return;
+  }
+  if (!hash_data(tx->data_chunk.bytes, tx->data_chunk.size)) {
+    aptos_signing_abort();
+    return;
+  }
+  process_chunk_end();
+}
@@ -318,35 +318,21 @@ void oledDrawStringRightAdapter(int x, int y, const char *text, uint8_t font) {
   x -= oledStringWidthAdapter(text, font);
   oledDrawStringAdapter(x, y, text, font);
 }
-#include "memzero.h"
-#include "util.h"
+#include "text_layout.h"
 
 uint8_t oledDrawPageableStringAdapter(int x, int y, const char *text,
                                       uint8_t font, const BITMAP *btn_no_icon,
                                       const BITMAP *btn_yes_icon) {
-  // NOTE: 21 is the max width of a line. CAUTION: This function uses VLA
-  // (Variable Length Array). Be aware of potential stack overflow risks.
-  size_t rowlen = 21;
+  static TextLayout layout;
   size_t rowcount = 0, index = 0;
 
-  const char *p = text;
-
-  while (*p) {
-    const char *next = memchr(p, '\n', MIN(rowlen, strlen(p)));
-    p = next ? (next + 1) : (p + MIN(rowlen, strlen(p)));
-    rowcount++;
+  text_layout_init(&layout, text, OLED_WIDTH - x, font);
+  if (layout.truncated) {
+    // never let the user confirm text they could not scroll to
+    return KEY_CANCEL;
   }
+  rowcount = layout.count;
   if (rowcount > 3) {
-    char str[rowcount][rowlen + 1];
-    memzero(str, sizeof(str));
-    p = text;
-    for (size_t i = 0; i < rowcount && *p; i++) {
-      const char *next = memchr(p, '\n', MIN(rowlen, strlen(p)));
-      size_t line_len = next ? (size_t)(next - p) : MIN(rowlen, strlen(p));
-      memcpy(str[i], p, line_len);
-      str[i][line_len] = '\0';
-      p = next ? (next + 1) : (p + line_len);
-    }
 #if !EMULATOR
     enableLongPress(true);
 #endif
@@ -354,25 +340,18 @@ uint8_t oledDrawPageableStringAdapter(int x, int y, const char *text,
     oledClear_ext(x, y);
     int y1 = y;
     y1++;
+    text_layout_draw(&layout, x, y1, index, 3, 10, font);
     if (0 == index) {
-      oledDrawStringAdapter(x, y1, str[0], font);
-      oledDrawStringAdapter(x, y1 + 1 * 10, str[1], font);
-      oledDrawStringAdapter(x, y1 + 2 * 10, str[2], font);
       oledDrawBitmap(3 * OLED_WIDTH / 4 - 8, OLED_HEIGHT - 8,
                      &bmp_bottom_middle_arrow_down);
+    } else if (index == rowcount - 3) {
+      oledDrawBitmap(OLED_WIDTH / 4, OLED_HEIGHT - 8,
+                     &bmp_bottom_middle_arrow_up);
     } else {
-      oledDrawStringAdapter(x, y1, str[index], font);
-      oledDrawStringAdapter(x, y1 + 1 * 10, str[index + 1], font);
-      oledDrawStringAdapter(x, y1 + 2 * 10, str[index + 2], font);
-      if (index == rowcount - 3) {
-        oledDrawBitmap(OLED_WIDTH / 4, OLED_HEIGHT - 8,
-                       &bmp_bottom_middle_arrow_up);
-      } else {
-        oledDrawBitmap(OLED_WIDTH / 4, OLED_HEIGHT - 8,
-                       &bmp_bottom_middle_arrow_up);
-        oledDrawBitmap(3 * OLED_WIDTH / 4 - 8, OLED_HEIGHT - 8,
-                       &bmp_bottom_middle_arrow_down);
-      }
+      oledDrawBitmap(OLED_WIDTH / 4, OLED_HEIGHT - 8,
+                     &bmp_bottom_middle_arrow_up);
+      oledDrawBitmap(3 * OLED_WIDTH / 4 - 8, OLED_HEIGHT - 8,
+                     &bmp_bottom_middle_arrow_down);
     }
     // scrollbar
     drawScrollbar(rowcount - 2, index);
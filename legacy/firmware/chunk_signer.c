@@ -0,0 +1,128 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "chunk_signer.h"
+#include <stdio.h>
+#include "fsm.h"
+#include "layout2.h"
+#include "usb.h"
+
+void chunk_signer_init(ChunkSigner *signer, const ChunkSignerOps *ops) {
+  signer->ops = ops;
+  signer->total = 0;
+  signer->left = 0;
+  signer->active = true;
+}
+
+bool chunk_signer_set_length(ChunkSigner *signer, uint32_t total,
+                             uint32_t initial_size) {
+  const char *error = NULL;
+  if (total > 0 && initial_size == 0) {
+    error = "Data length provided, but no initial chunk";
+  } else if (signer->ops->max_length != 0 &&
+             total > signer->ops->max_length) {
+    error = "Data length exceeds limit";
+  } else if (initial_size > total) {
+    error = "Invalid size of initial chunk";
+  }
+  if (error != NULL) {
+    fsm_sendFailure(FailureType_Failure_DataError, error);
+    chunk_signer_abort(signer);
+    return false;
+  }
+  signer->total = total;
+  signer->left = total;
+  return true;
+}
+
+static void request_next(ChunkSigner *signer) {
+  signer->ops->request(signer->left < CHUNK_SIGNER_CHUNK_SIZE
+                           ? signer->left
+                           : CHUNK_SIGNER_CHUNK_SIZE);
+  // Put the request on the wire now instead of after the chunk is hashed.
+  // Over BLE msg_write has sent it already and this finds nothing to do.
+  usbFlush(0);
+}
+
+static void consume(ChunkSigner *signer, const uint8_t *data, size_t size) {
+  signer->left -= size;
+  if (signer->left > 0 && !signer->ops->interactive) {
+    request_next(signer);
+    signer->ops->update(data, size);
+    return;
+  }
+  signer->ops->update(data, size);
+  if (!signer->active) {
+    // update failed and has aborted
+    return;
+  }
+  if (signer->left > 0) {
+    request_next(signer);
+  } else {
+    signer->ops->finish();
+    chunk_signer_abort(signer);
+  }
+}
+
+void chunk_signer_start(ChunkSigner *signer, const uint8_t *initial,
+                        size_t initial_size) {
+  consume(signer, initial, initial_size);
+}
+
+void chunk_signer_txack(ChunkSigner *signer, const uint8_t *data,
+                        size_t size) {
+  if (!signer->active) {
+    char text[48] = {0};
+    snprintf(text, sizeof(text), "Not in %s signing mode", signer->name);
+    fsm_sendFailure(FailureType_Failure_UnexpectedMessage, text);
+    layoutHome();
+    return;
+  }
+  if (size > signer->left) {
+    fsm_sendFailure(FailureType_Failure_DataError, "Too much data");
+    chunk_signer_abort(signer);
+    return;
+  }
+  if (size == 0) {
+    fsm_sendFailure(FailureType_Failure_DataError, "Empty data chunk received");
+    chunk_signer_abort(signer);
+    return;
+  }
+  consume(signer, data, size);
+}
+
+void chunk_signer_abort(ChunkSigner *signer) {
+  if (signer->active) {
+    signer->active = false;
+    signer->left = 0;
+    if (signer->ops->reset != NULL) {
+      signer->ops->reset();
+    }
+    layoutHome();
+  }
+}
+
+int chunk_signer_progress(const ChunkSigner *signer) {
+  if (signer->total == 0) {
+    return 1000;
+  }
+  return 1000 - (signer->total > 1000000
+                     ? signer->left / (signer->total / 800)
+                     : signer->left * 800 / signer->total);
+}
@@ -0,0 +1,73 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __CHUNK_SIGNER_H__
+#define __CHUNK_SIGNER_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define CHUNK_SIGNER_CHUNK_SIZE 1024
+
+/*
+ * Signing of a transaction whose data is longer than one message: the sign
+ * request carries the first chunk and the total length, the device asks the
+ * host for the rest chunk by chunk with TxRequest/TxAck.
+ *
+ * The next chunk is requested before the current one is consumed, so the
+ * host prepares it while the device is hashing.
+ */
+typedef struct {
+  uint32_t max_length;  // 0 for no limit
+  // Consumes the next bytes of the data, e.g. hashes them.
+  void (*update)(const uint8_t *data, size_t size);
+  // Asks the host for the next `size` bytes.
+  void (*request)(uint32_t size);
+  // Signs and sends the result once all data has been consumed.
+  void (*finish)(void);
+  // Wipes the key material of the session, may be NULL.
+  void (*reset)(void);
+  // update may wait for the user, so the next chunk is only requested once
+  // it has returned and the host is not sending while buttons are pending.
+  bool interactive;
+} ChunkSignerOps;
+
+typedef struct {
+  const char *name;  // as in "Not in <name> signing mode"
+  const ChunkSignerOps *ops;
+  uint32_t total;  // length of the data
+  uint32_t left;   // bytes the host has yet to send
+  bool active;
+} ChunkSigner;
+
+void chunk_signer_init(ChunkSigner *signer, const ChunkSignerOps *ops);
+// Sends a failure and aborts if the lengths are not acceptable.
+bool chunk_signer_set_length(ChunkSigner *signer, uint32_t total,
+                             uint32_t initial_size);
+// Consumes the initial chunk and requests the next one or finishes.
+void chunk_signer_start(ChunkSigner *signer, const uint8_t *initial,
+                        size_t initial_size);
+void chunk_signer_txack(ChunkSigner *signer, const uint8_t *data,
+                        size_t size);
+void chunk_signer_abort(ChunkSigner *signer);
+// Permille of the data received, for layoutProgress.
+int chunk_signer_progress(const ChunkSigner *signer);
+
+#endif
@@ -11,4 +11,10 @@
 
 extern const CoinInfo coins[COINS_COUNT];
 
+// Indices into coins[] sorted by coin_name (as strcmp orders them), by
+// coin_type and by address_type, for the lookups in coins.c.
+extern const uint8_t coins_by_name[COINS_COUNT];
+extern const uint8_t coins_by_slip44[COINS_COUNT];
+extern const uint8_t coins_by_address_type[COINS_COUNT];
+
 #endif
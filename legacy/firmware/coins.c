@@ -23,25 +23,55 @@
 #include "base58.h"
 #include "ecdsa.h"
 
+// The coin_info.c indices are sorted by key and keep the order of coins[]
+// among equal keys, so each lookup finds the first match in coins[].
+
 const CoinInfo *coinByName(const char *name) {
   if (!name) return 0;
-  for (int i = 0; i < COINS_COUNT; i++) {
-    if (strcmp(name, coins[i].coin_name) == 0) {
-      return &(coins[i]);
+  int lo = 0, hi = COINS_COUNT;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (strcmp(coins[coins_by_name[mid]].coin_name, name) < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
   }
+  if (lo < COINS_COUNT &&
+      strcmp(coins[coins_by_name[lo]].coin_name, name) == 0) {
+    return &(coins[coins_by_name[lo]]);
+  }
   return 0;
 }
 
-const CoinInfo *coinByAddressType(uint32_t address_type) {
-  for (int i = 0; i < COINS_COUNT; i++) {
-    if (address_type == coins[i].address_type) {
-      return &(coins[i]);
+static uint32_t coinAddressType(const CoinInfo *coin) {
+  return coin->address_type;
+}
+
+static uint32_t coinSlip44(const CoinInfo *coin) { return coin->coin_type; }
+
+static const CoinInfo *coinByKey(const uint8_t *index,
+                                 uint32_t (*key)(const CoinInfo *),
+                                 uint32_t value) {
+  int lo = 0, hi = COINS_COUNT;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (key(&coins[index[mid]]) < value) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
   }
+  if (lo < COINS_COUNT && key(&coins[index[lo]]) == value) {
+    return &(coins[index[lo]]);
+  }
   return 0;
 }
 
+const CoinInfo *coinByAddressType(uint32_t address_type) {
+  return coinByKey(coins_by_address_type, coinAddressType, address_type);
+}
+
 const CoinInfo *coinBySlip44(uint32_t coin_type) {
   if (coin_type == SLIP44_TESTNET) {
     // The slip44 coin type is the same for all testnets, so we return the
@@ -49,12 +79,7 @@ const CoinInfo *coinBySlip44(uint32_t coin_type) {
     return coinByName("Testnet");
   }
 
-  for (int i = 0; i < COINS_COUNT; i++) {
-    if (coin_type == coins[i].coin_type) {
-      return &(coins[i]);
-    }
-  }
-  return 0;
+  return coinByKey(coins_by_slip44, coinSlip44, coin_type);
 }
 
 bool coinExtractAddressType(const CoinInfo *coin, const char *addr,
@@ -30,6 +30,9 @@
 #include "cardano.h"
 #include "common.h"
 #include "config.h"
+#if !BITCOIN_ONLY
+#include "fido2/resident_credential.h"
+#endif
 
 #include "bip39.h"
 #include "firmware/algo/parser_txdef.h"
@@ -45,6 +48,7 @@
 #include "rng.h"
 #include "se_chip.h"
 #include "secbool.h"
+#include "u2f_counter.h"
 #include "usb.h"
 #include "util.h"
 
@@ -268,7 +272,10 @@ void config_init(void) {
   usbTiny(oldTiny);
 }
 
-void config_lockDevice(void) { se_clearSecsta(); }
+void config_lockDevice(void) {
+  fsm_clearNodeCache();
+  se_clearSecsta();
+}
 
 void config_setLabel(const char *label) {
   if (label == NULL || label[0] == '\0') {
@@ -360,6 +367,8 @@ bool config_genSessionSeed(void) {
 
   char oldTiny = usbTiny(1);
 
+  // nodes cached for a seed the SE no longer has
+  fsm_clearNodeCache();
   if (!(status & 0x80)) {
     if (!se_gen_session_seed(passphrase, false)) return false;
   }
@@ -472,6 +481,8 @@ bool config_changePin(const char *old_pin, const char *new_pin) {
 uint8_t *session_startSession(const uint8_t *received_session_id) {
   static uint8_t act_session_id[32];
 
+  fsm_clearNodeCache();
+
   if (received_session_id == NULL) {
     // se create session
     bool ret = se_sessionStart(act_session_id);
@@ -497,6 +508,7 @@ uint8_t *session_startSession(const uint8_t *received_session_id) {
 }
 
 void session_endCurrentSession(void) {
+  fsm_clearNodeCache();
   // se close session
   se_sessionClose();
 }
@@ -506,6 +518,7 @@ bool session_isUnlocked(void) {
 }
 
 void session_clear(bool lock) {
+  fsm_clearNodeCache();
   se_sessionClear();
 
   if (lock) {
@@ -563,16 +576,14 @@ bool config_getFlags(uint32_t *flags) {
   return sectrue == config_get_uint32(KEY_FLAGS, flags);
 }
 
-uint32_t config_nextU2FCounter(void) {
-  uint32_t u2fcounter = 0;
-  se_get_u2f_next_counter(&u2fcounter);
-  return u2fcounter;
-}
+uint32_t config_nextU2FCounter(void) { return u2f_counter_next(); }
 
 void config_setU2FCounter(uint32_t u2fcounter) {
-  se_set_u2f_counter(u2fcounter);
+  u2f_counter_set(u2fcounter);
 }
 
+void config_dropU2FCounterBlock(void) { u2f_counter_drop_block(); }
+
 uint32_t config_getAutoLockDelayMs(void) {
   if (sectrue == autoLockDelayMsCached) {
     return autoLockDelayMs;
@@ -643,6 +654,10 @@ void config_wipe(void) {
   session_clear(false);
   fsm_abortWorkflows();
   fsm_clearCosiNonce();
+  config_dropU2FCounterBlock();
+#if !BITCOIN_ONLY
+  resident_credential_invalidate();
+#endif
   config_getLanguage(config_language, sizeof(config_language));
 
   change_ble_sta(BLE_ADV_ON);
@@ -128,6 +128,8 @@ bool config_changeWipeCode(const char *pin, const char *wipe_code);
 
 uint32_t config_nextU2FCounter(void);
 void config_setU2FCounter(uint32_t u2fcounter);
+// Call after the SE has counted an authentication on its own
+void config_dropU2FCounterBlock(void);
 
 bool config_isInitialized(void);
 
@@ -539,6 +539,7 @@ void config_init(void) {
 }
 
 void session_clear(bool lock) {
+  fsm_clearNodeCache();
   for (uint8_t i = 0; i < MAX_SESSIONS_COUNT; i++) {
     session_clearCache(sessionsCache + i);
   }
@@ -563,6 +564,7 @@ void session_clearCache(Session *session) {
 
 void config_lockDevice(void) {
   fsm_abortWorkflows();
+  fsm_clearNodeCache();
   if (g_bSelectSEFlag) {
     se_unlocked = secfalse;
   } else {
@@ -1222,6 +1224,8 @@ uint8_t session_findSession(const uint8_t *sessionId) {
 uint8_t *session_startSession(const uint8_t *received_session_id) {
   int session_index = MAX_SESSIONS_COUNT;
 
+  fsm_clearNodeCache();
+
   if (received_session_id != NULL) {
     session_index = session_findSession(received_session_id);
   }
@@ -1241,6 +1245,7 @@ uint8_t *session_startSession(const uint8_t *received_session_id) {
 }
 
 void session_endCurrentSession(void) {
+  fsm_clearNodeCache();
   if (activeSessionCache == NULL) return;
   session_clearCache(activeSessionCache);
   activeSessionCache = NULL;
@@ -1334,6 +1339,9 @@ void config_setU2FCounter(uint32_t u2fcounter) {
   storage_set_counter(KEY_U2F_COUNTER, u2fcounter);
 }
 
+// The norcow counter is not reserved in blocks, there is nothing to drop.
+void config_dropU2FCounterBlock(void) {}
+
 uint32_t config_getAutoLockDelayMs() {
   if (sectrue == autoLockDelayMsCached) {
     return autoLockDelayMs;
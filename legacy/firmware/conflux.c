@@ -22,6 +22,7 @@
 #include <stdio.h>
 #include <string.h>
 #include "address.h"
+#include "chunk_signer.h"
 #include "conflux_tokens.h"
 #include "crypto.h"
 #include "ecdsa.h"
@@ -32,6 +33,7 @@
 #include "messages.h"
 #include "messages.pb.h"
 #include "protect.h"
+#include "rlp.h"
 #include "secp256k1.h"
 #include "sha3.h"
 #include "transaction.h"
@@ -48,12 +50,11 @@
 #define CFXADDR_SUCCESS 0
 #define CFXADDR_ERROR_WRONG_LENGTH 1
 
-static bool conflux_signing = false;
-static uint32_t data_total, data_left;
 static ConfluxTxRequest msg_tx_request;
 static CONFIDENTIAL HDNode *_node = NULL;
+static ChunkSigner cfx_signer = {.name = "Conflux"};
 static uint32_t chain_id;
-struct SHA3_CTX keccak_ctx_cfx = {0};
+static RLP_HASH_CTX rlp_ctx;
 
 void get_ethereum_format_address(uint8_t pubkeyhash[20], char *address) {
   const char *hex = "0123456789abcdef";
@@ -179,131 +180,14 @@ int get_base32_encode_address(uint8_t *in, char *out, size_t out_len,
   return CFXADDR_SUCCESS;
 }
 
-static inline void hash_data(const uint8_t *buf, size_t size) {
-  sha3_Update(&keccak_ctx_cfx, buf, size);
+static void hash_data(const uint8_t *buf, size_t size) {
+  rlp_hash_data(&rlp_ctx, buf, size);
 }
 
-/*
- * Push an RLP encoded length to the hash buffer.
- */
-static void hash_rlp_length(uint32_t length, uint8_t firstbyte) {
-  uint8_t buf[4] = {0};
-  if (length == 1 && firstbyte <= 0x7f) {
-    /* empty length header */
-  } else if (length <= 55) {
-    buf[0] = 0x80 + length;
-    hash_data(buf, 1);
-  } else if (length <= 0xff) {
-    buf[0] = 0xb7 + 1;
-    buf[1] = length;
-    hash_data(buf, 2);
-  } else if (length <= 0xffff) {
-    buf[0] = 0xb7 + 2;
-    buf[1] = length >> 8;
-    buf[2] = length & 0xff;
-    hash_data(buf, 3);
-  } else {
-    buf[0] = 0xb7 + 3;
-    buf[1] = length >> 16;
-    buf[2] = length >> 8;
-    buf[3] = length & 0xff;
-    hash_data(buf, 4);
-  }
-}
-
-/*
- * Push an RLP encoded list length to the hash buffer.
- */
-static void hash_rlp_list_length(uint32_t length) {
-  uint8_t buf[4] = {0};
-  if (length <= 55) {
-    buf[0] = 0xc0 + length;
-    hash_data(buf, 1);
-  } else if (length <= 0xff) {
-    buf[0] = 0xf7 + 1;
-    buf[1] = length;
-    hash_data(buf, 2);
-  } else if (length <= 0xffff) {
-    buf[0] = 0xf7 + 2;
-    buf[1] = length >> 8;
-    buf[2] = length & 0xff;
-    hash_data(buf, 3);
-  } else {
-    buf[0] = 0xf7 + 3;
-    buf[1] = length >> 16;
-    buf[2] = length >> 8;
-    buf[3] = length & 0xff;
-    hash_data(buf, 4);
-  }
-}
-
-/*
- * Push an RLP encoded length field and data to the hash buffer.
- */
-static void hash_rlp_field(const uint8_t *buf, size_t size) {
-  hash_rlp_length(size, buf[0]);
-  hash_data(buf, size);
-}
-
-/*
- * Push an RLP encoded number to the hash buffer.
- * Conflux yellow paper says to convert to big endian and strip leading zeros.
- */
-static void hash_rlp_number(uint32_t number) {
-  if (!number) {
-    return;
-  }
-  uint8_t data[4] = {0};
-  data[0] = (number >> 24) & 0xff;
-  data[1] = (number >> 16) & 0xff;
-  data[2] = (number >> 8) & 0xff;
-  data[3] = (number)&0xff;
-  int offset = 0;
-  while (!data[offset]) {
-    offset++;
-  }
-  hash_rlp_field(data + offset, 4 - offset);
-}
-
-/*
- * Calculate the number of bytes needed for an RLP length header.
- * NOTE: supports up to 16MB of data (how unlikely...)
- * FIXME: improve
- */
-static int rlp_calculate_length(int length, uint8_t firstbyte) {
-  if (length == 1 && firstbyte <= 0x7f) {
-    return 1;
-  } else if (length <= 55) {
-    return 1 + length;
-  } else if (length <= 0xff) {
-    return 2 + length;
-  } else if (length <= 0xffff) {
-    return 3 + length;
-  } else {
-    return 4 + length;
-  }
-}
-
-static int rlp_calculate_number_length(uint32_t number) {
-  if (number <= 0x7f) {
-    return 1;
-  } else if (number <= 0xff) {
-    return 2;
-  } else if (number <= 0xffff) {
-    return 3;
-  } else if (number <= 0xffffff) {
-    return 4;
-  } else {
-    return 5;
-  }
-}
-
-static void send_request_chunk(void) {
-  int progress = 1000 - (data_total > 1000000 ? data_left / (data_total / 800)
-                                              : data_left * 800 / data_total);
-  layoutProgressAdapter(_(C__SIGNING), progress);
+static void send_request_chunk(uint32_t size) {
+  layoutProgressAdapter(_(C__SIGNING), chunk_signer_progress(&cfx_signer));
   msg_tx_request.has_data_length = true;
-  msg_tx_request.data_length = data_left <= 1024 ? data_left : 1024;
+  msg_tx_request.data_length = size;
   msg_write(MessageType_MessageType_ConfluxTxRequest, &msg_tx_request);
 }
 
@@ -317,7 +201,7 @@ static void send_signature(void) {
   uint8_t v = 0;
   layoutProgressAdapter(_(C__SIGNING), 1000);
 
-  keccak_Final(&keccak_ctx_cfx, hash);
+  rlp_hash_final(&rlp_ctx, hash);
   if (hdnode_sign_digest(_node, hash, sig, &v, conflux_is_canonic) != 0) {
     fsm_sendFailure(FailureType_Failure_ProcessError, "Signing failed");
     conflux_signing_abort();
@@ -339,9 +223,20 @@ static void send_signature(void) {
   memcpy(msg_tx_request.signature_s.bytes, sig + 32, 32);
 
   msg_write(MessageType_MessageType_ConfluxTxRequest, &msg_tx_request);
-
-  conflux_signing_abort();
 }
+
+static void clear_node(void) { _node = NULL; }
+
+static const ChunkSignerOps conflux_signer_ops = {
+    /* Our encoding only supports transactions up to 2^24 bytes.  To
+     * prevent exceeding the limit we use a stricter limit on data length.
+     */
+    .max_length = 16000000,
+    .update = hash_data,
+    .request = send_request_chunk,
+    .finish = send_signature,
+    .reset = clear_node,
+};
 /* Format a 256 bit number (amount in drip) into a human readable format
  * using standard Conflux units.
  * The buffer must be at least 25 bytes.
@@ -467,8 +362,8 @@ static bool conflux_signing_check(const ConfluxSignTx *msg) {
 }
 
 void conflux_signing_init(ConfluxSignTx *msg, const HDNode *node) {
-  conflux_signing = true;
-  sha3_256_Init(&keccak_ctx_cfx);
+  chunk_signer_init(&cfx_signer, &conflux_signer_ops);
+  rlp_hash_init(&rlp_ctx);
 
   memzero(&msg_tx_request, sizeof(ConfluxTxRequest));
   /* set fields to 0, to avoid conditions later */
@@ -497,30 +392,9 @@ void conflux_signing_init(ConfluxSignTx *msg, const HDNode *node) {
     chain_id = CHAIN_ID_MAINNET;
   }
 
-  if (msg->has_data_length && msg->data_length > 0) {
-    if (!msg->has_data_initial_chunk || msg->data_initial_chunk.size == 0) {
-      fsm_sendFailure(FailureType_Failure_DataError,
-                      "Data length provided, but no initial chunk");
-      conflux_signing_abort();
-      return;
-    }
-    /* Our encoding only supports transactions up to 2^24 bytes.  To
-     * prevent exceeding the limit we use a stricter limit on data length.
-     */
-    if (msg->data_length > 16000000) {
-      fsm_sendFailure(FailureType_Failure_DataError,
-                      "Data length exceeds limit");
-      conflux_signing_abort();
-      return;
-    }
-    data_total = msg->data_length;
-  } else {
-    data_total = 0;
-  }
-  if (msg->data_initial_chunk.size > data_total) {
-    fsm_sendFailure(FailureType_Failure_DataError,
-                    "Invalid size of initial chunk");
-    conflux_signing_abort();
+  if (!msg->has_data_length) msg->data_length = 0;
+  if (!chunk_signer_set_length(&cfx_signer, msg->data_length,
+                               msg->data_initial_chunk.size)) {
     return;
   }
 
@@ -533,7 +407,7 @@ void conflux_signing_init(ConfluxSignTx *msg, const HDNode *node) {
   const ConfluxTokenType *token = NULL;
 
   // detect ERC-20 like token
-  if (toset && msg->value.size == 0 && data_total == 68 &&
+  if (toset && msg->value.size == 0 && cfx_signer.total == 68 &&
       msg->data_initial_chunk.size == 68 &&
       memcmp(msg->data_initial_chunk.bytes,
              "\xa9\x05\x9c\xbb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
@@ -596,73 +470,35 @@ void conflux_signing_init(ConfluxSignTx *msg, const HDNode *node) {
   rlp_length +=
       rlp_calculate_length(msg->epoch_height.size, msg->epoch_height.bytes[0]);
   rlp_length +=
-      rlp_calculate_length(data_total, msg->data_initial_chunk.bytes[0]);
+      rlp_calculate_length(cfx_signer.total, msg->data_initial_chunk.bytes[0]);
 
   rlp_length += rlp_calculate_number_length(chain_id);
 
   /* Stage 2: Store header fields */
-  hash_rlp_list_length(rlp_length);
+  rlp_hash_list_length(&rlp_ctx, rlp_length);
 
   layoutProgressAdapter(_(C__SIGNING), 100);
 
-  hash_rlp_field(msg->nonce.bytes, msg->nonce.size);
-  hash_rlp_field(msg->gas_price.bytes, msg->gas_price.size);
-  hash_rlp_field(msg->gas_limit.bytes, msg->gas_limit.size);
-  hash_rlp_field(pubkeyhash, toset ? 20 : 0);
-  hash_rlp_field(msg->value.bytes, msg->value.size);
-  hash_rlp_field(msg->storage_limit.bytes, msg->storage_limit.size);
-  hash_rlp_field(msg->epoch_height.bytes, msg->epoch_height.size);
-  hash_rlp_number(chain_id);
-  hash_rlp_length(data_total, msg->data_initial_chunk.bytes[0]);
-  hash_data(msg->data_initial_chunk.bytes, msg->data_initial_chunk.size);
-  data_left = data_total - msg->data_initial_chunk.size;
+  rlp_hash_field(&rlp_ctx, msg->nonce.bytes, msg->nonce.size);
+  rlp_hash_field(&rlp_ctx, msg->gas_price.bytes, msg->gas_price.size);
+  rlp_hash_field(&rlp_ctx, msg->gas_limit.bytes, msg->gas_limit.size);
+  rlp_hash_field(&rlp_ctx, pubkeyhash, toset ? 20 : 0);
+  rlp_hash_field(&rlp_ctx, msg->value.bytes, msg->value.size);
+  rlp_hash_field(&rlp_ctx, msg->storage_limit.bytes, msg->storage_limit.size);
+  rlp_hash_field(&rlp_ctx, msg->epoch_height.bytes, msg->epoch_height.size);
+  rlp_hash_number(&rlp_ctx, chain_id);
+  rlp_hash_length(&rlp_ctx, cfx_signer.total, msg->data_initial_chunk.bytes[0]);
   _node = (HDNode *)node;
-
-  if (data_left > 0) {
-    send_request_chunk();
-  } else {
-    send_signature();
-  }
+  chunk_signer_start(&cfx_signer, msg->data_initial_chunk.bytes,
+                     msg->data_initial_chunk.size);
 }
 
 void conflux_signing_txack(const ConfluxTxAck *tx) {
-  if (!conflux_signing) {
-    fsm_sendFailure(FailureType_Failure_UnexpectedMessage,
-                    "Not in Conflux signing mode");
-    layoutHome();
-    return;
-  }
-
-  if (tx->data_chunk.size > data_left) {
-    fsm_sendFailure(FailureType_Failure_DataError, "Too much data");
-    conflux_signing_abort();
-    return;
-  }
-
-  if (data_left > 0 && (!tx->has_data_chunk || tx->data_chunk.size == 0)) {
-    fsm_sendFailure(FailureType_Failure_DataError, "Empty data chunk received");
-    conflux_signing_abort();
-    return;
-  }
-
-  hash_data(tx->data_chunk.bytes, tx->data_chunk.size);
-
-  data_left -= tx->data_chunk.size;
-
-  if (data_left > 0) {
-    send_request_chunk();
-  } else {
-    send_signature();
-  }
+  chunk_signer_txack(&cfx_signer, tx->data_chunk.bytes,
+                     tx->has_data_chunk ? tx->data_chunk.size : 0);
 }
 
-void conflux_signing_abort(void) {
-  if (conflux_signing) {
-    _node = NULL;
-    layoutHome();
-    conflux_signing = false;
-  }
-}
+void conflux_signing_abort(void) { chunk_signer_abort(&cfx_signer); }
 
 static void conflux_message_hash(const uint8_t *message, size_t message_len,
                                  uint8_t hash[32]) {
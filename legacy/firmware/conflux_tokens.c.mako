@@ -5,7 +5,7 @@
 #include "conflux_tokens.h"
 
 const ConfluxTokenType conflux_tokens[TOKENS_COUNT] = {
-% for t in supported_on("trezor1", conflux):
+% for t in sorted(supported_on("trezor1", conflux), key=lambda t: t.address.encode()[:46]):
 	{${c_str(t.address)}, " ${ascii(t.symbol)}", ${t.decimals}}, // ${t.name}
 % endfor
 };
@@ -13,13 +13,21 @@ const ConfluxTokenType conflux_tokens[TOKENS_COUNT] = {
 static const ConfluxTokenType _UnknownToken = { "\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff", " UNKN", 0 };
 const ConfluxTokenType *ConfluxUnknownToken = &_UnknownToken;
 
+// conflux_tokens[] is sorted by address
 const ConfluxTokenType *tokenByAddress(const char *address)
 {
 	if (!address) return 0;
-	for (int i = 0; i < TOKENS_COUNT; i++) {
-		if (memcmp(address, conflux_tokens[i].address, 46) == 0) {
-			return &(conflux_tokens[i]);
+	int lo = 0, hi = TOKENS_COUNT;
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+		if (memcmp(conflux_tokens[mid].address, address, 46) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
 		}
 	}
+	if (lo < TOKENS_COUNT && memcmp(address, conflux_tokens[lo].address, 46) == 0) {
+		return &(conflux_tokens[lo]);
+	}
 	return ConfluxUnknownToken;
 }
@@ -43,6 +43,9 @@ typedef enum {
 #define INDEXING_TMP_VALUESIZE 70
 #define INDEXING_GROUPING_REF_TYPE_SIZE 70
 #define INDEXING_GROUPING_REF_FROM_SIZE 70
+// Leaves recorded by the display index and object keys kept per leaf
+#define INDEXING_MAX_ITEMS 128
+#define INDEXING_MAX_KEY_DEPTH 3
 
 #define MENU_MAIN_APP_LINE2_SECRET "?"
 #define COIN_SECRET_REQUIRED_CLICKS 0
@@ -221,6 +221,25 @@ parser_error_t object_get_nth_value(const parsed_json_t *json,
   return parser_ok;
 }
 
+parser_error_t token_get_subtree_end(const parsed_json_t *json,
+                                     uint16_t token_index,
+                                     uint16_t *next_token_index) {
+  if (token_index >= json->numberOfTokens) {
+    return parser_no_data;
+  }
+
+  // children always start before their parent ends, the first token past the
+  // end of the parent is its next sibling
+  const jsmntok_t token = json->tokens[token_index];
+  *next_token_index = token_index + 1;
+  while (*next_token_index < json->numberOfTokens &&
+         json->tokens[*next_token_index].start < token.end) {
+    (*next_token_index)++;
+  }
+
+  return parser_ok;
+}
+
 parser_error_t object_get_value(const parsed_json_t *json,
                                 uint16_t object_token_index,
                                 const char *key_name, uint16_t *token_index) {
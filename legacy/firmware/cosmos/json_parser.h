@@ -77,8 +77,9 @@ typedef struct {
   uint16_t offset;
 } parser_context_t;
 
-/// Max number of accepted tokens in the JSON input
-#define MAX_NUMBER_OF_TOKENS 96
+/// Max number of accepted tokens in the JSON input. Tokens are 4 bytes each
+/// (see jsmntok_t), so this costs less RAM than the previous 96 tokens.
+#define MAX_NUMBER_OF_TOKENS 256
 
 #define ROOT_TOKEN_INDEX 0
 
@@ -157,6 +158,15 @@ parser_error_t object_get_nth_value(const parsed_json_t *json,
                                     uint16_t object_element_index,
                                     uint16_t *token_index);
 
+/// Get the index of the first token that is not part of the given token
+/// \param json
+/// \param token_index
+/// \param next_token_index: token following the value and all its children
+/// \return Error message
+parser_error_t token_get_subtree_end(const parsed_json_t *json,
+                                     uint16_t token_index,
+                                     uint16_t *next_token_index);
+
 /// Get the token index of the value that matches the given key
 /// \param json
 /// \param object_token_index: token index of the parent object
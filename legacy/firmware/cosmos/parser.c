@@ -11,7 +11,6 @@ static char cosmos_chain_id[128] = {0};
 parser_error_t cosmos_parser_parse(parser_context_t *ctx, const uint8_t *data,
                                    size_t dataLen) {
   CHECK_PARSER_ERR(tx_display_readTx(ctx, data, dataLen))
-  extraDepthLevel = false;
   return parser_ok;
 }
 
@@ -159,9 +158,6 @@ __Z_INLINE parser_error_t parser_formatAmountItem(uint16_t amountToken,
 
   const char *amountPtr =
       parser_tx_obj.tx + parser_tx_obj.json.tokens[amountToken + 2].start;
-  if (parser_tx_obj.json.tokens[amountToken + 2].start < 0) {
-    return parser_unexpected_buffer_end;
-  }
 
   const int32_t amountLen = parser_tx_obj.json.tokens[amountToken + 2].end -
                             parser_tx_obj.json.tokens[amountToken + 2].start;
@@ -46,52 +46,64 @@ __Z_INLINE uint8_t get_root_max_level(root_item_e i) {
   }
 }
 
+#define DISPLAY_ITEM_MSG_TYPE 0x01
+#define DISPLAY_ITEM_MSG_FROM 0x02
+
+// A displayable leaf of the JSON tree. The key is rebuilt from the root item
+// name and the key tokens when the item is shown.
 typedef struct {
-  bool root_item_start_token_valid[NUM_REQUIRED_ROOT_PAGES];
-  // token where the root_item starts (negative for non-existing)
-  uint16_t root_item_start_token_idx[NUM_REQUIRED_ROOT_PAGES];
+  uint16_t value_token_idx;
+  uint16_t key_token_idx[INDEXING_MAX_KEY_DEPTH];
+  uint8_t root_item : 3;
+  uint8_t key_depth : 2;
+  uint8_t flags : 3;
+} display_item_t;
 
-  // total items
-  uint16_t total_item_count;
-  // number of items the root_item contains
-  uint8_t root_item_number_subitems[NUM_REQUIRED_ROOT_PAGES];
+typedef struct {
+  // every leaf while indexing, then only the items to show, in display order
+  display_item_t items[INDEXING_MAX_ITEMS];
+  uint8_t num_items;
 
   bool is_default_chain;
 } display_cache_t;
 
 display_cache_t display_cache;
 
+// Scratch space used while building the index
+typedef struct {
+  display_item_t item;  // root item and key path of the current token
+  char key[INDEXING_TMP_KEYSIZE];
+  char val[INDEXING_TMP_VALUESIZE];
+  char reference_msg_type[INDEXING_GROUPING_REF_TYPE_SIZE];
+  char reference_msg_from[INDEXING_GROUPING_REF_FROM_SIZE];
+} index_ctx_t;
+
 parser_error_t tx_display_readTx(parser_context_t *ctx, const uint8_t *data,
                                  size_t dataLen) {
   CHECK_PARSER_ERR(cosmos_parser_init(ctx, data, dataLen))
   CHECK_PARSER_ERR(_cosmos_readTx(ctx, &parser_tx_obj))
+  CHECK_PARSER_ERR(tx_indexRootFields())
   return parser_ok;
 }
 
 __Z_INLINE parser_error_t calculate_is_default_chainid(void) {
   display_cache.is_default_chain = false;
 
-  // get chain_id
-  char outKey[2];
-  char outVal[COIN_MAX_CHAINID_LEN];
-  uint8_t pageCount;
-  INIT_QUERY_CONTEXT(outKey, sizeof(outKey), outVal, sizeof(outVal), 0,
-                     get_root_max_level(root_item_chain_id))
-  parser_tx_obj.query.item_index = 0;
-  parser_tx_obj.query._item_index_current = 0;
-
-  uint16_t ret_value_token_index;
-  CHECK_PARSER_ERR(tx_traverse_find(
-      display_cache.root_item_start_token_idx[root_item_chain_id],
-      &ret_value_token_index))
+  for (uint8_t i = 0; i < display_cache.num_items; i++) {
+    if (display_cache.items[i].root_item != root_item_chain_id) {
+      continue;
+    }
 
-  CHECK_PARSER_ERR(
-      tx_getToken(ret_value_token_index, outVal, sizeof(outVal), 0, &pageCount))
+    char outVal[COIN_MAX_CHAINID_LEN];
+    uint8_t pageCount;
+    CHECK_PARSER_ERR(tx_getToken(display_cache.items[i].value_token_idx,
+                                 outVal, sizeof(outVal), 0, &pageCount))
 
-  if (strcmp(outVal, COIN_DEFAULT_CHAINID) == 0) {
-    // If we don't match the default chainid, switch to expert mode
-    display_cache.is_default_chain = true;
-  } else {
+    if (strcmp(outVal, COIN_DEFAULT_CHAINID) == 0) {
+      // If we don't match the default chainid, switch to expert mode
+      display_cache.is_default_chain = true;
+    }
+    break;
   }
 
   return parser_ok;
@@ -107,267 +119,256 @@ __Z_INLINE bool address_matches_own(char *addr) {
   return true;
 }
 
-parser_error_t tx_indexRootFields(void) {
-  if (parser_tx_obj.flags.cache_valid) {
-    return parser_ok;
+static parser_error_t index_leaf(index_ctx_t *ctx, uint16_t token_idx) {
+  if (display_cache.num_items >= INDEXING_MAX_ITEMS) {
+    return parser_json_too_many_tokens;
   }
 
-  // Clear cache
-  memset(&display_cache, 0, sizeof(display_cache_t));
+  display_item_t *item = &ctx->item;
+  const uint8_t item_idx = display_cache.num_items;
+  item->value_token_idx = token_idx;
+  item->flags = 0;
 
-  char tmp_key[INDEXING_TMP_KEYSIZE];
-  char tmp_val[INDEXING_TMP_VALUESIZE];
-  memset(&tmp_key, 0, sizeof(tmp_key));
-  memset(&tmp_val, 0, sizeof(tmp_val));
+  tx_getKey(get_required_root_item(item->root_item), item->key_token_idx,
+            item->key_depth, ctx->key, sizeof(ctx->key));
 
-  // Grouping references
-  char reference_msg_type[INDEXING_GROUPING_REF_TYPE_SIZE];
-  char reference_msg_from[INDEXING_GROUPING_REF_FROM_SIZE];
-  memset(&reference_msg_type, 0, sizeof(reference_msg_type));
-  memset(&reference_msg_from, 0, sizeof(reference_msg_from));
-
-  parser_tx_obj.filter_msg_type_count = 0;
-  parser_tx_obj.filter_msg_from_count = 0;
-  parser_tx_obj.flags.msg_type_grouping = 1;
-  parser_tx_obj.flags.msg_from_grouping = 1;
-
-  // Look for all expected root items in the JSON tree
-  // mark them as found/valid,
-
-  for (root_item_e root_item_idx = 0; root_item_idx < NUM_REQUIRED_ROOT_PAGES;
-       root_item_idx++) {
-    uint16_t req_root_item_key_token_idx = 0;
-
-    const char *required_root_item_key = get_required_root_item(root_item_idx);
-
-    parser_error_t err =
-        object_get_value(&parser_tx_obj.json, ROOT_TOKEN_INDEX,
-                         required_root_item_key, &req_root_item_key_token_idx);
+  // this also enables the extra depth level once a multisend is seen
+  uint8_t pageCount;
+  CHECK_PARSER_ERR(
+      tx_getToken(token_idx, ctx->val, sizeof(ctx->val), 0, &pageCount))
 
-    if (err == parser_no_data) {
-      continue;
+  switch (item->root_item) {
+    case root_item_memo: {
+      if (strlen(ctx->val) == 0) {
+        return parser_ok;
+      }
+      break;
     }
-    CHECK_PARSER_ERR(err)
-
-    // Remember root item start token
-    display_cache.root_item_start_token_valid[root_item_idx] = true;
-    display_cache.root_item_start_token_idx[root_item_idx] =
-        req_root_item_key_token_idx;
+    case root_item_msgs: {
+      // Note: if we are dealing with the message field, Ledger has
+      // requested that we group. This means that if all messages share the
+      // same time, we should only count the type field once This is
+      // indicated by `parser_tx_obj.flags.msg_type_grouping`
+
+      // GROUPING: Message Type
+      if (is_msg_type_field(ctx->key)) {
+        item->flags |= DISPLAY_ITEM_MSG_TYPE;
+      }
+      if (parser_tx_obj.flags.msg_type_grouping &&
+          (item->flags & DISPLAY_ITEM_MSG_TYPE)) {
+        // First message, initialize expected type
+        if (parser_tx_obj.filter_msg_type_count == 0) {
+          if (strlen(ctx->val) >= sizeof(ctx->reference_msg_type)) {
+            return parser_unexpected_type;
+          }
 
-    // Now count how many items can be found in this root item
-    int16_t current_item_idx = 0;
-    while (err == parser_ok) {
-      INIT_QUERY_CONTEXT(tmp_key, sizeof(tmp_key), tmp_val, sizeof(tmp_val), 0,
-                         get_root_max_level(root_item_idx))
+          snprintf(ctx->reference_msg_type, sizeof(ctx->reference_msg_type),
+                   "%s", ctx->val);
+          parser_tx_obj.filter_msg_type_valid_idx = item_idx;
+        }
 
-      parser_tx_obj.query.item_index = current_item_idx;
-      strncpy_s(parser_tx_obj.query.out_key, required_root_item_key,
-                parser_tx_obj.query.out_key_len);
+        if (strcmp(ctx->reference_msg_type, ctx->val) != 0) {
+          // different values, so disable grouping
+          parser_tx_obj.flags.msg_type_grouping = 0;
+          parser_tx_obj.filter_msg_type_count = 0;
+        }
 
-      uint16_t ret_value_token_index;
-      err = tx_traverse_find(
-          display_cache.root_item_start_token_idx[root_item_idx],
-          &ret_value_token_index);
-      if (err != parser_ok) {
-        continue;
+        parser_tx_obj.filter_msg_type_count++;
       }
 
-      uint8_t pageCount;
-      CHECK_PARSER_ERR(
-          tx_getToken(ret_value_token_index, parser_tx_obj.query.out_val,
-                      parser_tx_obj.query.out_val_len, 0, &pageCount))
-
-      switch (root_item_idx) {
-        case root_item_memo: {
-          if (strlen(parser_tx_obj.query.out_val) == 0) {
-            err = parser_query_no_results;
-            continue;
-          }
-          break;
+      // GROUPING: Message From
+      if (is_msg_from_field(ctx->key)) {
+        item->flags |= DISPLAY_ITEM_MSG_FROM;
+      }
+      if (parser_tx_obj.flags.msg_from_grouping &&
+          (item->flags & DISPLAY_ITEM_MSG_FROM)) {
+        // First message, initialize expected from
+        if (parser_tx_obj.filter_msg_from_count == 0) {
+          snprintf(ctx->reference_msg_from, sizeof(ctx->reference_msg_from),
+                   "%s", ctx->val);
+          parser_tx_obj.filter_msg_from_valid_idx = item_idx;
         }
-        case root_item_msgs: {
-          // Note: if we are dealing with the message field, Ledger has
-          // requested that we group. This means that if all messages share the
-          // same time, we should only count the type field once This is
-          // indicated by `parser_tx_obj.flags.msg_type_grouping`
-
-          // GROUPING: Message Type
-          if (parser_tx_obj.flags.msg_type_grouping &&
-              is_msg_type_field(tmp_key)) {
-            // First message, initialize expected type
-            if (parser_tx_obj.filter_msg_type_count == 0) {
-              if (strlen(tmp_val) >= sizeof(reference_msg_type)) {
-                return parser_unexpected_type;
-              }
-
-              snprintf(reference_msg_type, sizeof(reference_msg_type), "%s",
-                       tmp_val);
-              parser_tx_obj.filter_msg_type_valid_idx = current_item_idx;
-            }
-
-            if (strcmp(reference_msg_type, tmp_val) != 0) {
-              // different values, so disable grouping
-              parser_tx_obj.flags.msg_type_grouping = 0;
-              parser_tx_obj.filter_msg_type_count = 0;
-            }
-
-            parser_tx_obj.filter_msg_type_count++;
-          }
-
-          // GROUPING: Message From
-          if (parser_tx_obj.flags.msg_from_grouping &&
-              is_msg_from_field(tmp_key)) {
-            // First message, initialize expected from
-            if (parser_tx_obj.filter_msg_from_count == 0) {
-              snprintf(reference_msg_from, sizeof(reference_msg_from), "%s",
-                       tmp_val);
-              parser_tx_obj.filter_msg_from_valid_idx = current_item_idx;
-            }
-
-            if (strcmp(reference_msg_from, tmp_val) != 0) {
-              // different values, so disable grouping
-              parser_tx_obj.flags.msg_from_grouping = 0;
-              parser_tx_obj.filter_msg_from_count = 0;
-            }
-
-            parser_tx_obj.filter_msg_from_count++;
-          }
 
-          break;
+        if (strcmp(ctx->reference_msg_from, ctx->val) != 0) {
+          // different values, so disable grouping
+          parser_tx_obj.flags.msg_from_grouping = 0;
+          parser_tx_obj.filter_msg_from_count = 0;
         }
-        default:
-          break;
-      }
 
-      display_cache.root_item_number_subitems[root_item_idx]++;
-      current_item_idx++;
-    }
+        parser_tx_obj.filter_msg_from_count++;
+      }
 
-    if (err != parser_query_no_results && err != parser_no_data) {
-      return err;
+      break;
     }
-
-    display_cache.total_item_count +=
-        display_cache.root_item_number_subitems[root_item_idx];
+    default:
+      break;
   }
 
-  parser_tx_obj.flags.cache_valid = 1;
-
-  CHECK_PARSER_ERR(calculate_is_default_chainid())
+  display_cache.items[display_cache.num_items++] = *item;
+  return parser_ok;
+}
 
-  // turn off grouping if we are not in expert mode
-  if (tx_is_expert_mode()) {
-    parser_tx_obj.flags.msg_from_grouping = 0;
+// Records the leaves below token_idx in document order. Objects deeper than
+// the root item level and anything nested deeper than MAX_RECURSION_DEPTH are
+// shown as a single flattened value.
+static parser_error_t index_subtree(index_ctx_t *ctx, uint16_t token_idx,
+                                    uint8_t level, uint8_t depth,
+                                    uint16_t *next_token_idx) {
+  const jsmntok_t token = parser_tx_obj.json.tokens[token_idx];
+
+  if (level >= get_root_max_level(ctx->item.root_item) ||
+      depth >= MAX_RECURSION_DEPTH || token.type == JSMN_STRING ||
+      token.type == JSMN_PRIMITIVE ||
+      (token.type == JSMN_OBJECT &&
+       ctx->item.key_depth >= INDEXING_MAX_KEY_DEPTH)) {
+    CHECK_PARSER_ERR(index_leaf(ctx, token_idx))
+    return token_get_subtree_end(&parser_tx_obj.json, token_idx,
+                                 next_token_idx);
   }
 
-  // check if from reference value matches the device address that will be
-  // signing
-  parser_tx_obj.flags.msg_from_grouping_hide_all = 0;
-  if (address_matches_own(reference_msg_from)) {
-    parser_tx_obj.flags.msg_from_grouping_hide_all = 1;
+  uint16_t child_idx = token_idx + 1;
+  while (child_idx < parser_tx_obj.json.numberOfTokens &&
+         parser_tx_obj.json.tokens[child_idx].start < token.end) {
+    switch (token.type) {
+      case JSMN_OBJECT: {
+        // When traversing objects both level and depth should be considered
+        ctx->item.key_token_idx[ctx->item.key_depth++] = child_idx;
+        parser_error_t err = index_subtree(ctx, child_idx + 1, level + 1,
+                                           depth + 1, &child_idx);
+        ctx->item.key_depth--;
+        CHECK_PARSER_ERR(err)
+        break;
+      }
+      case JSMN_ARRAY:
+        // When iterating along an array,
+        // the level does not change but we need to count the recursion
+        CHECK_PARSER_ERR(
+            index_subtree(ctx, child_idx, level, depth + 1, &child_idx))
+        break;
+      default:
+        return parser_unexpected_type;
+    }
   }
 
+  *next_token_idx = child_idx;
   return parser_ok;
 }
 
-__Z_INLINE bool is_default_chainid(void) {
-  parser_error_t __err = tx_indexRootFields();
-  if (__err != parser_ok) return false;
-  return display_cache.is_default_chain;
-}
-
-bool tx_is_expert_mode(void) { return !is_default_chainid(); }
-
-__Z_INLINE uint8_t get_subitem_count(root_item_e root_item) {
-  CHECK_PARSER_ERR(tx_indexRootFields())
-  if (display_cache.total_item_count == 0) return 0;
-
-  int32_t tmp_num_items = display_cache.root_item_number_subitems[root_item];
+__Z_INLINE bool is_item_shown(uint8_t item_idx, uint8_t shown_in_root) {
+  const display_item_t *item = &display_cache.items[item_idx];
 
-  switch (root_item) {
-    case root_item_chain_id:
-      break;
+  switch (item->root_item) {
     case root_item_sequence:
     case root_item_account_number:
-      // if (!tx_is_expert_mode()) {
-      //   tmp_num_items = 0;
-      // }
-      tmp_num_items = 0;
-      break;
+      return false;
+    case root_item_fee:
+      // Only Amount
+      return shown_in_root == 0;
     case root_item_msgs: {
-      // Remove grouped items from list
+      // Remove grouped items from list, only the first one is left
       if (parser_tx_obj.flags.msg_type_grouping &&
-          parser_tx_obj.filter_msg_type_count > 0) {
-        tmp_num_items += 1;  // we leave main type
-        tmp_num_items -= parser_tx_obj.filter_msg_type_count;
+          (item->flags & DISPLAY_ITEM_MSG_TYPE) &&
+          parser_tx_obj.filter_msg_type_valid_idx != item_idx) {
+        return false;
       }
       if (parser_tx_obj.flags.msg_from_grouping &&
-          parser_tx_obj.filter_msg_from_count > 0) {
-        if (!parser_tx_obj.flags.msg_from_grouping_hide_all) {
-          tmp_num_items += 1;  // we leave main from
-        }
-        tmp_num_items -= parser_tx_obj.filter_msg_from_count;
+          (item->flags & DISPLAY_ITEM_MSG_FROM) &&
+          (parser_tx_obj.flags.msg_from_grouping_hide_all ||
+           parser_tx_obj.filter_msg_from_valid_idx != item_idx)) {
+        return false;
       }
-      break;
+      return true;
     }
-    case root_item_memo:
-      break;
-    case root_item_fee:
-      // if (!tx_is_expert_mode()) {
-      //   tmp_num_items = 1;  // Only Amount
-      // }
-      tmp_num_items = 1;  // Only Amount
-      break;
-    case root_item_tip:
-      tmp_num_items += 0;
-      break;
     default:
-      break;
+      return true;
   }
-
-  return tmp_num_items;
 }
 
-__Z_INLINE parser_error_t retrieve_tree_indexes(uint8_t display_index,
-                                                root_item_e *root_item,
-                                                uint8_t *subitem_index) {
-  // Find root index | display_index idx -> item_index
-  // consume indexed subpages until we get the item index in the subpage
-  *root_item = 0;
-  *subitem_index = 0;
-  while (get_subitem_count(*root_item) == 0) {
-    (*root_item)++;
+// Walks the JSON tree once and keeps every item to display with its value
+// token and key path, so that queries do not have to traverse the tree again
+parser_error_t tx_indexRootFields(void) {
+  if (parser_tx_obj.flags.cache_valid) {
+    return parser_ok;
   }
 
-  for (uint16_t i = 0; i < display_index; i++) {
-    (*subitem_index)++;
-    const uint8_t subitem_count = get_subitem_count(*root_item);
-    if (*subitem_index >= subitem_count) {
-      // Advance root index and skip empty items
-      *subitem_index = 0;
-      (*root_item)++;
-      while (get_subitem_count(*root_item) == 0) {
-        (*root_item)++;
-      }
+  // Clear cache
+  memset(&display_cache, 0, sizeof(display_cache_t));
+
+  index_ctx_t ctx;
+  memset(&ctx, 0, sizeof(ctx));
+
+  parser_tx_obj.filter_msg_type_count = 0;
+  parser_tx_obj.filter_msg_from_count = 0;
+  parser_tx_obj.flags.msg_type_grouping = 1;
+  parser_tx_obj.flags.msg_from_grouping = 1;
+
+  // Look for all expected root items in the JSON tree and record their
+  // leaves
+  for (root_item_e root_item_idx = 0; root_item_idx < NUM_REQUIRED_ROOT_PAGES;
+       root_item_idx++) {
+    uint16_t req_root_item_key_token_idx = 0;
+
+    parser_error_t err = object_get_value(
+        &parser_tx_obj.json, ROOT_TOKEN_INDEX,
+        get_required_root_item(root_item_idx), &req_root_item_key_token_idx);
+
+    if (err == parser_no_data) {
+      continue;
     }
+    CHECK_PARSER_ERR(err)
+
+    ctx.item.root_item = root_item_idx;
+    ctx.item.key_depth = 0;
+    uint16_t next_token_idx;
+    CHECK_PARSER_ERR(index_subtree(&ctx, req_root_item_key_token_idx, 0, 0,
+                                   &next_token_idx))
   }
 
-  if (*root_item > NUM_REQUIRED_ROOT_PAGES) {
-    return parser_no_data;
+  CHECK_PARSER_ERR(calculate_is_default_chainid())
+
+  // turn off grouping if we are not in expert mode
+  if (!display_cache.is_default_chain) {
+    parser_tx_obj.flags.msg_from_grouping = 0;
   }
 
+  // check if from reference value matches the device address that will be
+  // signing
+  parser_tx_obj.flags.msg_from_grouping_hide_all = 0;
+  if (address_matches_own(ctx.reference_msg_from)) {
+    parser_tx_obj.flags.msg_from_grouping_hide_all = 1;
+  }
+
+  // Drop the leaves that are not shown, items only move towards the front
+  uint8_t shown_in_root[NUM_REQUIRED_ROOT_PAGES] = {0};
+  uint8_t num_shown = 0;
+  for (uint8_t i = 0; i < display_cache.num_items; i++) {
+    const display_item_t item = display_cache.items[i];
+    if (!is_item_shown(i, shown_in_root[item.root_item])) {
+      continue;
+    }
+    shown_in_root[item.root_item]++;
+    display_cache.items[num_shown++] = item;
+  }
+  display_cache.num_items = num_shown;
+
+  parser_tx_obj.flags.cache_valid = 1;
+
   return parser_ok;
 }
 
+__Z_INLINE bool is_default_chainid(void) {
+  parser_error_t __err = tx_indexRootFields();
+  if (__err != parser_ok) return false;
+  return display_cache.is_default_chain;
+}
+
+bool tx_is_expert_mode(void) { return !is_default_chainid(); }
+
 parser_error_t tx_display_numItems(uint8_t *num_items) {
   *num_items = 0;
   CHECK_PARSER_ERR(tx_indexRootFields())
 
-  *num_items = 0;
-  for (root_item_e root_item = 0; root_item < NUM_REQUIRED_ROOT_PAGES;
-       root_item++) {
-    *num_items += get_subitem_count(root_item);
-  }
+  *num_items = display_cache.num_items;
 
   return parser_ok;
 }
@@ -378,34 +379,17 @@ parser_error_t tx_display_query(uint16_t displayIdx, char *outKey,
                                 uint16_t *ret_value_token_index) {
   CHECK_PARSER_ERR(tx_indexRootFields())
 
-  uint8_t num_items;
-  CHECK_PARSER_ERR(tx_display_numItems(&num_items))
-
-  if (displayIdx >= num_items) {
+  if (displayIdx >= display_cache.num_items) {
     return parser_display_idx_out_of_range;
   }
 
-  root_item_e root_index = 0;
-  uint8_t subitem_index = 0;
-  CHECK_PARSER_ERR(
-      retrieve_tree_indexes(displayIdx, &root_index, &subitem_index))
+  const display_item_t *item = &display_cache.items[displayIdx];
 
   // Prepare query
-  static char tmp_val[2];
-  INIT_QUERY_CONTEXT(outKey, outKeyLen, tmp_val, sizeof(tmp_val), 0,
-                     get_root_max_level(root_index))
-  parser_tx_obj.query.item_index = subitem_index;
-  parser_tx_obj.query._item_index_current = 0;
-
-  strncpy_s(outKey, get_required_root_item(root_index), outKeyLen);
-
-  if (!display_cache.root_item_start_token_valid[root_index]) {
-    return parser_no_data;
-  }
-
-  CHECK_PARSER_ERR(
-      tx_traverse_find(display_cache.root_item_start_token_idx[root_index],
-                       ret_value_token_index))
+  INIT_QUERY_CONTEXT(outKey, outKeyLen)
+  tx_getKey(get_required_root_item(item->root_item), item->key_token_idx,
+            item->key_depth, outKey, outKeyLen);
+  *ret_value_token_index = item->value_token_idx;
 
   return parser_ok;
 }
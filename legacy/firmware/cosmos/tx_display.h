@@ -16,6 +16,9 @@ typedef enum {
 
 bool tx_is_expert_mode(void);
 
+// Builds the display index, once per parsed transaction
+parser_error_t tx_indexRootFields(void);
+
 const char *get_required_root_item(root_item_e i);
 
 parser_error_t tx_display_query(uint16_t displayIdx, char *outKey,
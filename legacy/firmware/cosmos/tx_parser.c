@@ -44,6 +44,7 @@ parser_error_t _cosmos_readTx(parser_context_t *c,
   parser_tx_obj.flags.cache_valid = 0;
   parser_tx_obj.filter_msg_type_count = 0;
   parser_tx_obj.filter_msg_from_count = 0;
+  extraDepthLevel = false;
 
   return parser_ok;
 }
@@ -135,144 +136,14 @@ parser_error_t tx_getToken(uint16_t token_index, char *out_val,
   return parser_ok;
 }
 
-__Z_INLINE void append_key_item(uint16_t token_index) {
-  if (*parser_tx_obj.query.out_key > 0) {
-    // There is already something there, add separator
-    strcat_chunk_s(parser_tx_obj.query.out_key, parser_tx_obj.query.out_key_len,
-                   "/", 1);
-  }
-
-  const int16_t token_start = parser_tx_obj.json.tokens[token_index].start;
-  const int16_t token_end = parser_tx_obj.json.tokens[token_index].end;
-  const char *address_ptr = parser_tx_obj.tx + token_start;
-  const int32_t new_item_size = token_end - token_start;
-
-  strcat_chunk_s(parser_tx_obj.query.out_key, parser_tx_obj.query.out_key_len,
-                 address_ptr, new_item_size);
-}
-///////////////////////////
-///////////////////////////
-///////////////////////////
-///////////////////////////
-///////////////////////////
-///////////////////////////
-
-parser_error_t tx_traverse_find(uint16_t root_token_index,
-                                uint16_t *ret_value_token_index) {
-  const jsmntype_t token_type =
-      parser_tx_obj.json.tokens[root_token_index].type;
-
-  CHECK_APP_CANARY()
+void tx_getKey(const char *root_key, const uint16_t *key_token_index,
+               uint8_t key_depth, char *out_key, uint16_t out_key_len) {
+  strncpy_s(out_key, root_key, out_key_len);
 
-  if (parser_tx_obj.tx == NULL) {
-    return parser_no_data;
+  for (uint8_t i = 0; i < key_depth; i++) {
+    const jsmntok_t token = parser_tx_obj.json.tokens[key_token_index[i]];
+    strcat_chunk_s(out_key, out_key_len, "/", 1);
+    strcat_chunk_s(out_key, out_key_len, parser_tx_obj.tx + token.start,
+                   token.end - token.start);
   }
-
-  if (parser_tx_obj.query.max_level <= 0 ||
-      parser_tx_obj.query.max_depth <= 0 || token_type == JSMN_STRING ||
-      token_type == JSMN_PRIMITIVE) {
-    const bool skipTypeField = parser_tx_obj.flags.cache_valid &&
-                               parser_tx_obj.flags.msg_type_grouping &&
-                               is_msg_type_field(parser_tx_obj.query.out_key) &&
-                               parser_tx_obj.filter_msg_type_valid_idx !=
-                                   parser_tx_obj.query._item_index_current;
-
-    const bool skipFromFieldHidingRule =
-        parser_tx_obj.flags.msg_from_grouping_hide_all ||
-        parser_tx_obj.filter_msg_from_valid_idx !=
-            parser_tx_obj.query._item_index_current;
-
-    const bool skipFromField = parser_tx_obj.flags.cache_valid &&
-                               parser_tx_obj.flags.msg_from_grouping &&
-                               is_msg_from_field(parser_tx_obj.query.out_key) &&
-                               skipFromFieldHidingRule;
-
-    const bool skipField = skipFromField || skipTypeField;
-
-    CHECK_APP_CANARY()
-
-    // Early bail out
-    if (!skipField && parser_tx_obj.query._item_index_current ==
-                          parser_tx_obj.query.item_index) {
-      *ret_value_token_index = root_token_index;
-      CHECK_APP_CANARY()
-      return parser_ok;
-    }
-
-    if (skipField) {
-      parser_tx_obj.query.item_index++;
-    }
-
-    parser_tx_obj.query._item_index_current++;
-    CHECK_APP_CANARY()
-    return parser_query_no_results;
-  }
-
-  uint16_t el_count;
-  parser_error_t err;
-
-  CHECK_PARSER_ERR(object_get_element_count(&parser_tx_obj.json,
-                                            root_token_index, &el_count))
-
-  switch (token_type) {
-    case JSMN_OBJECT: {
-      const size_t key_len = strlen(parser_tx_obj.query.out_key);
-      for (uint16_t i = 0; i < el_count; ++i) {
-        uint16_t key_index;
-        uint16_t value_index;
-
-        CHECK_PARSER_ERR(object_get_nth_key(&parser_tx_obj.json,
-                                            root_token_index, i, &key_index))
-        CHECK_PARSER_ERR(object_get_nth_value(
-            &parser_tx_obj.json, root_token_index, i, &value_index))
-
-        // Skip writing keys if we are actually exploring to count
-        append_key_item(key_index);
-        CHECK_APP_CANARY()
-
-        // When traversing objects both level and depth should be considered
-        parser_tx_obj.query.max_level--;
-        parser_tx_obj.query.max_depth--;
-
-        // Traverse the value, extracting subkeys
-        err = tx_traverse_find(value_index, ret_value_token_index);
-        CHECK_APP_CANARY()
-        parser_tx_obj.query.max_level++;
-        parser_tx_obj.query.max_depth++;
-
-        if (err == parser_ok) {
-          return parser_ok;
-        }
-
-        *(parser_tx_obj.query.out_key + key_len) = 0;
-        CHECK_APP_CANARY()
-      }
-      break;
-    }
-    case JSMN_ARRAY: {
-      for (uint16_t i = 0; i < el_count; ++i) {
-        uint16_t element_index;
-        CHECK_PARSER_ERR(array_get_nth_element(
-            &parser_tx_obj.json, root_token_index, i, &element_index))
-        CHECK_APP_CANARY()
-
-        // When iterating along an array,
-        // the level does not change but we need to count the recursion
-        parser_tx_obj.query.max_depth--;
-        err = tx_traverse_find(element_index, ret_value_token_index);
-        parser_tx_obj.query.max_depth++;
-
-        CHECK_APP_CANARY()
-
-        if (err == parser_ok) {
-          return parser_ok;
-        }
-      }
-      break;
-    }
-    default:
-      break;
-  }
-
-  return parser_query_no_results;
 }
@@ -187,26 +187,9 @@ __Z_INLINE void pageString(char *outValue, uint16_t outValueLen,
 
 // parser_txdef.h
 typedef struct {
-  // These are internal values used for tracking the state of the query/search
-  uint16_t _item_index_current;
-
-  // maximum json tree level. Beyond this tree depth, key/values are flattened
-  uint8_t max_level;
-
-  // maximum tree traversal depth. This limits possible stack overflow issues
-  uint8_t max_depth;
-
-  // Index of the item to retrieve
-  int16_t item_index;
-  // Chunk of the item to retrieve (assuming partitioning based on out_val_len
-  // chunks)
-  int16_t page_index;
-
   // These fields (out_*) are where query results are placed
   char *out_key;
   uint16_t out_key_len;
-  char *out_val;
-  int16_t out_val_len;
 } tx_query_t;
 
 typedef struct {
@@ -256,27 +239,15 @@ parser_error_t _cosmos_readTx(parser_context_t *c, parser_tx_t *v);
 #define MULTISEND_KEY_IDX 9
 extern bool extraDepthLevel;
 
-#define INIT_QUERY_CONTEXT(_KEY, _KEY_LEN, _VAL, _VAL_LEN, _PAGE_IDX, \
-                           _MAX_LEVEL)                                \
-  parser_tx_obj.query._item_index_current = 0;                        \
-  parser_tx_obj.query.max_depth = MAX_RECURSION_DEPTH;                \
-  parser_tx_obj.query.max_level = _MAX_LEVEL;                         \
-                                                                      \
-  parser_tx_obj.query.item_index = 0;                                 \
-  parser_tx_obj.query.page_index = (_PAGE_IDX);                       \
-                                                                      \
-  memset(_KEY, 0, (_KEY_LEN));                                        \
-  memset(_VAL, 0, (_VAL_LEN));                                        \
-  parser_tx_obj.query.out_key = _KEY;                                 \
-  parser_tx_obj.query.out_val = _VAL;                                 \
-  parser_tx_obj.query.out_key_len = (_KEY_LEN);                       \
-  parser_tx_obj.query.out_val_len = (_VAL_LEN);
-
-parser_error_t tx_traverse_find(uint16_t root_token_index,
-                                uint16_t *ret_value_token_index);
-
-// Traverses transaction data and fills tx_context
-parser_error_t tx_traverse(int16_t root_token_index, uint8_t *numChunks);
+#define INIT_QUERY_CONTEXT(_KEY, _KEY_LEN) \
+  memset(_KEY, 0, (_KEY_LEN));              \
+  parser_tx_obj.query.out_key = _KEY;       \
+  parser_tx_obj.query.out_key_len = (_KEY_LEN);
+
+// Writes the key of a display item: the root item name followed by the
+// object keys leading to the value, separated by '/'
+void tx_getKey(const char *root_key, const uint16_t *key_token_index,
+               uint8_t key_depth, char *out_key, uint16_t out_key_len);
 
 // Retrieves the value for the corresponding token index. If the value goes
 // beyond val_len, the chunk_idx will be used
@@ -128,6 +128,16 @@ int signifyMessageSign(HDNode *node, const uint8_t *message, size_t message_len,
   return hdnode_sign(node, message, message_len, 0, signature + 1, NULL, NULL);
 }
 
+size_t cryptoMessagePrefix(const CoinInfo *coin, uint32_t message_len,
+                           uint8_t *prefix, size_t prefix_size) {
+  size_t header_len = strlen(coin->signed_message_header);
+  if (header_len + 5 > prefix_size) {
+    return 0;
+  }
+  memcpy(prefix, coin->signed_message_header, header_len);
+  return header_len + ser_length(message_len, prefix + header_len);
+}
+
 static void cryptoMessageHash(const CoinInfo *coin, const uint8_t *message,
                               size_t message_len,
                               uint8_t hash[HASHER_DIGEST_LENGTH]) {
@@ -142,10 +152,10 @@ static void cryptoMessageHash(const CoinInfo *coin, const uint8_t *message,
   hasher_Final(&hasher, hash);
 }
 
-int cryptoMessageSign(const CoinInfo *coin, HDNode *node,
-                      InputScriptType script_type, bool no_script_type,
-                      const uint8_t *message, size_t message_len,
-                      uint8_t *signature) {
+int cryptoMessageSignDigest(HDNode *node, InputScriptType script_type,
+                            bool no_script_type,
+                            const uint8_t hash[HASHER_DIGEST_LENGTH],
+                            uint8_t *signature) {
   uint8_t script_type_info = 0;
 
   if (!no_script_type) {
@@ -168,9 +178,6 @@ int cryptoMessageSign(const CoinInfo *coin, HDNode *node,
     }
   }
 
-  uint8_t hash[HASHER_DIGEST_LENGTH] = {0};
-  cryptoMessageHash(coin, message, message_len, hash);
-
   uint8_t pby = 0;
   int result = hdnode_sign_digest(node, hash, signature + 1, &pby, NULL);
   if (result == 0) {
@@ -179,6 +186,16 @@ int cryptoMessageSign(const CoinInfo *coin, HDNode *node,
   return result;
 }
 
+int cryptoMessageSign(const CoinInfo *coin, HDNode *node,
+                      InputScriptType script_type, bool no_script_type,
+                      const uint8_t *message, size_t message_len,
+                      uint8_t *signature) {
+  uint8_t hash[HASHER_DIGEST_LENGTH] = {0};
+  cryptoMessageHash(coin, message, message_len, hash);
+  return cryptoMessageSignDigest(node, script_type, no_script_type, hash,
+                                 signature);
+}
+
 // Determines the script type from a non-multisig address.
 static InputScriptType address_to_script_type(const CoinInfo *coin,
                                               const char *address) {
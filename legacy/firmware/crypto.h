@@ -69,6 +69,15 @@ int gpgMessageSign(HDNode *node, const uint8_t *message, size_t message_len,
 int signifyMessageSign(HDNode *node, const uint8_t *message, size_t message_len,
                        uint8_t *signature);
 
+// Signed message header and length, hashed before the message itself.
+size_t cryptoMessagePrefix(const CoinInfo *coin, uint32_t message_len,
+                           uint8_t *prefix, size_t prefix_size);
+
+int cryptoMessageSignDigest(HDNode *node, InputScriptType script_type,
+                            bool no_script_type,
+                            const uint8_t hash[HASHER_DIGEST_LENGTH],
+                            uint8_t *signature);
+
 int cryptoMessageSign(const CoinInfo *coin, HDNode *node,
                       InputScriptType script_type, bool no_script_type,
                       const uint8_t *message, size_t message_len,
@@ -0,0 +1,150 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ed25519_replay.h"
+#include <string.h>
+#include "memzero.h"
+#include "se_chip.h"
+#include "sha2.h"
+
+static CONFIDENTIAL struct {
+  Ed25519ReplayOwner owner;
+  uint32_t length;  // bytes in each pass
+  uint32_t offset;  // bytes fed in the current pass
+  uint8_t pass;     // 1 for the nonce, 2 for the challenge
+  SHA256_CTX transcript_ctx;
+  uint8_t transcript[SHA256_DIGEST_LENGTH];
+#if EMULATOR
+  ed25519_sign_stream_context sign_ctx;
+#endif
+} replay;
+
+bool ed25519_replay_init(Ed25519ReplayOwner owner, const HDNode *node,
+                         uint32_t length) {
+  if (owner == ED25519_REPLAY_NONE || replay.owner != ED25519_REPLAY_NONE) {
+    return false;
+  }
+#if EMULATOR
+  ed25519_sign_stream_init(&replay.sign_ctx, node->private_key);
+#else
+  if (se_ed25519_stream_begin(node->public_key) != 0) {
+    return false;
+  }
+#endif
+  replay.owner = owner;
+  replay.length = length;
+  replay.offset = 0;
+  replay.pass = 1;
+  sha256_Init(&replay.transcript_ctx);
+  return true;
+}
+
+bool ed25519_replay_update(Ed25519ReplayOwner owner, const uint8_t *data,
+                           size_t size) {
+  if (ed25519_replay_pass(owner) == 0 ||
+      size > replay.length - replay.offset) {
+    return false;
+  }
+  if (size == 0) {
+    return true;
+  }
+  sha256_Update(&replay.transcript_ctx, data, size);
+#if EMULATOR
+  ed25519_sign_stream_update(&replay.sign_ctx, data, size);
+#else
+  bool first = replay.offset == 0;
+  bool last = replay.offset + size == replay.length;
+  if (se_ed25519_stream_update(replay.pass == 2, data, size, first, last) !=
+      0) {
+    return false;
+  }
+#endif
+  replay.offset += size;
+  return true;
+}
+
+bool ed25519_replay_rewind(Ed25519ReplayOwner owner) {
+  if (ed25519_replay_pass(owner) != 1 || replay.offset != replay.length) {
+    return false;
+  }
+  sha256_Final(&replay.transcript_ctx, replay.transcript);
+  sha256_Init(&replay.transcript_ctx);
+#if EMULATOR
+  ed25519_sign_stream_rewind(&replay.sign_ctx);
+#endif
+  replay.pass = 2;
+  replay.offset = 0;
+  return true;
+}
+
+bool ed25519_replay_final(Ed25519ReplayOwner owner, uint8_t *sig) {
+  uint8_t digest[SHA256_DIGEST_LENGTH] = {0};
+
+  if (ed25519_replay_pass(owner) == 0) {
+    return false;
+  }
+  if (replay.pass != 2 || replay.offset != replay.length) {
+    ed25519_replay_clear(owner);
+    return false;
+  }
+  sha256_Final(&replay.transcript_ctx, digest);
+  if (memcmp(digest, replay.transcript, sizeof(digest)) != 0) {
+    ed25519_replay_clear(owner);
+    return false;
+  }
+#if EMULATOR
+  ed25519_sign_stream_final(&replay.sign_ctx, sig);
+  bool ok = true;
+#else
+  bool ok = se_ed25519_stream_sign(sig) == 0;
+#endif
+  ed25519_replay_clear(owner);
+  return ok;
+}
+
+uint8_t ed25519_replay_pass(Ed25519ReplayOwner owner) {
+  if (owner == ED25519_REPLAY_NONE || replay.owner != owner) {
+    return 0;
+  }
+  return replay.pass;
+}
+
+void ed25519_replay_clear(Ed25519ReplayOwner owner) {
+  if (owner != ED25519_REPLAY_NONE && replay.owner == owner) {
+    memzero(&replay, sizeof(replay));
+  }
+}
+
+bool ed25519_replay_sign_prefixed(const HDNode *node, const uint8_t *prefix,
+                                  size_t prefix_size, const uint8_t *data,
+                                  size_t size, uint8_t *sig) {
+  const Ed25519ReplayOwner owner = ED25519_REPLAY_PREFIXED;
+
+  bool ok = ed25519_replay_init(owner, node, prefix_size + size);
+  for (int pass = 1; pass <= 2 && ok; pass++) {
+    ok = ed25519_replay_update(owner, prefix, prefix_size) &&
+         ed25519_replay_update(owner, data, size) &&
+         (pass == 2 || ed25519_replay_rewind(owner));
+  }
+  if (!ok) {
+    ed25519_replay_clear(owner);
+    return false;
+  }
+  return ed25519_replay_final(owner, sig);
+}
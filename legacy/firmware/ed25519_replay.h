@@ -0,0 +1,69 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ED25519_REPLAY_H__
+#define __ED25519_REPLAY_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "bip32.h"
+
+/*
+ * Ed25519 signing of a message that is fed in pieces instead of being held
+ * in memory. Ed25519 hashes the message twice, so the caller feeds all of
+ * it, rewinds, and feeds it again from the start, e.g. by asking the host
+ * to send it a second time. Both passes are also hashed with SHA-256 and
+ * the signature is only released when they match: a nonce derived from one
+ * message and used for another would expose the private key.
+ *
+ * The emulator signs with the node's private key, the device with the key
+ * the SE derived for the node. The SE keeps the nonce of the first pass
+ * until the signature, the replay fails if anything else derives or signs
+ * in between. For the same reason there is a single replay: it belongs to
+ * the owner that started it and fails for any other until it is cleared.
+ */
+typedef enum {
+  ED25519_REPLAY_NONE = 0,
+  ED25519_REPLAY_SOLANA,
+  ED25519_REPLAY_APTOS,
+  ED25519_REPLAY_PREFIXED,
+} Ed25519ReplayOwner;
+
+// false if another owner holds the replay or the SE no longer holds the key
+// of node
+bool ed25519_replay_init(Ed25519ReplayOwner owner, const HDNode *node,
+                         uint32_t length);
+// false if the data does not fit into the pass or the SE failed
+bool ed25519_replay_update(Ed25519ReplayOwner owner, const uint8_t *data,
+                           size_t size);
+// Starts the second pass, the first one must be complete.
+bool ed25519_replay_rewind(Ed25519ReplayOwner owner);
+// false if the passes differ or the SE failed, sig is left untouched then
+bool ed25519_replay_final(Ed25519ReplayOwner owner, uint8_t *sig);
+// 1 or 2, 0 if owner does not hold the replay
+uint8_t ed25519_replay_pass(Ed25519ReplayOwner owner);
+void ed25519_replay_clear(Ed25519ReplayOwner owner);
+
+// Signs prefix || data in memory without copying them together.
+bool ed25519_replay_sign_prefixed(const HDNode *node, const uint8_t *prefix,
+                                  size_t prefix_size, const uint8_t *data,
+                                  size_t size, uint8_t *sig);
+
+#endif
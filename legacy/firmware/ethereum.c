@@ -21,9 +21,11 @@
 
 #include "ethereum.h"
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 // #include <cstdint>
 #include "address.h"
+#include "chunk_signer.h"
 #include "crypto.h"
 #include "ecdsa.h"
 #include "ethereum_networks.h"
@@ -33,9 +35,11 @@
 #include "gettext.h"
 #include "layout2.h"
 #include "memzero.h"
+#include "message_signer.h"
 #include "messages.h"
 #include "messages.pb.h"
 #include "protect.h"
+#include "rlp.h"
 #include "se_chip.h"
 #include "secp256k1.h"
 #include "sha3.h"
@@ -47,17 +51,16 @@ recalculate the full value: v = 2 * chain_id + 35 + v_bit */
 #define MAX_CHAIN_ID ((0xFFFFFFFF - 36) >> 1)
 #define EIP1559_TX_TYPE 2
 
-static bool ethereum_signing = false;
-static uint32_t data_total, data_left;
 static EthereumTxRequest msg_tx_request;
 static CONFIDENTIAL HDNode *_node = NULL;
+static ChunkSigner eth_signer = {.name = "Ethereum"};
 #if EMULATOR
 static CONFIDENTIAL uint8_t privkey[32];
 #endif
 static uint64_t chain_id;
 static const char *chain_suffix;
 static bool eip1559;
-struct SHA3_CTX keccak_ctx = {0};
+static RLP_HASH_CTX rlp_ctx;
 
 static uint32_t signing_access_list_count;
 static EthereumAccessList signing_access_list[8];
@@ -85,129 +88,6 @@ struct signing_params {
   const uint8_t *value_bytes;
 };
 
-static inline void hash_data(const uint8_t *buf, size_t size) {
-  sha3_Update(&keccak_ctx, buf, size);
-}
-
-/*
- * Push an RLP encoded length to the hash buffer.
- */
-static void hash_rlp_length(uint32_t length, uint8_t firstbyte) {
-  uint8_t buf[4] = {0};
-  if (length == 1 && firstbyte <= 0x7f) {
-    /* empty length header */
-  } else if (length <= 55) {
-    buf[0] = 0x80 + length;
-    hash_data(buf, 1);
-  } else if (length <= 0xff) {
-    buf[0] = 0xb7 + 1;
-    buf[1] = length;
-    hash_data(buf, 2);
-  } else if (length <= 0xffff) {
-    buf[0] = 0xb7 + 2;
-    buf[1] = length >> 8;
-    buf[2] = length & 0xff;
-    hash_data(buf, 3);
-  } else {
-    buf[0] = 0xb7 + 3;
-    buf[1] = length >> 16;
-    buf[2] = length >> 8;
-    buf[3] = length & 0xff;
-    hash_data(buf, 4);
-  }
-}
-
-/*
- * Push an RLP encoded list length to the hash buffer.
- */
-static void hash_rlp_list_length(uint32_t length) {
-  uint8_t buf[4] = {0};
-  if (length <= 55) {
-    buf[0] = 0xc0 + length;
-    hash_data(buf, 1);
-  } else if (length <= 0xff) {
-    buf[0] = 0xf7 + 1;
-    buf[1] = length;
-    hash_data(buf, 2);
-  } else if (length <= 0xffff) {
-    buf[0] = 0xf7 + 2;
-    buf[1] = length >> 8;
-    buf[2] = length & 0xff;
-    hash_data(buf, 3);
-  } else {
-    buf[0] = 0xf7 + 3;
-    buf[1] = length >> 16;
-    buf[2] = length >> 8;
-    buf[3] = length & 0xff;
-    hash_data(buf, 4);
-  }
-}
-
-/*
- * Push an RLP encoded length field and data to the hash buffer.
- */
-static void hash_rlp_field(const uint8_t *buf, size_t size) {
-  hash_rlp_length(size, buf[0]);
-  hash_data(buf, size);
-}
-
-/*
- * Push an RLP encoded number to the hash buffer.
- * Ethereum yellow paper says to convert to big endian and strip leading zeros.
- */
-static void hash_rlp_number(uint64_t number) {
-  if (!number) {
-    return;
-  }
-  uint8_t data[8] = {0};
-  data[0] = (number >> 56) & 0xff;
-  data[1] = (number >> 48) & 0xff;
-  data[2] = (number >> 40) & 0xff;
-  data[3] = (number >> 32) & 0xff;
-  data[4] = (number >> 24) & 0xff;
-  data[5] = (number >> 16) & 0xff;
-  data[6] = (number >> 8) & 0xff;
-  data[7] = (number)&0xff;
-  int offset = 0;
-  while (!data[offset]) {
-    offset++;
-  }
-  hash_rlp_field(data + offset, 8 - offset);
-}
-
-/*
- * Calculate the number of bytes needed for an RLP length header.
- * NOTE: supports up to 16MB of data (how unlikely...)
- * FIXME: improve
- */
-static int rlp_calculate_length(int length, uint8_t firstbyte) {
-  if (length == 1 && firstbyte <= 0x7f) {
-    return 1;
-  } else if (length <= 55) {
-    return 1 + length;
-  } else if (length <= 0xff) {
-    return 2 + length;
-  } else if (length <= 0xffff) {
-    return 3 + length;
-  } else {
-    return 4 + length;
-  }
-}
-
-/* If number is less than 0x80 the RLP encoding is iteself (1 byte).
- * If it is 0x80 or larger, RLP encoding is 1 + length in bytes.
- */
-static int rlp_calculate_number_length(uint64_t number) {
-  int length = 1;
-  if (number >= 0x80) {
-    while (number) {
-      length++;
-      number = number >> 8;
-    }
-  }
-  return length;
-}
-
 static uint32_t rlp_calculate_access_list_keys_length(
     const EthereumAccessList_storage_keys_t *keys, uint32_t keys_count) {
   uint32_t keys_length = 0;
@@ -231,12 +111,14 @@ static uint32_t rlp_calculate_access_list_length(
   return length;
 }
 
-static void send_request_chunk(void) {
-  int progress = 1000 - (data_total > 1000000 ? data_left / (data_total / 800)
-                                              : data_left * 800 / data_total);
-  layoutProgress(_(C__SIGNING), progress);
+static void hash_data(const uint8_t *buf, size_t size) {
+  rlp_hash_data(&rlp_ctx, buf, size);
+}
+
+static void send_request_chunk(uint32_t size) {
+  layoutProgress(_(C__SIGNING), chunk_signer_progress(&eth_signer));
   msg_tx_request.has_data_length = true;
-  msg_tx_request.data_length = data_left <= 1024 ? data_left : 1024;
+  msg_tx_request.data_length = size;
   msg_write(MessageType_MessageType_EthereumTxRequest, &msg_tx_request);
 }
 
@@ -251,8 +133,9 @@ static void send_signature(void) {
   layoutProgress(_(C__SIGNING), 1000);
 
   if (eip1559) {
-    hash_rlp_list_length(rlp_calculate_access_list_length(
-        signing_access_list, signing_access_list_count));
+    rlp_hash_list_length(
+        &rlp_ctx, rlp_calculate_access_list_length(signing_access_list,
+                                                   signing_access_list_count));
     for (size_t i = 0; i < signing_access_list_count; i++) {
       uint8_t address[20] = {0};
       if (!ethereum_parse(signing_access_list[i].address, address)) {
@@ -267,24 +150,24 @@ static void send_signature(void) {
           signing_access_list[i].storage_keys,
           signing_access_list[i].storage_keys_count);
 
-      hash_rlp_list_length(address_length +
-                           rlp_calculate_length(keys_length, 0xff));
-      hash_rlp_field(address, sizeof(address));
-      hash_rlp_list_length(keys_length);
+      rlp_hash_list_length(
+          &rlp_ctx, address_length + rlp_calculate_length(keys_length, 0xff));
+      rlp_hash_field(&rlp_ctx, address, sizeof(address));
+      rlp_hash_list_length(&rlp_ctx, keys_length);
       for (size_t j = 0; j < signing_access_list[i].storage_keys_count; j++) {
-        hash_rlp_field(signing_access_list[i].storage_keys[j].bytes,
+        rlp_hash_field(&rlp_ctx, signing_access_list[i].storage_keys[j].bytes,
                        signing_access_list[i].storage_keys[j].size);
       }
     }
   } else {
     /* eip-155 replay protection */
     /* hash v=chain_id, r=0, s=0 */
-    hash_rlp_number(chain_id);
-    hash_rlp_length(0, 0);
-    hash_rlp_length(0, 0);
+    rlp_hash_number(&rlp_ctx, chain_id);
+    rlp_hash_length(&rlp_ctx, 0, 0);
+    rlp_hash_length(&rlp_ctx, 0, 0);
   }
 
-  keccak_Final(&keccak_ctx, hash);
+  rlp_hash_final(&rlp_ctx, hash);
 #if EMULATOR
   if (ecdsa_sign_digest(&secp256k1, privkey, hash, sig, &v,
                         ethereum_is_canonic) != 0) {
@@ -318,9 +201,25 @@ static void send_signature(void) {
   memcpy(msg_tx_request.signature_s.bytes, sig + 32, 32);
 
   msg_write(MessageType_MessageType_EthereumTxRequest, &msg_tx_request);
+}
 
-  ethereum_signing_abort();
+static void clear_node(void) {
+  _node = NULL;
+#if EMULATOR
+  memzero(privkey, sizeof(privkey));
+#endif
 }
+
+static const ChunkSignerOps ethereum_signer_ops = {
+    /* Our encoding only supports transactions up to 2^24 bytes.  To
+     * prevent exceeding the limit we use a stricter limit on data length.
+     */
+    .max_length = 16000000,
+    .update = hash_data,
+    .request = send_request_chunk,
+    .finish = send_signature,
+    .reset = clear_node,
+};
 /* Format a 256 bit number (amount in wei) into a human readable format
  * using standard ethereum units.
  * The buffer must be at least 25 bytes.
@@ -444,14 +343,15 @@ static bool layoutEthereumConfirmTx(
     if (!is_eip1559) {
       return layoutTransactionSignEVM(
           chain_name, params->chain_id, false, amount, to_str, signer, NULL,
-          NULL, params->data_initial_chunk_bytes, data_total,
+          NULL, params->data_initial_chunk_bytes, eth_signer.total,
           _(I__ETH_MAXIMUM_FEE_COLON), gas_value, _(I__TOTAL_AMOUNT_COLON),
           total_amount, NULL, NULL, NULL, NULL);
     } else {
       return layoutTransactionSignEVM(
           chain_name, params->chain_id, false, amount, to_str, signer, NULL,
-          NULL, params->data_initial_chunk_bytes, data_total, key1, value1,
-          key2, value2, key3, value3, _(I__TOTAL_AMOUNT_COLON), total_amount);
+          NULL, params->data_initial_chunk_bytes, eth_signer.total, key1,
+          value1, key2, value2, key3, value3, _(I__TOTAL_AMOUNT_COLON),
+          total_amount);
     }
   } else {
     ethereumFormatAmount(&val, token, amount, sizeof(amount));
@@ -506,10 +406,9 @@ static void fillEthereumFee(const uint8_t *amount_bytes, uint32_t amount_len,
  */
 
 static bool ethereum_signing_init_common(struct signing_params *params) {
-  ethereum_signing = true;
-  sha3_256_Init(&keccak_ctx);
+  chunk_signer_init(&eth_signer, &ethereum_signer_ops);
+  rlp_hash_init(&rlp_ctx);
 
-  data_total = data_left = 0;
   chain_id = 0;
 
   memzero(&msg_tx_request, sizeof(EthereumTxRequest));
@@ -524,27 +423,8 @@ static bool ethereum_signing_init_common(struct signing_params *params) {
   chain_id = params->chain_id;
   chain_suffix = params->chain_suffix;
 
-  if (params->data_length > 0) {
-    if (params->data_initial_chunk_size == 0) {
-      fsm_sendFailure(FailureType_Failure_DataError,
-                      "Data length provided, but no initial chunk");
-      return false;
-    }
-    /* Our encoding only supports transactions up to 2^24 bytes.  To
-     * prevent exceeding the limit we use a stricter limit on data length.
-     */
-    if (params->data_length > 16000000) {
-      fsm_sendFailure(FailureType_Failure_DataError,
-                      "Data length exceeds limit");
-      return false;
-    }
-    data_total = params->data_length;
-  } else {
-    data_total = 0;
-  }
-  if (params->data_initial_chunk_size > data_total) {
-    fsm_sendFailure(FailureType_Failure_DataError,
-                    "Invalid size of initial chunk");
+  if (!chunk_signer_set_length(&eth_signer, params->data_length,
+                               params->data_initial_chunk_size)) {
     return false;
   }
 
@@ -575,7 +455,8 @@ static void ethereum_signing_handle_erc20(struct signing_params *params,
   }
 
   // detect ERC-20 token
-  if (params->pubkeyhash_set && params->value_size == 0 && data_total == 68 &&
+  if (params->pubkeyhash_set && params->value_size == 0 &&
+      eth_signer.total == 68 &&
       params->data_initial_chunk_size == 68 &&
       memcmp(params->data_initial_chunk_bytes,
              "\xa9\x05\x9c\xbb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
@@ -595,7 +476,8 @@ static bool ethereum_signing_handle_nft(struct signing_params *params,
   }
 
   // detect ERC-721/ERC1155 token
-  if (params->pubkeyhash_set && params->value_size == 0 && data_total == 228 &&
+  if (params->pubkeyhash_set && params->value_size == 0 &&
+      eth_signer.total == 228 &&
       params->data_initial_chunk_size == 228 &&
       memcmp(params->data_initial_chunk_bytes,
              "\xf2\x42\x43\x2a\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
@@ -617,7 +499,8 @@ static bool ethereum_signing_handle_nft(struct signing_params *params,
 
     return true;
   }
-  if (params->pubkeyhash_set && params->value_size == 0 && data_total == 100 &&
+  if (params->pubkeyhash_set && params->value_size == 0 &&
+      eth_signer.total == 100 &&
       params->data_initial_chunk_size == 100 &&
       memcmp(params->data_initial_chunk_bytes,
              "\x42\x84\x2e\x0e\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
@@ -772,8 +655,8 @@ void ethereum_signing_init(const EthereumSignTx *msg, const HDNode *node,
   rlp_length += rlp_calculate_length(params.pubkeyhash_set ? 20 : 0,
                                      params.pubkeyhash[0]);
   rlp_length += rlp_calculate_length(params.value_size, params.value_bytes[0]);
-  rlp_length +=
-      rlp_calculate_length(data_total, params.data_initial_chunk_bytes[0]);
+  rlp_length += rlp_calculate_length(eth_signer.total,
+                                     params.data_initial_chunk_bytes[0]);
   if (tx_type) {
     rlp_length += rlp_calculate_number_length(tx_type);
   }
@@ -782,32 +665,28 @@ void ethereum_signing_init(const EthereumSignTx *msg, const HDNode *node,
   rlp_length += rlp_calculate_length(0, 0);
 
   /* Stage 2: Store header fields */
-  hash_rlp_list_length(rlp_length);
+  rlp_hash_list_length(&rlp_ctx, rlp_length);
 
   layoutProgress(_(C__SIGNING), 100);
 
   if (tx_type) {
-    hash_rlp_number(tx_type);
+    rlp_hash_number(&rlp_ctx, tx_type);
   }
-  hash_rlp_field(msg->nonce.bytes, msg->nonce.size);
-  hash_rlp_field(msg->gas_price.bytes, msg->gas_price.size);
-  hash_rlp_field(msg->gas_limit.bytes, msg->gas_limit.size);
-  hash_rlp_field(params.pubkeyhash, params.pubkeyhash_set ? 20 : 0);
-  hash_rlp_field(params.value_bytes, params.value_size);
-  hash_rlp_length(data_total, params.data_initial_chunk_bytes[0]);
-  hash_data(params.data_initial_chunk_bytes, params.data_initial_chunk_size);
-  data_left = data_total - params.data_initial_chunk_size;
+  rlp_hash_field(&rlp_ctx, msg->nonce.bytes, msg->nonce.size);
+  rlp_hash_field(&rlp_ctx, msg->gas_price.bytes, msg->gas_price.size);
+  rlp_hash_field(&rlp_ctx, msg->gas_limit.bytes, msg->gas_limit.size);
+  rlp_hash_field(&rlp_ctx, params.pubkeyhash, params.pubkeyhash_set ? 20 : 0);
+  rlp_hash_field(&rlp_ctx, params.value_bytes, params.value_size);
+  rlp_hash_length(&rlp_ctx, eth_signer.total,
+                  params.data_initial_chunk_bytes[0]);
 
   _node = (HDNode *)node;
 #if EMULATOR
   memcpy(privkey, node->private_key, 32);
 #endif
 
-  if (data_left > 0) {
-    send_request_chunk();
-  } else {
-    send_signature();
-  }
+  chunk_signer_start(&eth_signer, params.data_initial_chunk_bytes,
+                     params.data_initial_chunk_size);
 }
 
 void ethereum_signing_init_eip1559(const EthereumSignTxEIP1559 *msg,
@@ -916,8 +795,8 @@ void ethereum_signing_init_eip1559(const EthereumSignTxEIP1559 *msg,
   rlp_length += rlp_calculate_length(params.pubkeyhash_set ? 20 : 0,
                                      params.pubkeyhash[0]);
   rlp_length += rlp_calculate_length(params.value_size, params.value_bytes[0]);
-  rlp_length +=
-      rlp_calculate_length(data_total, params.data_initial_chunk_bytes[0]);
+  rlp_length += rlp_calculate_length(eth_signer.total,
+                                     params.data_initial_chunk_bytes[0]);
 
   rlp_length +=
       rlp_calculate_length(rlp_calculate_access_list_length(
@@ -925,21 +804,21 @@ void ethereum_signing_init_eip1559(const EthereumSignTxEIP1559 *msg,
                            0xff);
 
   /* Stage 2: Store header fields */
-  hash_rlp_number(EIP1559_TX_TYPE);
-  hash_rlp_list_length(rlp_length);
+  rlp_hash_number(&rlp_ctx, EIP1559_TX_TYPE);
+  rlp_hash_list_length(&rlp_ctx, rlp_length);
 
   layoutProgress(_(C__SIGNING), 100);
 
-  hash_rlp_number(chain_id);
-  hash_rlp_field(msg->nonce.bytes, msg->nonce.size);
-  hash_rlp_field(msg->max_priority_fee.bytes, msg->max_priority_fee.size);
-  hash_rlp_field(msg->max_gas_fee.bytes, msg->max_gas_fee.size);
-  hash_rlp_field(msg->gas_limit.bytes, msg->gas_limit.size);
-  hash_rlp_field(params.pubkeyhash, params.pubkeyhash_set ? 20 : 0);
-  hash_rlp_field(params.value_bytes, params.value_size);
-  hash_rlp_length(data_total, params.data_initial_chunk_bytes[0]);
-  hash_data(params.data_initial_chunk_bytes, params.data_initial_chunk_size);
-  data_left = data_total - params.data_initial_chunk_size;
+  rlp_hash_number(&rlp_ctx, chain_id);
+  rlp_hash_field(&rlp_ctx, msg->nonce.bytes, msg->nonce.size);
+  rlp_hash_field(&rlp_ctx, msg->max_priority_fee.bytes,
+                 msg->max_priority_fee.size);
+  rlp_hash_field(&rlp_ctx, msg->max_gas_fee.bytes, msg->max_gas_fee.size);
+  rlp_hash_field(&rlp_ctx, msg->gas_limit.bytes, msg->gas_limit.size);
+  rlp_hash_field(&rlp_ctx, params.pubkeyhash, params.pubkeyhash_set ? 20 : 0);
+  rlp_hash_field(&rlp_ctx, params.value_bytes, params.value_size);
+  rlp_hash_length(&rlp_ctx, eth_signer.total,
+                  params.data_initial_chunk_bytes[0]);
 
   /* make a copy of access_list, hash it after data is processed */
   memcpy(signing_access_list, msg->access_list, sizeof(signing_access_list));
@@ -950,124 +829,119 @@ void ethereum_signing_init_eip1559(const EthereumSignTxEIP1559 *msg,
   memcpy(privkey, node->private_key, 32);
 #endif
 
-  if (data_left > 0) {
-    send_request_chunk();
-  } else {
-    send_signature();
-  }
+  chunk_signer_start(&eth_signer, params.data_initial_chunk_bytes,
+                     params.data_initial_chunk_size);
 }
 
 void ethereum_signing_txack(const EthereumTxAck *tx) {
-  if (!ethereum_signing) {
-    fsm_sendFailure(FailureType_Failure_UnexpectedMessage,
-                    "Not in Ethereum signing mode");
-    layoutHome();
-    return;
-  }
-
-  if (tx->data_chunk.size > data_left) {
-    fsm_sendFailure(FailureType_Failure_DataError, "Too much data");
-    ethereum_signing_abort();
-    return;
-  }
-
-  if (data_left > 0 && tx->data_chunk.size == 0) {
-    fsm_sendFailure(FailureType_Failure_DataError, "Empty data chunk received");
-    ethereum_signing_abort();
-    return;
-  }
-
-  hash_data(tx->data_chunk.bytes, tx->data_chunk.size);
-
-  data_left -= tx->data_chunk.size;
-
-  if (data_left > 0) {
-    send_request_chunk();
-  } else {
-    send_signature();
-  }
+  chunk_signer_txack(&eth_signer, tx->data_chunk.bytes, tx->data_chunk.size);
 }
 
-void ethereum_signing_abort(void) {
-  if (ethereum_signing) {
-    _node = NULL;
-#if EMULATOR
-    memzero(privkey, sizeof(privkey));
-#endif
-    layoutHome();
-    ethereum_signing = false;
-  }
+void ethereum_signing_abort(void) { chunk_signer_abort(&eth_signer); }
+
+static size_t ethereum_message_prefix(uint32_t message_len, uint8_t *prefix) {
+  return snprintf((char *)prefix, MESSAGE_SIGNER_PREFIX_SIZE,
+                  "\x19"
+                  "Ethereum Signed Message:\n%lu",
+                  (unsigned long)message_len);
 }
 
 static void ethereum_message_hash(const uint8_t *message, size_t message_len,
                                   uint8_t hash[32]) {
+  uint8_t prefix[MESSAGE_SIGNER_PREFIX_SIZE] = {0};
   struct SHA3_CTX ctx = {0};
   sha3_256_Init(&ctx);
-  sha3_Update(&ctx, (const uint8_t *)"\x19" "Ethereum Signed Message:\n", 26);
-  uint8_t c = 0;
-  if (message_len >= 1000000000) {
-    c = '0' + message_len / 1000000000 % 10;
-    sha3_Update(&ctx, &c, 1);
-  }
-  if (message_len >= 100000000) {
-    c = '0' + message_len / 100000000 % 10;
-    sha3_Update(&ctx, &c, 1);
-  }
-  if (message_len >= 10000000) {
-    c = '0' + message_len / 10000000 % 10;
-    sha3_Update(&ctx, &c, 1);
-  }
-  if (message_len >= 1000000) {
-    c = '0' + message_len / 1000000 % 10;
-    sha3_Update(&ctx, &c, 1);
-  }
-  if (message_len >= 100000) {
-    c = '0' + message_len / 100000 % 10;
-    sha3_Update(&ctx, &c, 1);
-  }
-  if (message_len >= 10000) {
-    c = '0' + message_len / 10000 % 10;
-    sha3_Update(&ctx, &c, 1);
-  }
-  if (message_len >= 1000) {
-    c = '0' + message_len / 1000 % 10;
-    sha3_Update(&ctx, &c, 1);
-  }
-  if (message_len >= 100) {
-    c = '0' + message_len / 100 % 10;
-    sha3_Update(&ctx, &c, 1);
-  }
-  if (message_len >= 10) {
-    c = '0' + message_len / 10 % 10;
-    sha3_Update(&ctx, &c, 1);
-  }
-  c = '0' + message_len % 10;
-  sha3_Update(&ctx, &c, 1);
+  sha3_Update(&ctx, prefix, ethereum_message_prefix(message_len, prefix));
   sha3_Update(&ctx, message, message_len);
   keccak_Final(&ctx, hash);
 }
 
-void ethereum_message_sign(const EthereumSignMessage *msg, const HDNode *node,
-                           EthereumMessageSignature *resp) {
-  uint8_t hash[32] = {0};
-  ethereum_message_hash(msg->message.bytes, msg->message.size, hash);
-
+static bool ethereum_message_sign_digest(const HDNode *node,
+                                         const uint8_t hash[32],
+                                         uint8_t signature[65]) {
   uint8_t v = 0;
 #if EMULATOR
-  if (ecdsa_sign_digest(&secp256k1, node->private_key, hash,
-                        resp->signature.bytes, &v, ethereum_is_canonic) != 0) {
+  if (ecdsa_sign_digest(&secp256k1, node->private_key, hash, signature, &v,
+                        ethereum_is_canonic) != 0) {
 #else
-  if (hdnode_sign_digest(node, hash, resp->signature.bytes, &v,
+  if (hdnode_sign_digest((HDNode *)node, hash, signature, &v,
                          ethereum_is_canonic) != 0) {
 #endif
     fsm_sendFailure(FailureType_Failure_ProcessError, "Signing failed");
+    return false;
+  }
+  signature[64] = 27 + v;
+  return true;
+}
+
+void ethereum_message_sign(const EthereumSignMessage *msg, const HDNode *node,
+                           EthereumMessageSignature *resp) {
+  uint8_t hash[32] = {0};
+  ethereum_message_hash(msg->message.bytes, msg->message.size, hash);
+
+  if (!ethereum_message_sign_digest(node, hash, resp->signature.bytes)) {
     return;
   }
-  resp->signature.bytes[64] = 27 + v;
   resp->signature.size = 65;
   msg_write(MessageType_MessageType_EthereumMessageSignature, resp);
 }
 
+static void send_message_signature(const HDNode *node, const char *signer_str,
+                                   const uint8_t digest[32]) {
+  EthereumMessageSignature resp = {0};
+  if (!ethereum_message_sign_digest(node, digest, resp.signature.bytes)) {
+    return;
+  }
+  resp.signature.size = 65;
+  strlcpy(resp.address, signer_str, sizeof(resp.address));
+  msg_write(MessageType_MessageType_EthereumMessageSignature, &resp);
+}
+
+static const MessageSignerOps ethereum_message_signer_ops = {
+    .chain_name = "Ethereum",
+    .hasher = HASHER_SHA3K,
+    .digest = NULL,
+    .sign = send_message_signature,
+};
+
+void ethereum_message_sign_init(const EthereumSignMessage *msg,
+                                const HDNode *node, const char *address) {
+  uint8_t prefix[MESSAGE_SIGNER_PREFIX_SIZE] = {0};
+  size_t prefix_size = ethereum_message_prefix(msg->data_length, prefix);
+  message_signer_init(&ethereum_message_signer_ops, node, address, prefix,
+                      prefix_size, msg->data_length, msg->message.bytes,
+                      msg->message.size);
+}
+
+static void send_message_signature_onekey(const HDNode *node,
+                                          const char *signer_str,
+                                          const uint8_t digest[32]) {
+  EthereumMessageSignatureOneKey resp = {0};
+  if (!ethereum_message_sign_digest(node, digest, resp.signature.bytes)) {
+    return;
+  }
+  resp.signature.size = 65;
+  strlcpy(resp.address, signer_str, sizeof(resp.address));
+  msg_write(MessageType_MessageType_EthereumMessageSignatureOneKey, &resp);
+}
+
+static const MessageSignerOps ethereum_message_signer_ops_onekey = {
+    .chain_name = "Ethereum",
+    .hasher = HASHER_SHA3K,
+    .digest = NULL,
+    .sign = send_message_signature_onekey,
+};
+
+void ethereum_message_sign_init_onekey(const EthereumSignMessageOneKey *msg,
+                                       const HDNode *node,
+                                       const char *address) {
+  uint8_t prefix[MESSAGE_SIGNER_PREFIX_SIZE] = {0};
+  size_t prefix_size = ethereum_message_prefix(msg->data_length, prefix);
+  message_signer_init(&ethereum_message_signer_ops_onekey, node, address,
+                      prefix, prefix_size, msg->data_length,
+                      msg->message.bytes, msg->message.size);
+}
+
 int ethereum_message_verify(const EthereumVerifyMessage *msg) {
   if (msg->signature.size != 65) {
     fsm_sendFailure(FailureType_Failure_DataError, "Malformed signature");
@@ -1120,9 +994,9 @@ int ethereum_message_verify(const EthereumVerifyMessage *msg) {
  * EIP-712 hashes might have no message_hash if primaryType="EIP712Domain".
  * In this case, set has_message_hash=false.
  */
-static void ethereum_typed_hash(const uint8_t domain_separator_hash[32],
-                                const uint8_t message_hash[32],
-                                bool has_message_hash, uint8_t hash[32]) {
+void ethereum_typed_hash(const uint8_t domain_separator_hash[32],
+                         const uint8_t message_hash[32], bool has_message_hash,
+                         uint8_t hash[32]) {
   struct SHA3_CTX ctx = {0};
   sha3_256_Init(&ctx);
   sha3_Update(&ctx, (const uint8_t *)"\x19\x01", 2);
@@ -0,0 +1,738 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "ethereum_eip712.h"
+#include <stdio.h>
+#include <string.h>
+#include "address.h"
+#include "bignum.h"
+#include "ecdsa.h"
+#include "ethereum.h"
+#include "fsm.h"
+#include "gettext.h"
+#include "layout2.h"
+#include "memzero.h"
+#include "messages.h"
+#include "messages.pb.h"
+#include "pb_decode.h"
+#include "secp256k1.h"
+#include "sha3.h"
+#include "util.h"
+
+#define EIP712_MAX_STRUCTS 16
+#define EIP712_MAX_MEMBERS 64
+// array nesting of a single member, e.g. uint256[][2] has two dimensions
+#define EIP712_MAX_DIMS 4
+// structs and arrays being encoded at the same time
+#define EIP712_MAX_DEPTH 8
+#define EIP712_NAME_POOL_SIZE 1024
+#define EIP712_DYNAMIC_SIZE 0xFFFF
+
+#define EIP712_DOMAIN "EIP712Domain"
+
+_Static_assert(EIP712_MAX_STRUCTS <= 32, "struct set must fit in uint32_t");
+_Static_assert(EIP712_MAX_DEPTH < 16, "member path too long");
+
+typedef struct {
+  uint16_t name;  // offset in the name pool
+  uint8_t first;  // first member in the member table
+  uint8_t count;
+  bool defined;
+  bool hashed;
+  uint8_t type_hash[32];
+} Eip712Struct;
+
+typedef struct {
+  uint16_t name;
+  uint8_t data_type;  // type of the innermost entry, never ARRAY
+  uint8_t size;       // for int, uint and bytes, 0 if the bytes are dynamic
+  uint8_t struct_index;
+  uint8_t dims;
+  uint16_t dim[EIP712_MAX_DIMS];  // outermost first
+} Eip712Member;
+
+typedef enum {
+  FRAME_STRUCT,
+  FRAME_ARRAY,
+} Eip712FrameKind;
+
+typedef struct {
+  SHA3_CTX ctx;
+  uint8_t kind;
+  uint8_t type;   // struct index for structs, member index for arrays
+  uint8_t dim;    // nesting level of an array frame
+  bool hashed;    // false for structs encoded into their parent array
+  uint16_t index;  // next member or element
+  uint16_t count;
+} Eip712Frame;
+
+typedef enum {
+  TYPED_DATA_IDLE,
+  TYPED_DATA_TYPES,
+  TYPED_DATA_VALUES,
+} TypedDataPhase;
+
+static TypedDataPhase phase = TYPED_DATA_IDLE;
+static bool metamask_v4_compat;
+static CONFIDENTIAL HDNode *_node = NULL;
+#if EMULATOR
+static CONFIDENTIAL uint8_t privkey[32];
+#endif
+static char signer[43];
+static char title[64];
+
+static Eip712Struct structs[EIP712_MAX_STRUCTS];
+static uint8_t struct_count;
+static Eip712Member members[EIP712_MAX_MEMBERS];
+static uint8_t member_count;
+static char names[EIP712_NAME_POOL_SIZE];
+static uint16_t names_used;
+static uint8_t primary_struct;
+static uint8_t requested_struct;
+
+static Eip712Frame frames[EIP712_MAX_DEPTH];
+static uint8_t depth;
+static uint8_t root;  // 0 while hashing the domain, 1 for the message
+static bool length_requested;
+static uint8_t domain_hash[32];
+static uint8_t message_hash[32];
+
+static EthereumTypedDataStructRequest struct_request;
+static EthereumTypedDataValueRequest value_request;
+static EthereumTypedDataSignature signature_resp;
+static EthereumFieldType field_types[2];
+// hex of the largest EthereumTypedDataValueAck.value
+static char value_text[2 * 1024 + 3];
+
+static void typed_data_fail(FailureType type, const char *message) {
+  fsm_sendFailure(type, message);
+  ethereum_typed_data_abort();
+}
+
+static const char *typed_data_name(uint16_t offset) { return names + offset; }
+
+static bool typed_data_add_name(const char *name, uint16_t *offset) {
+  size_t len = strlen(name) + 1;
+  if (len > sizeof(names) - names_used) return false;
+  memcpy(names + names_used, name, len);
+  *offset = names_used;
+  names_used += len;
+  return true;
+}
+
+static int typed_data_add_struct(const char *name) {
+  for (int i = 0; i < struct_count; i++) {
+    if (strcmp(typed_data_name(structs[i].name), name) == 0) return i;
+  }
+  if (struct_count >= EIP712_MAX_STRUCTS) return -1;
+  Eip712Struct *s = &structs[struct_count];
+  memzero(s, sizeof(*s));
+  if (!typed_data_add_name(name, &s->name)) return -1;
+  return struct_count++;
+}
+
+static bool typed_data_check_field(const EthereumFieldType *field) {
+  if ((field->data_type == EthereumDataType_ARRAY) != field->has_entry_type) {
+    return false;
+  }
+  if ((field->data_type == EthereumDataType_STRUCT) !=
+      field->has_struct_name) {
+    return false;
+  }
+  switch (field->data_type) {
+    case EthereumDataType_ARRAY:
+      return !field->has_size || field->size < EIP712_DYNAMIC_SIZE;
+    case EthereumDataType_STRUCT:
+      return field->has_size && field->struct_name[0] != '\0';
+    case EthereumDataType_BYTES:
+      return !field->has_size || (field->size >= 1 && field->size <= 32);
+    case EthereumDataType_UINT:
+    case EthereumDataType_INT:
+      return field->has_size && field->size >= 1 && field->size <= 32;
+    case EthereumDataType_STRING:
+    case EthereumDataType_BOOL:
+    case EthereumDataType_ADDRESS:
+      return !field->has_size;
+    default:
+      return false;
+  }
+}
+
+static bool typed_data_read_member(const EthereumStructMember *src,
+                                   Eip712Member *member) {
+  const EthereumFieldType *field = &src->type;
+  int next = 0;
+
+  memzero(member, sizeof(*member));
+  while (field->data_type == EthereumDataType_ARRAY) {
+    if (!typed_data_check_field(field)) {
+      typed_data_fail(FailureType_Failure_DataError, "Invalid field type");
+      return false;
+    }
+    if (member->dims >= EIP712_MAX_DIMS) {
+      typed_data_fail(FailureType_Failure_DataError, "Array nested too deeply");
+      return false;
+    }
+    member->dim[member->dims++] =
+        field->has_size ? field->size : EIP712_DYNAMIC_SIZE;
+
+    // entry types are decoded one level at a time, alternating between two
+    // buffers so the encoded entry is never overwritten while it is read
+    pb_istream_t stream = pb_istream_from_buffer(field->entry_type.bytes,
+                                                 field->entry_type.size);
+    if (!pb_decode(&stream, EthereumFieldType_fields, &field_types[next])) {
+      typed_data_fail(FailureType_Failure_DataError, "Invalid entry type");
+      return false;
+    }
+    field = &field_types[next];
+    next ^= 1;
+  }
+
+  if (!typed_data_check_field(field)) {
+    typed_data_fail(FailureType_Failure_DataError, "Invalid field type");
+    return false;
+  }
+  member->data_type = field->data_type;
+  if (field->data_type == EthereumDataType_UINT ||
+      field->data_type == EthereumDataType_INT ||
+      field->data_type == EthereumDataType_BYTES) {
+    member->size = field->has_size ? field->size : 0;
+  }
+  if (field->data_type == EthereumDataType_STRUCT) {
+    int index = typed_data_add_struct(field->struct_name);
+    if (index < 0) {
+      typed_data_fail(FailureType_Failure_DataError, "Too many types");
+      return false;
+    }
+    member->struct_index = index;
+  }
+  if (!typed_data_add_name(src->name, &member->name)) {
+    typed_data_fail(FailureType_Failure_DataError, "Too many types");
+    return false;
+  }
+  return true;
+}
+
+static void typed_data_write(SHA3_CTX *ctx, const char *text) {
+  sha3_Update(ctx, (const uint8_t *)text, strlen(text));
+}
+
+static void typed_data_write_type(SHA3_CTX *ctx, const Eip712Member *member) {
+  char buf[16] = {0};
+
+  switch (member->data_type) {
+    case EthereumDataType_UINT:
+      snprintf(buf, sizeof(buf), "uint%d", member->size * 8);
+      break;
+    case EthereumDataType_INT:
+      snprintf(buf, sizeof(buf), "int%d", member->size * 8);
+      break;
+    case EthereumDataType_BYTES:
+      if (member->size) {
+        snprintf(buf, sizeof(buf), "bytes%d", member->size);
+      } else {
+        strlcpy(buf, "bytes", sizeof(buf));
+      }
+      break;
+    case EthereumDataType_STRING:
+      strlcpy(buf, "string", sizeof(buf));
+      break;
+    case EthereumDataType_BOOL:
+      strlcpy(buf, "bool", sizeof(buf));
+      break;
+    case EthereumDataType_ADDRESS:
+      strlcpy(buf, "address", sizeof(buf));
+      break;
+    default:
+      break;
+  }
+  if (member->data_type == EthereumDataType_STRUCT) {
+    typed_data_write(ctx, typed_data_name(structs[member->struct_index].name));
+  } else {
+    typed_data_write(ctx, buf);
+  }
+
+  // T[2][] is a dynamic array of T[2], the outermost size comes last
+  for (int i = member->dims - 1; i >= 0; i--) {
+    if (member->dim[i] == EIP712_DYNAMIC_SIZE) {
+      strlcpy(buf, "[]", sizeof(buf));
+    } else {
+      snprintf(buf, sizeof(buf), "[%d]", member->dim[i]);
+    }
+    typed_data_write(ctx, buf);
+  }
+}
+
+static void typed_data_write_struct_type(SHA3_CTX *ctx, uint8_t index) {
+  const Eip712Struct *s = &structs[index];
+
+  typed_data_write(ctx, typed_data_name(s->name));
+  typed_data_write(ctx, "(");
+  for (int i = 0; i < s->count; i++) {
+    const Eip712Member *member = &members[s->first + i];
+    if (i > 0) typed_data_write(ctx, ",");
+    typed_data_write_type(ctx, member);
+    typed_data_write(ctx, " ");
+    typed_data_write(ctx, typed_data_name(member->name));
+  }
+  typed_data_write(ctx, ")");
+}
+
+/*
+ * typeHash = keccak256(encodeType), where encodeType is the struct itself
+ * followed by every struct it references, directly or not, sorted by name.
+ */
+static const uint8_t *typed_data_type_hash(uint8_t index) {
+  Eip712Struct *s = &structs[index];
+  if (s->hashed) return s->type_hash;
+
+  uint32_t deps = 1u << index;
+  bool changed = true;
+  while (changed) {
+    changed = false;
+    for (int i = 0; i < struct_count; i++) {
+      if (!(deps & (1u << i))) continue;
+      for (int j = 0; j < structs[i].count; j++) {
+        const Eip712Member *member = &members[structs[i].first + j];
+        if (member->data_type == EthereumDataType_STRUCT &&
+            !(deps & (1u << member->struct_index))) {
+          deps |= 1u << member->struct_index;
+          changed = true;
+        }
+      }
+    }
+  }
+  deps &= ~(1u << index);
+
+  SHA3_CTX ctx = {0};
+  sha3_256_Init(&ctx);
+  typed_data_write_struct_type(&ctx, index);
+  while (deps) {
+    int next = -1;
+    for (int i = 0; i < struct_count; i++) {
+      if (!(deps & (1u << i))) continue;
+      if (next < 0 || strcmp(typed_data_name(structs[i].name),
+                             typed_data_name(structs[next].name)) < 0) {
+        next = i;
+      }
+    }
+    typed_data_write_struct_type(&ctx, next);
+    deps &= ~(1u << next);
+  }
+  keccak_Final(&ctx, s->type_hash);
+  s->hashed = true;
+  return s->type_hash;
+}
+
+// Context that the values of frame `level` are encoded into.
+static SHA3_CTX *typed_data_sink(int level) {
+  while (!frames[level].hashed) level--;
+  return &frames[level].ctx;
+}
+
+static bool typed_data_push(uint8_t kind, uint8_t type, uint8_t dim,
+                            bool hashed) {
+  if (depth >= EIP712_MAX_DEPTH) {
+    typed_data_fail(FailureType_Failure_DataError, "Data nested too deeply");
+    return false;
+  }
+  Eip712Frame *frame = &frames[depth++];
+  frame->kind = kind;
+  frame->type = type;
+  frame->dim = dim;
+  frame->hashed = hashed;
+  frame->index = 0;
+  frame->count = 0;
+  if (hashed) sha3_256_Init(&frame->ctx);
+  return true;
+}
+
+static bool typed_data_push_struct(uint8_t index, bool hashed) {
+  if (!typed_data_push(FRAME_STRUCT, index, 0, hashed)) return false;
+  Eip712Frame *frame = &frames[depth - 1];
+  frame->count = structs[index].count;
+  if (hashed) sha3_Update(&frame->ctx, typed_data_type_hash(index), 32);
+  return true;
+}
+
+static const Eip712Member *typed_data_current_member(
+    const Eip712Frame *frame) {
+  if (frame->kind == FRAME_STRUCT) {
+    return &members[structs[frame->type].first + frame->index];
+  }
+  return &members[frame->type];
+}
+
+// Asks for the value at the current index of the first `count` frames.
+static void typed_data_request_value(uint8_t count) {
+  memzero(&value_request, sizeof(value_request));
+  value_request.member_path[value_request.member_path_count++] = root;
+  for (int i = 0; i < count; i++) {
+    value_request.member_path[value_request.member_path_count++] =
+        frames[i].index;
+  }
+  msg_write(MessageType_MessageType_EthereumTypedDataValueRequest,
+            &value_request);
+}
+
+static void typed_data_finish(void) {
+  bool has_message = primary_struct != 0;
+  char domain_hex[65] = {0};
+  char message_hex[65] = {0};
+  uint8_t hash[32] = {0};
+  uint8_t v = 0;
+
+  data2hex(domain_hash, 32, domain_hex);
+  data2hex(message_hash, 32, message_hex);
+  if (!fsm_layoutSignHash("Ethereum", signer, domain_hex,
+                          has_message ? message_hex : NULL, NULL)) {
+    typed_data_fail(FailureType_Failure_ActionCancelled, NULL);
+    return;
+  }
+
+  layoutProgress(_(C__SIGNING), 1000);
+  ethereum_typed_hash(domain_hash, message_hash, has_message, hash);
+
+  memzero(&signature_resp, sizeof(signature_resp));
+#if EMULATOR
+  if (ecdsa_sign_digest(&secp256k1, privkey, hash,
+                        signature_resp.signature.bytes, &v,
+                        ethereum_is_canonic) != 0) {
+#else
+  if (hdnode_sign_digest(_node, hash, signature_resp.signature.bytes, &v,
+                         ethereum_is_canonic) != 0) {
+#endif
+    typed_data_fail(FailureType_Failure_ProcessError, "Signing failed");
+    return;
+  }
+  signature_resp.signature.bytes[64] = 27 + v;
+  signature_resp.signature.size = 65;
+  strlcpy(signature_resp.address, signer, sizeof(signature_resp.address));
+  msg_write(MessageType_MessageType_EthereumTypedDataSignature,
+            &signature_resp);
+  ethereum_typed_data_abort();
+}
+
+// Closes the top frame. Returns false once there is nothing left to encode.
+static bool typed_data_pop(void) {
+  Eip712Frame *frame = &frames[--depth];
+  if (frame->hashed) {
+    uint8_t hash[32] = {0};
+    keccak_Final(&frame->ctx, hash);
+    if (depth == 0) {
+      if (root == 0) {
+        memcpy(domain_hash, hash, 32);
+        // primaryType may be EIP712Domain, then there is no message hash
+        if (primary_struct != 0) {
+          root = 1;
+          return typed_data_push_struct(primary_struct, true);
+        }
+      } else {
+        memcpy(message_hash, hash, 32);
+      }
+      typed_data_finish();
+      return false;
+    }
+    sha3_Update(typed_data_sink(depth - 1), hash, 32);
+  }
+  frames[depth - 1].index++;
+  return true;
+}
+
+/*
+ * Walks the data until the next value is needed from the host.
+ * Structs are encoded as typeHash followed by their members, arrays as the
+ * hash of their encoded entries. MetaMask v4 hashes structs found in arrays,
+ * otherwise they are encoded in place.
+ */
+static void typed_data_advance(void) {
+  for (;;) {
+    const Eip712Frame *frame = &frames[depth - 1];
+    if (frame->index >= frame->count) {
+      if (!typed_data_pop()) return;
+      continue;
+    }
+
+    const Eip712Member *member = typed_data_current_member(frame);
+    uint8_t member_index = member - members;
+    uint8_t dim = frame->kind == FRAME_STRUCT ? 0 : frame->dim + 1;
+    if (dim < member->dims) {
+      if (!typed_data_push(FRAME_ARRAY, member_index, dim, true)) return;
+      if (member->dim[dim] == EIP712_DYNAMIC_SIZE) {
+        length_requested = true;
+        typed_data_request_value(depth - 1);
+        return;
+      }
+      frames[depth - 1].count = member->dim[dim];
+    } else if (member->data_type == EthereumDataType_STRUCT) {
+      bool hashed = frame->kind == FRAME_STRUCT || metamask_v4_compat;
+      if (!typed_data_push_struct(member->struct_index, hashed)) return;
+    } else {
+      typed_data_request_value(depth);
+      return;
+    }
+  }
+}
+
+static void typed_data_request_struct(void) {
+  for (int i = 0; i < struct_count; i++) {
+    if (!structs[i].defined) {
+      requested_struct = i;
+      memzero(&struct_request, sizeof(struct_request));
+      strlcpy(struct_request.name, typed_data_name(structs[i].name),
+              sizeof(struct_request.name));
+      msg_write(MessageType_MessageType_EthereumTypedDataStructRequest,
+                &struct_request);
+      return;
+    }
+  }
+
+  // all types are known, start with the domain
+  phase = TYPED_DATA_VALUES;
+  root = 0;
+  depth = 0;
+  if (typed_data_push_struct(0, true)) typed_data_advance();
+}
+
+static const char *typed_data_check_value(const Eip712Member *member,
+                                          const uint8_t *value, size_t len) {
+  if (member->size && len != member->size) return "Invalid length";
+  switch (member->data_type) {
+    case EthereumDataType_BOOL:
+      if (len != 1 || value[0] > 1) return "Invalid boolean value";
+      break;
+    case EthereumDataType_ADDRESS:
+      if (len != 20) return "Invalid address";
+      break;
+    case EthereumDataType_STRING:
+      if (!is_valid_utf8(value, len)) return "Invalid UTF-8";
+      break;
+    default:
+      break;
+  }
+  return NULL;
+}
+
+static void typed_data_encode_value(SHA3_CTX *ctx, const Eip712Member *member,
+                                    const uint8_t *value, size_t len) {
+  uint8_t word[32] = {0};
+
+  switch (member->data_type) {
+    case EthereumDataType_STRING:
+      keccak_256(value, len, word);
+      break;
+    case EthereumDataType_BYTES:
+      if (member->size == 0) {
+        keccak_256(value, len, word);
+      } else {
+        memcpy(word, value, len);
+      }
+      break;
+    case EthereumDataType_INT:
+      // sign extended to 256 bits
+      if (value[0] & 0x80) memset(word, 0xFF, sizeof(word));
+      memcpy(word + 32 - len, value, len);
+      break;
+    default:
+      memcpy(word + 32 - len, value, len);
+      break;
+  }
+  sha3_Update(ctx, word, sizeof(word));
+}
+
+static void typed_data_format_value(const Eip712Member *member,
+                                    const uint8_t *value, size_t len) {
+  switch (member->data_type) {
+    case EthereumDataType_UINT:
+    case EthereumDataType_INT: {
+      uint8_t word[32] = {0};
+      bool negative =
+          member->data_type == EthereumDataType_INT && (value[0] & 0x80);
+      if (negative) memset(word, 0xFF, sizeof(word));
+      memcpy(word + 32 - len, value, len);
+      if (negative) {
+        // two's complement, show the magnitude
+        uint16_t carry = 1;
+        for (int i = 31; i >= 0; i--) {
+          carry += (uint8_t)~word[i];
+          word[i] = carry & 0xFF;
+          carry >>= 8;
+        }
+      }
+      bignum256 number = {0};
+      bn_read_be(word, &number);
+      bn_format(&number, negative ? "-" : NULL, NULL, 0, 0, false, 0,
+                value_text, sizeof(value_text));
+      break;
+    }
+    case EthereumDataType_BOOL:
+      strlcpy(value_text, value[0] ? "true" : "false", sizeof(value_text));
+      break;
+    case EthereumDataType_ADDRESS:
+      ethereum_address_checksum(value, value_text, false, 0);
+      break;
+    case EthereumDataType_STRING:
+      memcpy(value_text, value, len);
+      value_text[len] = '\0';
+      break;
+    default:
+      value_text[0] = '0';
+      value_text[1] = 'x';
+      data2hex(value, len, value_text + 2);
+      break;
+  }
+}
+
+// Shows a value labelled with its path, e.g. Mail.to[1].wallet
+static bool typed_data_confirm_value(const Eip712Member *member,
+                                     const uint8_t *value, size_t len) {
+  char label[128] = {0};
+  char index[8] = {0};
+
+  strlcpy(label, typed_data_name(structs[frames[0].type].name), sizeof(label));
+  for (int i = 0; i < depth; i++) {
+    const Eip712Frame *frame = &frames[i];
+    if (frame->kind == FRAME_STRUCT) {
+      strlcat(label, ".", sizeof(label));
+      strlcat(label, typed_data_name(typed_data_current_member(frame)->name),
+              sizeof(label));
+    } else {
+      snprintf(index, sizeof(index), "[%d]", frame->index);
+      strlcat(label, index, sizeof(label));
+    }
+  }
+
+  typed_data_format_value(member, value, len);
+  return layoutTypedDataField(title, label, value_text);
+}
+
+void ethereum_typed_data_init(const EthereumSignTypedData *msg,
+                              const HDNode *node, const char *address) {
+  ethereum_typed_data_abort();
+
+  if (msg->primary_type[0] == '\0') {
+    fsm_sendFailure(FailureType_Failure_DataError, "Invalid primary type");
+    layoutHome();
+    return;
+  }
+
+  phase = TYPED_DATA_TYPES;
+  metamask_v4_compat =
+      msg->has_metamask_v4_compat ? msg->metamask_v4_compat : true;
+  _node = (HDNode *)node;
+#if EMULATOR
+  memcpy(privkey, node->private_key, 32);
+#endif
+  strlcpy(signer, address, sizeof(signer));
+  snprintf(title, sizeof(title), "%s", _(T__CHAIN_STR_MESSAGE));
+  bracket_replace(title, "Ethereum");
+
+  struct_count = 0;
+  member_count = 0;
+  names_used = 0;
+  depth = 0;
+  root = 0;
+  length_requested = false;
+
+  // the domain is always the first struct
+  typed_data_add_struct(EIP712_DOMAIN);
+  primary_struct = typed_data_add_struct(msg->primary_type);
+  typed_data_request_struct();
+}
+
+void ethereum_typed_data_struct_ack(const EthereumTypedDataStructAck *msg) {
+  if (phase != TYPED_DATA_TYPES) {
+    fsm_sendFailure(FailureType_Failure_UnexpectedMessage,
+                    "Not expecting EIP-712 type definitions");
+    ethereum_typed_data_abort();
+    layoutHome();
+    return;
+  }
+
+  if (msg->members_count > EIP712_MAX_MEMBERS - member_count) {
+    typed_data_fail(FailureType_Failure_DataError, "Too many types");
+    return;
+  }
+
+  Eip712Struct *s = &structs[requested_struct];
+  s->first = member_count;
+  s->count = 0;
+  for (pb_size_t i = 0; i < msg->members_count; i++) {
+    if (!typed_data_read_member(&msg->members[i], &members[member_count])) {
+      return;
+    }
+    member_count++;
+    s->count++;
+  }
+  s->defined = true;
+
+  typed_data_request_struct();
+}
+
+void ethereum_typed_data_value_ack(const EthereumTypedDataValueAck *msg) {
+  if (phase != TYPED_DATA_VALUES) {
+    fsm_sendFailure(FailureType_Failure_UnexpectedMessage,
+                    "Not expecting EIP-712 values");
+    ethereum_typed_data_abort();
+    layoutHome();
+    return;
+  }
+
+  Eip712Frame *frame = &frames[depth - 1];
+  if (length_requested) {
+    if (msg->value.size != 2) {
+      typed_data_fail(FailureType_Failure_DataError, "Invalid array length");
+      return;
+    }
+    frame->count = (msg->value.bytes[0] << 8) | msg->value.bytes[1];
+    length_requested = false;
+    typed_data_advance();
+    return;
+  }
+
+  const Eip712Member *member = typed_data_current_member(frame);
+  const char *error =
+      typed_data_check_value(member, msg->value.bytes, msg->value.size);
+  if (error) {
+    typed_data_fail(FailureType_Failure_DataError, error);
+    return;
+  }
+
+  typed_data_encode_value(typed_data_sink(depth - 1), member,
+                          msg->value.bytes, msg->value.size);
+  if (!typed_data_confirm_value(member, msg->value.bytes, msg->value.size)) {
+    typed_data_fail(FailureType_Failure_ActionCancelled, NULL);
+    return;
+  }
+  frame->index++;
+  typed_data_advance();
+}
+
+void ethereum_typed_data_abort(void) {
+  if (phase != TYPED_DATA_IDLE) {
+    _node = NULL;
+#if EMULATOR
+    memzero(privkey, sizeof(privkey));
+#endif
+    memzero(frames, sizeof(frames));
+    depth = 0;
+    layoutHome();
+    phase = TYPED_DATA_IDLE;
+  }
+}
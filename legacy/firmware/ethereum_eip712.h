@@ -0,0 +1,43 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __ETHEREUM_EIP712_H__
+#define __ETHEREUM_EIP712_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "bip32.h"
+#include "messages-ethereum-eip712.pb.h"
+
+/*
+ * EIP-712 typed data signing.
+ *
+ * The host first sends the definition of every struct the device asks for,
+ * then the value of every atomic field, one message each. Each struct and
+ * array being encoded holds its own Keccak context on a small frame stack, so
+ * a value is hashed as soon as it arrives and nothing but the type tables is
+ * kept. Type hashes are computed once per struct and cached.
+ */
+void ethereum_typed_data_init(const EthereumSignTypedData *msg,
+                              const HDNode *node, const char *address);
+void ethereum_typed_data_struct_ack(const EthereumTypedDataStructAck *msg);
+void ethereum_typed_data_value_ack(const EthereumTypedDataValueAck *msg);
+void ethereum_typed_data_abort(void);
+
+#endif
@@ -32,6 +32,7 @@
 #include "messages.h"
 #include "messages.pb.h"
 #include "protect.h"
+#include "rlp.h"
 #include "secp256k1.h"
 #include "sha3.h"
 #include "transaction.h"
@@ -52,7 +53,7 @@ static CONFIDENTIAL uint8_t privkey[32];
 #endif
 static uint64_t chain_id;
 static bool eip1559;
-static struct SHA3_CTX keccak_ctx = {0};
+static RLP_HASH_CTX rlp_ctx;
 
 static uint32_t signing_access_list_count;
 static EthereumAccessListOneKey signing_access_list[8];
@@ -78,129 +79,6 @@ struct signing_params {
   const uint8_t *value_bytes;
 };
 
-static inline void hash_data(const uint8_t *buf, size_t size) {
-  sha3_Update(&keccak_ctx, buf, size);
-}
-
-/*
- * Push an RLP encoded length to the hash buffer.
- */
-static void hash_rlp_length(uint32_t length, uint8_t firstbyte) {
-  uint8_t buf[4] = {0};
-  if (length == 1 && firstbyte <= 0x7f) {
-    /* empty length header */
-  } else if (length <= 55) {
-    buf[0] = 0x80 + length;
-    hash_data(buf, 1);
-  } else if (length <= 0xff) {
-    buf[0] = 0xb7 + 1;
-    buf[1] = length;
-    hash_data(buf, 2);
-  } else if (length <= 0xffff) {
-    buf[0] = 0xb7 + 2;
-    buf[1] = length >> 8;
-    buf[2] = length & 0xff;
-    hash_data(buf, 3);
-  } else {
-    buf[0] = 0xb7 + 3;
-    buf[1] = length >> 16;
-    buf[2] = length >> 8;
-    buf[3] = length & 0xff;
-    hash_data(buf, 4);
-  }
-}
-
-/*
- * Push an RLP encoded list length to the hash buffer.
- */
-static void hash_rlp_list_length(uint32_t length) {
-  uint8_t buf[4] = {0};
-  if (length <= 55) {
-    buf[0] = 0xc0 + length;
-    hash_data(buf, 1);
-  } else if (length <= 0xff) {
-    buf[0] = 0xf7 + 1;
-    buf[1] = length;
-    hash_data(buf, 2);
-  } else if (length <= 0xffff) {
-    buf[0] = 0xf7 + 2;
-    buf[1] = length >> 8;
-    buf[2] = length & 0xff;
-    hash_data(buf, 3);
-  } else {
-    buf[0] = 0xf7 + 3;
-    buf[1] = length >> 16;
-    buf[2] = length >> 8;
-    buf[3] = length & 0xff;
-    hash_data(buf, 4);
-  }
-}
-
-/*
- * Push an RLP encoded length field and data to the hash buffer.
- */
-static void hash_rlp_field(const uint8_t *buf, size_t size) {
-  hash_rlp_length(size, buf[0]);
-  hash_data(buf, size);
-}
-
-/*
- * Push an RLP encoded number to the hash buffer.
- * Ethereum yellow paper says to convert to big endian and strip leading zeros.
- */
-static void hash_rlp_number(uint64_t number) {
-  if (!number) {
-    return;
-  }
-  uint8_t data[8] = {0};
-  data[0] = (number >> 56) & 0xff;
-  data[1] = (number >> 48) & 0xff;
-  data[2] = (number >> 40) & 0xff;
-  data[3] = (number >> 32) & 0xff;
-  data[4] = (number >> 24) & 0xff;
-  data[5] = (number >> 16) & 0xff;
-  data[6] = (number >> 8) & 0xff;
-  data[7] = (number)&0xff;
-  int offset = 0;
-  while (!data[offset]) {
-    offset++;
-  }
-  hash_rlp_field(data + offset, 8 - offset);
-}
-
-/*
- * Calculate the number of bytes needed for an RLP length header.
- * NOTE: supports up to 16MB of data (how unlikely...)
- * FIXME: improve
- */
-static int rlp_calculate_length(int length, uint8_t firstbyte) {
-  if (length == 1 && firstbyte <= 0x7f) {
-    return 1;
-  } else if (length <= 55) {
-    return 1 + length;
-  } else if (length <= 0xff) {
-    return 2 + length;
-  } else if (length <= 0xffff) {
-    return 3 + length;
-  } else {
-    return 4 + length;
-  }
-}
-
-/* If number is less than 0x80 the RLP encoding is iteself (1 byte).
- * If it is 0x80 or larger, RLP encoding is 1 + length in bytes.
- */
-static int rlp_calculate_number_length(uint64_t number) {
-  int length = 1;
-  if (number >= 0x80) {
-    while (number) {
-      length++;
-      number = number >> 8;
-    }
-  }
-  return length;
-}
-
 static uint32_t rlp_calculate_access_list_keys_length(
     const EthereumAccessListOneKey_storage_keys_t *keys, uint32_t keys_count) {
   uint32_t keys_length = 0;
@@ -244,8 +122,9 @@ static void send_signature(void) {
   layoutProgressAdapter(_(C__SIGNING), 1000);
 
   if (eip1559) {
-    hash_rlp_list_length(rlp_calculate_access_list_length(
-        signing_access_list, signing_access_list_count));
+    rlp_hash_list_length(
+        &rlp_ctx, rlp_calculate_access_list_length(signing_access_list,
+                                                   signing_access_list_count));
     for (size_t i = 0; i < signing_access_list_count; i++) {
       uint8_t address[20] = {0};
       if (!ethereum_parse_onekey(signing_access_list[i].address, address)) {
@@ -260,24 +139,24 @@ static void send_signature(void) {
           signing_access_list[i].storage_keys,
           signing_access_list[i].storage_keys_count);
 
-      hash_rlp_list_length(address_length +
-                           rlp_calculate_length(keys_length, 0xff));
-      hash_rlp_field(address, sizeof(address));
-      hash_rlp_list_length(keys_length);
+      rlp_hash_list_length(
+          &rlp_ctx, address_length + rlp_calculate_length(keys_length, 0xff));
+      rlp_hash_field(&rlp_ctx, address, sizeof(address));
+      rlp_hash_list_length(&rlp_ctx, keys_length);
       for (size_t j = 0; j < signing_access_list[i].storage_keys_count; j++) {
-        hash_rlp_field(signing_access_list[i].storage_keys[j].bytes,
+        rlp_hash_field(&rlp_ctx, signing_access_list[i].storage_keys[j].bytes,
                        signing_access_list[i].storage_keys[j].size);
       }
     }
   } else {
     /* eip-155 replay protection */
     /* hash v=chain_id, r=0, s=0 */
-    hash_rlp_number(chain_id);
-    hash_rlp_length(0, 0);
-    hash_rlp_length(0, 0);
+    rlp_hash_number(&rlp_ctx, chain_id);
+    rlp_hash_length(&rlp_ctx, 0, 0);
+    rlp_hash_length(&rlp_ctx, 0, 0);
   }
 
-  keccak_Final(&keccak_ctx, hash);
+  rlp_hash_final(&rlp_ctx, hash);
 #if EMULATOR
   if (ecdsa_sign_digest(&secp256k1, privkey, hash, sig, &v,
                         ethereum_is_canonic) != 0) {
@@ -488,7 +367,7 @@ static void fillEthereumFee(const uint8_t *amount_bytes, uint32_t amount_len,
 
 static bool ethereum_signing_init_common(struct signing_params *params) {
   ethereum_signing = true;
-  sha3_256_Init(&keccak_ctx);
+  rlp_hash_init(&rlp_ctx);
 
   data_total = data_left = 0;
   chain_id = 0;
@@ -759,20 +638,21 @@ void ethereum_signing_init_onekey(const EthereumSignTxOneKey *msg,
   rlp_length += rlp_calculate_length(0, 0);
 
   /* Stage 2: Store header fields */
-  hash_rlp_list_length(rlp_length);
+  rlp_hash_list_length(&rlp_ctx, rlp_length);
 
   layoutProgressAdapter(_(C__SIGNING), 100);
 
   if (tx_type) {
-    hash_rlp_number(tx_type);
-  }
-  hash_rlp_field(msg->nonce.bytes, msg->nonce.size);
-  hash_rlp_field(msg->gas_price.bytes, msg->gas_price.size);
-  hash_rlp_field(msg->gas_limit.bytes, msg->gas_limit.size);
-  hash_rlp_field(params.pubkeyhash, params.pubkeyhash_set ? 20 : 0);
-  hash_rlp_field(params.value_bytes, params.value_size);
-  hash_rlp_length(data_total, params.data_initial_chunk_bytes[0]);
-  hash_data(params.data_initial_chunk_bytes, params.data_initial_chunk_size);
+    rlp_hash_number(&rlp_ctx, tx_type);
+  }
+  rlp_hash_field(&rlp_ctx, msg->nonce.bytes, msg->nonce.size);
+  rlp_hash_field(&rlp_ctx, msg->gas_price.bytes, msg->gas_price.size);
+  rlp_hash_field(&rlp_ctx, msg->gas_limit.bytes, msg->gas_limit.size);
+  rlp_hash_field(&rlp_ctx, params.pubkeyhash, params.pubkeyhash_set ? 20 : 0);
+  rlp_hash_field(&rlp_ctx, params.value_bytes, params.value_size);
+  rlp_hash_length(&rlp_ctx, data_total, params.data_initial_chunk_bytes[0]);
+  rlp_hash_data(&rlp_ctx, params.data_initial_chunk_bytes,
+                params.data_initial_chunk_size);
   data_left = data_total - params.data_initial_chunk_size;
 
   _node = (HDNode *)node;
@@ -898,20 +778,22 @@ void ethereum_signing_init_eip1559_onekey(
                            0xff);
 
   /* Stage 2: Store header fields */
-  hash_rlp_number(EIP1559_TX_TYPE);
-  hash_rlp_list_length(rlp_length);
+  rlp_hash_number(&rlp_ctx, EIP1559_TX_TYPE);
+  rlp_hash_list_length(&rlp_ctx, rlp_length);
 
   layoutProgressAdapter(_(C__SIGNING), 100);
 
-  hash_rlp_number(chain_id);
-  hash_rlp_field(msg->nonce.bytes, msg->nonce.size);
-  hash_rlp_field(msg->max_priority_fee.bytes, msg->max_priority_fee.size);
-  hash_rlp_field(msg->max_gas_fee.bytes, msg->max_gas_fee.size);
-  hash_rlp_field(msg->gas_limit.bytes, msg->gas_limit.size);
-  hash_rlp_field(params.pubkeyhash, params.pubkeyhash_set ? 20 : 0);
-  hash_rlp_field(params.value_bytes, params.value_size);
-  hash_rlp_length(data_total, params.data_initial_chunk_bytes[0]);
-  hash_data(params.data_initial_chunk_bytes, params.data_initial_chunk_size);
+  rlp_hash_number(&rlp_ctx, chain_id);
+  rlp_hash_field(&rlp_ctx, msg->nonce.bytes, msg->nonce.size);
+  rlp_hash_field(&rlp_ctx, msg->max_priority_fee.bytes,
+                 msg->max_priority_fee.size);
+  rlp_hash_field(&rlp_ctx, msg->max_gas_fee.bytes, msg->max_gas_fee.size);
+  rlp_hash_field(&rlp_ctx, msg->gas_limit.bytes, msg->gas_limit.size);
+  rlp_hash_field(&rlp_ctx, params.pubkeyhash, params.pubkeyhash_set ? 20 : 0);
+  rlp_hash_field(&rlp_ctx, params.value_bytes, params.value_size);
+  rlp_hash_length(&rlp_ctx, data_total, params.data_initial_chunk_bytes[0]);
+  rlp_hash_data(&rlp_ctx, params.data_initial_chunk_bytes,
+                params.data_initial_chunk_size);
   data_left = data_total - params.data_initial_chunk_size;
 
   /* make a copy of access_list, hash it after data is processed */
@@ -950,7 +832,7 @@ void ethereum_signing_txack_onekey(const EthereumTxAckOneKey *tx) {
     return;
   }
 
-  hash_data(tx->data_chunk.bytes, tx->data_chunk.size);
+  rlp_hash_data(&rlp_ctx, tx->data_chunk.bytes, tx->data_chunk.size);
 
   data_left -= tx->data_chunk.size;
 
@@ -38,6 +38,10 @@ void ethereum_signing_txack_onekey(const EthereumTxAckOneKey *msg);
 void ethereum_message_sign_onekey(const EthereumSignMessageOneKey *msg,
                                   const HDNode *node,
                                   EthereumMessageSignatureOneKey *resp);
+// Signs a message sent in chunks, implemented next to the Ethereum one.
+void ethereum_message_sign_init_onekey(const EthereumSignMessageOneKey *msg,
+                                       const HDNode *node,
+                                       const char *address);
 int ethereum_message_verify_onekey(const EthereumVerifyMessageOneKey *msg);
 void ethereum_typed_hash_sign_onekey(const EthereumSignTypedHashOneKey *msg,
                                      const HDNode *node,
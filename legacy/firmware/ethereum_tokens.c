@@ -9,56 +9,38 @@
 
 static const EthereumTokenInfo tokens[TOKENS_COUNT] = {
     {
-        .symbol = "AAVE",
-        .decimals = 18,
-        .address = {.size = 20,
-                    .bytes = "\x7f\xc6\x65\x00\xc8\x4a\x76\xad\x7e\x9c\x93\x43"
-                             "\x7b\xfc\x5a\xc3\x3e\x2d\xda\xe9"},
-        .chain_id = 1,
-        .name = "",
-    },
-    {
-        .symbol = "APE",
-        .decimals = 18,
-        .address = {.size = 20,
-                    .bytes = "\x4d\x22\x44\x52\x80\x1a\xce\xd8\xb2\xf0\xae\xbe"
-                             "\x15\x53\x79\xbb\x5d\x59\x43\x81"},
-        .chain_id = 1,
-        .name = "",
-    },
-    {
-        .symbol = "AXS",
+        .symbol = "MANA",
         .decimals = 18,
         .address = {.size = 20,
-                    .bytes = "\xbb\x0e\x17\xef\x65\xf8\x2a\xb0\x18\xd8\xed\xd7"
-                             "\x76\xe8\xdd\x94\x03\x27\xb2\x8b"},
+                    .bytes = "\x0f\x5d\x2f\xb2\x9f\xb7\xd3\xcf\xee\x44\x4a\x20"
+                             "\x02\x98\xf4\x68\x90\x8c\xc9\x42"},
         .chain_id = 1,
         .name = "",
     },
     {
-        .symbol = "BUSD",
+        .symbol = "UNI",
         .decimals = 18,
         .address = {.size = 20,
-                    .bytes = "\x4f\xab\xb1\x45\xd6\x46\x52\xa9\x48\xd7\x25\x33"
-                             "\x02\x3f\x6e\x7a\x62\x3c\x7c\x53"},
+                    .bytes = "\x1f\x98\x40\xa8\x5d\x5a\xf5\xbf\x1d\x17\x62\xf9"
+                             "\x25\xbd\xad\xdc\x42\x01\xf9\x84"},
         .chain_id = 1,
         .name = "",
     },
     {
-        .symbol = "XCN",
-        .decimals = 18,
+        .symbol = "WBTC",
+        .decimals = 8,
         .address = {.size = 20,
-                    .bytes = "\xa2\xcd\x3d\x43\xc7\x75\x97\x8a\x96\xbd\xbf\x12"
-                             "\xd7\x33\xd5\xa1\xed\x94\xfb\x18"},
+                    .bytes = "\x22\x60\xfa\xc5\xe5\x54\x2a\x77\x3a\xa4\x4f\xbc"
+                             "\xfe\xdf\x7c\x19\x3b\xc2\xc5\x99"},
         .chain_id = 1,
         .name = "",
     },
     {
-        .symbol = "LINK",
+        .symbol = "LEO",
         .decimals = 18,
         .address = {.size = 20,
-                    .bytes = "\x51\x49\x10\x77\x1a\xf9\xca\x65\x6a\xf8\x40\xdf"
-                             "\xf8\x3e\x82\x64\xec\xf9\x86\xca"},
+                    .bytes = "\x2a\xf5\xd2\xad\x76\x74\x11\x91\xd1\x5d\xfe\x7b"
+                             "\xf6\xac\x92\xd4\xbd\x91\x2c\xa3"},
         .chain_id = 1,
         .name = "",
     },
@@ -72,56 +54,56 @@ static const EthereumTokenInfo tokens[TOKENS_COUNT] = {
         .name = "",
     },
     {
-        .symbol = "CRO",
-        .decimals = 8,
+        .symbol = "SAND",
+        .decimals = 18,
         .address = {.size = 20,
-                    .bytes = "\xa0\xb7\x3e\x1f\xf0\xb8\x09\x14\xab\x6f\xe0\x44"
-                             "\x4e\x65\x84\x8c\x4c\x34\x45\x0b"},
+                    .bytes = "\x38\x45\xba\xda\xde\x8e\x6d\xff\x04\x98\x20\x68"
+                             "\x0d\x1f\x14\xbd\x39\x03\xa5\xd0"},
         .chain_id = 1,
         .name = "",
     },
     {
-        .symbol = "DAI",
+        .symbol = "QNT",
         .decimals = 18,
         .address = {.size = 20,
-                    .bytes = "\x6b\x17\x54\x74\xe8\x90\x94\xc4\x4d\xa9\x8b\x95"
-                             "\x4e\xed\xea\xc4\x95\x27\x1d\x0f"},
+                    .bytes = "\x4a\x22\x0e\x60\x96\xb2\x5e\xad\xb8\x83\x58\xcb"
+                             "\x44\x06\x8a\x32\x48\x25\x46\x75"},
         .chain_id = 1,
         .name = "",
     },
     {
-        .symbol = "MANA",
+        .symbol = "APE",
         .decimals = 18,
         .address = {.size = 20,
-                    .bytes = "\x0f\x5d\x2f\xb2\x9f\xb7\xd3\xcf\xee\x44\x4a\x20"
-                             "\x02\x98\xf4\x68\x90\x8c\xc9\x42"},
+                    .bytes = "\x4d\x22\x44\x52\x80\x1a\xce\xd8\xb2\xf0\xae\xbe"
+                             "\x15\x53\x79\xbb\x5d\x59\x43\x81"},
         .chain_id = 1,
         .name = "",
     },
     {
-        .symbol = "FRAX",
+        .symbol = "BUSD",
         .decimals = 18,
         .address = {.size = 20,
-                    .bytes = "\x85\x3d\x95\x5a\xce\xf8\x22\xdb\x05\x8e\xb8\x50"
-                             "\x59\x11\xed\x77\xf1\x75\xb9\x9e"},
+                    .bytes = "\x4f\xab\xb1\x45\xd6\x46\x52\xa9\x48\xd7\x25\x33"
+                             "\x02\x3f\x6e\x7a\x62\x3c\x7c\x53"},
         .chain_id = 1,
         .name = "",
     },
     {
-        .symbol = "LEO",
+        .symbol = "LINK",
         .decimals = 18,
         .address = {.size = 20,
-                    .bytes = "\x2a\xf5\xd2\xad\x76\x74\x11\x91\xd1\x5d\xfe\x7b"
-                             "\xf6\xac\x92\xd4\xbd\x91\x2c\xa3"},
+                    .bytes = "\x51\x49\x10\x77\x1a\xf9\xca\x65\x6a\xf8\x40\xdf"
+                             "\xf8\x3e\x82\x64\xec\xf9\x86\xca"},
         .chain_id = 1,
         .name = "",
     },
     {
-        .symbol = "STETH",
+        .symbol = "DAI",
         .decimals = 18,
         .address = {.size = 20,
-                    .bytes = "\xae\x7a\xb9\x65\x20\xde\x3a\x18\xe5\xe1\x11\xb5"
-                             "\xea\xab\x09\x53\x12\xd7\xfe\x84"},
+                    .bytes = "\x6b\x17\x54\x74\xe8\x90\x94\xc4\x4d\xa9\x8b\x95"
+                             "\x4e\xed\xea\xc4\x95\x27\x1d\x0f"},
         .chain_id = 1,
         .name = "",
     },
@@ -144,11 +126,20 @@ static const EthereumTokenInfo tokens[TOKENS_COUNT] = {
         .name = "",
     },
     {
-        .symbol = "QNT",
+        .symbol = "AAVE",
         .decimals = 18,
         .address = {.size = 20,
-                    .bytes = "\x4a\x22\x0e\x60\x96\xb2\x5e\xad\xb8\x83\x58\xcb"
-                             "\x44\x06\x8a\x32\x48\x25\x46\x75"},
+                    .bytes = "\x7f\xc6\x65\x00\xc8\x4a\x76\xad\x7e\x9c\x93\x43"
+                             "\x7b\xfc\x5a\xc3\x3e\x2d\xda\xe9"},
+        .chain_id = 1,
+        .name = "",
+    },
+    {
+        .symbol = "FRAX",
+        .decimals = 18,
+        .address = {.size = 20,
+                    .bytes = "\x85\x3d\x95\x5a\xce\xf8\x22\xdb\x05\x8e\xb8\x50"
+                             "\x59\x11\xed\x77\xf1\x75\xb9\x9e"},
         .chain_id = 1,
         .name = "",
     },
@@ -162,47 +153,56 @@ static const EthereumTokenInfo tokens[TOKENS_COUNT] = {
         .name = "",
     },
     {
-        .symbol = "USDT",
+        .symbol = "CRO",
+        .decimals = 8,
+        .address = {.size = 20,
+                    .bytes = "\xa0\xb7\x3e\x1f\xf0\xb8\x09\x14\xab\x6f\xe0\x44"
+                             "\x4e\x65\x84\x8c\x4c\x34\x45\x0b"},
+        .chain_id = 1,
+        .name = "",
+    },
+    {
+        .symbol = "USDC",
         .decimals = 6,
         .address = {.size = 20,
-                    .bytes = "\xda\xc1\x7f\x95\x8d\x2e\xe5\x23\xa2\x20\x62\x06"
-                             "\x99\x45\x97\xc1\x3d\x83\x1e\xc7"},
+                    .bytes = "\xa0\xb8\x69\x91\xc6\x21\x8b\x36\xc1\xd1\x9d\x4a"
+                             "\x2e\x9e\xb0\xce\x36\x06\xeb\x48"},
         .chain_id = 1,
         .name = "",
     },
     {
-        .symbol = "SAND",
+        .symbol = "XCN",
         .decimals = 18,
         .address = {.size = 20,
-                    .bytes = "\x38\x45\xba\xda\xde\x8e\x6d\xff\x04\x98\x20\x68"
-                             "\x0d\x1f\x14\xbd\x39\x03\xa5\xd0"},
+                    .bytes = "\xa2\xcd\x3d\x43\xc7\x75\x97\x8a\x96\xbd\xbf\x12"
+                             "\xd7\x33\xd5\xa1\xed\x94\xfb\x18"},
         .chain_id = 1,
         .name = "",
     },
     {
-        .symbol = "USDC",
-        .decimals = 6,
+        .symbol = "STETH",
+        .decimals = 18,
         .address = {.size = 20,
-                    .bytes = "\xa0\xb8\x69\x91\xc6\x21\x8b\x36\xc1\xd1\x9d\x4a"
-                             "\x2e\x9e\xb0\xce\x36\x06\xeb\x48"},
+                    .bytes = "\xae\x7a\xb9\x65\x20\xde\x3a\x18\xe5\xe1\x11\xb5"
+                             "\xea\xab\x09\x53\x12\xd7\xfe\x84"},
         .chain_id = 1,
         .name = "",
     },
     {
-        .symbol = "UNI",
+        .symbol = "AXS",
         .decimals = 18,
         .address = {.size = 20,
-                    .bytes = "\x1f\x98\x40\xa8\x5d\x5a\xf5\xbf\x1d\x17\x62\xf9"
-                             "\x25\xbd\xad\xdc\x42\x01\xf9\x84"},
+                    .bytes = "\xbb\x0e\x17\xef\x65\xf8\x2a\xb0\x18\xd8\xed\xd7"
+                             "\x76\xe8\xdd\x94\x03\x27\xb2\x8b"},
         .chain_id = 1,
         .name = "",
     },
     {
-        .symbol = "WBTC",
-        .decimals = 8,
+        .symbol = "USDT",
+        .decimals = 6,
         .address = {.size = 20,
-                    .bytes = "\x22\x60\xfa\xc5\xe5\x54\x2a\x77\x3a\xa4\x4f\xbc"
-                             "\xfe\xdf\x7c\x19\x3b\xc2\xc5\x99"},
+                    .bytes = "\xda\xc1\x7f\x95\x8d\x2e\xe5\x23\xa2\x20\x62\x06"
+                             "\x99\x45\x97\xc1\x3d\x83\x1e\xc7"},
         .chain_id = 1,
         .name = "",
     },
@@ -233,6 +233,15 @@ static const EthereumTokenInfo tokens[TOKENS_COUNT] = {
         .chain_id = 137,
         .name = "",
     },
+    {
+        .symbol = "WBTC",
+        .decimals = 8,
+        .address = {.size = 20,
+                    .bytes = "\x61\x19\xca\x49\xa7\x9f\x58\x25\xc8\xb3\x45\xf8"
+                             "\xd7\xac\x36\xb2\x72\x56\x5b\x14"},
+        .chain_id = 177,
+        .name = "Wrapped BTC",
+    },
     {
         .symbol = "WHSK",
         .decimals = 18,
@@ -261,47 +270,38 @@ static const EthereumTokenInfo tokens[TOKENS_COUNT] = {
         .name = "",
     },
     {
-        .symbol = "WBTC",
-        .decimals = 8,
-        .address = {.size = 20,
-                    .bytes = "\x61\x19\xca\x49\xa7\x9f\x58\x25\xc8\xb3\x45\xf8"
-                             "\xd7\xac\x36\xb2\x72\x56\x5b\x14"},
-        .chain_id = 177,
-        .name = "Wrapped BTC",
-    },
-    {
-        .symbol = "HLT",
-        .decimals = 2,
+        .symbol = "dUSDT",
+        .decimals = 6,
         .address = {.size = 20,
-                    .bytes = "\xE5\x2a\x73\x68\x28\xc7\x82\xC2\xa4\xA3\x45\xbB"
-                             "\xE8\x05\x2a\xed\x01\x0f\xc8\x2D"},
+                    .bytes = "\x36\xE6\x50\x4c\x96\x8f\x5C\x2A\x31\x0B\x6A\xF7"
+                             "\xB9\x7B\xC2\x2c\xdd\x34\x02\xcc"},
         .chain_id = 9798,
         .name = "",
     },
     {
-        .symbol = "BV",
-        .decimals = 2,
+        .symbol = "STC08375",
+        .decimals = 0,
         .address = {.size = 20,
-                    .bytes = "\x8E\x79\x85\x0C\x50\xE5\x25\xeB\x6B\xa6\x3e\x60"
-                             "\x1E\x7b\x41\x88\x8A\x1c\x91\x02"},
+                    .bytes = "\x6d\x88\x5b\x0B\x37\xC6\x2B\xe0\xc7\x2E\xcd\x6a"
+                             "\x61\xAf\x2b\xfF\xf6\x81\x41\x9e"},
         .chain_id = 9798,
         .name = "",
     },
     {
-        .symbol = "dUSDT",
-        .decimals = 6,
+        .symbol = "DOS",
+        .decimals = 2,
         .address = {.size = 20,
-                    .bytes = "\x36\xE6\x50\x4c\x96\x8f\x5C\x2A\x31\x0B\x6A\xF7"
-                             "\xB9\x7B\xC2\x2c\xdd\x34\x02\xcc"},
+                    .bytes = "\x74\x5C\x11\xFb\x47\x83\xBd\x00\xA8\x8a\x0B\x99"
+                             "\x42\x02\x62\xf4\x09\xFA\x8B\xb8"},
         .chain_id = 9798,
         .name = "",
     },
     {
-        .symbol = "dBTC",
-        .decimals = 8,
+        .symbol = "CNV",
+        .decimals = 2,
         .address = {.size = 20,
-                    .bytes = "\xE8\x95\xc5\x77\xD7\x47\xbB\x5d\xbB\xc1\xF0\x6c"
-                             "\xb4\x4d\x60\x67\x68\x0b\xE4\xbe"},
+                    .bytes = "\x89\x9f\x0B\x9d\x67\xDD\x1B\x83\x3f\xda\xa9\x0c"
+                             "\x8b\x09\xea\x61\x6d\x0e\x9E\x98"},
         .chain_id = 9798,
         .name = "",
     },
@@ -315,38 +315,38 @@ static const EthereumTokenInfo tokens[TOKENS_COUNT] = {
         .name = "",
     },
     {
-        .symbol = "DOS",
+        .symbol = "BV",
         .decimals = 2,
         .address = {.size = 20,
-                    .bytes = "\x74\x5C\x11\xFb\x47\x83\xBd\x00\xA8\x8a\x0B\x99"
-                             "\x42\x02\x62\xf4\x09\xFA\x8B\xb8"},
+                    .bytes = "\x8E\x79\x85\x0C\x50\xE5\x25\xeB\x6B\xa6\x3e\x60"
+                             "\x1E\x7b\x41\x88\x8A\x1c\x91\x02"},
         .chain_id = 9798,
         .name = "",
     },
     {
-        .symbol = "CNV",
-        .decimals = 2,
+        .symbol = "FEC",
+        .decimals = 4,
         .address = {.size = 20,
-                    .bytes = "\x89\x9f\x0B\x9d\x67\xDD\x1B\x83\x3f\xda\xa9\x0c"
-                             "\x8b\x09\xea\x61\x6d\x0e\x9E\x98"},
+                    .bytes = "\xb8\x8a\xd7\x67\xB4\x16\x19\x7e\x62\x93\x9d\xEc"
+                             "\x20\x74\x31\xb5\x61\xA9\x38\x3B"},
         .chain_id = 9798,
         .name = "",
     },
     {
-        .symbol = "FEC",
-        .decimals = 4,
+        .symbol = "HLT",
+        .decimals = 2,
         .address = {.size = 20,
-                    .bytes = "\xb8\x8a\xd7\x67\xB4\x16\x19\x7e\x62\x93\x9d\xEc"
-                             "\x20\x74\x31\xb5\x61\xA9\x38\x3B"},
+                    .bytes = "\xE5\x2a\x73\x68\x28\xc7\x82\xC2\xa4\xA3\x45\xbB"
+                             "\xE8\x05\x2a\xed\x01\x0f\xc8\x2D"},
         .chain_id = 9798,
         .name = "",
     },
     {
-        .symbol = "STC08375",
-        .decimals = 0,
+        .symbol = "dBTC",
+        .decimals = 8,
         .address = {.size = 20,
-                    .bytes = "\x6d\x88\x5b\x0B\x37\xC6\x2B\xe0\xc7\x2E\xcd\x6a"
-                             "\x61\xAf\x2b\xfF\xf6\x81\x41\x9e"},
+                    .bytes = "\xE8\x95\xc5\x77\xD7\x47\xbB\x5d\xbB\xc1\xF0\x6c"
+                             "\xb4\x4d\x60\x67\x68\x0b\xE4\xbe"},
         .chain_id = 9798,
         .name = "",
     },
@@ -365,16 +365,27 @@ const EthereumTokenInfo UNKNOWN_TOKEN = {
     .name = "",
 };
 
+// tokens[] is sorted by chain_id, then by address
 const EthereumTokenInfo *ethereum_token_by_address(uint64_t chain_id,
                                                    const uint8_t *address) {
   if (!address) return 0;
-  for (int i = 0; i < TOKENS_COUNT; i++) {
-    if (chain_id == tokens[i].chain_id &&
-        memcmp(address, tokens[i].address.bytes,
-               sizeof(tokens[i].address.bytes)) == 0) {
-      return &(tokens[i]);
+  int lo = 0, hi = TOKENS_COUNT;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (tokens[mid].chain_id < chain_id ||
+        (tokens[mid].chain_id == chain_id &&
+         memcmp(tokens[mid].address.bytes, address,
+                sizeof(tokens[mid].address.bytes)) < 0)) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
   }
+  if (lo < TOKENS_COUNT && chain_id == tokens[lo].chain_id &&
+      memcmp(address, tokens[lo].address.bytes,
+             sizeof(tokens[lo].address.bytes)) == 0) {
+    return &(tokens[lo]);
+  }
   return &UNKNOWN_TOKEN;
 }
 
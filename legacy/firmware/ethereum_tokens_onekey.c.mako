@@ -5,7 +5,7 @@
 #include "ethereum_tokens_onekey.h"
 
 const TokenType tokens[TOKENS_COUNT] = {
-% for t in sorted(erc20, key=lambda t: t.chain_id):
+% for t in sorted(erc20, key=lambda t: (t.chain_id, t.address_bytes)):
 	{${"{:>2}".format(t.chain_id)}, ${c_str(t.address_bytes)}, " ${ascii(t.symbol)}", ${t.decimals}}, // ${t.chain} / ${t.name}
 % endfor
 };
@@ -13,13 +13,22 @@ const TokenType tokens[TOKENS_COUNT] = {
 static const TokenType _UnknownToken = { 0, "\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff\xff", " UNKN", 0 };
 const TokenType *UnknownToken = &_UnknownToken;
 
+// tokens[] is sorted by chain_id, then by address
 const TokenType *tokenByChainAddress(uint64_t chain_id, const uint8_t *address)
 {
 	if (!address) return 0;
-	for (int i = 0; i < TOKENS_COUNT; i++) {
-		if (chain_id == tokens[i].chain_id && memcmp(address, tokens[i].address, 20) == 0) {
-			return &(tokens[i]);
+	int lo = 0, hi = TOKENS_COUNT;
+	while (lo < hi) {
+		int mid = (lo + hi) / 2;
+		if (tokens[mid].chain_id < chain_id ||
+		    (tokens[mid].chain_id == chain_id && memcmp(tokens[mid].address, address, 20) < 0)) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
 		}
 	}
+	if (lo < TOKENS_COUNT && chain_id == tokens[lo].chain_id && memcmp(address, tokens[lo].address, 20) == 0) {
+		return &(tokens[lo]);
+	}
 	return UnknownToken;
 }
@@ -71,6 +71,9 @@ static uint32_t u2f_out_start = 0;
 
 uint32_t u2f_out_end = 0;
 uint8_t u2f_out_packets[U2F_OUT_PKT_BUFFER_LEN][HID_RPT_SIZE];
+// Frames handed out ahead of older frames of another channel
+static bool u2f_out_taken[U2F_OUT_PKT_BUFFER_LEN];
+static uint32_t u2f_out_last_cid = 0;
 
 #define U2F_PUBKEY_LEN 65
 #define KEY_PATH_LEN 32
@@ -135,11 +138,12 @@ static DIALOG_MANAGER dialog_manager = {
     .dialog_timer_start = 0, .is_busy = false, .last_req_state = INIT};
 
 uint32_t next_cid(void) {
+  uint32_t new_cid = 0;
   // extremely unlikely but hey
   do {
-    cid = random32();
-  } while (cid == 0 || cid == CID_BROADCAST);
-  return cid;
+    new_cid = random32();
+  } while (new_cid == 0 || new_cid == CID_BROADCAST || new_cid == cid);
+  return new_cid;
 }
 
 // https://fidoalliance.org/specs/fido-u2f-v1.2-ps-20170411/fido-u2f-hid-protocol-v1.2-ps-20170411.html#message--and-packet-structure
@@ -157,6 +161,121 @@ typedef struct {
 
 U2F_ReadBuffer *reader;
 
+// Channels other than `cid` with a PING coming in while the device is busy.
+// The payload is not kept, each frame is echoed as it arrives.
+#define CTAPHID_CHANNELS 4
+typedef struct {
+  uint32_t cid;
+  uint32_t timer_start;  // of the last frame
+  uint16_t len;
+  uint16_t received;
+  uint8_t seq;
+} CTAPHID_CHANNEL;
+
+static CTAPHID_CHANNEL channels[CTAPHID_CHANNELS];
+
+static CTAPHID_CHANNEL *channel_find(uint32_t fcid) {
+  for (int i = 0; i < CTAPHID_CHANNELS; i++) {
+    if (channels[i].cid == fcid && fcid != 0) {
+      return &channels[i];
+    }
+  }
+  return NULL;
+}
+
+static CTAPHID_CHANNEL *channel_claim(uint32_t fcid) {
+  for (int i = 0; i < CTAPHID_CHANNELS; i++) {
+    if (channels[i].cid == 0) {
+      channels[i].cid = fcid;
+      return &channels[i];
+    }
+  }
+  return NULL;
+}
+
+static void channel_release(CTAPHID_CHANNEL *channel) {
+  if (channel != NULL) {
+    memzero(channel, sizeof(CTAPHID_CHANNEL));
+  }
+}
+
+static void channels_expire(void) {
+  for (int i = 0; i < CTAPHID_CHANNELS; i++) {
+    if (channels[i].cid != 0 &&
+        timer_ms() - channels[i].timer_start > CTAP_HID_TIMEOUT) {
+      send_u2fhid_error(channels[i].cid, ERR_MSG_TIMEOUT);
+      channel_release(&channels[i]);
+    }
+  }
+}
+
+// A frame for another channel than the one being served. PING and WINK need
+// nothing but the channel's slot and are answered at once, other commands
+// have to wait until the current transaction is done.
+static void u2fhid_read_other(const U2FHID_FRAME *f) {
+  CTAPHID_CHANNEL *channel = channel_find(f->cid);
+
+  if (!(f->type & TYPE_INIT)) {
+    // ignore continuations of messages that were refused or never started
+    if (channel == NULL) {
+      return;
+    }
+    if (f->cont.seq != channel->seq) {
+      send_u2fhid_error(f->cid, ERR_INVALID_SEQ);
+      channel_release(channel);
+      return;
+    }
+    queue_u2f_pkt(f);
+    channel->seq++;
+    channel->received += sizeof(f->cont.data);
+    channel->timer_start = timer_ms();
+    if (channel->received >= channel->len) {
+      channel_release(channel);
+    }
+    return;
+  }
+
+  // Broadcast is reserved for init
+  if (f->cid == CID_BROADCAST || f->cid == 0) {
+    send_u2fhid_error(f->cid, ERR_INVALID_CID);
+    return;
+  }
+  // a new message drops the one that was coming in
+  channel_release(channel);
+
+  switch (f->type) {
+    case U2FHID_PING:
+      if ((unsigned)MSG_LEN(*f) > U2F_MAXIMUM_PAYLOAD_LENGTH) {
+        send_u2fhid_error(f->cid, ERR_INVALID_LEN);
+        return;
+      }
+      if ((unsigned)MSG_LEN(*f) > sizeof(f->init.data)) {
+        channel = channel_claim(f->cid);
+        if (channel == NULL) {
+          send_u2fhid_error(f->cid, ERR_CHANNEL_BUSY);
+          return;
+        }
+        channel->len = MSG_LEN(*f);
+        channel->received = sizeof(f->init.data);
+        channel->seq = 0;
+        channel->timer_start = timer_ms();
+      }
+      // the response is the request, so echo the frames as they come
+      queue_u2f_pkt(f);
+      break;
+    case U2FHID_WINK:
+      if (MSG_LEN(*f) != 0) {
+        send_u2fhid_error(f->cid, ERR_INVALID_LEN);
+        return;
+      }
+      queue_u2f_pkt(f);
+      break;
+    default:
+      send_u2fhid_error(f->cid, ERR_CHANNEL_BUSY);
+      break;
+  }
+}
+
 bool dialog_is_busy(void) {
   // if (dialog_manager.is_busy) {
   //   if (timer_ms() - dialog_manager.dialog_timer_start >
@@ -184,6 +303,7 @@ void u2fhid_read(char tiny, const U2FHID_FRAME *f) {
   if (f->init.cmd == U2FHID_INIT) {
     u2f_init_command = true;
     u2fhid_init(f);
+    channel_release(channel_find(f->cid));
     if (usb_hid_tiny && reader && f->cid == cid) {
       // abort current channel
       reader->cmd = 0;
@@ -193,10 +313,22 @@ void u2fhid_read(char tiny, const U2FHID_FRAME *f) {
     return;
   }
 
+  channels_expire();
+
+  CTAPHID_CHANNEL *channel = channel_find(f->cid);
+  if (channel != NULL) {
+    if (!(f->type & TYPE_INIT)) {
+      // the rest of a PING that came in while busy
+      u2fhid_read_other(f);
+      return;
+    }
+    channel_release(channel);
+  }
+
   if (usb_hid_tiny || dialog_is_busy()) {
     // read continue packet
     if (reader == 0 || cid != f->cid) {
-      send_u2fhid_error(f->cid, ERR_CHANNEL_BUSY);
+      u2fhid_read_other(f);
       return;
     }
 
@@ -276,6 +408,7 @@ void u2fhid_read_start(const U2FHID_FRAME *f) {
           return;
         }
         usbPoll();
+        channels_expire();
       }
     }
 
@@ -330,6 +463,7 @@ void u2fhid_read_start(const U2FHID_FRAME *f) {
         break;
       }
       usbPoll();  // may trigger new request
+      channels_expire();
       buttonUpdate();
       if (button.YesUp && (dialog_manager.last_req_state == AUTH ||
                            dialog_manager.last_req_state == REG)) {
@@ -434,17 +568,41 @@ void queue_u2f_pkt(const U2FHID_FRAME *u2f_pkt) {
   uint32_t next = (u2f_out_end + 1) % U2F_OUT_PKT_BUFFER_LEN;
   if (u2f_out_start == next) {
     debugLog(0, "", "u2f_write_pkt full");
-    return;  // Buffer full :(
+    // make room rather than lose a frame in the middle of a message
+    usb_u2f_data_send();
   }
   memcpy(u2f_out_packets[u2f_out_end], u2f_pkt, HID_RPT_SIZE);
+  u2f_out_taken[u2f_out_end] = false;
   u2f_out_end = next;
 }
 
+static uint32_t u2f_out_cid(uint32_t index) {
+  return ((const U2FHID_FRAME *)(const void *)u2f_out_packets[index])->cid;
+}
+
+// Channels take turns: the next frame is the oldest one of a channel other
+// than the last one sent, if any. The frames of a channel keep their order,
+// and an error or keepalive is not held up by a long response elsewhere.
 uint8_t *u2f_out_data(void) {
+  while (u2f_out_start != u2f_out_end && u2f_out_taken[u2f_out_start]) {
+    u2f_out_start = (u2f_out_start + 1) % U2F_OUT_PKT_BUFFER_LEN;
+  }
   if (u2f_out_start == u2f_out_end) return NULL;  // No data
   // debugLog(0, "", "u2f_out_data");
   uint32_t t = u2f_out_start;
-  u2f_out_start = (u2f_out_start + 1) % U2F_OUT_PKT_BUFFER_LEN;
+  for (uint32_t i = u2f_out_start; i != u2f_out_end;
+       i = (i + 1) % U2F_OUT_PKT_BUFFER_LEN) {
+    if (!u2f_out_taken[i] && u2f_out_cid(i) != u2f_out_last_cid) {
+      t = i;
+      break;
+    }
+  }
+  u2f_out_last_cid = u2f_out_cid(t);
+  if (t == u2f_out_start) {
+    u2f_out_start = (u2f_out_start + 1) % U2F_OUT_PKT_BUFFER_LEN;
+  } else {
+    u2f_out_taken[t] = true;
+  }
   return u2f_out_packets[t];
 }
 
@@ -1074,6 +1232,8 @@ void u2f_authenticate(const APDU *a) {
       send_u2f_error(U2F_SW_WRONG_DATA);
       return;
     }
+    // the SE counted this one past the block handed out for FIDO2
+    config_dropU2FCounterBlock();
 
 #endif
     // Copy DER encoded signature into response
@@ -1125,6 +1285,7 @@ void ctap_hid_keepalive_status(void) {
   if (transport_type == TRANSPORT_BLE) {
     ctap_ble_u2f_send(U2FHID_KEEPALIVE, &status, 1);
   } else {
+    channels_expire();
     send_u2fhid_msg(CTAPHID_KEEPALIVE, &status, 1);
   }
 }
@@ -1138,21 +1299,13 @@ void ctap_hid_keepalive_process(void) {
   }
 }
 
+// Sent from the loops waiting for the user rather than from the timer
+// interrupt, which would write to the output queue under the main loop.
 void ctap_hid_keepalive_register(void) {
-  if (transport_type == TRANSPORT_BLE) {
-    register_loop_callback(ctap_hid_keepalive_status, timer_ms(), timer1s / 12);
-  } else {
-    register_timer("ctap_keepalive", timer1s / 12, ctap_hid_keepalive_status);
-  }
+  register_loop_callback(ctap_hid_keepalive_status, timer_ms(), timer1s / 12);
 }
 
-void ctap_hid_keepalive_unregister(void) {
-  if (transport_type == TRANSPORT_BLE) {
-    unregister_loop_callback();
-  } else {
-    unregister_timer("ctap_keepalive");
-  }
-}
+void ctap_hid_keepalive_unregister(void) { unregister_loop_callback(); }
 
 uint8_t ctap_check_device_status(void) {
   uint8_t status = CTAP1_ERR_SUCCESS;
@@ -1603,6 +1756,8 @@ void u2f_authenticate_ble(const APDU *a) {
     send_u2f_error(U2F_SW_WRONG_DATA);
     return;
   }
+  // the SE counted this one past the block handed out for FIDO2
+  config_dropU2FCounterBlock();
 
 #endif
   // Copy DER encoded signature into response
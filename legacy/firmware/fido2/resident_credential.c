@@ -4,84 +4,174 @@
 #include "gettext.h"
 #include "layout2.h"
 #include "se_chip.h"
+#include "sha2.h"
+
+#define DIRECTORY_RP_ID_HASH_LEN 8
+#define DIRECTORY_USER_ID_HASH_LEN 4
+
+// State of a slot in the directory
+#define SLOT_EMPTY 0
+#define SLOT_UNREADABLE 1
+#define SLOT_USED 2
+#define SLOT_USED_USER 3  // user_id_hash is known
+
+// What the SE holds in each slot, so that a lookup only reads the slots
+// whose rpIdHash prefix matches. Filled on first use, kept up to date by
+// the writes made here and dropped when the SE storage is reset.
+typedef struct {
+  uint8_t rp_id_hash[DIRECTORY_RP_ID_HASH_LEN];
+  uint8_t user_id_hash[DIRECTORY_USER_ID_HASH_LEN];
+  uint8_t state;
+} directory_entry;
+
+static directory_entry directory[FIDO2_RESIDENT_CREDENTIALS_COUNT];
+static bool directory_loaded = false;
+
+static void hash_user_id(const uint8_t *user_id, uint32_t user_id_len,
+                         uint8_t hash[DIRECTORY_USER_ID_HASH_LEN]) {
+  uint8_t digest[SHA256_DIGEST_LENGTH] = {0};
+  sha256_Raw(user_id, user_id_len, digest);
+  memcpy(hash, digest, DIRECTORY_USER_ID_HASH_LEN);
+}
 
-uint32_t resident_credential_get_count(void) { return 0; }
+static void refresh_slot(uint32_t index) {
+  directory_entry *entry = &directory[index];
+  uint8_t rp_id_hash[RP_ID_HASH_LENGTH] = {0};
+  int status = se_get_fido2_resident_credential_rp_id_hash(index, rp_id_hash);
+  memset(entry, 0, sizeof(directory_entry));
+  if (status == SE_FIDO2_SLOT_DATA_OK) {
+    memcpy(entry->rp_id_hash, rp_id_hash, DIRECTORY_RP_ID_HASH_LEN);
+    entry->state = SLOT_USED;
+  } else if (status == SE_FIDO2_SLOT_DATA_NULL) {
+    entry->state = SLOT_EMPTY;
+  } else {
+    entry->state = SLOT_UNREADABLE;
+  }
+}
 
-uint32_t resident_credential_find_by_rp_id_hash(
-    const uint8_t *rp_id_hash, CTAP_credentialDescriptor *cred_desc,
-    uint32_t max_count) {
+// progress_ratio: 0-100, the share of the progress bar the scan takes
+static void directory_load(int progress_ratio) {
+  UI_WAIT_CALLBACK ui_callback = se_get_ui_callback();
+
+  for (uint32_t i = 0; i < FIDO2_RESIDENT_CREDENTIALS_COUNT; i++) {
+    if (directory_loaded && directory[i].state != SLOT_UNREADABLE) {
+      continue;
+    }
+    if (!directory_loaded) {
+      ui_callback(_(C__PROCESSING_ETC),
+                  (i + 1) * 1000 / FIDO2_RESIDENT_CREDENTIALS_COUNT *
+                      progress_ratio / 100);
+    }
+    refresh_slot(i);
+  }
+  directory_loaded = true;
+}
+
+static bool directory_rp_matches(uint32_t index, const uint8_t *rp_id_hash) {
+  return directory[index].state >= SLOT_USED &&
+         memcmp(directory[index].rp_id_hash, rp_id_hash,
+                DIRECTORY_RP_ID_HASH_LEN) == 0;
+}
+
+static void directory_set_user(uint32_t index, const CTAP_userEntity *user) {
+  hash_user_id(user->id, user->id_size, directory[index].user_id_hash);
+  directory[index].state = SLOT_USED_USER;
+}
+
+// Reads slot `index` into cred_desc if it holds a credential for
+// rp_id_hash, and authenticates it.
+static bool load_credential(uint32_t index, const uint8_t *rp_id_hash,
+                            CTAP_credentialDescriptor *cred_desc) {
   CTAP_credential_id_storage cred_id_storage = {0};
   uint16_t len =
       sizeof(cred_id_storage) - FIDO2_RESIDENT_CREDENTIALS_HEADER_LEN;
+  int status = se_get_fido2_resident_credentials(
+      index, cred_id_storage.rp_id_hash, &len);
+  if (status != SE_FIDO2_SLOT_DATA_OK) {
+    if (status == SE_FIDO2_SLOT_DATA_NULL) {
+      directory[index].state = SLOT_EMPTY;
+    }
+    return false;
+  }
+  ctap_printf("get resident credential %d\n", index);
+  dump_hex1(NULL, cred_id_storage.rp_id_hash, len);
+  if (memcmp(cred_id_storage.rp_id_hash, rp_id_hash, RP_ID_HASH_LENGTH) != 0) {
+    return false;
+  }
+  cred_desc->type = PUB_KEY_CRED_PUB_KEY;
+  cred_desc->cred_id_len = len - RP_ID_HASH_LENGTH;
+  memcpy(cred_desc->cred_id, cred_id_storage.credential_id,
+         cred_desc->cred_id_len);
+  if (ctap_authenticate_credential_data(rp_id_hash, cred_desc)) {
+    directory_set_user(index, &cred_desc->credential.user);
+  }
+  return true;
+}
+
+void resident_credential_invalidate(void) { directory_loaded = false; }
+
+uint32_t resident_credential_get_count(void) {
   uint32_t count = 0;
+  directory_load(100);
+  for (uint32_t i = 0; i < FIDO2_RESIDENT_CREDENTIALS_COUNT; i++) {
+    if (directory[i].state >= SLOT_USED) {
+      count++;
+    }
+  }
+  return count;
+}
 
-  UI_WAIT_CALLBACK ui_callback = se_get_ui_callback();
-  uint8_t percent = 0;
+uint32_t resident_credential_find_by_rp_id_hash(
+    const uint8_t *rp_id_hash, CTAP_credentialDescriptor *cred_desc,
+    uint32_t max_count) {
+  uint32_t count = 0;
 
+  directory_load(100);
   for (uint32_t i = 0;
        i < FIDO2_RESIDENT_CREDENTIALS_COUNT && count < max_count; i++) {
-    percent = (i + 1) * 100 / FIDO2_RESIDENT_CREDENTIALS_COUNT;
-    ui_callback(_(C__PROCESSING_ETC), percent * 10);
-    len = sizeof(cred_id_storage) - FIDO2_RESIDENT_CREDENTIALS_HEADER_LEN;
-    if (se_get_fido2_resident_credentials(i, cred_id_storage.rp_id_hash,
-                                          &len) == SE_FIDO2_SLOT_DATA_OK) {
-      ctap_printf("get resident credential %d\n", i);
-      dump_hex1(NULL, cred_id_storage.rp_id_hash, len);
-      if (memcmp(cred_id_storage.rp_id_hash, rp_id_hash, RP_ID_HASH_LENGTH) ==
-          0) {
-        ctap_printf("find same rp id hash\n");
-        memcpy(cred_desc[count].cred_id, cred_id_storage.credential_id,
-               len - RP_ID_HASH_LENGTH);
-        cred_desc[count].cred_id_len = len - RP_ID_HASH_LENGTH;
-        cred_desc[count].type = PUB_KEY_CRED_PUB_KEY;
-        ctap_authenticate_credential_data(rp_id_hash, &cred_desc[count]);
-        count++;
-      }
+    if (!directory_rp_matches(i, rp_id_hash)) {
+      continue;
+    }
+    if (load_credential(i, rp_id_hash, &cred_desc[count])) {
+      ctap_printf("find same rp id hash\n");
+      count++;
     }
   }
   return count;
 }
 
 bool resident_credential_store(const uint8_t *rp_id_hash,
-                               const uint8_t *user_id, const uint8_t *cred_id,
-                               uint32_t cred_id_len) {
+                               const uint8_t *user_id, uint32_t user_id_len,
+                               const uint8_t *cred_id, uint32_t cred_id_len) {
   CTAP_credentialDescriptor cred_id_desc = {0};
   CTAP_credential_id_storage cred_id_storage = {0};
-  uint16_t len =
-      sizeof(cred_id_storage) - FIDO2_RESIDENT_CREDENTIALS_HEADER_LEN;
-
+  uint8_t user_id_hash[DIRECTORY_USER_ID_HASH_LEN] = {0};
   int slot = -1;
-  uint8_t status;
-
-  UI_WAIT_CALLBACK ui_callback = se_get_ui_callback();
-  uint8_t percent = 0;
 
+  hash_user_id(user_id, user_id_len, user_id_hash);
+  directory_load(100);
   for (uint32_t i = 0; i < FIDO2_RESIDENT_CREDENTIALS_COUNT; i++) {
-    percent = (i + 1) * 100 / FIDO2_RESIDENT_CREDENTIALS_COUNT;
-    ui_callback(_(C__PROCESSING_ETC), percent * 10);
-    len = sizeof(cred_id_storage) - FIDO2_RESIDENT_CREDENTIALS_HEADER_LEN;
-    status =
-        se_get_fido2_resident_credentials(i, cred_id_storage.rp_id_hash, &len);
-    if (status == SE_FIDO2_SLOT_DATA_NULL) {
+    if (directory[i].state == SLOT_EMPTY) {
       if (slot == -1) {
         slot = i;
       }
       continue;
-    } else if (status == SE_FIDO2_SLOT_DATA_OK) {
-      if (memcmp(cred_id_storage.rp_id_hash, rp_id_hash, RP_ID_HASH_LENGTH) ==
-          0) {
-        cred_id_desc.type = PUB_KEY_CRED_PUB_KEY;
-        cred_id_desc.cred_id_len = len - RP_ID_HASH_LENGTH;
-        memcpy(cred_id_desc.cred_id, cred_id_storage.credential_id,
-               len - RP_ID_HASH_LENGTH);
-        ctap_authenticate_credential_data(rp_id_hash, &cred_id_desc);
-        if (memcmp(cred_id_desc.credential.user.id, user_id,
-                   cred_id_desc.credential.user.id_size) == 0) {
-          ctap_printf("find same user id, override\n");
-          slot = i;
-          break;
-        }
-      }
+    }
+    if (!directory_rp_matches(i, rp_id_hash)) {
+      continue;
+    }
+    if (directory[i].state == SLOT_USED_USER &&
+        memcmp(directory[i].user_id_hash, user_id_hash,
+               DIRECTORY_USER_ID_HASH_LEN) != 0) {
+      continue;
+    }
+    memset(&cred_id_desc, 0, sizeof(cred_id_desc));
+    if (load_credential(i, rp_id_hash, &cred_id_desc) &&
+        cred_id_desc.credential.user.id_size == user_id_len &&
+        memcmp(cred_id_desc.credential.user.id, user_id, user_id_len) == 0) {
+      ctap_printf("find same user id, override\n");
+      slot = i;
+      break;
     }
   }
   layoutHome();
@@ -94,8 +184,14 @@ bool resident_credential_store(const uint8_t *rp_id_hash,
   dump_hex1(NULL, cred_id_storage.rp_id_hash, RP_ID_HASH_LENGTH + cred_id_len);
   if (!se_set_fido2_resident_credentials(slot, cred_id_storage.rp_id_hash,
                                          cred_id_len + RP_ID_HASH_LENGTH)) {
+    // the slot may have been partly written
+    refresh_slot(slot);
     return false;
   }
+  memcpy(directory[slot].rp_id_hash, rp_id_hash, DIRECTORY_RP_ID_HASH_LEN);
+  memcpy(directory[slot].user_id_hash, user_id_hash,
+         DIRECTORY_USER_ID_HASH_LEN);
+  directory[slot].state = SLOT_USED_USER;
   ctap_printf("store credential to slot %d success\n", slot);
   return true;
 }
@@ -103,20 +199,12 @@ bool resident_credential_store(const uint8_t *rp_id_hash,
 // progress_ratio: 0-100
 int resident_credential_info(uint8_t indexs[FIDO2_RESIDENT_CREDENTIALS_COUNT],
                              int progress_ratio) {
-  uint8_t status;
-
-  UI_WAIT_CALLBACK ui_callback = se_get_ui_callback();
-  uint8_t percent = 0;
-
   uint8_t count = 0;
 
+  check_se_fido_seed(NULL);
+  directory_load(progress_ratio);
   for (uint32_t i = 0; i < FIDO2_RESIDENT_CREDENTIALS_COUNT; i++) {
-    percent = ((i + 1) * 100 / FIDO2_RESIDENT_CREDENTIALS_COUNT) *
-              progress_ratio / 100;
-    ui_callback(_(C__PROCESSING_ETC), percent);
-    status = se_check_fido2_resident_credential_simple(i);
-    if (status == SE_FIDO2_SLOT_DATA_NULL) {
-    } else if (status == SE_FIDO2_SLOT_DATA_OK) {
+    if (directory[i].state >= SLOT_USED) {
       indexs[count] = i;
       count++;
     }
@@ -147,5 +235,13 @@ int resident_credential_get_desc(uint8_t index,
 }
 
 bool resident_credential_delete(uint8_t index) {
-  return se_delete_fido2_resident_credentials(index);
+  if (index >= FIDO2_RESIDENT_CREDENTIALS_COUNT) {
+    return false;
+  }
+  if (!se_delete_fido2_resident_credentials(index)) {
+    refresh_slot(index);
+    return false;
+  }
+  directory[index].state = SLOT_EMPTY;
+  return true;
 }
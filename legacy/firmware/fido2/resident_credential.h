@@ -24,12 +24,14 @@ _Static_assert(sizeof(CTAP_credential_id_storage) ==
                    FIDO2_RESIDENT_CREDENTIALS_SIZE,
                "CTAP_credential_id_storage size must be flash page size");
 
+void resident_credential_invalidate(void);
+uint32_t resident_credential_get_count(void);
 uint32_t resident_credential_find_by_rp_id_hash(
     const uint8_t *rp_id_hash, CTAP_credentialDescriptor *cred_desc,
     uint32_t max_count);
 bool resident_credential_store(const uint8_t *rp_id_hash,
-                               const uint8_t *user_id, const uint8_t *cred_id,
-                               uint32_t cred_id_len);
+                               const uint8_t *user_id, uint32_t user_id_len,
+                               const uint8_t *cred_id, uint32_t cred_id_len);
 int resident_credential_info(uint8_t indexs[FIDO2_RESIDENT_CREDENTIALS_COUNT],
                              int progress_ratio);
 int resident_credential_get_desc(uint8_t index,
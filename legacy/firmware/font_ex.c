@@ -176,6 +176,8 @@ uint8_t *font_get_data(const uint8_t *ch, uint8_t *width) {
     font_data_read(buff, font_info.offset, line_bytes * font_header.height);
     *width = font_info.width;
   } else {
+    // unknown glyph, leave a blank gap instead of the last glyph read
+    memset(buff, 0, sizeof(buff));
     *width = 5;
   }
 
@@ -42,6 +42,7 @@
 #include "layout2.h"
 #include "memory.h"
 #include "memzero.h"
+#include "message_signer.h"
 #include "messages.h"
 #include "messages.pb.h"
 #include "oled.h"
@@ -76,6 +77,7 @@
 #include "cosmos.h"
 #include "ethereum.h"
 #include "ethereum_definitions.h"
+#include "ethereum_eip712.h"
 #include "ethereum_networks.h"
 #include "ethereum_onekey.h"
 #include "filecoin.h"
@@ -99,7 +101,7 @@
 #include "tron.h"
 #endif
 #include "bip322_simple/bip322_simple.h"
-#include "psbt/psbt.h"
+#include "psbt/psbt_signing.h"
 #if EMULATOR
 #include <stdio.h>
 #endif
@@ -361,6 +363,137 @@ HDNode *fsm_getDerivedNode(const char *curve, const uint32_t *address_n,
   return &node;
 }
 
+// Public part of the nodes derived in this session, so that read-only
+// requests for a path seen before skip the derivation. Nothing here can
+// sign: on the device signing uses the key the SE derived last.
+#define NODE_CACHE_SIZE 8
+#define NODE_CACHE_MAX_PATH 8
+typedef struct {
+  const curve_info *curve;
+  uint32_t address_n[NODE_CACHE_MAX_PATH];
+  size_t address_n_count;
+  uint32_t fingerprint;
+  uint32_t depth;
+  uint32_t child_num;
+  uint8_t chain_code[32];
+  uint8_t public_key[33];
+  uint32_t last_use;  // 0 if the entry is empty
+} NodeCacheEntry;
+
+static NodeCacheEntry node_cache[NODE_CACHE_SIZE];
+static uint32_t node_cache_use_counter = 0;
+#if EMULATOR && DEBUG_LOG
+// SE derivations a device would have made and skipped for the requests seen,
+// printed when the cache is cleared
+static uint32_t node_cache_hits = 0;
+static uint32_t node_cache_misses = 0;
+#endif
+
+void fsm_clearNodeCache(void) {
+#if EMULATOR && DEBUG_LOG
+  if (node_cache_hits + node_cache_misses > 0) {
+    printf("Node cache: %u SE derivations avoided, %u made\n",
+           (unsigned)node_cache_hits, (unsigned)node_cache_misses);
+  }
+  node_cache_hits = 0;
+  node_cache_misses = 0;
+#endif
+  memzero(node_cache, sizeof(node_cache));
+  node_cache_use_counter = 0;
+}
+
+static NodeCacheEntry *node_cache_find(const curve_info *curve,
+                                       const uint32_t *address_n,
+                                       size_t address_n_count) {
+  for (int i = 0; i < NODE_CACHE_SIZE; i++) {
+    NodeCacheEntry *entry = &node_cache[i];
+    if (entry->last_use != 0 && entry->curve == curve &&
+        entry->address_n_count == address_n_count &&
+        memcmp(entry->address_n, address_n,
+               address_n_count * sizeof(uint32_t)) == 0) {
+      return entry;
+    }
+  }
+  return NULL;
+}
+
+static void node_cache_put(const curve_info *curve, const uint32_t *address_n,
+                           size_t address_n_count, const HDNode *node,
+                           uint32_t fingerprint) {
+  NodeCacheEntry *entry = &node_cache[0];
+  for (int i = 1; i < NODE_CACHE_SIZE; i++) {
+    if (node_cache[i].last_use < entry->last_use) {
+      entry = &node_cache[i];
+    }
+  }
+  entry->curve = curve;
+  memcpy(entry->address_n, address_n, address_n_count * sizeof(uint32_t));
+  entry->address_n_count = address_n_count;
+  entry->fingerprint = fingerprint;
+  entry->depth = node->depth;
+  entry->child_num = node->child_num;
+  memcpy(entry->chain_code, node->chain_code, sizeof(entry->chain_code));
+  memcpy(entry->public_key, node->public_key, sizeof(entry->public_key));
+  entry->last_use = ++node_cache_use_counter;
+}
+
+// Like fsm_getDerivedNode, for requests that only need the public key and
+// chain code. The node has no private key.
+static HDNode *fsm_getDerivedPublicNode(const char *curve,
+                                        const uint32_t *address_n,
+                                        size_t address_n_count,
+                                        uint32_t *fingerprint) {
+  static HDNode public_node;
+  const curve_info *info = get_curve_by_name(curve);
+  NodeCacheEntry *entry = NULL;
+  if (info != NULL && address_n_count <= NODE_CACHE_MAX_PATH) {
+    // starting the session seed clears the cache, so settle it first
+#if EMULATOR
+    bool ready = config_getRootNode(&public_node, curve);
+    memzero(&public_node, sizeof(public_node));
+#else
+    // asks for the passphrase if the session has no seed yet
+    bool ready = config_genSessionSeed();
+#endif
+    if (!ready) {
+      layoutHome();
+      return 0;
+    }
+    entry = node_cache_find(info, address_n, address_n_count);
+  }
+  if (entry == NULL) {
+    HDNode *node =
+        fsm_getDerivedNode(curve, address_n, address_n_count, fingerprint);
+    if (!node) return 0;
+#if EMULATOR && DEBUG_LOG
+    node_cache_misses++;
+#endif
+    if (info != NULL && address_n_count <= NODE_CACHE_MAX_PATH &&
+        hdnode_fill_public_key(node) == 0 && node->public_key[0] != 0) {
+      node_cache_put(info, address_n, address_n_count, node,
+                     fingerprint ? *fingerprint : 0);
+    }
+    return node;
+  }
+
+#if EMULATOR && DEBUG_LOG
+  node_cache_hits++;
+#endif
+  memzero(&public_node, sizeof(public_node));
+  public_node.curve = info;
+  public_node.depth = entry->depth;
+  public_node.child_num = entry->child_num;
+  memcpy(public_node.chain_code, entry->chain_code,
+         sizeof(public_node.chain_code));
+  memcpy(public_node.public_key, entry->public_key,
+         sizeof(public_node.public_key));
+  if (fingerprint) {
+    *fingerprint = entry->fingerprint;
+  }
+  entry->last_use = ++node_cache_use_counter;
+  return &public_node;
+}
+
 static bool fsm_getSlip21Key(const char *path[], size_t path_count,
                              uint8_t key[32]) {
 #if EMULATOR
@@ -618,11 +751,31 @@ void fsm_msgRebootToBootloader(void) {
 void fsm_abortWorkflows(void) {
   recovery_abort();
   signing_abort();
+  psbt_signing_abort();
+  message_signer_abort();
   authorization_type = 0;
   unlock_path = 0;
 #if !BITCOIN_ONLY
   ethereum_signing_abort();
+  ethereum_typed_data_abort();
   stellar_signingAbort();
+  solana_signing_abort();
+  aptos_signing_abort();
+#endif
+}
+
+void fsm_preMsgProcess(MessageType message_type) {
+#if !BITCOIN_ONLY
+  // The SE holds the nonce of a streamed Ed25519 signature across messages,
+  // nothing may come between the chunks of the transaction.
+  if (message_type != MessageType_MessageType_SolanaTxAck) {
+    solana_signing_abort();
+  }
+  if (message_type != MessageType_MessageType_AptosTxAck) {
+    aptos_signing_abort();
+  }
+#else
+  (void)message_type;
 #endif
 }
 
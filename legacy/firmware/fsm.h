@@ -31,6 +31,7 @@
 #include "messages-cosmos.pb.h"
 #include "messages-crypto.pb.h"
 #include "messages-debug.pb.h"
+#include "messages-ethereum-eip712.pb.h"
 #include "messages-ethereum-onekey.pb.h"
 #include "messages-ethereum.pb.h"
 #include "messages-filecoin.pb.h"
@@ -116,6 +117,8 @@ void fsm_msgCancelAuthorization(const CancelAuthorization *msg);
 void fsm_msgDoPreauthorized(const DoPreauthorized *msg);
 void fsm_msgUnlockPath(const UnlockPath *msg);
 void fsm_msgSignPsbt(const SignPsbt *msg);
+void fsm_msgPsbtAck(const PsbtAck *msg);
+void fsm_msgSignMessageChunkAck(const SignMessageChunkAck *msg);
 
 // crypto
 void fsm_msgCipherKeyValue(const CipherKeyValue *msg);
@@ -125,6 +128,7 @@ void fsm_msgCosiCommit(const CosiCommit *msg);
 void fsm_msgCosiSign(const CosiSign *msg);
 void fsm_msgBatchGetPublickeys(const BatchGetPublickeys *msg);
 void fsm_clearCosiNonce(void);
+void fsm_clearNodeCache(void);
 
 // debug
 #if DEBUG_LINK
@@ -146,6 +150,9 @@ void fsm_msgEthereumTxAck(const EthereumTxAck *msg);
 void fsm_msgEthereumSignMessage(const EthereumSignMessage *msg);
 void fsm_msgEthereumVerifyMessage(const EthereumVerifyMessage *msg);
 void fsm_msgEthereumSignTypedHash(const EthereumSignTypedHash *msg);
+void fsm_msgEthereumSignTypedData(const EthereumSignTypedData *msg);
+void fsm_msgEthereumTypedDataStructAck(const EthereumTypedDataStructAck *msg);
+void fsm_msgEthereumTypedDataValueAck(const EthereumTypedDataValueAck *msg);
 
 // ethereum onekey
 void fsm_msgEthereumGetAddressOneKey(const EthereumGetAddressOneKey *msg);
@@ -168,6 +175,7 @@ void fsm_msgNEMDecryptMessage(
 // solana
 void fsm_msgSolanaGetAddress(const SolanaGetAddress *msg);
 void fsm_msgSolanaSignTx(const SolanaSignTx *msg);
+void fsm_msgSolanaTxAck(const SolanaTxAck *msg);
 void fsm_msgSolanaSignOffChainMessage(const SolanaSignOffChainMessage *msg);
 void fsm_msgSolanaSignUnsafeMessage(const SolanaSignUnsafeMessage *msg);
 // starcoin
@@ -226,6 +234,7 @@ bool fsm_getOwnershipId(uint8_t *script_pubkey, size_t script_pubkey_size,
                         uint8_t ownership_id[32]);
 
 void fsm_abortWorkflows(void);
+void fsm_preMsgProcess(MessageType message_type);
 void fsm_postMsgCleanup(MessageType message_type);
 
 // tron
@@ -236,6 +245,7 @@ void fsm_msgTronSignTx(TronSignTx *msg);
 // aptos
 void fsm_msgAptosGetAddress(const AptosGetAddress *msg);
 void fsm_msgAptosSignTx(const AptosSignTx *msg);
+void fsm_msgAptosTxAck(const AptosTxAck *msg);
 void fsm_msgAptosSignMessage(const AptosSignMessage *msg);
 
 // near
@@ -68,10 +68,18 @@ void fsm_msgAptosSignTx(const AptosSignTx *msg) {
   if (!node) return;
 
   hdnode_fill_public_key(node);
+  if (msg->has_data_length && msg->data_length > 0) {
+    aptos_signing_init(msg, node);
+  } else {
+    aptos_sign_tx(msg, node, resp);
+    layoutHome();
+  }
+}
 
-  aptos_sign_tx(msg, node, resp);
+void fsm_msgAptosTxAck(const AptosTxAck *msg) {
+  CHECK_UNLOCKED
 
-  layoutHome();
+  aptos_signing_txack(msg);
 }
 
 void fsm_msgAptosSignMessage(const AptosSignMessage *msg) {
@@ -409,8 +409,9 @@ void fsm_msgBatchGetPublickeys(const BatchGetPublickeys *msg) {
   }
   size_t size = msg->paths_count;
   for (size_t i = 0; i < size; i++) {
-    HDNode *node = fsm_getDerivedNode(curve_name, msg->paths[i].address_n,
-                                      msg->paths[i].address_n_count, NULL);
+    HDNode *node =
+        fsm_getDerivedPublicNode(curve_name, msg->paths[i].address_n,
+                                 msg->paths[i].address_n_count, NULL);
     CHECK_PARAM(node, "Firmware error")
 
     CHECK_PARAM(!hdnode_fill_public_key(node), "Failed to derive public key")
@@ -31,6 +31,9 @@ void fsm_msgDebugLinkGetState(const DebugLinkGetState *msg) {
   resp.layout.size = OLED_BUFSIZE;
   memcpy(resp.layout.bytes, oledGetBuffer(), OLED_BUFSIZE);
 
+  resp.has_oled_refresh_bytes = true;
+  resp.oled_refresh_bytes = oledGetRefreshBytes();
+
   resp.has_pin = config_getPin(resp.pin, sizeof(resp.pin));
 
   resp.has_matrix = true;
@@ -88,8 +88,8 @@ void fsm_msgEthereumGetPublicKey(const EthereumGetPublicKey *msg) {
 
   const char *curve = coin->curve_name;
   uint32_t fingerprint;
-  HDNode *node = fsm_getDerivedNode(curve, msg->address_n, msg->address_n_count,
-                                    &fingerprint);
+  HDNode *node = fsm_getDerivedPublicNode(curve, msg->address_n,
+                                          msg->address_n_count, &fingerprint);
   if (!node) return;
 
   if (hdnode_fill_public_key(node) != 0) {
@@ -197,8 +197,8 @@ void fsm_msgEthereumGetAddress(const EthereumGetAddress *msg) {
     return;
   }
 
-  const HDNode *node = fsm_getDerivedNode(SECP256K1_NAME, msg->address_n,
-                                          msg->address_n_count, NULL);
+  const HDNode *node = fsm_getDerivedPublicNode(
+      SECP256K1_NAME, msg->address_n, msg->address_n_count, NULL);
   if (!node) return;
 
   uint8_t pubkeyhash[20];
@@ -280,6 +280,11 @@ void fsm_msgEthereumSignMessage(const EthereumSignMessage *msg) {
   ethereum_address_checksum(pubkeyhash, resp->address, false, 0);
   // ethereum_address_checksum adds trailing zero
 
+  if (msg->has_data_length) {
+    ethereum_message_sign_init(msg, node, resp->address);
+    return;
+  }
+
   if (!fsm_layoutSignMessage("Ethereum", resp->address, msg->message.bytes,
                              msg->message.size)) {
     fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
@@ -393,3 +398,50 @@ void fsm_msgEthereumSignTypedHash(const EthereumSignTypedHash *msg) {
   ethereum_typed_hash_sign(msg, node, resp);
   layoutHome();
 }
+
+void fsm_msgEthereumSignTypedData(const EthereumSignTypedData *msg) {
+  CHECK_INITIALIZED
+
+  CHECK_PIN
+
+  uint32_t slip44 = (msg->address_n_count > 1)
+                        ? (msg->address_n[1] & PATH_UNHARDEN_MASK)
+                        : SLIP44_UNKNOWN;
+
+  const EthereumNetworkInfo *network = get_network_definition_only(
+      msg->has_definitions && msg->definitions.has_encoded_network,
+      &msg->definitions.encoded_network, slip44);
+
+  if (!network || !fsm_ethereumCheckPath(msg->address_n_count, msg->address_n,
+                                         false, network)) {
+    layoutHome();
+    return;
+  }
+
+  const HDNode *node = fsm_getDerivedNode(SECP256K1_NAME, msg->address_n,
+                                          msg->address_n_count, NULL);
+  if (!node) return;
+
+  uint8_t pubkeyhash[20] = {0};
+  if (!hdnode_get_ethereum_pubkeyhash(node, pubkeyhash)) {
+    layoutHome();
+    return;
+  }
+
+  char address[43] = {0};
+  ethereum_address_checksum(pubkeyhash, address, false, 0);
+
+  ethereum_typed_data_init(msg, node, address);
+}
+
+void fsm_msgEthereumTypedDataStructAck(const EthereumTypedDataStructAck *msg) {
+  CHECK_UNLOCKED
+
+  ethereum_typed_data_struct_ack(msg);
+}
+
+void fsm_msgEthereumTypedDataValueAck(const EthereumTypedDataValueAck *msg) {
+  CHECK_UNLOCKED
+
+  ethereum_typed_data_value_ack(msg);
+}
@@ -52,8 +52,8 @@ void fsm_msgEthereumGetPublicKeyOneKey(const EthereumGetPublicKeyOneKey *msg) {
 
   const char *curve = coin->curve_name;
   uint32_t fingerprint;
-  HDNode *node = fsm_getDerivedNode(curve, msg->address_n, msg->address_n_count,
-                                    &fingerprint);
+  HDNode *node = fsm_getDerivedPublicNode(curve, msg->address_n,
+                                          msg->address_n_count, &fingerprint);
   if (!node) return;
 
   if (hdnode_fill_public_key(node) != 0) {
@@ -146,8 +146,8 @@ void fsm_msgEthereumGetAddressOneKey(const EthereumGetAddressOneKey *msg) {
     return;
   }
 
-  const HDNode *node = fsm_getDerivedNode(SECP256K1_NAME, msg->address_n,
-                                          msg->address_n_count, NULL);
+  const HDNode *node = fsm_getDerivedPublicNode(
+      SECP256K1_NAME, msg->address_n, msg->address_n_count, NULL);
   if (!node) return;
 
   uint8_t pubkeyhash[20];
@@ -223,6 +223,11 @@ void fsm_msgEthereumSignMessageOneKey(const EthereumSignMessageOneKey *msg) {
   ethereum_address_checksum(pubkeyhash, resp->address, false, 0);
   // ethereum_address_checksum adds trailing zero
 
+  if (msg->has_data_length) {
+    ethereum_message_sign_init_onekey(msg, node, resp->address);
+    return;
+  }
+
   if (!fsm_layoutSignMessage("Ethereum", resp->address, msg->message.bytes,
                              msg->message.size)) {
     fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
@@ -62,10 +62,18 @@ void fsm_msgSolanaSignTx(const SolanaSignTx *msg) {
   if (!node) return;
 
   hdnode_fill_public_key(node);
+  if (msg->has_data_length && msg->data_length > 0) {
+    solana_signing_init(msg, node);
+  } else {
+    solana_sign_tx(msg, node, resp);
+    layoutHome();
+  }
+}
 
-  solana_sign_tx(msg, node, resp);
+void fsm_msgSolanaTxAck(const SolanaTxAck *msg) {
+  CHECK_UNLOCKED
 
-  layoutHome();
+  solana_signing_txack(msg);
 }
 
 void fsm_msgSolanaSignOffChainMessage(const SolanaSignOffChainMessage *msg) {
@@ -35,6 +35,11 @@ void fsm_msgTronSignMessage(TronSignMessage *msg) {
   if (!hdnode_get_ethereum_pubkeyhash(node, eth_address)) return;
   tron_eth_2_trx_address(eth_address, signer_str, sizeof(signer_str));
 
+  if (msg->has_data_length) {
+    tron_message_sign_init(msg, node, signer_str);
+    return;
+  }
+
   if (!fsm_layoutSignMessage("Tron", signer_str, msg->message.bytes,
                              msg->message.size)) {
     fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
@@ -57,8 +62,8 @@ void fsm_msgTronGetAddress(TronGetAddress *msg) {
   CHECK_PIN
   RESP_INIT(TronAddress);
 
-  const HDNode *node = fsm_getDerivedNode(SECP256K1_NAME, msg->address_n,
-                                          msg->address_n_count, NULL);
+  const HDNode *node = fsm_getDerivedPublicNode(
+      SECP256K1_NAME, msg->address_n, msg->address_n_count, NULL);
   if (!node) return;
 
   uint8_t eth_address[20];
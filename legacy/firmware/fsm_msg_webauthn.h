@@ -15,7 +15,8 @@ void fsm_msgWebAuthnListResidentCredentials(
   }
 
   CTAP_credential_id_storage cred_id_storage = {0};
-  uint16_t len;
+  uint16_t len = sizeof(CTAP_credential_id_storage) -
+                 FIDO2_RESIDENT_CREDENTIALS_HEADER_LEN;
   uint8_t status;
   static bool is_protect_button_pressed = false;
   static uint8_t last_index = 0;
@@ -31,19 +32,14 @@ void fsm_msgWebAuthnListResidentCredentials(
       return;
     }
     is_protect_button_pressed = true;
-    for (uint8_t i = 0; i < FIDO2_RESIDENT_CREDENTIALS_COUNT; i++) {
-      len = sizeof(CTAP_credential_id_storage) -
-            FIDO2_RESIDENT_CREDENTIALS_HEADER_LEN;
-      status = se_get_fido2_resident_credentials(i, cred_id_storage.rp_id_hash,
-                                                 &len);
-      if (status == SE_FIDO2_SLOT_DATA_OK) {
-        resp->id_map[0].bytes[count] = i;
-        last_index = i;
-        count++;
-      }
-      if (count > sizeof(resp->id_map[0].bytes)) {
-        break;
-      }
+    uint8_t indexs[FIDO2_RESIDENT_CREDENTIALS_COUNT] = {0};
+    count = resident_credential_info(indexs, 100);
+    if (count > sizeof(resp->id_map[0].bytes)) {
+      count = sizeof(resp->id_map[0].bytes);
+    }
+    memcpy(resp->id_map[0].bytes, indexs, count);
+    if (count > 0) {
+      last_index = indexs[count - 1];
     }
     resp->id_map_count = 1;
     resp->id_map[0].size = count;
@@ -203,7 +199,8 @@ void fsm_msgWebAuthnAddResidentCredential(
              rp_id_hash);
 
   if (!resident_credential_store(rp_id_hash, desc.credential.user.id,
-                                 desc.cred_id, desc.cred_id_len)) {
+                                 desc.credential.user.id_size, desc.cred_id,
+                                 desc.cred_id_len)) {
     fsm_sendFailure(FailureType_Failure_ProcessError,
                     "Failed to store resident credential");
     return;
@@ -260,7 +257,7 @@ void fsm_msgWebAuthnRemoveResidentCredential(
     return;
   }
 
-  if (se_delete_fido2_resident_credentials(msg->index)) {
+  if (resident_credential_delete(msg->index)) {
     fsm_sendSuccess("Credential removed");
   } else {
     fsm_sendFailure(FailureType_Failure_ProcessError,
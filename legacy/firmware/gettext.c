@@ -13,38 +13,45 @@ char *gettext(const char *msgid) { return (char *)msgid; }
 char *gettextX(int msgid) {
   switch (ui_language) {
     case 1:
-      return (char *)languages_zh_cn[msgid];
+      return (char *)languages_zh_cn_pool + languages_zh_cn_offsets[msgid];
     case 2:
-      return (char *)languages_zh_tw[msgid];
+      return (char *)languages_zh_tw_pool + languages_zh_tw_offsets[msgid];
     case 3:
-      return (char *)languages_ja[msgid];
+      return (char *)languages_ja_pool + languages_ja_offsets[msgid];
     case 4:
-      return (char *)languages_es[msgid];
+      return (char *)languages_es_pool + languages_es_offsets[msgid];
     case 5:
-      return (char *)languages_pt_br[msgid];
+      return (char *)languages_pt_br_pool + languages_pt_br_offsets[msgid];
     case 6:
-      return (char *)languages_de[msgid];
+      return (char *)languages_de_pool + languages_de_offsets[msgid];
     default:
       break;
   }
 
-  return (char *)languages_en[msgid];
+  return (char *)languages_en_pool + languages_en_offsets[msgid];
+}
+
+// FNV-1a, the seed is folded into the offset basis (see script/i18n.py)
+static uint32_t en_hash(uint32_t seed, const char *str) {
+  uint32_t h = 0x811c9dc5 ^ seed;
+  while (*str) {
+    h = (h ^ (uint8_t)*str++) * 0x01000193;
+  }
+  return h;
 }
 
 extern bool is_valid_ascii(const uint8_t *data, uint32_t size);
 const char *gettext_from_en(char *en_str) {
-  int msgid = -1;
   size_t len = strlen(en_str);
   if (!is_valid_ascii((uint8_t *)en_str, len)) {
     return en_str;
   }
-  for (int i = 0; i < I18N_LANGUAGE_ITEMS; i++) {
-    if ((0 == strncmp(en_str, languages_en[i], len)) &&
-        (len == strlen(languages_en[i]))) {
-      msgid = i;
-      break;
-    }
+  uint32_t n = I18N_LANGUAGE_ITEMS;
+  int32_t seed = i18n_en_seeds[en_hash(0, en_str) % n];
+  uint32_t slot = seed < 0 ? (uint32_t)(-seed - 1) : en_hash(seed, en_str) % n;
+  int msgid = i18n_en_slots[slot];
+  if (strcmp(en_str, languages_en_pool + languages_en_offsets[msgid]) != 0) {
+    return en_str;
   }
-  if (msgid < 0) return en_str;
   return _(msgid);
 }
@@ -15,4 +15,11 @@ const char* const i18n_langs[] = {"English", "中文 (简体)", "中文 (繁體)
 #include "locales/zh_cn.inc"
 #include "locales/zh_tw.inc"
 
-int I18N_LANGUAGE_ITEMS = sizeof(languages_en) / sizeof(languages_en[0]);
+#include "locales/en_index.inc"
+
+int I18N_LANGUAGE_ITEMS =
+    sizeof(languages_en_offsets) / sizeof(languages_en_offsets[0]);
+
+_Static_assert(I18N_EN_INDEX_SIZE == sizeof(languages_en_offsets) /
+                                         sizeof(languages_en_offsets[0]),
+               "locales/en_index.inc is out of date");
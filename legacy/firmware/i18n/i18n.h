@@ -10,11 +10,22 @@ extern const char *const i18n_langs[];
 extern uint8_t langs_len;
 extern int I18N_LANGUAGE_ITEMS;
 
-extern const char *const languages_en[];
-extern const char *const languages_zh_cn[];
-extern const char *const languages_zh_tw[];
-extern const char *const languages_ja[];
-extern const char *const languages_es[];
-extern const char *const languages_pt_br[];
-extern const char *const languages_de[];
+extern const char languages_en_pool[];
+extern const uint16_t languages_en_offsets[];
+extern const char languages_zh_cn_pool[];
+extern const uint16_t languages_zh_cn_offsets[];
+extern const char languages_zh_tw_pool[];
+extern const uint16_t languages_zh_tw_offsets[];
+extern const char languages_ja_pool[];
+extern const uint16_t languages_ja_offsets[];
+extern const char languages_es_pool[];
+extern const uint16_t languages_es_offsets[];
+extern const char languages_pt_br_pool[];
+extern const uint16_t languages_pt_br_offsets[];
+extern const char languages_de_pool[];
+extern const uint16_t languages_de_offsets[];
+
+// perfect hash from English text to msgid, see gettext_from_en
+extern const int16_t i18n_en_seeds[];
+extern const uint16_t i18n_en_slots[];
 #endif
@@ -10,8 +10,7 @@ static jsmntok_t *jsmn_alloc_token(jsmn_parser *parser, jsmntok_t *tokens,
     return NULL;
   }
   tok = &tokens[parser->toknext++];
-  tok->start = tok->end = -1;
-  tok->size = 0;
+  tok->start = tok->end = JSMN_NO_POS;
 #ifdef JSMN_PARENT_LINKS
   tok->parent = -1;
 #endif
@@ -26,7 +25,6 @@ static void jsmn_fill_token(jsmntok_t *token, jsmntype_t type, short int start,
   token->type = type;
   token->start = start;
   token->end = end;
-  token->size = 0;
 }
 
 /**
@@ -168,6 +166,10 @@ int jsmn_parse(jsmn_parser *parser, const char *js, int len, jsmntok_t *tokens,
   jsmntok_t *token;
   short int count = parser->toknext;
 
+  if (len >= JSMN_NO_POS) {
+    return JSMN_ERROR_NOMEM;
+  }
+
   for (; parser->pos < len && js[parser->pos] != '\0'; parser->pos++) {
     char c;
     jsmntype_t type;
@@ -182,12 +184,9 @@ int jsmn_parse(jsmn_parser *parser, const char *js, int len, jsmntok_t *tokens,
         }
         token = jsmn_alloc_token(parser, tokens, num_tokens);
         if (token == NULL) return JSMN_ERROR_NOMEM;
-        if (parser->toksuper != -1) {
-          tokens[parser->toksuper].size++;
 #ifdef JSMN_PARENT_LINKS
-          token->parent = parser->toksuper;
+        token->parent = parser->toksuper;
 #endif
-        }
         token->type = (c == '{' ? JSMN_OBJECT : JSMN_ARRAY);
         token->start = parser->pos;
         parser->toksuper = parser->toknext - 1;
@@ -202,7 +201,7 @@ int jsmn_parse(jsmn_parser *parser, const char *js, int len, jsmntok_t *tokens,
         }
         token = &tokens[parser->toknext - 1];
         for (;;) {
-          if (token->start != -1 && token->end == -1) {
+          if (token->start != JSMN_NO_POS && token->end == JSMN_NO_POS) {
             if (token->type != type) {
               return JSMN_ERROR_INVAL;
             }
@@ -221,7 +220,7 @@ int jsmn_parse(jsmn_parser *parser, const char *js, int len, jsmntok_t *tokens,
 #else
         for (i = parser->toknext - 1; i >= 0; i--) {
           token = &tokens[i];
-          if (token->start != -1 && token->end == -1) {
+          if (token->start != JSMN_NO_POS && token->end == JSMN_NO_POS) {
             if (token->type != type) {
               return JSMN_ERROR_INVAL;
             }
@@ -234,7 +233,7 @@ int jsmn_parse(jsmn_parser *parser, const char *js, int len, jsmntok_t *tokens,
         if (i == -1) return JSMN_ERROR_INVAL;
         for (; i >= 0; i--) {
           token = &tokens[i];
-          if (token->start != -1 && token->end == -1) {
+          if (token->start != JSMN_NO_POS && token->end == JSMN_NO_POS) {
             parser->toksuper = i;
             break;
           }
@@ -245,8 +244,6 @@ int jsmn_parse(jsmn_parser *parser, const char *js, int len, jsmntok_t *tokens,
         r = jsmn_parse_string(parser, js, len, tokens, num_tokens);
         if (r < 0) return r;
         count++;
-        if (parser->toksuper != -1 && tokens != NULL)
-          tokens[parser->toksuper].size++;
         break;
       case '\t':
       case '\r':
@@ -265,7 +262,8 @@ int jsmn_parse(jsmn_parser *parser, const char *js, int len, jsmntok_t *tokens,
 #else
           for (i = parser->toknext - 1; i >= 0; i--) {
             if (tokens[i].type == JSMN_ARRAY || tokens[i].type == JSMN_OBJECT) {
-              if (tokens[i].start != -1 && tokens[i].end == -1) {
+              if (tokens[i].start != JSMN_NO_POS &&
+                  tokens[i].end == JSMN_NO_POS) {
                 parser->toksuper = i;
                 break;
               }
@@ -293,8 +291,7 @@ int jsmn_parse(jsmn_parser *parser, const char *js, int len, jsmntok_t *tokens,
         /* And they must not be keys of the object */
         if (tokens != NULL && parser->toksuper != -1) {
           jsmntok_t *t = &tokens[parser->toksuper];
-          if (t->type == JSMN_OBJECT ||
-              (t->type == JSMN_STRING && t->size != 0)) {
+          if (t->type == JSMN_OBJECT) {
             return JSMN_ERROR_INVAL;
           }
         }
@@ -305,8 +302,6 @@ int jsmn_parse(jsmn_parser *parser, const char *js, int len, jsmntok_t *tokens,
         r = jsmn_parse_primitive(parser, js, len, tokens, num_tokens);
         if (r < 0) return r;
         count++;
-        if (parser->toksuper != -1 && tokens != NULL)
-          tokens[parser->toksuper].size++;
         break;
 
 #ifdef JSMN_STRICT
@@ -320,7 +315,7 @@ int jsmn_parse(jsmn_parser *parser, const char *js, int len, jsmntok_t *tokens,
   if (tokens != NULL) {
     for (i = parser->toknext - 1; i >= 0; i--) {
       /* Unmatched opened object or array */
-      if (tokens[i].start != -1 && tokens[i].end == -1) {
+      if (tokens[i].start != JSMN_NO_POS && tokens[i].end == JSMN_NO_POS) {
         return JSMN_ERROR_PART;
       }
     }
@@ -2,6 +2,7 @@
 #define __JSMN_H_
 
 #include <stddef.h>
+#include <stdint.h>
 
 /**
  * JSON type identifier. Basic types are:
@@ -28,16 +29,22 @@ enum jsmnerr {
 };
 
 /**
- * JSON token description.
+ * Positions are stored in JSMN_POS_BITS bits, JSMN_NO_POS marks a position
+ * that is not known yet. Inputs must be shorter than JSMN_NO_POS.
+ */
+#define JSMN_POS_BITS 13
+#define JSMN_NO_POS ((1 << JSMN_POS_BITS) - 1)
+
+/**
+ * JSON token description, packed into 4 bytes.
  * type		type (object, array, string etc.)
  * start	start position in JSON data string
  * end		end position in JSON data string
  */
 typedef struct {
-  jsmntype_t type;
-  short int start;
-  short int end;
-  short int size;
+  uint16_t start : JSMN_POS_BITS;
+  uint16_t type : 3;
+  uint16_t end : JSMN_POS_BITS;
 #ifdef JSMN_PARENT_LINKS
   short int parent;
 #endif
@@ -55,6 +55,7 @@
 #include "secp256k1.h"
 #include "signing.h"
 #include "sys.h"
+#include "text_layout.h"
 #include "timer.h"
 #include "util.h"
 
@@ -2286,10 +2287,15 @@ static int line_index(char *text, int lines) {
 static uint8_t layoutPagination(char *title, char *content) {
   uint8_t key = KEY_NULL;
   int rows = 0, pages = 0, index = 0;
-  int p1 = 0, p2 = 0;
   char text[256] = {0};
+  static TextLayout layout;
 
-  rows = countlines(content);
+  text_layout_init(&layout, content, 0, FONT_STANDARD);
+  if (layout.truncated) {
+    // never let the user confirm text they could not scroll to
+    return KEY_CANCEL;
+  }
+  rows = layout.count;
   if (rows > 4) {
     pages = rows - 4 + 1;
   } else {
@@ -2304,13 +2310,7 @@ static uint8_t layoutPagination(char *title, char *content) {
 _layout:
   oledClear_ex();
 
-  p1 = line_index(content, index);
-  p2 = line_index(content, index + 4);
-  memset(text, 0, 256);
-  if (index == 0)
-    memcpy(text, content + p1, p2 - p1);
-  else
-    memcpy(text, content + p1 + 1, p2 - p1);
+  text_layout_copy(&layout, index, 4, text, sizeof(text));
 
   if (pages == 1) {
     bmp_up = NULL;
@@ -5413,9 +5413,10 @@ refresh_layout:
 bool layoutSignHash(const char *chain_name, bool verify, const char *signer,
                     const char *domain_hash, const char *message_hash,
                     const char *warning) {
-  (void)warning;
   bool result = false;
-  int index = 0;
+  // the blind signing warning is skipped when the data has been shown
+  int first_index = warning ? 0 : 1;
+  int index = first_index;
   uint8_t max_index = 5;
   uint8_t key = KEY_NULL;
   char title[64] = {0};
@@ -5492,7 +5493,7 @@ refresh_layout:
       }
       goto refresh_layout;
     case KEY_CANCEL:
-      if (0 == index || index == max_index - 1) {
+      if (first_index == index || index == max_index - 1) {
         result = false;
         break;
       }
@@ -5507,6 +5508,32 @@ refresh_layout:
   return result;
 }
 
+bool layoutTypedDataField(const char *title, const char *name,
+                          const char *value) {
+  uint8_t key = KEY_NULL;
+
+  ButtonRequest resp = {0};
+  memzero(&resp, sizeof(ButtonRequest));
+  resp.has_code = true;
+  resp.code = ButtonRequestType_ButtonRequest_ProtectCall;
+  msg_write(MessageType_MessageType_ButtonRequest, &resp);
+
+  layoutSwipe();
+  oledClear();
+  layoutHeader(title);
+  oledDrawStringAdapter(0, 13, name, FONT_STANDARD);
+  key = oledDrawPageableStringAdapter(0, 13 + 10, value, FONT_STANDARD,
+                                      &bmp_bottom_left_close,
+                                      &bmp_bottom_right_arrow);
+  oledRefresh();
+
+  while (key != KEY_CONFIRM && key != KEY_CANCEL) {
+    key = protectWaitKey(0, 0);
+    if (key == KEY_NULL) return false;
+  }
+  return key == KEY_CONFIRM;
+}
+
 bool layoutSignSchnorrHash(const char *chain_name, const char *signer,
                            const char *hash) {
   bool result = false;
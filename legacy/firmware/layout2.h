@@ -312,6 +312,8 @@ bool layoutNostrEncryptMessage(const char *chain_name, bool verify,
 bool layoutSignHash(const char *chain_name, bool verify, const char *signer,
                     const char *domain_hash, const char *message_hash,
                     const char *tips);
+bool layoutTypedDataField(const char *title, const char *name,
+                          const char *value);
 bool layoutSignSchnorrHash(const char *chain_name, const char *signer,
                            const char *hash);
 bool layoutPaginated(const char *title, const uint8_t *data, uint16_t len);
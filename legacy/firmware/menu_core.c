@@ -17,23 +17,6 @@ void menu_init(struct menu *menu) {
   refresh_menu = true;
 }
 
-static const char *_gettext(char *en_str) {
-  int msgid = -1;
-  size_t len = strlen(en_str);
-  if (!is_valid_ascii((uint8_t *)en_str, len)) {
-    return en_str;
-  }
-  for (int i = 0; i < I18N_LANGUAGE_ITEMS; i++) {
-    if ((0 == strncmp(en_str, languages_en[i], len)) &&
-        (len == strlen(languages_en[i]))) {
-      msgid = i;
-      break;
-    }
-  }
-  if (msgid < 0) return en_str;
-  return _(msgid);
-}
-
 void menu_display(struct menu *menu) {
   char descriptions[7][64] = {0};
   const BITMAP *bmp_yes = NULL;
@@ -44,14 +27,14 @@ void menu_display(struct menu *menu) {
     if (index < 0 || index >= menu->counts) {
       continue;
     }
-    strlcpy(descriptions[i + 3], _gettext(menu->items[index].name), 64);
+    strlcpy(descriptions[i + 3], gettext_from_en(menu->items[index].name), 64);
     if (menu->items[index].name2) {
       if (0 == memcmp(menu->items[index].name2, "minutes", 7)) {
         strlcpy(descriptions[i + 3], _(O__STR_MINUTES), 64);
         bracket_replace(descriptions[i + 3], menu->items[index].name);
       } else {
         strcat(descriptions[i + 3], " ");
-        strcat(descriptions[i + 3], _gettext(menu->items[index].name2));
+        strcat(descriptions[i + 3], gettext_from_en(menu->items[index].name2));
       }
     }
   }
@@ -69,10 +52,11 @@ void menu_display(struct menu *menu) {
   }
 
   layoutMenuItemsEx(text_yes, bmp_yes, menu->current + 1, menu->counts,
-                    menu->title ? _gettext(menu->title) : NULL, descriptions[3],
-                    _gettext(menu->items[menu->current].name),
+                    menu->title ? gettext_from_en(menu->title) : NULL,
+                    descriptions[3],
+                    gettext_from_en(menu->items[menu->current].name),
                     menu->items[menu->current].name2
-                        ? _gettext(menu->items[menu->current].name2)
+                        ? gettext_from_en(menu->items[menu->current].name2)
                         : NULL,
                     menu->items[menu->current].para
                         ? menu->items[menu->current].para()
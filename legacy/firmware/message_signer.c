@@ -0,0 +1,122 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "message_signer.h"
+#include <stdio.h>
+#include <string.h>
+#include "chunk_signer.h"
+#include "fsm.h"
+#include "gettext.h"
+#include "layout2.h"
+#include "memzero.h"
+#include "messages.h"
+#include "messages.pb.h"
+#include "util.h"
+
+static const MessageSignerOps *message_ops;
+static CONFIDENTIAL HDNode node_cache;
+static char signer_str[130];
+static Hasher hasher;
+static uint8_t preview[MESSAGE_SIGNER_PREVIEW_SIZE];
+static size_t preview_size;
+static SignMessageChunkRequest msg_chunk_request;
+static ChunkSigner msg_signer = {.name = "message"};
+
+static void hash_chunk(const uint8_t *data, size_t size) {
+  if (preview_size < sizeof(preview)) {
+    size_t keep = MIN(size, sizeof(preview) - preview_size);
+    memcpy(preview + preview_size, data, keep);
+    preview_size += keep;
+  }
+  hasher_Update(&hasher, data, size);
+}
+
+static void send_request_chunk(uint32_t size) {
+  layoutProgress(_(C__SIGNING), chunk_signer_progress(&msg_signer));
+  msg_chunk_request.data_length = size;
+  msg_write(MessageType_MessageType_SignMessageChunkRequest,
+            &msg_chunk_request);
+}
+
+static void confirm_and_sign(void) {
+  uint8_t digest[32] = {0};
+  hasher_Final(&hasher, digest);
+  if (message_ops->digest != NULL) {
+    message_ops->digest(digest);
+  }
+
+  if (!fsm_layoutSignMessage(message_ops->chain_name, signer_str, preview,
+                             preview_size)) {
+    fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
+    return;
+  }
+  char length[32] = {0};
+  char digest_hex[65] = {0};
+  snprintf(length, sizeof(length), "%lu bytes",
+           (unsigned long)msg_signer.total);
+  data2hex(digest, sizeof(digest), digest_hex);
+  if (!layoutTypedDataField(_(T__MESSAGE_HASH), length, digest_hex)) {
+    fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
+    return;
+  }
+
+  layoutProgressSwipe(_(C__SIGNING), 0);
+  message_ops->sign(&node_cache, signer_str, digest);
+}
+
+static void clear_session(void) {
+  memzero(&node_cache, sizeof(node_cache));
+  memzero(&hasher, sizeof(hasher));
+  memzero(preview, sizeof(preview));
+  preview_size = 0;
+}
+
+static const ChunkSignerOps message_signer_ops = {
+    .max_length = 0,
+    .update = hash_chunk,
+    .request = send_request_chunk,
+    .finish = confirm_and_sign,
+    .reset = clear_session,
+    .interactive = false,
+};
+
+void message_signer_init(const MessageSignerOps *ops, const HDNode *node,
+                         const char *signer_address, const uint8_t *prefix,
+                         size_t prefix_size, uint32_t data_length,
+                         const uint8_t *initial, size_t initial_size) {
+  chunk_signer_init(&msg_signer, &message_signer_ops);
+  if (!chunk_signer_set_length(&msg_signer, data_length, initial_size)) {
+    return;
+  }
+
+  message_ops = ops;
+  memcpy(&node_cache, node, sizeof(HDNode));
+  strlcpy(signer_str, signer_address, sizeof(signer_str));
+  preview_size = 0;
+  hasher_Init(&hasher, ops->hasher);
+  hasher_Update(&hasher, prefix, prefix_size);
+
+  chunk_signer_start(&msg_signer, initial, initial_size);
+}
+
+void message_signer_ack(const SignMessageChunkAck *msg) {
+  chunk_signer_txack(&msg_signer, msg->data_chunk.bytes, msg->data_chunk.size);
+}
+
+void message_signer_abort(void) { chunk_signer_abort(&msg_signer); }
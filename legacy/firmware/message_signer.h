@@ -0,0 +1,58 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __MESSAGE_SIGNER_H__
+#define __MESSAGE_SIGNER_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "bip32.h"
+#include "hasher.h"
+#include "messages-common.pb.h"
+
+// Bytes from the start of the message shown before the digest.
+#define MESSAGE_SIGNER_PREVIEW_SIZE 256
+#define MESSAGE_SIGNER_PREFIX_SIZE 64
+
+/*
+ * Signing of a message that is longer than one sign request: the request
+ * carries the first chunk and data_length, the device asks for the rest with
+ * SignMessageChunkRequest and hashes every chunk as it arrives. Only the
+ * start of the message is kept, the user confirms it together with the
+ * length and the digest once the whole message has been hashed.
+ */
+typedef struct {
+  const char *chain_name;
+  HasherType hasher;  // hashes the prefix and the message
+  // Turns the hash into the digest that is shown and signed, may be NULL.
+  void (*digest)(uint8_t hash[32]);
+  // Signs the digest and sends the signature made by signer.
+  void (*sign)(const HDNode *node, const char *signer,
+               const uint8_t digest[32]);
+} MessageSignerOps;
+
+// Hashes prefix and the initial chunk, then requests the rest or finishes.
+void message_signer_init(const MessageSignerOps *ops, const HDNode *node,
+                         const char *signer_address, const uint8_t *prefix,
+                         size_t prefix_size, uint32_t data_length,
+                         const uint8_t *initial, size_t initial_size);
+void message_signer_ack(const SignMessageChunkAck *msg);
+void message_signer_abort(void);
+
+#endif
@@ -40,33 +40,52 @@ struct MessagesMap_t {
   void (*process_func)(const void *ptr);
 };
 
-static const struct MessagesMap_t MessagesMap[] = {
+// MessagesMap is laid out by a minimal perfect hash over all messages,
+// computed by messages_map.py: a message is found in the slot given by the
+// seed of its bucket, or not at all.
 #include "messages_map.h"
-    // end
-    {0, 0, 0, 0, 0}};
 
 #include "messages_map_limits.h"
 
-const pb_msgdesc_t *MessageFields(char type, char dir, uint16_t msg_id) {
-  const struct MessagesMap_t *m = MessagesMap;
-  while (m->type) {
-    if (type == m->type && dir == m->dir && msg_id == m->msg_id) {
-      return m->fields;
-    }
-    m++;
+// Must match message_key() in messages_map.py
+static inline uint32_t messages_map_key(char type, char dir, uint16_t msg_id) {
+  return msg_id | (uint32_t)(type == 'd') << 16 | (uint32_t)(dir == 'o') << 17;
+}
+
+// Must match message_hash() in messages_map.py
+static inline uint32_t messages_map_hash(uint32_t seed, uint32_t key) {
+  uint32_t h = (key ^ seed) * 0x9E3779B1;
+  return h ^ (h >> 15);
+}
+
+static const struct MessagesMap_t *MessageFind(char type, char dir,
+                                               uint16_t msg_id) {
+  uint32_t key = messages_map_key(type, dir, msg_id);
+  uint32_t seed =
+      MessagesMapSeeds[messages_map_hash(0, key) % MESSAGES_MAP_BUCKETS];
+  const struct MessagesMap_t *m =
+      &MessagesMap[messages_map_hash(seed, key) % MESSAGES_MAP_SLOTS];
+  // unknown messages land on another message's slot or an empty one
+  if (type != m->type || dir != m->dir || msg_id != m->msg_id) {
+    return 0;
   }
-  return 0;
+  return m;
+}
+
+const pb_msgdesc_t *MessageFields(char type, char dir, uint16_t msg_id) {
+  const struct MessagesMap_t *m = MessageFind(type, dir, msg_id);
+  return m ? m->fields : 0;
 }
 
 void MessageProcessFunc(char type, char dir, uint16_t msg_id, void *ptr) {
-  const struct MessagesMap_t *m = MessagesMap;
-  while (m->type) {
-    if (type == m->type && dir == m->dir && msg_id == m->msg_id) {
-      m->process_func(ptr);
-      fsm_postMsgCleanup(msg_id);
-      return;
+  const struct MessagesMap_t *m = MessageFind(type, dir, msg_id);
+  if (m && m->process_func) {
+    // the debug link may look at the device in the middle of a workflow
+    if (type == 'n') {
+      fsm_preMsgProcess(msg_id);
     }
-    m++;
+    m->process_func(ptr);
+    fsm_postMsgCleanup(msg_id);
   }
 }
 
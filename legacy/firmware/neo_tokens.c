@@ -5,11 +5,11 @@
 
 static const NeoToken neo_tokens[NEO_TOKENS_COUNT] = {
     {
-        .contract_script_hash = {0xf5, 0x63, 0xea, 0x40, 0xbc, 0x28, 0x3d,
-                                 0x4d, 0x0e, 0x05, 0xc4, 0x8e, 0xa3, 0x05,
-                                 0xb3, 0xf2, 0xa0, 0x73, 0x40, 0xef},
-        .decimals = 0,
-        .symbol = "NEO",
+        .contract_script_hash = {0x28, 0xab, 0x18, 0x74, 0xda, 0x47, 0xaa,
+                                 0xd8, 0x2c, 0x9c, 0xb3, 0x51, 0x88, 0x55,
+                                 0x27, 0x81, 0x52, 0x1f, 0x15, 0xf0},
+        .decimals = 8,
+        .symbol = "FLM",
     },
     {
         .contract_script_hash = {0xcf, 0x76, 0xe2, 0x8b, 0xd0, 0x06, 0x2c,
@@ -19,11 +19,11 @@ static const NeoToken neo_tokens[NEO_TOKENS_COUNT] = {
         .symbol = "GAS",
     },
     {
-        .contract_script_hash = {0x28, 0xab, 0x18, 0x74, 0xda, 0x47, 0xaa,
-                                 0xd8, 0x2c, 0x9c, 0xb3, 0x51, 0x88, 0x55,
-                                 0x27, 0x81, 0x52, 0x1f, 0x15, 0xf0},
-        .decimals = 8,
-        .symbol = "FLM",
+        .contract_script_hash = {0xf5, 0x63, 0xea, 0x40, 0xbc, 0x28, 0x3d,
+                                 0x4d, 0x0e, 0x05, 0xc4, 0x8e, 0xa3, 0x05,
+                                 0xb3, 0xf2, 0xa0, 0x73, 0x40, 0xef},
+        .decimals = 0,
+        .symbol = "NEO",
     },
 };
 
@@ -33,14 +33,24 @@ const NeoToken UNK_TOKEN = {
     .symbol = "UNK",
 };
 
+// neo_tokens[] is sorted by contract_script_hash
 const NeoToken *neo_token_by_contract_script_hash(
     const uint8_t *contract_script_hash) {
-  for (size_t i = 0; i < NEO_TOKENS_COUNT; i++) {
-    if (memcmp(neo_tokens[i].contract_script_hash, contract_script_hash, 20) ==
-        0) {
-      return &neo_tokens[i];
+  size_t lo = 0, hi = NEO_TOKENS_COUNT;
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    if (memcmp(neo_tokens[mid].contract_script_hash, contract_script_hash,
+               20) < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
     }
   }
+  if (lo < NEO_TOKENS_COUNT &&
+      memcmp(neo_tokens[lo].contract_script_hash, contract_script_hash, 20) ==
+          0) {
+    return &neo_tokens[lo];
+  }
   return &UNK_TOKEN;
 }
 
@@ -16,6 +16,7 @@
 
 #define EXPERT_FIELDS_TOTAL_COUNT 5
 extern uint16_t __address_type;
+extern char polkadot_network[32];
 #define POLKADOT_PARSER_PARSE_V26 \
   polkadot_parser_parse_dispatch(ctx, data, dataLen, tx_obj, true);
 #define POLKADOT_PARSER_PARSE_V25 \
@@ -42,6 +43,17 @@ static parser_error_t polkadot_parser_parse_dispatch(parser_context_t *ctx,
 parser_error_t polkadot_parser_parse(parser_context_t *ctx, const uint8_t *data,
                                      size_t dataLen, parser_tx_t *tx_obj) {
   __address_type = _detectAddressType(ctx);
+  // The genesis hash ends 64 bytes before the end of the payload, or 65 when
+  // it carries the metadata hash mode. Either way the runtime is picked once,
+  // before the call is decoded.
+  const uint8_t *genesisHash = NULL;
+  if (dataLen >= 65 && _isKnownGenesisHash(data + dataLen - 65)) {
+    genesisHash = data + dataLen - 65;
+  } else if (dataLen >= 64) {
+    genesisHash = data + dataLen - 64;
+  }
+  CHECK_PARSER_ERR(_selectRuntime(genesisHash, polkadot_network))
+
   parser_error_t err = POLKADOT_PARSER_PARSE_V26;
   if (err != parser_ok && err != parser_unexpected_callIndex) {
     err = POLKADOT_PARSER_PARSE_V25;
@@ -83,9 +95,7 @@ parser_error_t polkadot_parser_validate(const parser_context_t *ctx) {
 
 parser_error_t polkadot_parser_getNumItems(const parser_context_t *ctx,
                                            uint8_t *num_items) {
-  uint8_t methodArgCount = _getMethod_NumItems(ctx->tx_obj->transactionVersion,
-                                               ctx->tx_obj->callIndex.moduleIdx,
-                                               ctx->tx_obj->callIndex.idx);
+  uint8_t methodArgCount = _getMethod_NumItems(&ctx->tx_obj->method);
   uint8_t total = FIELD_FIXED_TOTAL_COUNT;
   if (!parser_show_tip(ctx)) {
     total -= 1;
@@ -94,9 +104,8 @@ parser_error_t polkadot_parser_getNumItems(const parser_context_t *ctx,
     total -= EXPERT_FIELDS_TOTAL_COUNT;
 
     for (uint8_t argIdx = 0; argIdx < methodArgCount; argIdx++) {
-      bool isArgExpert = _getMethod_ItemIsExpert(
-          ctx->tx_obj->transactionVersion, ctx->tx_obj->callIndex.moduleIdx,
-          ctx->tx_obj->callIndex.idx, argIdx);
+      bool isArgExpert =
+          _getMethod_ItemIsExpert(&ctx->tx_obj->method, argIdx);
       if (isArgExpert) {
         methodArgCount--;
       }
@@ -128,26 +137,18 @@ parser_error_t polkadot_parser_getItem(const parser_context_t *ctx,
   parser_error_t err = parser_ok;
   if (displayIdx == FIELD_METHOD) {
     snprintf(outKey, outKeyLen, "%s",
-             _getMethod_ModuleName(ctx->tx_obj->transactionVersion,
-                                   ctx->tx_obj->callIndex.moduleIdx));
-    snprintf(outVal, outValLen, "%s",
-             _getMethod_Name(ctx->tx_obj->transactionVersion,
-                             ctx->tx_obj->callIndex.moduleIdx,
-                             ctx->tx_obj->callIndex.idx));
+             _getMethod_ModuleName(&ctx->tx_obj->method));
+    snprintf(outVal, outValLen, "%s", _getMethod_Name(&ctx->tx_obj->method));
     return err;
   }
 
   // VARIABLE ARGUMENTS
-  uint8_t methodArgCount = _getMethod_NumItems(ctx->tx_obj->transactionVersion,
-                                               ctx->tx_obj->callIndex.moduleIdx,
-                                               ctx->tx_obj->callIndex.idx);
+  uint8_t methodArgCount = _getMethod_NumItems(&ctx->tx_obj->method);
   uint8_t argIdx = displayIdx - 1;
   if (!parser_show_expert_fields()) {
     // Search for the next non expert item
     while ((argIdx < methodArgCount) &&
-           _getMethod_ItemIsExpert(ctx->tx_obj->transactionVersion,
-                                   ctx->tx_obj->callIndex.moduleIdx,
-                                   ctx->tx_obj->callIndex.idx, argIdx)) {
+           _getMethod_ItemIsExpert(&ctx->tx_obj->method, argIdx)) {
       argIdx++;
       displayIdx++;
     }
@@ -155,14 +156,10 @@ parser_error_t polkadot_parser_getItem(const parser_context_t *ctx,
 
   if (argIdx < methodArgCount) {
     snprintf(outKey, outKeyLen, "%s",
-             _getMethod_ItemName(ctx->tx_obj->transactionVersion,
-                                 ctx->tx_obj->callIndex.moduleIdx,
-                                 ctx->tx_obj->callIndex.idx, argIdx));
-
-    err = _getMethod_ItemValue(
-        ctx->tx_obj->transactionVersion, &ctx->tx_obj->method,
-        ctx->tx_obj->callIndex.moduleIdx, ctx->tx_obj->callIndex.idx, argIdx,
-        outVal, outValLen, pageIdx, pageCount);
+             _getMethod_ItemName(&ctx->tx_obj->method, argIdx));
+
+    err = _getMethod_ItemValue(&ctx->tx_obj->method, argIdx, outVal,
+                               outValLen, pageIdx, pageCount);
     return err;
   } else {
     // CONTINUE WITH FIXED ARGUMENTS
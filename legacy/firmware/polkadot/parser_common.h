@@ -36,6 +36,7 @@ typedef enum {
   parser_tx_nesting_not_supported,
   parser_tx_nesting_limit_reached,
   parser_tx_call_vec_too_large,
+  parser_unexpected_genesis_hash,
 } parser_error_t;
 
 typedef struct {
@@ -0,0 +1,144 @@
+#!/usr/bin/env python
+# Generates substrate_calls.h from substrate_calls.json, a digest of the
+# runtime metadata of the supported chains.
+#
+# Argument lists and call descriptors are shared by every runtime that
+# exposes the same call with the same argument types, so adding a runtime
+# only costs its genesis hash and a few bytes of call index.
+import json
+import os
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+
+MAX_CALL_ARGS = 4
+
+ARG_TYPES = {
+    "AccountId": "PD_ARG_ACCOUNT_ID",
+    "AccountIdLookupOf": "PD_ARG_ACCOUNT_ID_LOOKUP",
+    "Compact<Balance>": "PD_ARG_COMPACT_BALANCE",
+    "bool": "PD_ARG_BOOL",
+}
+
+
+def c_str(s):
+    return '"%s"' % s.replace("\\", "\\\\").replace('"', '\\"')
+
+
+def share(table, items):
+    # reuse an identical run of entries when one is already in the table
+    items = list(items)
+    for i in range(len(table) - len(items) + 1):
+        if table[i : i + len(items)] == items:
+            return i
+    table.extend(items)
+    return len(table) - len(items)
+
+
+def arg_list(call, aliases):
+    return tuple(
+        (
+            a["label"],
+            ARG_TYPES[aliases.get(a["type"], a["type"])],
+            a.get("expert", False),
+        )
+        for a in call["args"]
+    )
+
+
+def main():
+    with open(os.path.join(HERE, "substrate_calls.json")) as f:
+        spec = json.load(f)
+
+    def calls(rt):
+        for pallet, p in rt["pallets"].items():
+            module = spec["calls"][pallet]
+            for call, indexes in p["calls"].items():
+                yield p["index"], module, module["calls"][call], indexes
+
+    # place the longest argument lists first so shorter ones can share them
+    args = []  # flattened argument lists, SCALE order
+    lists = set()
+    for rt in spec["runtimes"]:
+        for _, _, c, _ in calls(rt):
+            lists.add(arg_list(c, rt.get("types", {})))
+    for lst in sorted(lists, key=lambda x: (-len(x), x)):
+        share(args, lst)
+
+    descs = []
+    desc_ids = {}
+    runtimes = []
+    entries = []
+    for rt in spec["runtimes"]:
+        genesis = bytes.fromhex(rt["genesis"])
+        assert len(genesis) == 32, rt["name"]
+        rt_entries = {}
+        for pallet_idx, module, c, indexes in calls(rt):
+            names = [a["name"] for a in c["args"]]
+            assert len(names) <= MAX_CALL_ARGS, c["name"]
+            assert sorted(names) == sorted(c["display"]), c["name"]
+            lst = arg_list(c, rt.get("types", {}))
+            desc = (
+                module["name"],
+                c["name"],
+                share(args, lst),
+                len(lst),
+                tuple(names.index(n) for n in c["display"]),
+                c.get("nesting", True),
+            )
+            if desc not in desc_ids:
+                desc_ids[desc] = len(descs)
+                descs.append(desc)
+            for idx in indexes:
+                key = (pallet_idx << 8) | idx
+                assert key not in rt_entries, (rt["name"], c["name"])
+                rt_entries[key] = desc_ids[desc]
+        first = share(entries, sorted(rt_entries.items()))
+        runtimes.append((rt, genesis, first, len(rt_entries)))
+
+    assert len(args) < 256 and len(descs) < 256
+
+    out = [
+        "// This file is generated by substrate_calls.py, do not edit.",
+        "",
+        "static const pd_CallArg_t pd_call_args[] = {",
+    ]
+    for label, type_, expert in args:
+        expert = "true" if expert else "false"
+        out.append("    {%s, %s, %s}," % (c_str(label), type_, expert))
+    out += ["};", "", "static const pd_CallDesc_t pd_calls[] = {"]
+    for module, name, first, count, order, nesting in descs:
+        out.append(
+            "    {%s, %s, %d, %d, {%s}, %s},"
+            % (
+                c_str(module),
+                c_str(name),
+                first,
+                count,
+                ", ".join(str(o) for o in order),
+                "true" if nesting else "false",
+            )
+        )
+    out += ["};", "", "static const pd_CallEntry_t pd_call_index[] = {"]
+    for key, desc in entries:
+        out.append("    {0x%04x, %d}," % (key, desc))
+    out += ["};", "", "static const pd_Runtime_t pd_runtimes[] = {"]
+    for rt, genesis, first, count in runtimes:
+        out.append("    // %s" % rt["name"])
+        out.append("    {%s," % c_str(rt["network"]))
+        rows = [
+            ", ".join("0x%02x" % b for b in genesis[i : i + 8])
+            for i in range(0, 32, 8)
+        ]
+        out.append("     {%s," % rows[0])
+        out += ["      %s," % r for r in rows[1:-1]]
+        out.append("      %s}," % rows[-1])
+        out.append("     %d," % first)
+        out.append("     %d}," % count)
+    out += ["};", ""]
+
+    with open(os.path.join(HERE, "substrate_calls.h"), "wt") as f:
+        f.write("\n".join(out))
+
+
+if __name__ == "__main__":
+    main()
@@ -1,137 +1,163 @@
 #include "substrate_dispatch.h"
+#include <string.h>
 #include "../parser_impl.h"
 
+typedef struct {
+  uint16_t callPrivIdx;  // (module << 8) | call
+  uint8_t desc;          // into pd_calls
+} pd_CallEntry_t;
+
+typedef struct {
+  const char* network;
+  uint8_t genesisHash[32];
+  uint8_t firstCall;  // into pd_call_index, sorted by callPrivIdx
+  uint8_t numCalls;
+} pd_Runtime_t;
+
+#include "substrate_calls.h"
+
+#define PD_NUM_RUNTIMES (sizeof(pd_runtimes) / sizeof(pd_runtimes[0]))
+
+static const pd_Runtime_t* runtime = NULL;
+
+parser_error_t _selectRuntime(const uint8_t* genesisHash, const char* network) {
+  const pd_Runtime_t* byName = NULL;
+  runtime = NULL;
+  for (size_t i = 0; i < PD_NUM_RUNTIMES; i++) {
+    const pd_Runtime_t* rt = &pd_runtimes[i];
+    bool sameNetwork =
+        strncmp(network, rt->network, strlen(rt->network)) == 0;
+    if (genesisHash != NULL &&
+        memcmp(genesisHash, rt->genesisHash, sizeof(rt->genesisHash)) == 0) {
+      if (!sameNetwork) return parser_unexpected_genesis_hash;
+      runtime = rt;
+      return parser_ok;
+    }
+    if (sameNetwork && byName == NULL) byName = rt;
+  }
+  runtime = byName;
+  return parser_ok;
+}
+
+bool _isKnownGenesisHash(const uint8_t* genesisHash) {
+  for (size_t i = 0; i < PD_NUM_RUNTIMES; i++) {
+    if (memcmp(genesisHash, pd_runtimes[i].genesisHash,
+               sizeof(pd_runtimes[i].genesisHash)) == 0) {
+      return true;
+    }
+  }
+  return false;
+}
+
+static const pd_CallDesc_t* _findCall(uint8_t moduleIdx, uint8_t callIdx) {
+  if (runtime == NULL) return NULL;
+  const uint16_t key = ((uint16_t)moduleIdx << 8u) | callIdx;
+  const pd_CallEntry_t* entries = &pd_call_index[runtime->firstCall];
+  uint8_t lo = 0, hi = runtime->numCalls;
+  while (lo < hi) {
+    uint8_t mid = (lo + hi) / 2;
+    if (entries[mid].callPrivIdx == key) return &pd_calls[entries[mid].desc];
+    if (entries[mid].callPrivIdx < key) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return NULL;
+}
+
+static const pd_CallArg_t* _getArg(const pd_Method_t* m, uint8_t itemIdx,
+                                   uint8_t* argIdx) {
+  if (m == NULL || m->desc == NULL || itemIdx >= m->desc->numArgs) {
+    return NULL;
+  }
+  *argIdx = m->desc->order[itemIdx];
+  return &pd_call_args[m->desc->firstArg + *argIdx];
+}
+
 parser_error_t _readMethod(parser_context_t* c, uint8_t moduleIdx,
                            uint8_t callIdx, pd_Method_t* method) {
-  // switch (c->tx_obj->transactionVersion) {
-  // case 25:
-  // case 2:
-  //     return _readMethod_V25(c, moduleIdx, callIdx, &method->V25);
-  // case 26:
-  // case 9:
-  //     return _readMethod_V26(c, moduleIdx, callIdx, &method->V26);
-  // default:
-  //     return parser_tx_version_not_supported;
-  // }
-  return _readMethod_V26(c, moduleIdx, callIdx, &method->V26);
+  const pd_CallDesc_t* desc = _findCall(moduleIdx, callIdx);
+  if (desc == NULL) return parser_unexpected_callIndex;
+
+  memset(method, 0, sizeof(pd_Method_t));
+  method->desc = desc;
+  for (uint8_t i = 0; i < desc->numArgs; i++) {
+    pd_ArgValue_t* v = &method->args[i];
+    switch (pd_call_args[desc->firstArg + i].type) {
+      case PD_ARG_ACCOUNT_ID:
+        CHECK_ERROR(_readAccountId(c, &v->accountId))
+        break;
+      case PD_ARG_ACCOUNT_ID_LOOKUP:
+        CHECK_ERROR(_readAccountIdLookupOfT(c, &v->accountIdLookup))
+        break;
+      case PD_ARG_COMPACT_BALANCE:
+        CHECK_ERROR(_readCompactBalance(c, &v->compactBalance))
+        break;
+      case PD_ARG_BOOL:
+        CHECK_ERROR(_readbool(c, &v->boolean))
+        break;
+      default:
+        return parser_unexpected_value;
+    }
+  }
+  return parser_ok;
 }
 
-uint8_t _getMethod_NumItems(uint32_t transactionVersion, uint8_t moduleIdx,
-                            uint8_t callIdx) {
-  // switch (transactionVersion) {
-  // case 25:
-  // case 2:
-  //     return _getMethod_NumItems_V25(moduleIdx, callIdx);
-  // case 26:
-  // case 9:
-  //     return _getMethod_NumItems_V26(moduleIdx, callIdx);
-  // default:
-  //     return 0;
-  // }
-  (void)transactionVersion;
-  return _getMethod_NumItems_V26(moduleIdx, callIdx);
+uint8_t _getMethod_NumItems(const pd_Method_t* m) {
+  if (m == NULL || m->desc == NULL) return 0;
+  return m->desc->numArgs;
 }
 
-const char* _getMethod_ModuleName(uint32_t transactionVersion,
-                                  uint8_t moduleIdx) {
-  // switch (transactionVersion) {
-  // case 25:
-  // case 2:
-  //     return _getMethod_ModuleName_V25(moduleIdx);
-  // case 26:
-  // case 9:
-  //     return _getMethod_ModuleName_V26(moduleIdx);
-  // default:
-  //     return NULL;
-  // }
-  (void)transactionVersion;
-  return _getMethod_ModuleName_V26(moduleIdx);
+const char* _getMethod_ModuleName(const pd_Method_t* m) {
+  if (m == NULL || m->desc == NULL) return "Unknown module";
+  return m->desc->module;
 }
 
-const char* _getMethod_Name(uint32_t transactionVersion, uint8_t moduleIdx,
-                            uint8_t callIdx) {
-  // switch (transactionVersion) {
-  // case 25:
-  // case 2:
-  //     return _getMethod_Name_V25(moduleIdx, callIdx);
-  // case 26:
-  // case 9:
-  //     return _getMethod_Name_V26(moduleIdx, callIdx);
-  // default:
-  //     return NULL;
-  // }
-  (void)transactionVersion;
-  return _getMethod_Name_V26(moduleIdx, callIdx);
+const char* _getMethod_Name(const pd_Method_t* m) {
+  if (m == NULL || m->desc == NULL) return "Unknown method";
+  return m->desc->name;
 }
 
-const char* _getMethod_ItemName(uint32_t transactionVersion, uint8_t moduleIdx,
-                                uint8_t callIdx, uint8_t itemIdx) {
-  // switch (transactionVersion) {
-  // case 25:
-  // case 2:
-  //     return _getMethod_ItemName_V25(moduleIdx, callIdx, itemIdx);
-  // case 26:
-  // case 9:
-  //     return _getMethod_ItemName_V26(moduleIdx, callIdx, itemIdx);
-  // default:
-  //     return NULL;
-  // }
-  (void)transactionVersion;
-  return _getMethod_ItemName_V26(moduleIdx, callIdx, itemIdx);
+const char* _getMethod_ItemName(const pd_Method_t* m, uint8_t itemIdx) {
+  uint8_t argIdx = 0;
+  const pd_CallArg_t* arg = _getArg(m, itemIdx, &argIdx);
+  if (arg == NULL) return "Unknown item";
+  return arg->name;
 }
 
-parser_error_t _getMethod_ItemValue(uint32_t transactionVersion, pd_Method_t* m,
-                                    uint8_t moduleIdx, uint8_t callIdx,
-                                    uint8_t itemIdx, char* outValue,
-                                    uint16_t outValueLen, uint8_t pageIdx,
-                                    uint8_t* pageCount) {
-  // switch (transactionVersion) {
-  // case 25:
-  // case 2:
-  //     return _getMethod_ItemValue_V25(&m->V25, moduleIdx, callIdx, itemIdx,
-  //     outValue,
-  //         outValueLen, pageIdx, pageCount);
-  // case 26:
-  // case 9:
-  //     return _getMethod_ItemValue_V26(&m->V26, moduleIdx, callIdx, itemIdx,
-  //     outValue,
-  //         outValueLen, pageIdx, pageCount);
-  // default:
-  //     return parser_tx_version_not_supported;
-  // }
-  (void)transactionVersion;
-  return _getMethod_ItemValue_V26(&m->V26, moduleIdx, callIdx, itemIdx,
-                                  outValue, outValueLen, pageIdx, pageCount);
+parser_error_t _getMethod_ItemValue(const pd_Method_t* m, uint8_t itemIdx,
+                                    char* outValue, uint16_t outValueLen,
+                                    uint8_t pageIdx, uint8_t* pageCount) {
+  uint8_t argIdx = 0;
+  const pd_CallArg_t* arg = _getArg(m, itemIdx, &argIdx);
+  if (arg == NULL) return parser_no_data;
+
+  const pd_ArgValue_t* v = &m->args[argIdx];
+  switch (arg->type) {
+    case PD_ARG_ACCOUNT_ID:
+      return _toStringAccountId(&v->accountId, outValue, outValueLen, pageIdx,
+                                pageCount);
+    case PD_ARG_ACCOUNT_ID_LOOKUP:
+      return _toStringAccountIdLookupOfT(&v->accountIdLookup, outValue,
+                                         outValueLen, pageIdx, pageCount);
+    case PD_ARG_COMPACT_BALANCE:
+      return _toStringCompactBalance(&v->compactBalance, outValue,
+                                     outValueLen, pageIdx, pageCount);
+    case PD_ARG_BOOL:
+      return _toStringbool(&v->boolean, outValue, outValueLen, pageCount);
+    default:
+      return parser_no_data;
+  }
 }
 
-bool _getMethod_ItemIsExpert(uint32_t transactionVersion, uint8_t moduleIdx,
-                             uint8_t callIdx, uint8_t itemIdx) {
-  // switch (transactionVersion) {
-  // case 25:
-  // case 2:
-  //     return _getMethod_ItemIsExpert_V25(moduleIdx, callIdx, itemIdx);
-  // case 26:
-  // case 9:
-  //     return _getMethod_ItemIsExpert_V26(moduleIdx, callIdx, itemIdx);
-  // default:
-  //     return false;
-  // }
-  (void)transactionVersion;
-  return _getMethod_ItemIsExpert_V26(moduleIdx, callIdx, itemIdx);
+bool _getMethod_ItemIsExpert(const pd_Method_t* m, uint8_t itemIdx) {
+  uint8_t argIdx = 0;
+  const pd_CallArg_t* arg = _getArg(m, itemIdx, &argIdx);
+  return arg != NULL && arg->expert;
 }
 
-bool _getMethod_IsNestingSupported(uint32_t transactionVersion,
-                                   uint8_t moduleIdx, uint8_t callIdx) {
-  // switch (transactionVersion) {
-  // case 25:
-  // case 2:
-  //     return _getMethod_IsNestingSupported_V25(moduleIdx, callIdx);
-  // case 26:
-  // case 9:
-  //     return _getMethod_IsNestingSupported_V26(moduleIdx, callIdx);
-  // default:
-  //     return false;
-  // }
-  (void)transactionVersion;
-  return _getMethod_IsNestingSupported_V26(moduleIdx, callIdx);
+bool _getMethod_IsNestingSupported(uint8_t moduleIdx, uint8_t callIdx) {
+  const pd_CallDesc_t* desc = _findCall(moduleIdx, callIdx);
+  return desc != NULL && desc->nesting;
 }
@@ -2,29 +2,29 @@
 #define __POLKADOT_SUBSTRATE_DISPATCH_H__
 
 #include <stdbool.h>
-// #include "substrate_dispatch_V25.h"
-#include "substrate_dispatch_V26.h"
+#include <stddef.h>
+#include <stdint.h>
+#include "../parser_impl.h"
+#include "substrate_functions.h"
+
+// Selects the runtime whose call table decodes the following transactions.
+// A known genesis hash decides, the network name is used for chains that are
+// not listed. Fails if the genesis hash belongs to another network.
+parser_error_t _selectRuntime(const uint8_t* genesisHash, const char* network);
+bool _isKnownGenesisHash(const uint8_t* genesisHash);
 
 parser_error_t _readMethod(parser_context_t* c, uint8_t moduleIdx,
                            uint8_t callIdx, pd_Method_t* method);
-uint8_t _getMethod_NumItems(uint32_t transactionVersion, uint8_t moduleIdx,
-                            uint8_t callIdx);
-const char* _getMethod_ModuleName(uint32_t transactionVersion,
-                                  uint8_t moduleIdx);
-const char* _getMethod_Name(uint32_t transactionVersion, uint8_t moduleIdx,
-                            uint8_t callIdx);
-const char* _getMethod_ItemName(uint32_t transactionVersion, uint8_t moduleIdx,
-                                uint8_t callIdx, uint8_t itemIdx);
+uint8_t _getMethod_NumItems(const pd_Method_t* m);
+const char* _getMethod_ModuleName(const pd_Method_t* m);
+const char* _getMethod_Name(const pd_Method_t* m);
+const char* _getMethod_ItemName(const pd_Method_t* m, uint8_t itemIdx);
 
-parser_error_t _getMethod_ItemValue(uint32_t transactionVersion, pd_Method_t* m,
-                                    uint8_t moduleIdx, uint8_t callIdx,
-                                    uint8_t itemIdx, char* outValue,
-                                    uint16_t outValueLen, uint8_t pageIdx,
-                                    uint8_t* pageCount);
+parser_error_t _getMethod_ItemValue(const pd_Method_t* m, uint8_t itemIdx,
+                                    char* outValue, uint16_t outValueLen,
+                                    uint8_t pageIdx, uint8_t* pageCount);
 
-bool _getMethod_ItemIsExpert(uint32_t transactionVersion, uint8_t moduleIdx,
-                             uint8_t callIdx, uint8_t itemIdx);
-bool _getMethod_IsNestingSupported(uint32_t transactionVersion,
-                                   uint8_t moduleIdx, uint8_t callIdx);
+bool _getMethod_ItemIsExpert(const pd_Method_t* m, uint8_t itemIdx);
+bool _getMethod_IsNestingSupported(uint8_t moduleIdx, uint8_t callIdx);
 
 #endif
@@ -38,6 +38,7 @@ parser_error_t _readOptionu8_array_20(parser_context_t* c,
 parser_error_t _readVecTupleDataData(parser_context_t* c,
                                      pd_VecTupleDataData_t* v);
 
+parser_error_t _readAccountId(parser_context_t* c, pd_AccountId_t* v);
 parser_error_t _readAccountIdLookupOfT(parser_context_t* c,
                                        pd_AccountIdLookupOfT_t* v);
 // Common toString functions
@@ -142,6 +143,9 @@ parser_error_t _toStringOptionu8_array_20(const pd_Optionu8_array_20_t* v,
 parser_error_t _toStringVecTupleDataData(const pd_VecTupleDataData_t* v,
                                          char* outValue, uint16_t outValueLen,
                                          uint8_t pageIdx, uint8_t* pageCount);
+parser_error_t _toStringAccountId(const pd_AccountId_t* v, char* outValue,
+                                  uint16_t outValueLen, uint8_t pageIdx,
+                                  uint8_t* pageCount);
 parser_error_t _toStringAccountIdLookupOfT(const pd_AccountIdLookupOfT_t* v,
                                            char* outValue, uint16_t outValueLen,
                                            uint8_t pageIdx, uint8_t* pageCount);
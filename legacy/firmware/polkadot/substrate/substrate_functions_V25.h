@@ -1,7 +0,0 @@
-#ifndef __POLKADOT_SUBSTRATE_FUNCTIONS_V25_H__
-#define __POLKADOT_SUBSTRATE_FUNCTIONS_V25_H__
-
-#include <stddef.h>
-#include <stdint.h>
-#include "../parser_common.h"
-#endif
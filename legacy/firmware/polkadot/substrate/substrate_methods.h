@@ -1,17 +1,51 @@
 #ifndef __POLKADOT_SUBSTRATE_METHODS_H__
 #define __POLKADOT_SUBSTRATE_METHODS_H__
 
-#include "substrate_methods_V25.h"
-#include "substrate_methods_V26.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include "substrate_types.h"
+
+// Calls are described by the tables that substrate_calls.py generates from
+// substrate_calls.json. Argument lists and descriptors are shared between
+// runtimes, each runtime only maps its call indexes onto them.
+#define PD_MAX_CALL_ARGS 4
+
+typedef enum {
+  PD_ARG_ACCOUNT_ID = 0,
+  PD_ARG_ACCOUNT_ID_LOOKUP,
+  PD_ARG_COMPACT_BALANCE,
+  PD_ARG_BOOL,
+} pd_ArgType_e;
+
+typedef struct {
+  const char* name;
+  uint8_t type;  // pd_ArgType_e
+  bool expert;
+} pd_CallArg_t;
+
+typedef struct {
+  const char* module;
+  const char* name;
+  uint8_t firstArg;  // into pd_call_args, arguments are in SCALE order
+  uint8_t numArgs;
+  uint8_t order[PD_MAX_CALL_ARGS];  // display position -> argument
+  bool nesting;
+} pd_CallDesc_t;
 
 typedef union {
-  pd_Method_V26_t V26;
-  pd_Method_V25_t V25;
+  pd_AccountId_t accountId;
+  pd_AccountIdLookupOfT_t accountIdLookup;
+  pd_CompactBalance_t compactBalance;
+  pd_bool_t boolean;
+} pd_ArgValue_t;
+
+// A decoded call. The arguments are read once when the transaction is
+// parsed, displaying them only formats the values kept here.
+typedef struct {
+  const pd_CallDesc_t* desc;
+  pd_ArgValue_t args[PD_MAX_CALL_ARGS];
 } pd_Method_t;
 
-typedef union {
-  pd_MethodNested_V26_t V26;
-  pd_MethodNested_V25_t V25;
-} pd_MethodNested_t;
+typedef pd_Method_t pd_MethodNested_t;
 
 #endif
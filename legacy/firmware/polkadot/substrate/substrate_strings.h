@@ -1,19 +0,0 @@
-#ifndef __POLKADOT_SUBSTRATE_STRINGS_H__
-#define __POLKADOT_SUBSTRATE_STRINGS_H__
-
-// Modules names
-static const char* STR_MO_BALANCES = "Balances";
-
-// Methods names
-static const char* STR_ME_TRANSFER_ALLOW_DEATH = "Transfer allow death";
-static const char* STR_ME_FORCE_TRANSFER = "Force transfer";
-static const char* STR_ME_TRANSFER_KEEP_ALIVE = "Transfer keep alive";
-static const char* STR_ME_TRANSFER_ALL = "Transfer all";
-
-// Items names
-static const char* STR_IT_AMOUNT = "Amount";
-static const char* STR_IT_SOURCE = "Source";
-static const char* STR_IT_DEST = "Send to";
-static const char* STR_IT_KEEP_ALIVE = "Keep alive";
-
-#endif
@@ -7,7 +7,6 @@
 
 extern char __polkadot_ticker[8];
 extern uint16_t __polkadot_decimal;
-extern char polkadot_network[32];
 
 #define IS_PRINTABLE(c) (c >= 0x20 && c <= 0x7e)
 
@@ -66,15 +65,13 @@ parser_error_t _readCallImpl(parser_context_t* c, pd_Call_t* v,
 
   CHECK_ERROR(_readCallIndex(c, &v->callIndex));
 
-  if (!_getMethod_IsNestingSupported(c->tx_obj->transactionVersion,
-                                     v->callIndex.moduleIdx,
+  if (!_getMethod_IsNestingSupported(v->callIndex.moduleIdx,
                                      v->callIndex.idx)) {
     return parser_tx_nesting_not_supported;
   }
 
   // Read and check the contained method on this Call
-  CHECK_ERROR(
-      _readMethod(c, v->callIndex.moduleIdx, v->callIndex.idx, (pd_Method_t*)m))
+  CHECK_ERROR(_readMethod(c, v->callIndex.moduleIdx, v->callIndex.idx, m))
 
   // The instance of 'v' corresponding to the upper call on the stack (persisted
   // variable) will end up having the pointer to the first Call and to the
@@ -399,29 +396,24 @@ parser_error_t _toStringCall(const pd_Call_t* v, char* outValue,
   ctx.tx_obj->nestCallIdx.isTail = false;
 
   // Read the Call, so we get the contained Method
-  parser_error_t err =
-      _readCallImpl(&ctx, &_call, (pd_MethodNested_t*)&_txObj.method);
+  parser_error_t err = _readCallImpl(&ctx, &_call, &_txObj.method);
   if (err != parser_ok) {
     return err;
   }
 
   // Get num items of this current Call
-  uint8_t callNumItems = _getMethod_NumItems(
-      *v->_txVerPtr, v->callIndex.moduleIdx, v->callIndex.idx);
+  uint8_t callNumItems = _getMethod_NumItems(&_txObj.method);
 
   // Count how many pages this call has (including nested ones if they exists)
   for (uint8_t i = 0; i < callNumItems; i++) {
     uint8_t itemPages = 0;
-    _getMethod_ItemValue(*v->_txVerPtr, &_txObj.method,
-                         _call.callIndex.moduleIdx, _call.callIndex.idx, i,
-                         outValue, outValueLen, 0, &itemPages);
+    _getMethod_ItemValue(&_txObj.method, i, outValue, outValueLen, 0,
+                         &itemPages);
     (*pageCount) += itemPages;
   }
 
   if (pageIdx == 0) {
-    snprintf(outValue, outValueLen, "%s",
-             _getMethod_Name(*v->_txVerPtr, v->callIndex.moduleIdx,
-                             v->callIndex.idx));
+    snprintf(outValue, outValueLen, "%s", _getMethod_Name(&_txObj.method));
     return parser_ok;
   }
 
@@ -433,15 +425,13 @@ parser_error_t _toStringCall(const pd_Call_t* v, char* outValue,
 
   for (uint8_t i = 0; i < callNumItems; i++) {
     uint8_t itemPages = 0;
-    _getMethod_ItemValue(*v->_txVerPtr, &_txObj.method, v->callIndex.moduleIdx,
-                         v->callIndex.idx, i, outValue, outValueLen, 0,
+    _getMethod_ItemValue(&_txObj.method, i, outValue, outValueLen, 0,
                          &itemPages);
 
     if (pageIdx < itemPages) {
       uint8_t tmp;
-      _getMethod_ItemValue(*v->_txVerPtr, &_txObj.method,
-                           v->callIndex.moduleIdx, v->callIndex.idx, i,
-                           outValue, outValueLen, pageIdx, &tmp);
+      _getMethod_ItemValue(&_txObj.method, i, outValue, outValueLen, pageIdx,
+                           &tmp);
       return parser_ok;
     }
 
@@ -487,8 +477,7 @@ parser_error_t _toStringVecCall(const pd_VecCall_t* v, char* outValue,
     ctx.tx_obj->nestCallIdx._ptr = NULL;
     ctx.tx_obj->nestCallIdx._nextPtr = NULL;
     ctx.tx_obj->nestCallIdx.slotIdx = 0;
-    CHECK_ERROR(
-        _readCallImpl(&ctx, &_call, (pd_MethodNested_t*)&_txObj.method));
+    CHECK_ERROR(_readCallImpl(&ctx, &_call, &_txObj.method));
     CHECK_ERROR(
         _toStringCall(&_call, outValue, outValueLen, 0, &chunkPageCount));
     (*pageCount) += chunkPageCount;
@@ -500,8 +489,7 @@ parser_error_t _toStringVecCall(const pd_VecCall_t* v, char* outValue,
     ctx.tx_obj->nestCallIdx._ptr = NULL;
     ctx.tx_obj->nestCallIdx._nextPtr = NULL;
     ctx.tx_obj->nestCallIdx.slotIdx = 0;
-    CHECK_ERROR(
-        _readCallImpl(&ctx, &_call, (pd_MethodNested_t*)&_txObj.method));
+    CHECK_ERROR(_readCallImpl(&ctx, &_call, &_txObj.method));
     chunkPageCount = 1;
     currentPage = 0;
     while (currentPage < chunkPageCount) {
@@ -668,9 +656,7 @@ parser_error_t _readTupleAccountIdData(parser_context_t* c,
 parser_error_t _readAccountIdLookupOfT(parser_context_t* c,
                                        pd_AccountIdLookupOfT_t* v) {
   CHECK_INPUT()
-  if (strncmp(polkadot_network, "joystream", 9) != 0) {
-    CHECK_ERROR(_preadUInt8(c, &v->value))
-  }
+  CHECK_ERROR(_preadUInt8(c, &v->value))
   switch (v->value) {
     case 0:  // Id
       CHECK_ERROR(_readAccountId(c, &v->id))
@@ -18,13 +18,6 @@ fl = open("messages_map_limits.h", "wt")
 # len("MessageType_MessageType_") - len("_fields") == 17
 TEMPLATE = "\t{{ {type} {dir} {msg_id:46} {fields:29} {process_func} }},\n"
 
-LABELS = {
-    wire_in: "in messages",
-    wire_out: "out messages",
-    wire_debug_in: "debug in messages",
-    wire_debug_out: "debug out messages",
-}
-
 # interface-direction pairs
 IFACE_DIR_PAIRS = {
     wire_in: ("n", "i"),
@@ -35,13 +28,56 @@ IFACE_DIR_PAIRS = {
 
 SPECIAL_DEBUG_MESSAGES = {"MessageType_LoadDevice"}
 
+# average number of messages per perfect hash bucket
+BUCKET_SIZE = 4
+
 
 def get_wire_extensions(message):
     extensions = message.GetOptions().Extensions
     return (ext for ext in IFACE_DIR_PAIRS if extensions[ext])
 
 
-def handle_message(fh, fl, skipped, message, extension):
+# Lookup key of a message, see messages_map_key() in messages.c
+def message_key(interface, direction, msg_id):
+    assert msg_id <= 0xFFFF
+    return msg_id | (interface == "d") << 16 | (direction == "o") << 17
+
+
+# Must match messages_map_hash() in messages.c
+def message_hash(seed, key):
+    h = ((key ^ seed) * 0x9E3779B1) & 0xFFFFFFFF
+    return h ^ (h >> 15)
+
+
+# Hash and displace: keys are spread over buckets by message_hash(0, key),
+# and each bucket gets the first seed that moves all of its keys to free
+# slots. Biggest buckets are placed first, while most slots are free.
+def perfect_hash(keys, bucket_count):
+    slot_count = len(keys)
+    buckets = [[] for _ in range(bucket_count)]
+    for key in keys:
+        buckets[message_hash(0, key) % bucket_count].append(key)
+
+    seeds = [0] * bucket_count
+    slots = [None] * slot_count
+    for b in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        for seed in range(1, 0x10000):
+            placed = [message_hash(seed, key) % slot_count for key in buckets[b]]
+            if len(set(placed)) == len(placed) and all(
+                slots[slot] is None for slot in placed
+            ):
+                break
+        else:
+            raise ValueError("no perfect hash found, change the bucket count")
+        seeds[b] = seed
+        for slot, key in zip(placed, buckets[b]):
+            slots[slot] = key
+    return seeds, slots
+
+
+def handle_message(fl, entries, notes, skipped, message, extension, condition):
     name = message.name
     short_name = name.split("MessageType_", 1).pop()
     assert short_name != name
@@ -57,13 +93,13 @@ def handle_message(fh, fl, skipped, message, extension):
     no_fsm = options.Extensions[wire_no_fsm]
 
     if getattr(options, "deprecated", None):
-        fh.write(f"\t// Message {short_name} is deprecated\n")
+        notes.append(f"// Message {short_name} is deprecated\n")
         return
     if bootloader:
-        fh.write(f"\t// Message {short_name} is used in bootloader mode only\n")
+        notes.append(f"// Message {short_name} is used in bootloader mode only\n")
         return
     if no_fsm:
-        fh.write(f"\t// Message {short_name} is not used in FSM\n")
+        notes.append(f"// Message {short_name} is not used in FSM\n")
         return
 
     if direction == "i":
@@ -71,13 +107,17 @@ def handle_message(fh, fl, skipped, message, extension):
     else:
         process_func = "0"
 
-    fh.write(
-        TEMPLATE.format(
-            type=f"'{interface}',",
-            dir=f"'{direction}',",
-            msg_id=f"MessageType_{name},",
-            fields=f"{short_name}_fields,",
-            process_func=process_func,
+    entries.append(
+        (
+            message_key(interface, direction, message.number),
+            TEMPLATE.format(
+                type=f"'{interface}',",
+                dir=f"'{direction}',",
+                msg_id=f"MessageType_{name},",
+                fields=f"{short_name}_fields,",
+                process_func=process_func,
+            ),
+            condition,
         )
     )
 
@@ -108,7 +148,7 @@ def handle_message(fh, fl, skipped, message, extension):
 skipped = sys.argv[1:]
 
 fh.write(
-    "\t// This file is automatically generated by messages_map.py -- DO NOT EDIT!\n"
+    "// This file is automatically generated by messages_map.py -- DO NOT EDIT!\n\n"
 )
 fl.write(
     "// This file is automatically generated by messages_map.py -- DO NOT EDIT!\n\n"
@@ -122,23 +162,51 @@ for message in MessageType.DESCRIPTOR.values:
     for extension in get_wire_extensions(message):
         messages[extension].append(message)
 
+entries = []
+notes = []
+
 for extension in (wire_in, wire_out, wire_debug_in, wire_debug_out):
     if extension == wire_debug_in:
-        fh.write("\n#if DEBUG_LINK\n")
         fl.write("\n#if DEBUG_LINK\n")
 
-    fh.write(f"\n\t// {LABELS[extension]}\n\n")
-
     for message in messages[extension]:
-        if message.name in SPECIAL_DEBUG_MESSAGES:
-            fh.write("#if DEBUG_LINK\n")
-        handle_message(fh, fl, skipped, message, extension)
-        if message.name in SPECIAL_DEBUG_MESSAGES:
-            fh.write("#endif\n")
+        condition = None
+        if (
+            extension in (wire_debug_in, wire_debug_out)
+            or message.name in SPECIAL_DEBUG_MESSAGES
+        ):
+            condition = "DEBUG_LINK"
+        handle_message(fl, entries, notes, skipped, message, extension, condition)
 
     if extension == wire_debug_out:
-        fh.write("\n#endif\n")
         fl.write("#endif\n")
 
+keys = [key for key, _, _ in entries]
+assert len(set(keys)) == len(keys)
+bucket_count = (len(keys) + BUCKET_SIZE - 1) // BUCKET_SIZE
+seeds, slots = perfect_hash(keys, bucket_count)
+lines = {key: (line, condition) for key, line, condition in entries}
+
+for note in notes:
+    fh.write(note)
+
+fh.write(f"\n#define MESSAGES_MAP_BUCKETS {bucket_count}\n")
+fh.write(f"#define MESSAGES_MAP_SLOTS {len(slots)}\n\n")
+
+fh.write("static const uint16_t MessagesMapSeeds[MESSAGES_MAP_BUCKETS] = {\n")
+for i in range(0, len(seeds), 8):
+    fh.write("\t" + " ".join(f"{seed}," for seed in seeds[i : i + 8]) + "\n")
+fh.write("};\n\n")
+
+# Slots of messages that are compiled out stay in place, empty.
+fh.write("static const struct MessagesMap_t MessagesMap[MESSAGES_MAP_SLOTS] = {\n")
+for key in slots:
+    line, condition = lines[key]
+    if condition:
+        fh.write(f"#if {condition}\n{line}#else\n\t{{ 0, 0, 0, 0, 0 }},\n#endif\n")
+    else:
+        fh.write(line)
+fh.write("};\n")
+
 fh.close()
 fl.close()
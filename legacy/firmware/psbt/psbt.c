@@ -3,6 +3,8 @@
 #include <stdint.h>
 #include <string.h>
 #include "hasher.h"
+#include "memzero.h"
+#include "transaction.h"
 #include "util.h"
 
 static const uint8_t PSBT_MAGIC_BYTES[5] = {'p', 's', 'b', 't', 0xff};
@@ -86,1030 +88,743 @@ int ser_compact_size(uint64_t value, BufferWriter* writer) {
   return write_bytes(buffer, size, writer);
 }
 
-int deser_string(BufferReader* f, uint8_t* out_buffer, size_t buffer_size,
-                 size_t* out_len) {
-  uint64_t length = deser_compact_size(f);
-  if (length == 0 || length > f->length - f->position || length > buffer_size) {
-    *out_len = 0;
-    return 0;
-  }
-
-  if (!read_bytes(f, out_buffer, length)) {
-    *out_len = 0;
-    return 0;
-  }
 
-  *out_len = length;
-  return 1;
-}
-
-int ser_string(const uint8_t* src, size_t count, BufferWriter* writer) {
+static int ser_string(const uint8_t* src, size_t count, BufferWriter* writer) {
   if (!ser_compact_size(count, writer)) return 0;
   if (count == 0) return 1;
   if (!write_bytes(src, count, writer)) return 0;
   return 1;
 }
 
-int deser_string_to_buffer_reader(BufferReader* f, BufferReader* out_reader) {
-  uint8_t buffer[1024];
-  size_t length;
-  if (!deser_string(f, buffer, sizeof(buffer), &length)) {
-    return 0;
-  }
-
-  init_buffer_reader(out_reader, buffer, length);
-  return 1;
-}
-
-bool deser_ctx_in(BufferReader* reader, CTxIn* input) {
-  if (!read_bytes(reader, input->prevout.hash, sizeof(input->prevout.hash)))
-    return false;
-  if (!read_bytes(reader, (uint8_t*)&input->prevout.n,
-                  sizeof(input->prevout.n)))
-    return false;
-  uint64_t scriptSig_len = deser_compact_size(reader);
-  if (scriptSig_len > sizeof(input->scriptSig)) return false;
-  input->scriptSig_len = scriptSig_len;
-  if (!read_bytes(reader, input->scriptSig, scriptSig_len)) return false;
-  if (!read_bytes(reader, (uint8_t*)&input->nSequence,
-                  sizeof(input->nSequence)))
-    return false;
-  return true;
-}
-bool deser_ctx_out(BufferReader* reader, CTxOut* output) {
-  if (!read_bytes(reader, (uint8_t*)&output->nValue, sizeof(output->nValue)))
-    return false;
-  uint64_t scriptPubKey_len = deser_compact_size(reader);
-  if (scriptPubKey_len > sizeof(output->scriptPubKey)) return false;
-  output->scriptPubKey_len = scriptPubKey_len;
-  if (!read_bytes(reader, output->scriptPubKey, scriptPubKey_len)) return false;
+enum {
+  ST_MAGIC,
+  ST_MAP_START,
+  ST_KEY_LEN,
+  ST_KEY,
+  ST_VALUE_LEN,
+  ST_VALUE,
+  ST_NEXT_MAP,
+  ST_DONE,
+  ST_ERROR,
+};
+
+enum { MAP_GLOBAL, MAP_INPUT, MAP_OUTPUT };
+
+enum { VALUE_BUFFER, VALUE_SKIP, VALUE_TX };
+
+// States of the unsigned transaction, which is parsed as it streams by
+enum {
+  TX_VERSION,
+  TX_VIN_COUNT,
+  TX_IN_OUTPOINT,
+  TX_IN_SCRIPT_LEN,
+  TX_IN_SEQUENCE,
+  TX_VOUT_COUNT,
+  TX_OUT_VALUE,
+  TX_OUT_SCRIPT_LEN,
+  TX_OUT_SCRIPT,
+  TX_LOCKTIME,
+  TX_DONE,
+};
+
+#define KEY_BIT(type) (1u << (type))
+
+static void advance(const uint8_t** data, size_t* len, size_t count) {
+  *data += count;
+  *len -= count;
+}
+
+// Collects `need` bytes at `dst` across chunks, stream->got counts the bytes
+// collected so far.
+static bool take(PsbtStream* stream, const uint8_t** data, size_t* len,
+                 uint8_t* dst, size_t need) {
+  size_t count = MIN(need - stream->got, *len);
+  memcpy(dst + stream->got, *data, count);
+  advance(data, len, count);
+  stream->got += count;
+  if (stream->got < need) return false;
+  stream->got = 0;
   return true;
 }
-bool deser_transaction(BufferReader* reader, CTransaction* tx) {
-  // Read version
-  if (!read_bytes(reader, (uint8_t*)&tx->nVersion, 4)) {
-    return false;
-  }
 
-  // Read input count
-  uint8_t flag = 0;
-  uint64_t vin_count = deser_compact_size(reader);
-  if (vin_count == 0) {
-    if (!read_bytes(reader, &flag, 1)) return false;
-    if (flag == 0) return false;  // flag must be 1
-    vin_count = deser_compact_size(reader);
-  }
-  if (vin_count == 0 || vin_count > MAX_INPUTS) {
-    return false;
-  }
-  tx->vin_len = vin_count;
-  // Read inputs
-  for (size_t i = 0; i < vin_count; i++) {
-    CTxIn* input = &tx->vin[i];
-    if (!deser_ctx_in(reader, input)) return false;
-  }
-
-  // Read output count
-  uint64_t vout_count = deser_compact_size(reader);
-  if (vout_count > MAX_OUTPUTS) {
-    return false;
-  }
-  tx->vout_len = vout_count;
-
-  // Read outputs
-  for (size_t i = 0; i < vout_count; i++) {
-    CTxOut* output = &tx->vout[i];
-    if (!deser_ctx_out(reader, output)) return false;
-  }
-
-  // Read nLockTime
-  if (!read_bytes(reader, (uint8_t*)&tx->nLockTime, 4)) {
-    return false;
+static bool take_compact_size(PsbtStream* stream, const uint8_t** data,
+                              size_t* len, uint64_t* value) {
+  while (*len > 0) {
+    stream->num[stream->got++] = **data;
+    advance(data, len, 1);
+    size_t size = stream->num[0] < 253 ? 1 : (1u << (stream->num[0] - 252)) + 1;
+    if (stream->got == size) {
+      *value = size == 1 ? stream->num[0] : 0;
+      for (size_t i = size - 1; i > 0; i--) {
+        *value = (*value << 8) | stream->num[i];
+      }
+      stream->got = 0;
+      return true;
+    }
   }
-
-  return true;
+  return false;
 }
 
-bool deser_hd_keypath(BufferReader* key_origin_info_reader,
-                      KeyOriginInfo* key_origin) {
-  size_t key_origin_info_reader_len =
-      key_origin_info_reader->length - key_origin_info_reader->position;
-  if (key_origin_info_reader_len % 4 != 0) return false;
-  if (!read_bytes(key_origin_info_reader, (uint8_t*)&key_origin->fingerprint,
-                  4)) {
+static bool deser_hd_keypath(BufferReader* reader, KeyOriginInfo* key_origin) {
+  size_t left = reader->length - reader->position;
+  if (left < 4 || left % 4 != 0) return false;
+  if (left / 4 - 1 > sizeof(key_origin->path) / sizeof(key_origin->path[0]))
     return false;
-  }
-  key_origin->path_len = key_origin_info_reader_len / 4 - 1;
+  if (!read_bytes(reader, key_origin->fingerprint, 4)) return false;
+  key_origin->path_len = left / 4 - 1;
   for (size_t i = 0; i < key_origin->path_len; i++) {
-    if (!read_bytes(key_origin_info_reader, (uint8_t*)&key_origin->path[i],
-                    4)) {
-      return false;
-    }
+    if (!read_bytes(reader, (uint8_t*)&key_origin->path[i], 4)) return false;
   }
   return true;
 }
-bool deser_tap_bip32_derivation(BufferReader* reader,
-                                TAP_BIP32_DERIVATION* tap_bip32_derivation) {
-  BufferReader value_reader = {0};
-  if (!deser_string_to_buffer_reader(reader, &value_reader)) return false;
-  uint64_t num_hashes = deser_compact_size(&value_reader);
-  if (num_hashes > (sizeof(tap_bip32_derivation->tap_leaf_hashs) /
-                    sizeof(tap_bip32_derivation->tap_leaf_hashs[0])))
-    return false;
-  for (size_t i = 0; i < num_hashes; i++) {
-    if (!read_bytes(&value_reader, tap_bip32_derivation->tap_leaf_hashs[i], 32))
-      return false;
-  }
-  tap_bip32_derivation->tap_leaf_hashs_len = num_hashes;
-  if (!deser_hd_keypath(&value_reader, &tap_bip32_derivation->key_origin))
-    return false;
-  return true;
-}
 
-bool ser_key_origin(const KeyOriginInfo* key_origin, BufferWriter* writer) {
-  if (!write_bytes((uint8_t*)&key_origin->fingerprint, 4, writer)) return false;
-  for (size_t i = 0; i < key_origin->path_len; i++) {
-    if (!write_bytes((uint8_t*)&key_origin->path[i], 4, writer)) return false;
-  }
-  return true;
-}
-bool ser_tap_bip32_derivation(const TAP_BIP32_DERIVATION* tap_bip32_derivation,
-                              BufferWriter* writer) {
-  BufferWriter dummy_writer = {0};
-  init_buffer_writer(&dummy_writer, NULL, 0);
-  if (!ser_key_origin(&tap_bip32_derivation->key_origin, &dummy_writer))
-    return false;
-  uint64_t value_len =
-      1 + tap_bip32_derivation->tap_leaf_hashs_len * 32 + dummy_writer.position;
-  if (!ser_compact_size(value_len, writer)) return false;
-  if (!ser_compact_size(tap_bip32_derivation->tap_leaf_hashs_len, writer))
-    return false;
-  for (size_t i = 0; i < tap_bip32_derivation->tap_leaf_hashs_len; i++) {
-    if (!write_bytes(tap_bip32_derivation->tap_leaf_hashs[i], 32, writer))
-      return false;
-  }
-  if (!ser_key_origin(&tap_bip32_derivation->key_origin, writer)) return false;
-  return true;
-}
-bool deser_tap_script_sig(BufferReader* reader, BufferReader* key_reader,
-                          TAP_SCRIPT_SIG* tap_script_sig) {
-  if (!read_bytes(key_reader, tap_script_sig->x_only_pubkey, 32)) return false;
-  if (!read_bytes(key_reader, tap_script_sig->leaf_hash, 32)) return false;
-  uint64_t signature_len = deser_compact_size(reader);
-  if (signature_len != 64 && signature_len != 65) return false;
-  if (!read_bytes(reader, tap_script_sig->signature, signature_len))
-    return false;
-  tap_script_sig->signature_len = signature_len;
-  return true;
-}
-bool deser_tap_leaf_script(BufferReader* reader, BufferReader* key_reader,
-                           TAP_LEAF_SCRIPT* tap_leaf_script) {
-  uint64_t control_block_len = key_reader->length - 1;
-  if (control_block_len > sizeof(tap_leaf_script->control_block)) return false;
-  if (!read_bytes(key_reader, tap_leaf_script->control_block,
-                  control_block_len))
-    return false;
-  tap_leaf_script->control_block_len = control_block_len;
-  uint64_t script_len = deser_compact_size(reader);
-  if (script_len > sizeof(tap_leaf_script->script)) return false;
-  if (!read_bytes(reader, tap_leaf_script->script, script_len - 1))
-    return false;
-  tap_leaf_script->script_len = script_len - 1;
-  if (!read_bytes(reader, (uint8_t*)&tap_leaf_script->leaf_version, 1))
-    return false;
+static bool deser_tap_bip32_derivation(const PsbtStream* stream,
+                                       TAP_BIP32_DERIVATION* derivation) {
+  BufferReader reader = {0};
+  init_buffer_reader(&reader, stream->value, stream->value_len);
+  uint64_t num_hashes = deser_compact_size(&reader);
+  // the leaf hashes are not needed, only skipped
+  if (num_hashes * 32 > reader.length - reader.position) return false;
+  reader.position += num_hashes * 32;
+  memcpy(derivation->x_only_pubkey, stream->key + 1, 32);
+  return deser_hd_keypath(&reader, &derivation->key_origin);
+}
+
+static bool read_value(const PsbtStream* stream, void* dst, size_t size) {
+  if (stream->value_len != size) return false;
+  memcpy(dst, stream->value, size);
   return true;
 }
-bool deser_partial_sig(BufferReader* reader, BufferReader* key_reader,
-                       Partial_Sig* partial_sig) {
-  if (key_reader->length != 34 && key_reader->length != 66) return false;
-  uint8_t key_len = key_reader->length - 1;
-  if (!read_bytes(key_reader, partial_sig->pubkey, key_len)) return false;
-  partial_sig->pubkey_len = key_len;
-  if (!deser_string(reader, partial_sig->sig, sizeof(partial_sig->sig),
-                    &partial_sig->sig_len))
-    return false;
-  return true;
+
+static bool read_compact_value(const PsbtStream* stream, uint32_t* value) {
+  BufferReader reader = {0};
+  init_buffer_reader(&reader, stream->value, stream->value_len);
+  *value = deser_compact_size(&reader);
+  return reader.position == reader.length;
 }
-bool ser_partial_sig(BufferWriter* writer, const Partial_Sig* partial_sig) {
-  uint8_t key[66] = {0};
-  uint8_t key_len = partial_sig->pubkey_len + 1;
-  key[0] = PSBT_IN_PARTIAL_SIG;
-  memcpy(key + 1, partial_sig->pubkey, partial_sig->pubkey_len);
-  if (!ser_string(key, key_len, writer)) return false;
-  if (!ser_string(partial_sig->sig, partial_sig->sig_len, writer)) return false;
+
+// Marks a key type that may appear only once in a map.
+static bool key_once(PsbtStream* stream) {
+  uint8_t type = stream->key[0];
+  if (stream->seen & KEY_BIT(type)) return false;
+  stream->seen |= KEY_BIT(type);
   return true;
 }
-bool deser_psbt_input(BufferReader* reader, PartiallySignedInput* input) {
-  while (1) {
-    uint8_t key[193] = {0};
-    size_t key_len = 0;
-    if (!deser_string(reader, key, sizeof(key), &key_len)) break;
-    if (key_len == 0) break;  // Separator (key_len of 0)
-    uint8_t key_type;
-    BufferReader key_reader = {0};
-    init_buffer_reader(&key_reader, key, key_len);
-    if (!read_bytes(&key_reader, &key_type, 1)) return false;
-    switch (key_type) {
-      case PSBT_IN_NON_WITNESS_UTXO:
-        if (input->non_witness_utxo_lookuped || key_len > 1) return false;
-        BufferReader tx_reader = {0};
-        if (!deser_string_to_buffer_reader(reader, &tx_reader)) return false;
-        if (!deser_transaction(&tx_reader, &input->non_witness_utxo))
-          return false;
-        input->non_witness_utxo_lookuped = true;
-        break;
-      case PSBT_IN_WITNESS_UTXO:
-        if (input->witness_utxo_lookuped || key_len > 1) return false;
-        BufferReader out_reader = {0};
-        if (!deser_string_to_buffer_reader(reader, &out_reader)) return false;
-        if (!deser_ctx_out(&out_reader, &input->witness_utxo)) return false;
-        input->witness_utxo_lookuped = true;
-        break;
-      case PSBT_IN_PARTIAL_SIG:
-        // TODO: check the duplicate partial_sig
-        if (input->partial_sigs_len >= MAX_INPUTS - 1) return false;
-        if (!deser_partial_sig(reader, &key_reader,
-                               &input->partial_sigs[input->partial_sigs_len]))
-          return false;
-        input->partial_sigs_len++;
-        break;
-      case PSBT_IN_SIGHASH_TYPE:
-        if (input->sighash_type_lookuped || key_len > 1) return false;
-        uint64_t sighash_type_len = deser_compact_size(reader);
-        if (sighash_type_len != 4) return false;
-        if (!read_bytes(reader, (uint8_t*)&input->sighash_type, 4))
-          return false;
-        input->sighash_type_lookuped = true;
-        break;
-      case PSBT_IN_REDEEM_SCRIPT:
-        // ignore
-        return false;
-        if (input->redeem_script_lookuped || key_len > 1) return false;
-        if (!deser_string(reader, input->redeem_script,
-                          sizeof(input->redeem_script),
-                          &input->redeem_script_len))
-          return false;
-        input->redeem_script_lookuped = true;
-        break;
-      case PSBT_IN_WITNESS_SCRIPT:
-        // ignore
-        return false;
-        if (input->witness_script_lookuped || key_len > 1) return false;
-        if (!deser_string(reader, input->witness_script,
-                          sizeof(input->witness_script),
-                          &input->witness_script_len))
-          return false;
-        input->witness_script_lookuped = true;
-        break;
-      case PSBT_IN_BIP32_DERIVATION:
-        if (input->bip32_path_lookuped || (key_len != 34 && key_len != 66))
-          return false;
-        if (!read_bytes(&key_reader, (uint8_t*)input->bip32_path.pubkey,
-                        key_len - 1))
-          return false;
-        input->bip32_path.pubkey_len = key_len - 1;
-        if (!deser_hd_keypath(reader, &input->bip32_path.key_origin))
-          return false;
-        input->bip32_path_lookuped = true;
-        break;
-      case PSBT_IN_FINAL_SCRIPTSIG:
-        // ignore
+
+static bool begin_global_value(PsbtStream* stream) {
+  switch (stream->key[0]) {
+    case PSBT_GLOBAL_XPUB:
+      // not support
+      return false;
+    case PSBT_GLOBAL_UNSIGNED_TX:
+      stream->value_mode = VALUE_TX;
+      stream->tx_state = TX_VERSION;
+      // fall through
+    case PSBT_GLOBAL_TX_VERSION:
+    case PSBT_GLOBAL_FALLBACK_LOCKTIME:
+    case PSBT_GLOBAL_INPUT_COUNT:
+    case PSBT_GLOBAL_OUTPUT_COUNT:
+    case PSBT_GLOBAL_TX_MODIFIABLE:
+      return stream->key_len == 1 && key_once(stream);
+    case PSBT_GLOBAL_VERSION:
+      if (stream->key_len > 1 || stream->global_version_lookuped) return false;
+      stream->global_version_lookuped = true;
+      return true;
+    default:
+      stream->value_mode = VALUE_SKIP;
+      return true;
+  }
+}
+
+static bool begin_input_value(PsbtStream* stream) {
+  PartiallySignedInput* input = &stream->input;
+  uint8_t type = stream->key[0];
+  size_t key_len = stream->key_len;
+  switch (type) {
+    case PSBT_IN_NON_WITNESS_UTXO:
+      if (key_len > 1) return false;
+      input->non_witness_utxo_lookuped = true;
+      stream->value_mode = VALUE_SKIP;
+      return key_once(stream);
+    case PSBT_IN_PARTIAL_SIG:
+      input->partial_sig_lookuped = true;
+      stream->value_mode = VALUE_SKIP;
+      return key_len == 34 || key_len == 66;
+    case PSBT_IN_BIP32_DERIVATION:
+      if (key_len != 34 && key_len != 66) return false;
+      // the first compressed key is kept, it may be the one of a P2WPKH
+      if (key_len == 66 || input->bip32_paths++ > 0)
+        stream->value_mode = VALUE_SKIP;
+      return true;
+    case PSBT_IN_TAP_SCRIPT_SIG:
+      stream->value_mode = VALUE_SKIP;
+      return key_len == 65;
+    case PSBT_IN_REDEEM_SCRIPT:
+    case PSBT_IN_WITNESS_SCRIPT:
+    case PSBT_IN_FINAL_SCRIPTSIG:
+    case PSBT_IN_FINAL_SCRIPTWITNESS:
+      // ignore
+      return false;
+    case PSBT_IN_PREVIOUS_TXID:
+    case PSBT_IN_OUTPUT_INDEX:
+    case PSBT_IN_SEQUENCE:
+    case PSBT_IN_REQUIRED_TIME_LOCKTIME:
+    case PSBT_IN_REQUIRED_HEIGHT_LOCKTIME:
+      if (stream->global_version < 2) return false;
+      // fall through
+    case PSBT_IN_WITNESS_UTXO:
+    case PSBT_IN_SIGHASH_TYPE:
+    case PSBT_IN_TAP_KEY_SIG:
+    case PSBT_IN_TAP_INTERNAL_KEY:
+    case PSBT_IN_TAP_MERKLE_ROOT:
+      return key_len == 1 && key_once(stream);
+    case PSBT_IN_TAP_LEAF_SCRIPT:
+      // the key is the control block, 33 + 32 * depth bytes
+      if (key_len < 34 || (key_len - 34) % 32 != 0) return false;
+      if (stream->value_left == 0 ||
+          stream->value_left > sizeof(input->leaf_script))
         return false;
-        if (input->final_script_sig_lookuped || key_len > 1) return false;
-        if (!deser_string(reader, input->final_script_sig,
-                          sizeof(input->final_script_sig),
-                          &input->final_script_sig_len))
-          return false;
-        input->final_script_sig_lookuped = true;
-        break;
-      case PSBT_IN_FINAL_SCRIPTWITNESS:
-        // ignore
+      stream->value_dst = input->leaf_script;
+      return key_once(stream);
+    case PSBT_IN_TAP_BIP32_DERIVATION:
+      return key_len == 33 && key_once(stream);
+    default:
+      stream->value_mode = VALUE_SKIP;
+      return true;
+  }
+}
+
+static bool begin_output_value(PsbtStream* stream) {
+  uint8_t type = stream->key[0];
+  size_t key_len = stream->key_len;
+  switch (type) {
+    case PSBT_OUT_REDEEM_SCRIPT:
+    case PSBT_OUT_WITNESS_SCRIPT:
+    case PSBT_OUT_TAP_TREE:
+      // ignore
+      return false;
+    case PSBT_OUT_BIP32_DERIVATION:
+      return (key_len == 34 || key_len == 66) && key_once(stream);
+    case PSBT_OUT_AMOUNT:
+    case PSBT_OUT_SCRIPT:
+      if (stream->global_version < 2) return false;
+      // fall through
+    case PSBT_OUT_TAP_INTERNAL_KEY:
+      return key_len == 1 && key_once(stream);
+    case PSBT_OUT_TAP_BIP32_DERIVATION:
+      return key_len == 33 && key_once(stream);
+    default:
+      stream->value_mode = VALUE_SKIP;
+      return true;
+  }
+}
+
+// Decides what to do with the value of the record whose key has been read.
+static bool begin_value(PsbtStream* stream) {
+  stream->value_mode = VALUE_BUFFER;
+  stream->value_dst = stream->value;
+  stream->value_len = stream->value_left;
+  bool ok = false;
+  switch (stream->map) {
+    case MAP_GLOBAL:
+      ok = begin_global_value(stream);
+      break;
+    case MAP_INPUT:
+      ok = begin_input_value(stream);
+      break;
+    case MAP_OUTPUT:
+      ok = begin_output_value(stream);
+      break;
+  }
+  if (!ok) return false;
+  return stream->value_mode != VALUE_BUFFER ||
+         stream->value_dst != stream->value ||
+         stream->value_left <= sizeof(stream->value);
+}
+
+static bool end_global_value(PsbtStream* stream) {
+  switch (stream->key[0]) {
+    case PSBT_GLOBAL_UNSIGNED_TX:
+      stream->tx_lookuped = true;
+      return stream->tx_state == TX_DONE;
+    case PSBT_GLOBAL_TX_VERSION:
+      return read_value(stream, &stream->tx_version, 4);
+    case PSBT_GLOBAL_FALLBACK_LOCKTIME:
+      return read_value(stream, &stream->fallback_locktime, 4);
+    case PSBT_GLOBAL_INPUT_COUNT:
+      return read_compact_value(stream, &stream->inputs_len);
+    case PSBT_GLOBAL_OUTPUT_COUNT:
+      return read_compact_value(stream, &stream->outputs_len);
+    case PSBT_GLOBAL_TX_MODIFIABLE:
+      return stream->value_len == 1;
+    case PSBT_GLOBAL_VERSION:
+      return read_value(stream, &stream->global_version, 4);
+    default:
+      return true;
+  }
+}
+
+static bool end_input_value(PsbtStream* stream) {
+  PartiallySignedInput* input = &stream->input;
+  BufferReader reader = {0};
+  init_buffer_reader(&reader, stream->value, stream->value_len);
+  switch (stream->key[0]) {
+    case PSBT_IN_WITNESS_UTXO:
+      if (!read_bytes(&reader, (uint8_t*)&input->amount, 8)) return false;
+      input->script_pubkey_len = deser_compact_size(&reader);
+      if (input->script_pubkey_len > sizeof(input->script_pubkey)) return false;
+      if (!read_bytes(&reader, input->script_pubkey, input->script_pubkey_len))
         return false;
-        if (input->final_script_witness_lookuped || key_len > 1) return false;
-        if (!deser_string(reader, input->final_script_witness,
-                          sizeof(input->final_script_witness),
-                          &input->final_script_witness_len))
-          return false;
-        input->final_script_witness_lookuped = true;
-        break;
-      case PSBT_IN_PREVIOUS_TXID:
-        if (input->prev_txid_lookuped || key_len > 1) return false;
-        uint64_t prev_txid_len = deser_compact_size(reader);
-        if (prev_txid_len != 32) return false;
-        if (!read_bytes(reader, input->prev_txid, sizeof(input->prev_txid)))
-          return false;
-        input->prev_txid_lookuped = true;
-        break;
-      case PSBT_IN_OUTPUT_INDEX:
-        if (input->prev_out_index_lookuped || key_len > 1) return false;
-        uint64_t prev_out_index_len = deser_compact_size(reader);
-        if (prev_out_index_len != 4) return false;
-        if (!read_bytes(reader, (uint8_t*)&input->prev_out_index, 4))
-          return false;
-        input->prev_out_index_lookuped = true;
-        break;
-      case PSBT_IN_SEQUENCE:
-        if (input->sequence_lookuped || key_len > 1) return false;
-        uint64_t sequence_len = deser_compact_size(reader);
-        if (sequence_len != 4) return false;
-        if (!read_bytes(reader, (uint8_t*)&input->sequence, 4)) return false;
-        input->sequence_lookuped = true;
-        break;
-      case PSBT_IN_REQUIRED_TIME_LOCKTIME:
-        if (input->time_locktime_lookuped || key_len > 1) return false;
-        uint64_t time_locktime_len = deser_compact_size(reader);
-        if (time_locktime_len != 4) return false;
-        if (!read_bytes(reader, (uint8_t*)&input->time_locktime, 4))
-          return false;
-        input->time_locktime_lookuped = true;
-        break;
-      case PSBT_IN_REQUIRED_HEIGHT_LOCKTIME:
-        if (input->height_locktime_lookuped || key_len > 1) return false;
-        uint64_t height_locktime_len = deser_compact_size(reader);
-        if (height_locktime_len != 4) return false;
-        if (!read_bytes(reader, (uint8_t*)&input->height_locktime, 4))
-          return false;
-        input->height_locktime_lookuped = true;
-        break;
-      case PSBT_IN_TAP_KEY_SIG:
-        if (input->tap_key_sig_lookuped || key_len > 1) return false;
-        uint64_t tap_key_sig_len = deser_compact_size(reader);
-        if (tap_key_sig_len != 64 && tap_key_sig_len != 65) return false;
-        if (!read_bytes(reader, input->tap_key_sig, tap_key_sig_len))
-          return false;
-        input->tap_key_sig_len = tap_key_sig_len;
-        input->tap_key_sig_lookuped = true;
-        break;
-      case PSBT_IN_TAP_SCRIPT_SIG:
-        if (input->tap_script_sig_lookuped || key_len != 65) return false;
-        if (!deser_tap_script_sig(reader, &key_reader, &input->tap_script_sig))
-          return false;
-        input->tap_script_sig_lookuped = true;
-        break;
-      case PSBT_IN_TAP_LEAF_SCRIPT:
-        if (input->tap_leaf_script_lookuped || key_len < 34 ||
-            (key_len - 2) % 32 != 0)
-          return false;
-        if (!deser_tap_leaf_script(reader, &key_reader,
-                                   &input->tap_leaf_script))
-          return false;
-        input->tap_leaf_script_lookuped = true;
-        break;
-      case PSBT_IN_TAP_BIP32_DERIVATION:
-        if (input->tap_bip32_path_lookuped || key_len != 33) return false;
-        if (!read_bytes(&key_reader, input->tap_bip32_path.x_only_pubkey, 32))
-          return false;
-        if (!deser_tap_bip32_derivation(reader, &input->tap_bip32_path))
-          return false;
-        input->tap_bip32_path_lookuped = true;
-        break;
-      case PSBT_IN_TAP_INTERNAL_KEY:
-        if (input->tap_internal_key_lookuped || key_len > 1) return false;
-        uint64_t tap_internal_key_len = deser_compact_size(reader);
-        if (tap_internal_key_len != 32) return false;
-        if (!read_bytes(reader, input->tap_internal_key, 32)) return false;
-        input->tap_internal_key_lookuped = true;
-        break;
-      case PSBT_IN_TAP_MERKLE_ROOT:
-        if (input->tap_merkle_root_lookuped || key_len > 1) return false;
-        uint64_t tap_merkle_root_len = deser_compact_size(reader);
-        if (tap_merkle_root_len != 32) return false;
-        if (!read_bytes(reader, input->tap_merkle_root, 32)) return false;
-        input->tap_merkle_root_lookuped = true;
+      input->witness_utxo_lookuped = true;
+      return reader.position == reader.length;
+    case PSBT_IN_BIP32_DERIVATION:
+      memcpy(input->bip32_pubkey, stream->key + 1, 33);
+      return deser_hd_keypath(&reader, &input->bip32_path);
+    case PSBT_IN_SIGHASH_TYPE:
+      input->sighash_type_lookuped = true;
+      return read_value(stream, &input->sighash_type, 4);
+    case PSBT_IN_PREVIOUS_TXID:
+      input->prev_txid_lookuped = true;
+      return read_value(stream, input->prev_txid, 32);
+    case PSBT_IN_OUTPUT_INDEX:
+      input->prev_out_index_lookuped = true;
+      return read_value(stream, &input->prev_out_index, 4);
+    case PSBT_IN_SEQUENCE:
+      input->sequence_lookuped = true;
+      return read_value(stream, &input->sequence, 4);
+    case PSBT_IN_REQUIRED_TIME_LOCKTIME:
+      input->time_locktime_lookuped = true;
+      return read_value(stream, &input->time_locktime, 4);
+    case PSBT_IN_REQUIRED_HEIGHT_LOCKTIME:
+      input->height_locktime_lookuped = true;
+      return read_value(stream, &input->height_locktime, 4);
+    case PSBT_IN_TAP_KEY_SIG:
+      input->tap_key_sig_lookuped = true;
+      return stream->value_len == 64 || stream->value_len == 65;
+    case PSBT_IN_TAP_LEAF_SCRIPT:
+      input->leaf_script_len = stream->value_len - 1;
+      input->leaf_version = input->leaf_script[input->leaf_script_len];
+      input->tap_leaf_script_lookuped = true;
+      return true;
+    case PSBT_IN_TAP_BIP32_DERIVATION:
+      input->tap_bip32_path_lookuped = true;
+      return deser_tap_bip32_derivation(stream, &input->tap_bip32_path);
+    case PSBT_IN_TAP_INTERNAL_KEY:
+      input->tap_internal_key_lookuped = true;
+      return read_value(stream, input->tap_internal_key, 32);
+    case PSBT_IN_TAP_MERKLE_ROOT:
+      input->tap_merkle_root_lookuped = true;
+      return stream->value_len == 32;
+    default:
+      return true;
+  }
+}
+
+static bool end_output_value(PsbtStream* stream) {
+  PartiallySignedOutput* output = &stream->output;
+  BufferReader reader = {0};
+  init_buffer_reader(&reader, stream->value, stream->value_len);
+  switch (stream->key[0]) {
+    case PSBT_OUT_BIP32_DERIVATION: {
+      KeyOriginInfo key_origin = {0};
+      if (!deser_hd_keypath(&reader, &key_origin)) return false;
+      memcpy(output->bip32_fingerprint, key_origin.fingerprint, 4);
+      output->bip32_path_lookuped = true;
+      return true;
+    }
+    case PSBT_OUT_AMOUNT:
+      output->amount_lookuped = true;
+      return read_value(stream, &output->amount, 8);
+    case PSBT_OUT_SCRIPT:
+      if (stream->value_len > sizeof(output->script)) return false;
+      memcpy(output->script, stream->value, stream->value_len);
+      output->script_len = stream->value_len;
+      output->script_lookuped = true;
+      return true;
+    case PSBT_OUT_TAP_INTERNAL_KEY:
+      output->tap_internal_key_lookuped = true;
+      return read_value(stream, output->tap_internal_key, 32);
+    case PSBT_OUT_TAP_BIP32_DERIVATION:
+      output->tap_bip32_path_lookuped = true;
+      return deser_tap_bip32_derivation(stream, &output->tap_bip32_path);
+    default:
+      return true;
+  }
+}
+
+static bool end_value(PsbtStream* stream) {
+  if (stream->value_mode == VALUE_SKIP) return true;
+  switch (stream->map) {
+    case MAP_GLOBAL:
+      return end_global_value(stream);
+    case MAP_INPUT:
+      return end_input_value(stream);
+    default:
+      return end_output_value(stream);
+  }
+}
+
+// Parses the unsigned transaction of a version 0 PSBT. Its prevouts and
+// sequences go straight to the sighash midstates, only the outputs are kept
+// until their maps have been parsed.
+static bool feed_tx(PsbtStream* stream, const uint8_t** data, size_t* len) {
+  uint64_t count = 0;
+  while (*len > 0) {
+    switch (stream->tx_state) {
+      case TX_VERSION:
+        if (!take(stream, data, len, stream->value, 4)) return true;
+        memcpy(&stream->tx_version, stream->value, 4);
+        stream->tx_state = TX_VIN_COUNT;
+        break;
+      case TX_VIN_COUNT:
+        if (!take_compact_size(stream, data, len, &count)) return true;
+        // no segwit marker, the unsigned transaction has no witnesses
+        if (count == 0 || count > PSBT_MAX_INPUTS) return false;
+        stream->inputs_len = count;
+        stream->tx_index = 0;
+        stream->tx_state = TX_IN_OUTPOINT;
+        break;
+      case TX_IN_OUTPOINT:
+        if (!take(stream, data, len, stream->value, 36)) return true;
+        hasher_Update(&stream->hasher.hasher_prevouts, stream->value, 36);
+        memcpy(stream->inputs[stream->tx_index].outpoint, stream->value, 36);
+        stream->tx_state = TX_IN_SCRIPT_LEN;
+        break;
+      case TX_IN_SCRIPT_LEN:
+        if (!take_compact_size(stream, data, len, &count)) return true;
+        if (count != 0) return false;
+        stream->tx_state = TX_IN_SEQUENCE;
+        break;
+      case TX_IN_SEQUENCE: {
+        if (!take(stream, data, len, stream->value, 4)) return true;
+        uint32_t sequence = 0;
+        memcpy(&sequence, stream->value, 4);
+        hasher_Update(&stream->hasher.hasher_sequences, stream->value, 4);
+        stream->inputs[stream->tx_index].sequence = sequence;
+        if (sequence != 0xFFFFFFFF) stream->locktime_disabled = false;
+        stream->tx_state = ++stream->tx_index < stream->inputs_len
+                               ? TX_IN_OUTPOINT
+                               : TX_VOUT_COUNT;
+        break;
+      }
+      case TX_VOUT_COUNT:
+        if (!take_compact_size(stream, data, len, &count)) return true;
+        if (count == 0 || count > PSBT_MAX_OUTPUTS) return false;
+        stream->outputs_len = count;
+        stream->tx_index = 0;
+        stream->tx_state = TX_OUT_VALUE;
+        break;
+      case TX_OUT_VALUE:
+        if (!take(stream, data, len, stream->value, 8)) return true;
+        memcpy(&stream->tx_outputs[stream->tx_index].amount, stream->value, 8);
+        stream->tx_state = TX_OUT_SCRIPT_LEN;
+        break;
+      case TX_OUT_SCRIPT_LEN:
+        if (!take_compact_size(stream, data, len, &count)) return true;
+        if (count > PSBT_MAX_SCRIPT_SIZE) return false;
+        stream->tx_outputs[stream->tx_index].script_len = count;
+        stream->tx_state = TX_OUT_SCRIPT;
+        break;
+      case TX_OUT_SCRIPT: {
+        PsbtTxOutput* output = &stream->tx_outputs[stream->tx_index];
+        if (!take(stream, data, len, output->script, output->script_len))
+          return true;
+        stream->tx_state = ++stream->tx_index < stream->outputs_len
+                               ? TX_OUT_VALUE
+                               : TX_LOCKTIME;
+        break;
+      }
+      case TX_LOCKTIME:
+        if (!take(stream, data, len, stream->value, 4)) return true;
+        memcpy(&stream->fallback_locktime, stream->value, 4);
+        stream->tx_state = TX_DONE;
         break;
       default:
-        // TODO: handle unknown key type
+        // trailing bytes
         return false;
     }
   }
   return true;
 }
-bool deser_psbt_output(BufferReader* reader, PartiallySignedOutput* output) {
-  while (1) {
-    uint8_t key[66] = {0};
-    size_t key_len = 0;
-    if (!deser_string(reader, key, sizeof(key), &key_len)) break;
-    if (key_len == 0) break;  // Separator (key_len of 0)
-    uint8_t key_type;
-    BufferReader key_reader = {0};
-    init_buffer_reader(&key_reader, key, key_len);
-    if (!read_bytes(&key_reader, &key_type, 1)) return false;
-    switch (key_type) {
-      case PSBT_OUT_REDEEM_SCRIPT:
-        // ignore
-        return false;
-        if (output->redeem_script_lookuped || key_len > 1) return false;
-        if (!deser_string(reader, output->redeem_script,
-                          sizeof(output->redeem_script),
-                          &output->redeem_script_len))
-          return false;
-        output->redeem_script_lookuped = true;
-        break;
-      case PSBT_OUT_WITNESS_SCRIPT:
-        // ignore
-        return false;
-        if (output->witness_script_lookuped || key_len > 1) return false;
-        if (!deser_string(reader, output->witness_script,
-                          sizeof(output->witness_script),
-                          &output->witness_script_len))
-          return false;
-        output->witness_script_lookuped = true;
-        break;
-      case PSBT_OUT_BIP32_DERIVATION:
-        if (output->bip32_path_lookuped || (key_len != 34 && key_len != 66))
-          return false;
-        if (!read_bytes(&key_reader, (uint8_t*)output->bip32_path.pubkey,
-                        key_len - 1))
-          return false;
-        output->bip32_path.pubkey_len = key_len - 1;
-        if (!deser_hd_keypath(reader, &output->bip32_path.key_origin))
-          return false;
-        output->bip32_path_lookuped = true;
-        break;
-      case PSBT_OUT_AMOUNT:
-        if (output->amount_lookuped || key_len > 1) return false;
-        uint64_t amount_len = deser_compact_size(reader);
-        if (amount_len != 8) return false;
-        if (!read_bytes(reader, (uint8_t*)&output->amount, 8)) return false;
-        output->amount_lookuped = true;
-        break;
-      case PSBT_OUT_SCRIPT:
-        if (output->script_lookuped || key_len > 1) return false;
-        if (!deser_string(reader, output->script, sizeof(output->script),
-                          &output->script_len))
-          return false;
-        output->script_lookuped = true;
-        break;
-      case PSBT_OUT_TAP_INTERNAL_KEY:
-        if (output->tap_internal_key_lookuped || key_len > 1) return false;
-        uint64_t tap_internal_key_len = deser_compact_size(reader);
-        if (tap_internal_key_len != 32) return false;
-        if (!read_bytes(reader, output->tap_internal_key, 32)) return false;
-        output->tap_internal_key_lookuped = true;
-        break;
-      case PSBT_OUT_TAP_TREE:
-        // ignore
-        return false;
-        if (output->tap_tree_lookuped || key_len > 1) return false;
-        if (!deser_string(reader, output->tap_tree, sizeof(output->tap_tree),
-                          &output->tap_tree_len))
-          return false;
-        output->tap_tree_lookuped = true;
-        break;
-      case PSBT_OUT_TAP_BIP32_DERIVATION:
-        if (output->tap_bip32_path_lookuped || key_len != 33) return false;
-        if (!read_bytes(&key_reader, output->tap_bip32_path.x_only_pubkey, 32))
-          return false;
-        if (!deser_tap_bip32_derivation(reader, &output->tap_bip32_path))
-          return false;
-        output->tap_bip32_path_lookuped = true;
-        break;
-      default:
-        // TODO: handle unknown key type
-        return false;
+
+static bool feed_value(PsbtStream* stream, const uint8_t** data, size_t* len) {
+  size_t count = MIN(*len, stream->value_left);
+  switch (stream->value_mode) {
+    case VALUE_BUFFER:
+      memcpy(stream->value_dst + (stream->value_len - stream->value_left),
+             *data, count);
+      break;
+    case VALUE_TX: {
+      const uint8_t* tx_data = *data;
+      size_t tx_len = count;
+      if (!feed_tx(stream, &tx_data, &tx_len)) return false;
+      break;
     }
+    default:
+      break;
   }
-  return true;
-}
-bool ser_ctx_in(BufferWriter* writer, const CTxIn* input) {
-  if (!write_bytes(input->prevout.hash, 32, writer)) return false;
-  if (!write_bytes((uint8_t*)&input->prevout.n, 4, writer)) return false;
-  if (!ser_compact_size(input->scriptSig_len, writer)) return false;
-  if (!write_bytes(input->scriptSig, input->scriptSig_len, writer))
-    return false;
-  if (!write_bytes((uint8_t*)&input->nSequence, 4, writer)) return false;
+  advance(data, len, count);
+  stream->value_left -= count;
   return true;
 }
 
-bool ser_ctx_out(BufferWriter* writer, const CTxOut* output) {
-  if (!write_bytes((uint8_t*)&output->nValue, 8, writer)) return false;
-  if (!ser_compact_size(output->scriptPubKey_len, writer)) return false;
-  if (!write_bytes(output->scriptPubKey, output->scriptPubKey_len, writer))
+static bool end_globals(PsbtStream* stream) {
+  const uint32_t v2_keys =
+      KEY_BIT(PSBT_GLOBAL_TX_VERSION) | KEY_BIT(PSBT_GLOBAL_INPUT_COUNT) |
+      KEY_BIT(PSBT_GLOBAL_OUTPUT_COUNT);
+  if (stream->global_version == 0) {
+    if (!stream->tx_lookuped) return false;
+    if (stream->seen & (v2_keys | KEY_BIT(PSBT_GLOBAL_FALLBACK_LOCKTIME) |
+                        KEY_BIT(PSBT_GLOBAL_TX_MODIFIABLE)))
+      return false;
+  } else if (stream->global_version == 1) {
+    return false;
+  } else {
+    if (stream->tx_lookuped) return false;
+    if ((stream->seen & v2_keys) != v2_keys) return false;
+  }
+  if (stream->inputs_len == 0 || stream->inputs_len > PSBT_MAX_INPUTS)
+    return false;
+  if (stream->outputs_len == 0 || stream->outputs_len > PSBT_MAX_OUTPUTS)
     return false;
+  stream->map = MAP_INPUT;
+  stream->index = 0;
+  stream->state = ST_MAP_START;
   return true;
 }
 
-bool ser_transaction(BufferWriter* writer, const CTransaction* tx) {
-  // without witness
-  if (!write_bytes((uint8_t*)&tx->nVersion, 4, writer)) return false;
-  if (!ser_compact_size(tx->vin_len, writer)) return false;
-
-  for (size_t i = 0; i < tx->vin_len; i++) {
-    const CTxIn* input = &tx->vin[i];
-    if (!ser_ctx_in(writer, input)) return false;
+static void sig_hasher_add_input(BitcoinSigHasher* hasher,
+                                 const PartiallySignedInput* input,
+                                 bool outpoint) {
+  if (outpoint) {
+    hasher_Update(&hasher->hasher_prevouts, input->prev_txid, 32);
+    hasher_Update(&hasher->hasher_prevouts,
+                  (const uint8_t*)&input->prev_out_index, 4);
+    hasher_Update(&hasher->hasher_sequences, (const uint8_t*)&input->sequence,
+                  4);
   }
-  if (!ser_compact_size(tx->vout_len, writer)) return false;
-
-  for (size_t i = 0; i < tx->vout_len; i++) {
-    const CTxOut* output = &tx->vout[i];
-    if (!ser_ctx_out(writer, output)) return false;
-  }
-  if (!write_bytes((uint8_t*)&tx->nLockTime, 4, writer)) return false;
+  hasher_Update(&hasher->hasher_amounts, (const uint8_t*)&input->amount, 8);
+  ser_length_hash(&hasher->hasher_scriptpubkeys, input->script_pubkey_len);
+  hasher_Update(&hasher->hasher_scriptpubkeys, input->script_pubkey,
+                input->script_pubkey_len);
+}
 
-  return true;
+static void sig_hasher_add_output(BitcoinSigHasher* hasher,
+                                  const PartiallySignedOutput* output) {
+  hasher_Update(&hasher->hasher_outputs, (const uint8_t*)&output->amount, 8);
+  ser_length_hash(&hasher->hasher_outputs, output->script_len);
+  hasher_Update(&hasher->hasher_outputs, output->script, output->script_len);
 }
 
-bool ser_psbt_input(BufferWriter* writer, const PartiallySignedInput* input) {
-  if (input->non_witness_utxo_lookuped) {
-    if (!ser_string((uint8_t*)&PSBT_IN_NON_WITNESS_UTXO, 1, writer))
-      return false;
-    BufferWriter dummy_writer = {0};
-    init_buffer_writer(&dummy_writer, NULL, 0);
-    if (!ser_transaction(&dummy_writer, &input->non_witness_utxo)) return false;
-    if (!ser_compact_size(dummy_writer.position, writer)) return false;
-    if (!ser_transaction(writer, &input->non_witness_utxo)) return false;
-  }
-  if (input->witness_utxo_lookuped) {
-    if (!ser_string((uint8_t*)&PSBT_IN_WITNESS_UTXO, 1, writer)) return false;
-    BufferWriter dummy_writer = {0};
-    init_buffer_writer(&dummy_writer, NULL, 0);
-    if (!ser_ctx_out(&dummy_writer, &input->witness_utxo)) return false;
-    if (!ser_compact_size(dummy_writer.position, writer)) return false;
-    if (!ser_ctx_out(writer, &input->witness_utxo)) return false;
-  }
-  if (input->final_script_sig_len == 0 &&
-      input->final_script_witness_len == 0) {
-    for (size_t i = 0; i < input->partial_sigs_len; i++) {
-      if (!ser_partial_sig(writer, &input->partial_sigs[i])) return false;
-    }
-    if (input->sighash_type_lookuped) {
-      if (!ser_string((uint8_t*)&PSBT_IN_SIGHASH_TYPE, 1, writer)) return false;
-      if (!ser_string((uint8_t*)&input->sighash_type, 4, writer)) return false;
-    }
-    if (input->redeem_script_len > 0) {
-      if (!ser_string((uint8_t*)&PSBT_IN_REDEEM_SCRIPT, 1, writer))
-        return false;
-      if (!ser_string(input->redeem_script, input->redeem_script_len, writer))
-        return false;
-    }
-    if (input->witness_script_len > 0) {
-      if (!ser_string((uint8_t*)&PSBT_IN_WITNESS_SCRIPT, 1, writer))
-        return false;
-      if (!ser_string(input->witness_script, input->witness_script_len, writer))
-        return false;
+static PsbtStreamEvent end_input(PsbtStream* stream, uint32_t end) {
+  PartiallySignedInput* input = &stream->input;
+  PsbtInputSummary* summary = &stream->inputs[stream->index];
+  if (stream->global_version >= 2) {
+    if (!input->prev_txid_lookuped || !input->prev_out_index_lookuped ||
+        !input->sequence_lookuped)
+      return PSBT_STREAM_ERROR;
+    if (input->sequence != 0xFFFFFFFF) stream->locktime_disabled = false;
+    // the locktime type must be one all inputs that require one can use
+    if (input->time_locktime_lookuped && !input->height_locktime_lookuped)
+      stream->height_lock_allowed = false;
+    if (input->height_locktime_lookuped && !input->time_locktime_lookuped)
+      stream->time_lock_allowed = false;
+    if (!stream->time_lock_allowed && !stream->height_lock_allowed)
+      return PSBT_STREAM_ERROR;
+    if (input->time_locktime_lookuped)
+      stream->time_lock = MAX(stream->time_lock, input->time_locktime);
+    if (input->height_locktime_lookuped)
+      stream->height_lock = MAX(stream->height_lock, input->height_locktime);
+  }
+  sig_hasher_add_input(&stream->hasher, input, stream->global_version >= 2);
+
+  // the outpoint and sequence of a version 0 PSBT came with its transaction
+  if (stream->global_version >= 2) {
+    memcpy(summary->outpoint, input->prev_txid, 32);
+    memcpy(summary->outpoint + 32, &input->prev_out_index, 4);
+    summary->sequence = input->sequence;
+  }
+  summary->amount = input->amount;
+  summary->end = end;
+  summary->p2wpkh = is_p2wpkh(input->script_pubkey, input->script_pubkey_len);
+  if (summary->p2wpkh) {
+    summary->key_origin = input->bip32_path;
+  } else if (input->tap_bip32_path_lookuped) {
+    summary->key_origin = input->tap_bip32_path.key_origin;
+  }
+  if (input->tap_leaf_script_lookuped) {
+    char TAG_TAPLEAF[] = "TapLeaf";
+    Hasher hasher = {0};
+    tagged_hasher_init(&hasher, (uint8_t*)TAG_TAPLEAF, sizeof(TAG_TAPLEAF) - 1);
+    hasher_Update(&hasher, &input->leaf_version, 1);
+    ser_length_hash(&hasher, input->leaf_script_len);
+    hasher_Update(&hasher, input->leaf_script, input->leaf_script_len);
+    hasher_Final(&hasher, summary->leaf_hash);
+    summary->script_path = true;
+  }
+  stream->state = ST_NEXT_MAP;
+  return PSBT_STREAM_INPUT;
+}
+
+static PsbtStreamEvent end_output(PsbtStream* stream) {
+  PartiallySignedOutput* output = &stream->output;
+  if (!output->amount_lookuped || !output->script_lookuped)
+    return PSBT_STREAM_ERROR;
+  sig_hasher_add_output(&stream->hasher, output);
+  stream->state = ST_NEXT_MAP;
+  return PSBT_STREAM_OUTPUT;
+}
+
+static void begin_map(PsbtStream* stream) {
+  stream->seen = 0;
+  if (stream->map == MAP_INPUT) {
+    memzero(&stream->input, sizeof(stream->input));
+  } else if (stream->map == MAP_OUTPUT) {
+    PartiallySignedOutput* output = &stream->output;
+    memzero(output, sizeof(PartiallySignedOutput));
+    if (stream->tx_lookuped) {
+      const PsbtTxOutput* tx_output = &stream->tx_outputs[stream->index];
+      output->amount = tx_output->amount;
+      output->script_len = tx_output->script_len;
+      memcpy(output->script, tx_output->script, tx_output->script_len);
+      output->amount_lookuped = true;
+      output->script_lookuped = true;
     }
-    if (input->bip32_path_lookuped && input->bip32_path.pubkey_len > 0) {
-      uint8_t key[66] = {0};
-      uint8_t key_len = input->bip32_path.pubkey_len + 1;
-      key[0] = PSBT_IN_BIP32_DERIVATION;
-      memcpy(key + 1, input->bip32_path.pubkey, input->bip32_path.pubkey_len);
-      if (!ser_string(key, key_len, writer)) return false;
-      BufferWriter dummy_writer = {0};
-      init_buffer_writer(&dummy_writer, NULL, 0);
-      if (!ser_key_origin(&input->bip32_path.key_origin, &dummy_writer))
-        return false;
-      if (dummy_writer.position % 4 != 0) return false;
-      if (!ser_compact_size(dummy_writer.position, writer)) return false;
-      if (!ser_key_origin(&input->bip32_path.key_origin, writer)) return false;
-    }
-    if (input->tap_key_sig_len != 0) {
-      if (!ser_string((uint8_t*)&PSBT_IN_TAP_KEY_SIG, 1, writer)) return false;
-      if (!ser_string(input->tap_key_sig, input->tap_key_sig_len, writer))
-        return false;
-    }
-    if (input->tap_script_sig.signature_len > 0) {
-      uint8_t key[65] = {0};
-      key[0] = PSBT_IN_TAP_SCRIPT_SIG;
-      memcpy(key + 1, input->tap_script_sig.x_only_pubkey, 32);
-      memcpy(key + 33, input->tap_script_sig.leaf_hash, 32);
-      if (!ser_string(key, sizeof(key), writer)) return false;
-      if (!ser_string(input->tap_script_sig.signature,
-                      input->tap_script_sig.signature_len, writer))
-        return false;
-    }
-    if (input->tap_leaf_script_lookuped &&
-        input->tap_leaf_script.script_len > 0) {
-      uint8_t key[194] = {0};
-      size_t key_len = 1 + input->tap_leaf_script.control_block_len;
-      key[0] = PSBT_IN_TAP_LEAF_SCRIPT;
-      memcpy(key + 1, input->tap_leaf_script.control_block,
-             input->tap_leaf_script.control_block_len);
-      if (!ser_string(key, key_len, writer)) return false;
-      if (!ser_compact_size(input->tap_leaf_script.script_len + 1, writer))
-        return false;
-      if (!write_bytes(input->tap_leaf_script.script,
-                       input->tap_leaf_script.script_len, writer))
-        return false;
-      if (!write_bytes(&input->tap_leaf_script.leaf_version, 1, writer))
-        return false;
-    }
-    if (input->tap_bip32_path_lookuped &&
-        input->tap_bip32_path.key_origin.path_len > 0) {
-      uint8_t key[33] = {0};
-      key[0] = PSBT_IN_TAP_BIP32_DERIVATION;
-      memcpy(key + 1, input->tap_bip32_path.x_only_pubkey, 32);
-      if (!ser_string(key, sizeof(key), writer)) return false;
-      if (!ser_tap_bip32_derivation(&input->tap_bip32_path, writer))
-        return false;
-    }
-    if (input->tap_internal_key_lookuped) {
-      if (!ser_string((uint8_t*)&PSBT_IN_TAP_INTERNAL_KEY, 1, writer))
-        return false;
-      if (!ser_string(input->tap_internal_key, 32, writer)) return false;
-    }
-    if (input->tap_merkle_root_lookuped) {
-      if (!ser_string((uint8_t*)&PSBT_IN_TAP_MERKLE_ROOT, 1, writer))
-        return false;
-      if (!ser_string(input->tap_merkle_root, 32, writer)) return false;
-    }
-  }
-  if (input->final_script_sig_len > 0) {
-    if (!ser_string((uint8_t*)&PSBT_IN_FINAL_SCRIPTSIG, 1, writer))
-      return false;
-    if (!ser_string(input->final_script_sig, input->final_script_sig_len,
-                    writer))
-      return false;
-  }
-  if (input->final_script_witness_len > 0) {
-    if (!ser_string((uint8_t*)&PSBT_IN_FINAL_SCRIPTWITNESS, 1, writer))
-      return false;
-    if (!ser_string(input->final_script_witness,
-                    input->final_script_witness_len, writer))
-      return false;
   }
-  if (input->version >= 2) {
-    if (!ser_string((uint8_t*)&PSBT_IN_PREVIOUS_TXID, 1, writer)) return false;
-    if (!ser_string(input->prev_txid, 32, writer)) return false;
-
-    if (!ser_string((uint8_t*)&PSBT_IN_OUTPUT_INDEX, 1, writer)) return false;
-    if (!ser_string((uint8_t*)&input->prev_out_index, 4, writer)) return false;
-
-    if (!ser_string((uint8_t*)&PSBT_IN_SEQUENCE, 1, writer)) return false;
-    if (!ser_string((uint8_t*)&input->sequence, 4, writer)) return false;
-
-    if (!ser_string((uint8_t*)&PSBT_IN_REQUIRED_TIME_LOCKTIME, 1, writer))
-      return false;
-    if (!ser_string((uint8_t*)&input->time_locktime, 4, writer)) return false;
-
-    if (!ser_string((uint8_t*)&PSBT_IN_REQUIRED_HEIGHT_LOCKTIME, 1, writer))
-      return false;
-    if (!ser_string((uint8_t*)&input->height_locktime, 4, writer)) return false;
-  }
-  // separator
-  if (!write_bytes((uint8_t*)&PSBT_SEPARATOR, 1, writer)) return false;
-  return true;
 }
-bool ser_psbt_output(BufferWriter* writer,
-                     const PartiallySignedOutput* output) {
-  if (output->redeem_script_lookuped && output->redeem_script_len > 0) {
-    if (!ser_string((uint8_t*)&PSBT_OUT_REDEEM_SCRIPT, 1, writer)) return false;
-    if (!ser_string(output->redeem_script, output->redeem_script_len, writer))
-      return false;
-  }
-  if (output->witness_script_lookuped && output->witness_script_len > 0) {
-    if (!ser_string((uint8_t*)&PSBT_OUT_WITNESS_SCRIPT, 1, writer))
-      return false;
-    if (!ser_string(output->witness_script, output->witness_script_len, writer))
-      return false;
-  }
-  if (output->bip32_path_lookuped && output->bip32_path.pubkey_len > 0) {
-    uint8_t key[66] = {0};
-    uint8_t key_len = output->bip32_path.pubkey_len + 1;
-    key[0] = PSBT_OUT_BIP32_DERIVATION;
-    memcpy(key + 1, output->bip32_path.pubkey, output->bip32_path.pubkey_len);
-    if (!ser_string(key, key_len, writer)) return false;
-    BufferWriter dummy_writer = {0};
-    init_buffer_writer(&dummy_writer, NULL, 0);
-    if (!ser_key_origin(&output->bip32_path.key_origin, &dummy_writer))
-      return false;
-    if (dummy_writer.position % 4 != 0) return false;
-    if (!ser_compact_size(dummy_writer.position, writer)) return false;
-    if (!ser_key_origin(&output->bip32_path.key_origin, writer)) return false;
-  }
-  if (output->version >= 2) {
-    if (!ser_string((uint8_t*)&PSBT_OUT_AMOUNT, 1, writer)) return false;
-    if (!ser_string((uint8_t*)&output->amount, 8, writer)) return false;
-    if (!ser_string((uint8_t*)&PSBT_OUT_SCRIPT, 1, writer)) return false;
-    if (!ser_string(output->script, output->script_len, writer)) return false;
-  }
-  if (output->tap_internal_key_lookuped) {
-    if (!ser_string((uint8_t*)&PSBT_OUT_TAP_INTERNAL_KEY, 1, writer))
-      return false;
-    if (!ser_string(output->tap_internal_key, 32, writer)) return false;
-  }
-  if (output->tap_tree_lookuped && output->tap_tree_len > 0) {
-    if (!ser_string((uint8_t*)&PSBT_OUT_TAP_TREE, 1, writer)) return false;
-    if (!ser_string(output->tap_tree, output->tap_tree_len, writer))
-      return false;
-  }
-  if (output->tap_bip32_path_lookuped &&
-      output->tap_bip32_path.key_origin.path_len > 0) {
-    uint8_t key[33] = {0};
-    key[0] = PSBT_OUT_TAP_BIP32_DERIVATION;
-    memcpy(key + 1, output->tap_bip32_path.x_only_pubkey, 32);
-    if (!ser_string(key, sizeof(key), writer)) return false;
-    if (!ser_tap_bip32_derivation(&output->tap_bip32_path, writer))
-      return false;
-  }
-  // separator
-  if (!write_bytes((uint8_t*)&PSBT_SEPARATOR, 1, writer)) return false;
-  return true;
-}
-// PSBT parsing function
-bool psbt_deserialize(const uint8_t* psbt_bytes, size_t psbt_len, PSBT* psbt) {
-  BufferReader reader = {0};
-  init_buffer_reader(&reader, psbt_bytes, psbt_len);
 
-  // Check magic bytes
-  uint8_t magic[5] = {0};
-  if (!read_bytes(&reader, magic, sizeof(magic))) {
-    return false;
-  }
-  if (memcmp(magic, PSBT_MAGIC_BYTES, sizeof(PSBT_MAGIC_BYTES)) != 0) {
-    return false;
-  }
-
-  // Parse global map
-  while (1) {
-    // Read key
-    uint8_t key[80] = {0};
-    size_t key_len = 0;
-    if (!deser_string(&reader, key, sizeof(key), &key_len)) break;
-    if (key_len == 0) break;  // Separator (key_len of 0)
-
-    // Read key type
-    uint8_t key_type;
-    BufferReader key_reader = {0};
-    init_buffer_reader(&key_reader, key, key_len);
-    if (!read_bytes(&key_reader, &key_type, 1)) return false;
-
-    // Process key-value pair
-    switch (key_type) {
-      case PSBT_GLOBAL_UNSIGNED_TX:
-        if (psbt->tx_lookuped || key_len > 1) return false;
-        BufferReader tx_reader = {0};
-        if (!deser_string_to_buffer_reader(&reader, &tx_reader)) return false;
-        if (!deser_transaction(&tx_reader, &psbt->tx)) return false;
-        psbt->tx_lookuped = true;
-        break;
-      case PSBT_GLOBAL_XPUB:
-        // not support
-        return false;
-        if (key_reader.length != 79) return false;
-        if (psbt->xpubs_len >= (sizeof(psbt->xpubs) / sizeof(psbt->xpubs[0])))
-          return false;
-        if (!read_bytes(&key_reader, psbt->xpubs[psbt->xpubs_len].pubkey, 78)) {
-          return false;
+static void next_map(PsbtStream* stream) {
+  stream->state = ST_MAP_START;
+  if (stream->map == MAP_INPUT && ++stream->index == stream->inputs_len) {
+    stream->map = MAP_OUTPUT;
+    stream->index = 0;
+  } else if (stream->map == MAP_OUTPUT &&
+             ++stream->index == stream->outputs_len) {
+    stream->state = ST_DONE;
+  }
+}
+
+static PsbtStreamEvent feed(PsbtStream* stream, const uint8_t** data,
+                            size_t* len) {
+  uint64_t size = 0;
+  for (;;) {
+    switch (stream->state) {
+      case ST_MAGIC:
+        if (!take(stream, data, len, stream->value, sizeof(PSBT_MAGIC_BYTES)))
+          return PSBT_STREAM_MORE;
+        if (memcmp(stream->value, PSBT_MAGIC_BYTES, sizeof(PSBT_MAGIC_BYTES)))
+          return PSBT_STREAM_ERROR;
+        stream->state = ST_MAP_START;
+        break;
+      case ST_MAP_START:
+        begin_map(stream);
+        stream->state = ST_KEY_LEN;
+        break;
+      case ST_KEY_LEN:
+        if (!take_compact_size(stream, data, len, &size))
+          return PSBT_STREAM_MORE;
+        if (size == 0) {
+          // separator
+          if (stream->map == MAP_INPUT) {
+            return end_input(stream, stream->pos + (*data - stream->chunk) - 1);
+          } else if (stream->map == MAP_OUTPUT) {
+            return end_output(stream);
+          }
+          if (!end_globals(stream)) return PSBT_STREAM_ERROR;
+          break;
         }
-        psbt->xpubs[psbt->xpubs_len].pubkey_len = 78;
-        BufferReader key_origin_reader = {0};
-        if (!deser_string_to_buffer_reader(&reader, &key_origin_reader))
-          return false;
-        if (!deser_hd_keypath(&key_origin_reader,
-                              &psbt->xpubs[psbt->xpubs_len].key_origin))
-          return false;
-        psbt->xpubs_len++;
-        break;
-      case PSBT_GLOBAL_TX_VERSION:
-        psbt->tx_version_lookuped = true;
-        if (psbt->tx_version_lookuped || key_len > 1) return false;
-        uint16_t tx_version_len = deser_compact_size(&reader);
-        if (tx_version_len != 4) return false;
-        if (!read_bytes(&reader, (uint8_t*)&psbt->tx_version, 4)) return false;
-        break;
-      case PSBT_GLOBAL_FALLBACK_LOCKTIME:
-        psbt->fallback_locktime_lookuped = true;
-        if (psbt->fallback_locktime_lookuped || key_len > 1) return false;
-        uint16_t fallback_locktime_len = deser_compact_size(&reader);
-        if (fallback_locktime_len != 4) return false;
-        if (!read_bytes(&reader, (uint8_t*)&psbt->fallback_locktime, 4))
-          return false;
-        break;
-      case PSBT_GLOBAL_INPUT_COUNT:
-        psbt->inputs_len_lookuped = true;
-        if (psbt->inputs_len_lookuped || key_len > 1) return false;
-        deser_compact_size(&reader);
-        uint16_t inputs_len = deser_compact_size(&reader);
-        if (inputs_len > MAX_INPUTS) return false;
-        psbt->inputs_len = inputs_len;
-        break;
-      case PSBT_GLOBAL_OUTPUT_COUNT:
-        psbt->outputs_len_lookuped = true;
-        if (psbt->outputs_len_lookuped || key_len > 1) return false;
-        deser_compact_size(&reader);
-        uint16_t outputs_len = deser_compact_size(&reader);
-        if (outputs_len > MAX_OUTPUTS) return false;
-        psbt->outputs_len = outputs_len;
-        break;
-      case PSBT_GLOBAL_TX_MODIFIABLE:
-        psbt->tx_modifiable_lookuped = true;
-        if (psbt->tx_modifiable_lookuped || key_len > 1) return false;
-        uint8_t tx_modifiable_len = deser_compact_size(&reader);
-        if (tx_modifiable_len != 1) return false;
-        if (!read_bytes(&reader, (uint8_t*)&psbt->tx_modifiable, 1))
-          return false;
-        break;
-      case PSBT_GLOBAL_VERSION:
-        psbt->global_version_lookuped = true;
-        if (psbt->global_version_lookuped || key_len > 1) return false;
-        uint16_t version_len = deser_compact_size(&reader);
-        if (version_len != 4) return false;
-        if (!read_bytes(&reader, (uint8_t*)&psbt->global_version, 4))
-          return false;
-        psbt->explicit_version = true;
-        break;
+        if (size > PSBT_MAX_KEY_SIZE) return PSBT_STREAM_ERROR;
+        stream->key_len = size;
+        stream->state = ST_KEY;
+        break;
+      case ST_KEY:
+        if (!take(stream, data, len, stream->key, stream->key_len))
+          return PSBT_STREAM_MORE;
+        stream->state = ST_VALUE_LEN;
+        break;
+      case ST_VALUE_LEN:
+        if (!take_compact_size(stream, data, len, &size))
+          return PSBT_STREAM_MORE;
+        stream->value_left = size;
+        if (!begin_value(stream)) return PSBT_STREAM_ERROR;
+        stream->state = ST_VALUE;
+        break;
+      case ST_VALUE:
+        if (!feed_value(stream, data, len)) return PSBT_STREAM_ERROR;
+        if (stream->value_left > 0) return PSBT_STREAM_MORE;
+        if (!end_value(stream)) return PSBT_STREAM_ERROR;
+        stream->state = ST_KEY_LEN;
+        break;
+      case ST_NEXT_MAP:
+        next_map(stream);
+        break;
+      case ST_DONE:
+        return *len == 0 ? PSBT_STREAM_DONE : PSBT_STREAM_ERROR;
       default:
-        // TODO: handle unknown key type
-        return false;
-    }
-  }
-  if (psbt->global_version == 0) {
-    if (psbt->tx.vin_len == 0 && psbt->tx.vout_len == 0) return false;
-    if (psbt->tx_version != 0) return false;
-    if (psbt->fallback_locktime != 0) return false;
-    if (psbt->inputs_len != 0) return false;
-    if (psbt->outputs_len != 0) return false;
-    if (psbt->tx_modifiable != 0) return false;
-  } else if (psbt->global_version == 1) {
-    return false;
-  } else if (psbt->global_version >= 2) {
-    if (psbt->tx_version == 0) return false;
-    if (psbt->inputs_len == 0) return false;
-    if (psbt->outputs_len == 0) return false;
-    if (psbt->tx.vin_len != 0 && psbt->tx.vout_len != 0) return false;
-  }
-  // Parse inputs
-  if (psbt->inputs_len == 0) {
-    psbt->inputs_len = psbt->tx.vin_len;
-  }
-  for (size_t i = 0; i < psbt->inputs_len; i++) {
-    if (reader.position >= reader.length) break;
-    PartiallySignedInput* input = &psbt->inputs[i];
-    if (!deser_psbt_input(&reader, input)) return false;
-    if (psbt->global_version >= 2) {
-      if (!input->prev_txid_lookuped) return false;
-      if (!input->prev_out_index_lookuped) return false;
-    }
-    input->version = psbt->global_version;
-    uint8_t prev_txid[32] = {0};
-    if (psbt->global_version >= 2) {
-      memcpy(prev_txid, input->prev_txid, 32);
-    } else {
-      memcpy(prev_txid, psbt->tx.vin[i].prevout.hash, 32);
-    }
-    if (input->non_witness_utxo_lookuped) {
-      BufferWriter tx_writer = {0};
-      uint8_t tx_buffer[1024] = {0};
-      uint8_t calc_prev_txid[32] = {0};
-      init_buffer_writer(&tx_writer, tx_buffer, sizeof(tx_buffer));
-      if (!ser_transaction(&tx_writer, &input->non_witness_utxo)) return false;
-      hasher_Raw(HASHER_SHA2D, tx_buffer, tx_writer.position, calc_prev_txid);
-      if (memcmp(calc_prev_txid, prev_txid, 32) != 0) return false;
+        return PSBT_STREAM_ERROR;
     }
   }
-  // Parse outputs
-  if (psbt->outputs_len == 0) {
-    psbt->outputs_len = psbt->tx.vout_len;
-  }
-  for (size_t i = 0; i < psbt->outputs_len; i++) {
-    if (reader.position >= reader.length) break;
-    PartiallySignedOutput* output = &psbt->outputs[i];
-    if (!deser_psbt_output(&reader, output)) return false;
-    if (psbt->global_version >= 2) {
-      if (!output->amount_lookuped) return false;
-      if (!output->script_lookuped) return false;
-    }
-    output->version = psbt->global_version;
-  }
-
-  if (psbt->tx_lookuped) {
-    psbt->tx_version = psbt->tx.nVersion;
-    psbt->fallback_locktime = psbt->tx.nLockTime;
-    for (size_t i = 0; i < psbt->tx.vin_len; i++) {
-      memcpy(psbt->inputs[i].prev_txid, psbt->tx.vin[i].prevout.hash, 32);
-      psbt->inputs[i].prev_out_index = psbt->tx.vin[i].prevout.n;
-      psbt->inputs[i].sequence = psbt->tx.vin[i].nSequence;
-    }
-    for (size_t i = 0; i < psbt->tx.vout_len; i++) {
-      psbt->outputs[i].amount = psbt->tx.vout[i].nValue;
-      psbt->outputs[i].script_len = psbt->tx.vout[i].scriptPubKey_len;
-      memcpy(psbt->outputs[i].script, psbt->tx.vout[i].scriptPubKey,
-             psbt->tx.vout[i].scriptPubKey_len);
-    }
-  }
-  return true;
 }
 
-// PSBT serialization function
-bool psbt_serialize(const PSBT* psbt, uint8_t* buffer, size_t buffer_size,
-                    size_t* psbt_size) {
-  BufferWriter writer = {0};
-  init_buffer_writer(&writer, buffer, buffer_size);
-  // Serialize magic bytes
-  if (!write_bytes(PSBT_MAGIC_BYTES, sizeof(PSBT_MAGIC_BYTES), &writer))
-    return false;
-  if (psbt->global_version == 0) {
-    // Serialize unsigned tx flag
-    if (!ser_string((uint8_t*)&PSBT_GLOBAL_UNSIGNED_TX, 1, &writer))
-      return false;
-    // Serialize unsigned tx
-    BufferWriter dummy_writer = {0};
-    init_buffer_writer(&dummy_writer, NULL, 0);
-    if (!ser_transaction(&dummy_writer, &psbt->tx)) return false;
-    if (!ser_compact_size(dummy_writer.position, &writer)) return false;
-    if (!ser_transaction(&writer, &psbt->tx)) return false;
-  }
-  // Serialize xpubs
-  for (size_t i = 0; i < psbt->xpubs_len; i++) {
-    uint8_t key[1 + 78] = {0};
-    key[0] = PSBT_GLOBAL_XPUB;
-    memcpy(key + 1, psbt->xpubs[i].pubkey, psbt->xpubs[i].pubkey_len);
-    if (!ser_string(key, sizeof(key), &writer)) return false;
-    BufferWriter dummy_writer = {0};
-    init_buffer_writer(&dummy_writer, NULL, 0);
-    if (!ser_key_origin(&psbt->xpubs[i].key_origin, &dummy_writer))
-      return false;
-    if (dummy_writer.position % 4 != 0) return false;
-    if (!ser_compact_size(dummy_writer.position, &writer)) return false;
-    if (!ser_key_origin(&psbt->xpubs[i].key_origin, &writer)) return false;
-  }
-  if (psbt->global_version >= 2) {
-    if (!psbt->tx_version_lookuped) return false;
-    if (!ser_string((uint8_t*)&PSBT_GLOBAL_TX_VERSION, 1, &writer))
-      return false;
-    if (!ser_string((uint8_t*)&psbt->tx_version, 4, &writer)) return false;
-
-    if (psbt->fallback_locktime_lookuped) {
-      if (!ser_string((uint8_t*)&PSBT_GLOBAL_FALLBACK_LOCKTIME, 1, &writer))
-        return false;
-      if (!ser_string((uint8_t*)&psbt->fallback_locktime, 4, &writer))
-        return false;
-    }
-
-    if (!ser_string((uint8_t*)&PSBT_GLOBAL_INPUT_COUNT, 1, &writer))
-      return false;
-    if (!ser_string((uint8_t*)&psbt->inputs_len, 4, &writer)) return false;
-
-    if (!ser_string((uint8_t*)&PSBT_GLOBAL_OUTPUT_COUNT, 1, &writer))
-      return false;
-    if (!ser_string((uint8_t*)&psbt->outputs_len, 4, &writer)) return false;
-
-    if (psbt->tx_modifiable_lookuped) {
-      if (!ser_string((uint8_t*)&PSBT_GLOBAL_TX_MODIFIABLE, 1, &writer))
-        return false;
-      if (!ser_string((uint8_t*)&psbt->tx_modifiable, 1, &writer)) return false;
-    }
+void psbt_stream_init(PsbtStream* stream) {
+  memzero(stream, sizeof(PsbtStream));
+  stream->state = ST_MAGIC;
+  stream->map = MAP_GLOBAL;
+  stream->time_lock_allowed = true;
+  stream->height_lock_allowed = true;
+  stream->locktime_disabled = true;
+  sig_hasher_init(&stream->hasher);
+}
 
-    if (psbt->global_version > 0 || psbt->explicit_version) {
-      if (!ser_string((uint8_t*)&PSBT_GLOBAL_VERSION, 1, &writer)) return false;
-      if (!ser_string((uint8_t*)&psbt->global_version, 4, &writer))
-        return false;
-    }
-  }
-  // separator
-  if (!write_bytes((uint8_t*)&PSBT_SEPARATOR, 1, &writer)) return false;
-  // Serialize inputs
-  for (size_t i = 0; i < psbt->inputs_len; i++) {
-    if (!ser_psbt_input(&writer, &psbt->inputs[i])) return false;
-  }
-  // Serialize outputs
-  for (size_t i = 0; i < psbt->outputs_len; i++) {
-    if (!ser_psbt_output(&writer, &psbt->outputs[i])) return false;
-  }
-  *psbt_size = writer.position;
-  return true;
+PsbtStreamEvent psbt_stream_feed(PsbtStream* stream, const uint8_t** data,
+                                 size_t* len) {
+  stream->chunk = *data;
+  PsbtStreamEvent event = feed(stream, data, len);
+  stream->pos += *data - stream->chunk;
+  if (event == PSBT_STREAM_ERROR) stream->state = ST_ERROR;
+  return event;
 }
 
-bool locktime_disabled(const PSBT* psbt) {
-  for (size_t i = 0; i < psbt->inputs_len; i++) {
-    if (psbt->inputs[i].sequence != 0xFFFFFFFF) {
-      return false;
-    }
+uint32_t psbt_stream_locktime(const PsbtStream* stream) {
+  if (stream->height_lock_allowed && stream->height_lock > 0) {
+    return stream->height_lock;
+  } else if (stream->time_lock_allowed && stream->time_lock > 0) {
+    return stream->time_lock;
   }
-  return true;
+  return stream->fallback_locktime;
 }
 
-bool compute_locktime(const PSBT* psbt, uint32_t* locktime) {
-  int64_t time_lock = 0;
-  int64_t height_lock = 0;
-  for (size_t i = 0; i < psbt->inputs_len; i++) {
-    if (psbt->inputs[i].time_locktime_lookuped &&
-        !psbt->inputs[i].height_locktime_lookuped) {
-      height_lock = -1;
-      if (time_lock == -1) return false;
-    } else if (!psbt->inputs[i].height_locktime_lookuped &&
-               psbt->inputs[i].time_locktime_lookuped) {
-      time_lock = -1;
-      if (height_lock == -1) return false;
-    }
-    if (psbt->inputs[i].time_locktime_lookuped && time_lock != -1) {
-      time_lock = MAX(time_lock, psbt->inputs[i].time_locktime);
-    }
-    if (psbt->inputs[i].height_locktime_lookuped && height_lock != -1) {
-      height_lock = MAX(height_lock, psbt->inputs[i].height_locktime);
-    }
-  }
-  if (height_lock > 0) {
-    *locktime = (uint32_t)height_lock;
-  } else if (time_lock > 0) {
-    *locktime = (uint32_t)time_lock;
-  } else if (psbt->fallback_locktime > 0) {
-    *locktime = psbt->fallback_locktime;
+bool psbt_write_tap_sig(BufferWriter* writer, const PsbtInputSummary* summary,
+                        const uint8_t* x_only_pubkey,
+                        const uint8_t* signature) {
+  if (!summary->script_path) {
+    if (!ser_string((uint8_t*)&PSBT_IN_TAP_KEY_SIG, 1, writer)) return false;
   } else {
-    *locktime = 0;
+    uint8_t key[65] = {0};
+    key[0] = PSBT_IN_TAP_SCRIPT_SIG;
+    memcpy(key + 1, x_only_pubkey, 32);
+    memcpy(key + 33, summary->leaf_hash, 32);
+    if (!ser_string(key, sizeof(key), writer)) return false;
   }
-  return true;
+  return ser_string(signature, 64, writer);
+}
+
+bool psbt_write_partial_sig(BufferWriter* writer, const uint8_t* pubkey,
+                            const uint8_t* signature) {
+  uint8_t key[34] = {0};
+  key[0] = PSBT_IN_PARTIAL_SIG;
+  memcpy(key + 1, pubkey, 33);
+  if (!ser_string(key, sizeof(key), writer)) return false;
+  uint8_t der[73] = {0};
+  int der_len = ecdsa_sig_to_der(signature, der);
+  der[der_len++] = SIGHASH_ALL;
+  return ser_string(der, der_len, writer);
 }
+
+bool psbt_write_separator(BufferWriter* writer) {
+  return write_bytes(&PSBT_SEPARATOR, 1, writer);
+}
+
 bool is_witness(const uint8_t* script, size_t script_len,
                 uint8_t* witness_version) {
   if (script_len < 4 || script_len > 42) {
@@ -1131,6 +846,10 @@ bool is_witness(const uint8_t* script, size_t script_len,
   return false;
 }
 
+bool is_p2wpkh(const uint8_t* script, size_t script_len) {
+  return script_len == 22 && script[0] == 0x00 && script[1] == 0x14;
+}
+
 bool is_opreturn(const uint8_t* script, size_t script_len) {
   return script_len > 2 && script[0] == 0x6A;
 }
@@ -1170,27 +889,6 @@ void sig_hasher_init(BitcoinSigHasher* hasher) {
   hasher_Init(&hasher->hasher_outputs, HASHER_SHA2);
 }
 
-void sig_hasher_add_input(BitcoinSigHasher* hasher,
-                          const PartiallySignedInput* input) {
-  hasher_Update(&hasher->hasher_prevouts, input->prev_txid, 32);
-  hasher_Update(&hasher->hasher_prevouts,
-                (const uint8_t*)&input->prev_out_index, 4);
-  hasher_Update(&hasher->hasher_amounts,
-                (const uint8_t*)&input->witness_utxo.nValue, 8);
-  ser_length_hash(&hasher->hasher_scriptpubkeys,
-                  input->witness_utxo.scriptPubKey_len);
-  hasher_Update(&hasher->hasher_scriptpubkeys, input->witness_utxo.scriptPubKey,
-                input->witness_utxo.scriptPubKey_len);
-  hasher_Update(&hasher->hasher_sequences, (const uint8_t*)&input->sequence, 4);
-}
-
-void sig_hasher_add_output(BitcoinSigHasher* hasher,
-                           const PartiallySignedOutput* output) {
-  hasher_Update(&hasher->hasher_outputs, (const uint8_t*)&output->amount, 8);
-  ser_length_hash(&hasher->hasher_outputs, output->script_len);
-  hasher_Update(&hasher->hasher_outputs, output->script, output->script_len);
-}
-
 void sig_hasher_final(BitcoinSigHasher* hasher) {
   hasher_Final(&hasher->hasher_prevouts, hasher->hash_prevouts);
   hasher_Final(&hasher->hasher_amounts, hasher->hash_amounts);
@@ -1248,3 +946,45 @@ void sig_hasher_hash_341(const BitcoinSigHasher* hasher, uint32_t i,
   }
   hasher_Final(&sigmsg_hasher, hash);
 }
+
+void sig_hasher_hash_143(const BitcoinSigHasher* hasher,
+                         const PsbtInputSummary* input,
+                         const uint8_t* pubkeyhash, uint32_t version,
+                         uint32_t locktime, uint8_t* hash) {
+  // BIP143 hashes the same data as BIP341, twice
+  uint8_t hash_prevouts[32] = {0};
+  uint8_t hash_sequences[32] = {0};
+  uint8_t hash_outputs[32] = {0};
+  hasher_Raw(HASHER_SHA2, hasher->hash_prevouts, 32, hash_prevouts);
+  hasher_Raw(HASHER_SHA2, hasher->hash_sequences, 32, hash_sequences);
+  hasher_Raw(HASHER_SHA2, hasher->hash_outputs, 32, hash_outputs);
+
+  const uint8_t script_code_prefix[4] = {0x19, 0x76, 0xA9, 0x14};
+  const uint8_t script_code_suffix[2] = {0x88, 0xAC};
+  const uint32_t sighash_type = SIGHASH_ALL;
+  Hasher sigmsg_hasher = {0};
+  hasher_Init(&sigmsg_hasher, HASHER_SHA2D);
+  // nVersion
+  hasher_Update(&sigmsg_hasher, (const uint8_t*)&version, 4);
+  // hashPrevouts
+  hasher_Update(&sigmsg_hasher, hash_prevouts, 32);
+  // hashSequence
+  hasher_Update(&sigmsg_hasher, hash_sequences, 32);
+  // outpoint
+  hasher_Update(&sigmsg_hasher, input->outpoint, 36);
+  // scriptCode of P2WPKH
+  hasher_Update(&sigmsg_hasher, script_code_prefix, 4);
+  hasher_Update(&sigmsg_hasher, pubkeyhash, 20);
+  hasher_Update(&sigmsg_hasher, script_code_suffix, 2);
+  // amount
+  hasher_Update(&sigmsg_hasher, (const uint8_t*)&input->amount, 8);
+  // nSequence
+  hasher_Update(&sigmsg_hasher, (const uint8_t*)&input->sequence, 4);
+  // hashOutputs
+  hasher_Update(&sigmsg_hasher, hash_outputs, 32);
+  // nLocktime
+  hasher_Update(&sigmsg_hasher, (const uint8_t*)&locktime, 4);
+  // nHashType
+  hasher_Update(&sigmsg_hasher, (const uint8_t*)&sighash_type, 4);
+  hasher_Final(&sigmsg_hasher, hash);
+}
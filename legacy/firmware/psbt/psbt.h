@@ -2,9 +2,16 @@
 #define PSBT_H
 #include "../crypto.h"
 #include "segwit_addr.h"
+#include "util.h"
 
-#define MAX_INPUTS 5
-#define MAX_OUTPUTS 5
+#define PSBT_MAX_INPUTS 32
+#define PSBT_MAX_OUTPUTS 32
+// type byte + control block of a leaf at depth <= 4
+#define PSBT_MAX_KEY_SIZE 193
+// largest value that is buffered, a TAP_BIP32_DERIVATION with 5 leaf hashes
+#define PSBT_MAX_VALUE_SIZE 197
+#define PSBT_MAX_SCRIPT_SIZE 83  // the limit of OP_RETURN is 83 bytes
+#define PSBT_MAX_LEAF_SCRIPT_SIZE 1024
 
 typedef struct {
   uint8_t fingerprint[4];
@@ -13,105 +20,36 @@ typedef struct {
 } KeyOriginInfo;
 
 typedef struct {
-  uint8_t hash[32];
-  uint32_t n;
-} COutPoint;
-
-typedef struct {
-  uint8_t scriptSig[1];  // ignore, assume it's empty
-  COutPoint prevout;
-  size_t scriptSig_len;
-  uint32_t nSequence;
-} CTxIn;
-
-typedef struct {
-  uint8_t scriptPubKey[83];
-  int64_t nValue;
-  size_t scriptPubKey_len;
-} CTxOut;
-
-typedef struct {
-  CTxIn vin[MAX_INPUTS];
-  CTxOut vout[MAX_OUTPUTS];
-  int32_t nVersion;
-  size_t vin_len;
-  size_t vout_len;
-  uint32_t nLockTime;
-} CTransaction;
-
-typedef struct {
-  uint8_t sig[72];
-  uint8_t pubkey[65];
-  size_t sig_len;
-  size_t pubkey_len;
-} Partial_Sig;
-
-typedef struct {
-  uint8_t pubkey[78];
-  KeyOriginInfo key_origin;
-  size_t pubkey_len;
-} HD_KEYPATH;
-typedef struct {
-  uint8_t signature[65];
-  uint8_t x_only_pubkey[32];
-  uint8_t leaf_hash[32];
-  uint8_t signature_len;
-} TAP_SCRIPT_SIG;
-
-typedef struct {
-  uint8_t script[1024];
-  uint8_t control_block[193];
-  size_t control_block_len;
-  size_t script_len;
-  uint8_t leaf_version;
-} TAP_LEAF_SCRIPT;
-
-typedef struct {
-  uint8_t tap_leaf_hashs[5][32];
   KeyOriginInfo key_origin;
   uint8_t x_only_pubkey[32];
-  size_t tap_leaf_hashs_len;
 } TAP_BIP32_DERIVATION;
-typedef struct {
-  CTransaction non_witness_utxo;
-  CTxOut witness_utxo;
-  Partial_Sig partial_sigs[MAX_INPUTS - 1];
-  TAP_SCRIPT_SIG tap_script_sig;
-  TAP_LEAF_SCRIPT tap_leaf_script;
-  TAP_BIP32_DERIVATION tap_bip32_path;
-  HD_KEYPATH bip32_path;
-
-  uint8_t redeem_script[1];         // ignore, assume it's empty
-  uint8_t witness_script[1];        // ignore, assume it's empty
-  uint8_t final_script_witness[1];  // ignore, assume it's empty
-  uint8_t final_script_sig[1];      // ignore, assume it's empty
 
-  uint8_t tap_key_sig[65];
+// The input map being parsed, valid until the next map starts.
+typedef struct {
   uint8_t prev_txid[32];
+  uint8_t script_pubkey[PSBT_MAX_SCRIPT_SIZE];  // of witness_utxo
   uint8_t tap_internal_key[32];
-  uint8_t tap_merkle_root[32];
-
-  uint32_t sighash_type;
+  uint8_t leaf_script[PSBT_MAX_LEAF_SCRIPT_SIZE];
+  TAP_BIP32_DERIVATION tap_bip32_path;
+  // the first compressed key with a derivation, and how many there are
+  KeyOriginInfo bip32_path;
+  uint8_t bip32_pubkey[33];
+  uint8_t bip32_paths;
+  int64_t amount;  // of witness_utxo
+  size_t script_pubkey_len;
+  size_t leaf_script_len;
   uint32_t prev_out_index;
   uint32_t sequence;
   uint32_t time_locktime;
   uint32_t height_locktime;
-  uint32_t version;
-
-  size_t partial_sigs_len;
-  size_t redeem_script_len;
-  size_t witness_script_len;
-  size_t tap_key_sig_len;
-  size_t final_script_witness_len;
-  size_t final_script_sig_len;
+  uint32_t sighash_type;
+  uint8_t leaf_version;
 
   bool non_witness_utxo_lookuped : 1;
   bool witness_utxo_lookuped : 1;
+  bool partial_sig_lookuped : 1;
   bool sighash_type_lookuped : 1;
-  bool redeem_script_lookuped : 1;
-  bool witness_script_lookuped : 1;
   bool tap_key_sig_lookuped : 1;
-  bool tap_script_sig_lookuped : 1;
   bool tap_leaf_script_lookuped : 1;
   bool prev_txid_lookuped : 1;
   bool prev_out_index_lookuped : 1;
@@ -119,58 +57,44 @@ typedef struct {
   bool time_locktime_lookuped : 1;
   bool height_locktime_lookuped : 1;
   bool tap_bip32_path_lookuped : 1;
-  bool bip32_path_lookuped : 1;
   bool tap_internal_key_lookuped : 1;
   bool tap_merkle_root_lookuped : 1;
-  bool final_script_witness_lookuped : 1;
-  bool final_script_sig_lookuped : 1;
 } PartiallySignedInput;
 
+// The output map being parsed, valid until the next map starts.
 typedef struct {
-  uint8_t redeem_script[1];   // ignore, assume it's empty
-  uint8_t tap_tree[1];        // ignore, assume it's empty
-  uint8_t witness_script[1];  // ignore, assume it's empty
-  uint8_t script[83];         // the limit of OP_RETURN is 83 bytes
-  HD_KEYPATH bip32_path;
+  uint8_t script[PSBT_MAX_SCRIPT_SIZE];
+  uint8_t bip32_fingerprint[4];
+  uint8_t tap_internal_key[32];
   TAP_BIP32_DERIVATION tap_bip32_path;
   int64_t amount;
-  size_t redeem_script_len;
-  size_t tap_tree_len;
-  size_t witness_script_len;
   size_t script_len;
-  uint8_t tap_internal_key[32];
-  uint8_t version;
-  bool redeem_script_lookuped : 1;
-  bool witness_script_lookuped : 1;
   bool amount_lookuped : 1;
   bool script_lookuped : 1;
   bool tap_internal_key_lookuped : 1;
-  bool tap_tree_lookuped : 1;
   bool tap_bip32_path_lookuped : 1;
   bool bip32_path_lookuped : 1;
 } PartiallySignedOutput;
 
+// What signing needs of an input once its map has been parsed.
 typedef struct {
-  CTransaction tx;
-  PartiallySignedInput inputs[MAX_INPUTS];
-  PartiallySignedOutput outputs[MAX_OUTPUTS];
-  HD_KEYPATH xpubs[5];
-  size_t xpubs_len;
-  uint32_t tx_version;
-  uint32_t fallback_locktime;
-  uint32_t global_version;
-  uint8_t inputs_len;
-  uint8_t outputs_len;
-  uint8_t tx_modifiable;
-  bool tx_lookuped : 1;
-  bool inputs_len_lookuped : 1;
-  bool outputs_len_lookuped : 1;
-  bool tx_version_lookuped : 1;
-  bool fallback_locktime_lookuped : 1;
-  bool tx_modifiable_lookuped : 1;
-  bool global_version_lookuped : 1;
-  bool explicit_version : 1;
-} PSBT;
+  KeyOriginInfo key_origin;
+  uint8_t leaf_hash[32];
+  // BIP143 signs the outpoint, amount and sequence of the input itself
+  uint8_t outpoint[36];
+  int64_t amount;
+  uint32_t sequence;
+  uint32_t end;  // offset of the separator of the input map
+  bool script_path;
+  bool p2wpkh;
+} PsbtInputSummary;
+
+// Output of a version 0 unsigned transaction, until its map is parsed.
+typedef struct {
+  int64_t amount;
+  uint8_t script[PSBT_MAX_SCRIPT_SIZE];
+  uint8_t script_len;
+} PsbtTxOutput;
 
 typedef struct {
   Hasher hasher_prevouts;
@@ -185,27 +109,90 @@ typedef struct {
   uint8_t hash_outputs[32];
 } BitcoinSigHasher;
 
-bool psbt_deserialize(const uint8_t *psbt_bytes, size_t psbt_len, PSBT *psbt);
-bool psbt_serialize(const PSBT *psbt, uint8_t *buffer, size_t buffer_size,
-                    size_t *psbt_size);
+typedef enum {
+  PSBT_STREAM_MORE,    // all data consumed, feed the next chunk
+  PSBT_STREAM_INPUT,   // input map `index` parsed into `input`
+  PSBT_STREAM_OUTPUT,  // output map `index` parsed into `output`
+  PSBT_STREAM_DONE,    // the last output map has been parsed
+  PSBT_STREAM_ERROR,
+} PsbtStreamEvent;
+
+/*
+ * Parses a PSBT fed in chunks of any size. Each map is reported as soon as
+ * its separator has been read, the sighash midstates are updated as the
+ * inputs and outputs go by and only a PsbtInputSummary is kept per input,
+ * so neither the PSBT nor its unsigned transaction is ever held whole.
+ */
+typedef struct {
+  BitcoinSigHasher hasher;
+  PsbtInputSummary inputs[PSBT_MAX_INPUTS];
+  PsbtTxOutput tx_outputs[PSBT_MAX_OUTPUTS];
+  PartiallySignedInput input;
+  PartiallySignedOutput output;
+  uint8_t key[PSBT_MAX_KEY_SIZE];
+  uint8_t value[PSBT_MAX_VALUE_SIZE];
+  uint8_t num[9];
+  const uint8_t *chunk;
+  uint8_t *value_dst;
+  uint64_t value_left;
+  size_t key_len;
+  size_t value_len;
+  size_t got;
+  uint32_t pos;
+  uint32_t seen;  // single byte key types seen in the current map
+  uint32_t index;
+  uint32_t tx_index;
+  uint32_t tx_version;
+  uint32_t fallback_locktime;
+  uint32_t time_lock;    // largest required time locktime
+  uint32_t height_lock;  // largest required height locktime
+  uint32_t global_version;
+  uint32_t inputs_len;
+  uint32_t outputs_len;
+  uint8_t state;
+  uint8_t map;
+  uint8_t value_mode;
+  uint8_t tx_state;
+  bool tx_lookuped : 1;
+  bool global_version_lookuped : 1;
+  bool time_lock_allowed : 1;
+  bool height_lock_allowed : 1;
+  bool locktime_disabled : 1;
+} PsbtStream;
+
+void psbt_stream_init(PsbtStream *stream);
+// Consumes `data` up to the next event and advances it past what was used.
+PsbtStreamEvent psbt_stream_feed(PsbtStream *stream, const uint8_t **data,
+                                 size_t *len);
+// Only valid once the stream is done.
+uint32_t psbt_stream_locktime(const PsbtStream *stream);
+// Writes the fields of a signature for input `summary` to the input map.
+bool psbt_write_tap_sig(BufferWriter *writer, const PsbtInputSummary *summary,
+                        const uint8_t *x_only_pubkey,
+                        const uint8_t *signature);
+// Writes the partial signature of a P2WPKH input to the input map.
+bool psbt_write_partial_sig(BufferWriter *writer, const uint8_t *pubkey,
+                            const uint8_t *signature);
+bool psbt_write_separator(BufferWriter *writer);
+int ser_compact_size(uint64_t value, BufferWriter *writer);
+
 bool is_witness(const uint8_t *script, size_t script_len,
                 uint8_t *witness_version);
+bool is_p2wpkh(const uint8_t *script, size_t script_len);
 bool is_opreturn(const uint8_t *script, size_t script_len);
 bool is_p2sh(const uint8_t *script, size_t script_len);
 bool is_p2pkh(const uint8_t *script, size_t script_len);
-bool compute_locktime(const PSBT *psbt, uint32_t *locktime);
-bool locktime_disabled(const PSBT *psbt);
 void *custom_memmem(const void *haystack, size_t haystacklen,
                     const void *needle, size_t needlelen);
 
 void sig_hasher_init(BitcoinSigHasher *hasher);
-void sig_hasher_add_input(BitcoinSigHasher *hasher,
-                          const PartiallySignedInput *input);
-void sig_hasher_add_output(BitcoinSigHasher *hasher,
-                           const PartiallySignedOutput *output);
 void sig_hasher_final(BitcoinSigHasher *hasher);
 void sig_hasher_hash_341(const BitcoinSigHasher *hasher, uint32_t i,
                          uint8_t sighash_type, uint8_t *hash, uint32_t version,
                          uint32_t locktime, uint8_t *leaf_hash);
+void sig_hasher_hash_143(const BitcoinSigHasher *hasher,
+                         const PsbtInputSummary *input,
+                         const uint8_t *pubkeyhash, uint32_t version,
+                         uint32_t locktime, uint8_t *hash);
 void tagged_hasher_init(Hasher *hasher, const uint8_t *tag, size_t tag_len);
 #endif  // PSBT_H
@@ -0,0 +1,376 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "psbt_signing.h"
+#include <string.h>
+#include "address.h"
+#include "base58.h"
+#include "buttons.h"
+#include "chunk_signer.h"
+#include "fsm.h"
+#include "layout2.h"
+#include "memzero.h"
+#include "messages.h"
+#include "messages.pb.h"
+#include "protect.h"
+#include "psbt.h"
+#include "transaction.h"
+
+extern HDNode *fsm_getDerivedNode(const char *curve, const uint32_t *address_n,
+                                  size_t address_n_count,
+                                  uint32_t *fingerprint);
+extern bool button_request(const ButtonRequestType code);
+
+static PsbtStream stream;
+static const CoinInfo *coin;
+static uint32_t root_fingerprint;
+static int64_t total_in;
+static int64_t total_out;
+static int64_t change_out;
+// The PSBT when it came in the SignPsbt, the response is the whole PSBT then.
+// Otherwise only the fields added to each input are sent back.
+static const uint8_t *whole_psbt;
+static size_t whole_psbt_len;
+static bool done;
+static PsbtRequest msg_psbt_request;
+static SignedPsbt msg_signed_psbt;
+static ChunkSigner psbt_signer = {.name = "PSBT"};
+
+static bool fail(const char *error) {
+  fsm_sendFailure(FailureType_Failure_DataError, error);
+  return false;
+}
+
+static bool is_root(const uint8_t *fingerprint) {
+  uint32_t mfp = fingerprint[0] << 24 | fingerprint[1] << 16 |
+                 fingerprint[2] << 8 | fingerprint[3];
+  return mfp == root_fingerprint;
+}
+
+// A P2WPKH input, signed with BIP143.
+static bool check_input_p2wpkh(const PartiallySignedInput *input) {
+  if (!coin->has_segwit) return fail("invalid psbt, segwit not enabled");
+  if (input->bip32_paths != 1)
+    return fail("invalid psbt, bip32 path is missing");
+  if (input->sighash_type_lookuped && input->sighash_type != SIGHASH_ALL)
+    return fail("invalid psbt, only SIGHASH_ALL is allowed");
+
+  const KeyOriginInfo *key_origin = &input->bip32_path;
+  if (!is_root(key_origin->fingerprint))
+    return fail("invalid psbt, wallet mismatch");
+  if (!fsm_checkCoinPath(coin, InputScriptType_SPENDWITNESS,
+                         key_origin->path_len, key_origin->path, false,
+                         MessageType_MessageType_SignTx, true)) {
+    return false;
+  }
+  HDNode *node = fsm_getDerivedNode(coin->curve_name, key_origin->path,
+                                    key_origin->path_len, NULL);
+  if (!node) return false;
+  uint8_t pubkeyhash[20] = {0};
+  ecdsa_get_pubkeyhash(node->public_key, coin->curve->hasher_pubkey,
+                       pubkeyhash);
+  if (memcmp(node->public_key, input->bip32_pubkey, 33) != 0 ||
+      memcmp(pubkeyhash, input->script_pubkey + 2, 20) != 0)
+    return fail("invalid key");
+  // the only key of the input has signed already
+  if (input->partial_sig_lookuped)
+    return fail("invalid psbt, input already signed");
+  total_in += input->amount;
+  return true;
+}
+
+static bool check_input(const PartiallySignedInput *input) {
+  if (input->non_witness_utxo_lookuped || !input->witness_utxo_lookuped)
+    return fail("invalid psbt, only witness_utxo is supported");
+  if (input->script_pubkey_len > 34)
+    return fail("invalid psbt, input script overflow");
+  if (is_p2wpkh(input->script_pubkey, input->script_pubkey_len))
+    return check_input_p2wpkh(input);
+  uint8_t witness_version = 0;
+  if (!is_witness(input->script_pubkey, input->script_pubkey_len,
+                  &witness_version) ||
+      witness_version != 1)
+    return fail("invalid psbt, only taproot and P2WPKH are supported");
+  if (!input->tap_bip32_path_lookuped)
+    return fail("invalid psbt, taproot path is missing");
+  if (input->sighash_type_lookuped &&
+      input->sighash_type != SIGHASH_ALL_TAPROOT)
+    return fail("invalid psbt, only SIGHASH_ALL_TAPROOT is allowed");
+
+  const KeyOriginInfo *key_origin = &input->tap_bip32_path.key_origin;
+  if (!is_root(key_origin->fingerprint))
+    return fail("invalid psbt, wallet mismatch");
+  if (!fsm_checkCoinPath(coin, InputScriptType_SPENDTAPROOT,
+                         key_origin->path_len, key_origin->path, false,
+                         MessageType_MessageType_SignTx, true)) {
+    return false;
+  }
+  HDNode *node = fsm_getDerivedNode(coin->curve_name, key_origin->path,
+                                    key_origin->path_len, NULL);
+  if (!node) return false;
+  const uint8_t *x_only_pubkey = input->tap_bip32_path.x_only_pubkey;
+  if (memcmp(node->public_key + 1, x_only_pubkey, 32) != 0)
+    return fail("invalid key");
+  if (!input->tap_leaf_script_lookuped) {
+    if (memcmp(x_only_pubkey, input->tap_internal_key, 32) != 0)
+      return fail("invalid key");
+    // a second key path signature would be a duplicate key
+    if (input->tap_key_sig_lookuped)
+      return fail("invalid psbt, input already signed");
+  } else if (custom_memmem(input->leaf_script, input->leaf_script_len,
+                           x_only_pubkey, 32) == NULL) {
+    return fail("invalid script");
+  }
+  total_in += input->amount;
+  return true;
+}
+
+static bool confirm_output(const PartiallySignedOutput *output) {
+  bool is_change = false;
+  uint8_t witness_version = 0;
+  bool is_wit =
+      is_witness(output->script, output->script_len, &witness_version);
+  char out_addr[MAX_ADDR_SIZE] = {0};
+  uint8_t op_return_data[80] = {0};
+  uint8_t op_return_data_len = 0;
+  if (is_wit) {
+    segwit_addr_encode(out_addr, coin->bech32_prefix, witness_version,
+                       output->script + 2, output->script_len - 2);
+  } else if (is_p2pkh(output->script, output->script_len)) {
+    uint8_t raw[MAX_ADDR_RAW_SIZE] = {0};
+    size_t prefix_len = address_prefix_bytes_len(coin->address_type);
+    address_write_prefix_bytes(coin->address_type, raw);
+    memcpy(raw + prefix_len, output->script + 3, 20);
+    base58_encode_check(raw, 20 + prefix_len, coin->curve->hasher_base58,
+                        out_addr, MAX_ADDR_SIZE);
+  } else if (is_p2sh(output->script, output->script_len)) {
+    uint8_t raw[MAX_ADDR_RAW_SIZE] = {0};
+    size_t prefix_len = address_prefix_bytes_len(coin->address_type_p2sh);
+    address_write_prefix_bytes(coin->address_type_p2sh, raw);
+    memcpy(raw + prefix_len, output->script + 2, 20);
+    base58_encode_check(raw, 20 + prefix_len, coin->curve->hasher_base58,
+                        out_addr, MAX_ADDR_SIZE);
+  } else if (is_opreturn(output->script, output->script_len)) {
+    if (output->amount != 0)
+      return fail("OpReturn output should have 0 value");
+    op_return_data_len = output->script_len - 2;
+    memcpy(op_return_data, output->script + 2, op_return_data_len);
+  } else {
+    return fail("invalid output type");
+  }
+  if (!is_wit || witness_version == 0) {
+    if (output->bip32_path_lookuped) {
+      if (!is_root(output->bip32_fingerprint))
+        return fail("invalid psbt, fingerprint mismatch");
+      is_change = true;
+    }
+  } else if (witness_version == 1) {
+    if (output->tap_bip32_path_lookuped) {
+      if (!is_root(output->tap_bip32_path.key_origin.fingerprint) ||
+          memcmp(output->tap_bip32_path.x_only_pubkey,
+                 output->tap_internal_key, 32) != 0)
+        return fail("invalid parameters, only key path change is allowed");
+      is_change = true;
+    }
+  }
+  total_out += output->amount;
+  if (is_change) {
+    change_out += output->amount;
+    return true;
+  }
+
+  if (op_return_data_len > 0) {
+    if (!button_request(ButtonRequestType_ButtonRequest_ConfirmOutput) ||
+        layoutConfirmOpReturn(coin, op_return_data, op_return_data_len) ==
+            KEY_CANCEL) {
+      fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
+      return false;
+    }
+  } else {
+    TxOutputType tx_output = {0};
+    tx_output.amount = (uint64_t)output->amount;
+    strlcpy(tx_output.address, out_addr, sizeof(tx_output.address));
+    if (!layoutConfirmOutput(coin, AmountUnit_BITCOIN, &tx_output)) {
+      fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
+      return false;
+    }
+  }
+  return true;
+}
+
+static void parse_chunk(const uint8_t *data, size_t size) {
+  for (;;) {
+    bool ok = true;
+    switch (psbt_stream_feed(&stream, &data, &size)) {
+      case PSBT_STREAM_MORE:
+        return;
+      case PSBT_STREAM_INPUT:
+        ok = check_input(&stream.input);
+        break;
+      case PSBT_STREAM_OUTPUT:
+        ok = confirm_output(&stream.output);
+        break;
+      case PSBT_STREAM_DONE:
+        done = true;
+        return;
+      default:
+        ok = fail("PSBT parse failed");
+        break;
+    }
+    if (!ok) {
+      chunk_signer_abort(&psbt_signer);
+      return;
+    }
+  }
+}
+
+static void send_request_chunk(uint32_t size) {
+  msg_psbt_request.has_data_length = true;
+  msg_psbt_request.data_length = size;
+  msg_write(MessageType_MessageType_PsbtRequest, &msg_psbt_request);
+}
+
+static bool sign_input(uint32_t i, uint32_t locktime, BufferWriter *writer) {
+  const PsbtInputSummary *summary = &stream.inputs[i];
+  HDNode *node = fsm_getDerivedNode(coin->curve_name, summary->key_origin.path,
+                                    summary->key_origin.path_len, NULL);
+  if (!node) return false;
+  uint8_t digest[32] = {0};
+  uint8_t signature[64] = {0};
+  if (summary->p2wpkh) {
+    uint8_t pubkeyhash[20] = {0};
+    ecdsa_get_pubkeyhash(node->public_key, coin->curve->hasher_pubkey,
+                         pubkeyhash);
+    sig_hasher_hash_143(&stream.hasher, summary, pubkeyhash, stream.tx_version,
+                        locktime, digest);
+    if (hdnode_sign_digest(node, digest, signature, NULL, NULL) != 0)
+      return fail("sign failed");
+    if (!psbt_write_partial_sig(writer, node->public_key, signature))
+      return fail("PSBT serialization failed");
+    return true;
+  }
+  sig_hasher_hash_341(&stream.hasher, i, SIGHASH_ALL_TAPROOT, digest,
+                      stream.tx_version, locktime,
+                      summary->script_path ? (uint8_t *)summary->leaf_hash
+                                           : NULL);
+  int ret = summary->script_path
+                ? hdnode_bip340_sign_digest_internal(node, digest, signature)
+                : hdnode_bip340_sign_digest(node, digest, signature);
+  if (ret != 0) return fail("sign failed");
+  if (!psbt_write_tap_sig(writer, summary, node->public_key + 1, signature))
+    return fail("PSBT serialization failed");
+  return true;
+}
+
+static void send_signed_psbt(void) {
+  if (!done) {
+    fail("PSBT parse failed");
+    return;
+  }
+  if (total_in <= total_out) {
+    fail("Insufficient funds");
+    return;
+  }
+  uint32_t locktime = psbt_stream_locktime(&stream);
+  if (locktime > 0) {
+    layoutConfirmNondefaultLockTime(coin, locktime, stream.locktime_disabled);
+    if (protectWaitKeyValue(ButtonRequestType_ButtonRequest_SignTx, true, 0,
+                            1) != KEY_CONFIRM) {
+      fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
+      return;
+    }
+  }
+  if (!layoutConfirmTx(coin, AmountUnit_BITCOIN, total_in, 0, total_out,
+                       change_out, 0)) {
+    fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
+    return;
+  }
+
+  sig_hasher_final(&stream.hasher);
+  memzero(&msg_signed_psbt, sizeof(msg_signed_psbt));
+  BufferWriter writer = {0};
+  init_buffer_writer(&writer, msg_signed_psbt.psbt.bytes,
+                     sizeof(msg_signed_psbt.psbt.bytes));
+  // The signatures go at the end of each input map, right before its
+  // separator, the rest of the PSBT is copied through unchanged.
+  uint32_t copied = 0;
+  for (uint32_t i = 0; i < stream.inputs_len; i++) {
+    if (whole_psbt != NULL) {
+      if (!write_bytes(whole_psbt + copied, stream.inputs[i].end - copied,
+                       &writer)) {
+        fail("PSBT serialization failed");
+        return;
+      }
+      copied = stream.inputs[i].end;
+    }
+    if (!sign_input(i, locktime, &writer)) return;
+    if (whole_psbt == NULL && !psbt_write_separator(&writer)) {
+      fail("PSBT serialization failed");
+      return;
+    }
+  }
+  if (whole_psbt != NULL &&
+      !write_bytes(whole_psbt + copied, whole_psbt_len - copied, &writer)) {
+    fail("PSBT serialization failed");
+    return;
+  }
+  msg_signed_psbt.psbt.size = writer.position;
+  msg_write(MessageType_MessageType_SignedPsbt, &msg_signed_psbt);
+}
+
+static void clear_stream(void) {
+  memzero(&stream, sizeof(stream));
+  whole_psbt = NULL;
+  whole_psbt_len = 0;
+  done = false;
+}
+
+static const ChunkSignerOps psbt_signer_ops = {
+    .update = parse_chunk,
+    .request = send_request_chunk,
+    .finish = send_signed_psbt,
+    .reset = clear_stream,
+    .interactive = true,
+};
+
+void psbt_signing_init(const SignPsbt *msg, const CoinInfo *coin_info,
+                       uint32_t fingerprint) {
+  chunk_signer_init(&psbt_signer, &psbt_signer_ops);
+  uint32_t total = msg->has_data_length ? msg->data_length : msg->psbt.size;
+  if (!chunk_signer_set_length(&psbt_signer, total, msg->psbt.size)) {
+    return;
+  }
+  coin = coin_info;
+  root_fingerprint = fingerprint;
+  total_in = 0;
+  total_out = 0;
+  change_out = 0;
+  done = false;
+  whole_psbt = msg->has_data_length ? NULL : msg->psbt.bytes;
+  whole_psbt_len = msg->psbt.size;
+  psbt_stream_init(&stream);
+
+  chunk_signer_start(&psbt_signer, msg->psbt.bytes, msg->psbt.size);
+}
+
+void psbt_signing_txack(const PsbtAck *msg) {
+  chunk_signer_txack(&psbt_signer, msg->data_chunk.bytes, msg->data_chunk.size);
+}
+
+void psbt_signing_abort(void) { chunk_signer_abort(&psbt_signer); }
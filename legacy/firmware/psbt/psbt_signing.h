@@ -0,0 +1,32 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PSBT_SIGNING_H__
+#define __PSBT_SIGNING_H__
+
+#include <stdint.h>
+#include "coins.h"
+#include "messages-bitcoin.pb.h"
+
+void psbt_signing_init(const SignPsbt *msg, const CoinInfo *coin,
+                       uint32_t root_fingerprint);
+void psbt_signing_txack(const PsbtAck *msg);
+void psbt_signing_abort(void);
+
+#endif  // __PSBT_SIGNING_H__
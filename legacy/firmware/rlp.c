@@ -0,0 +1,153 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "rlp.h"
+#include <string.h>
+#include "memzero.h"
+
+static void rlp_hash_flush(RLP_HASH_CTX *rlp) {
+  if (rlp->staged) {
+    sha3_Update(&rlp->ctx, rlp->staging, rlp->staged);
+    rlp->staged = 0;
+  }
+}
+
+void rlp_hash_init(RLP_HASH_CTX *rlp) {
+  sha3_256_Init(&rlp->ctx);
+  rlp->staged = 0;
+}
+
+void rlp_hash_data(RLP_HASH_CTX *rlp, const uint8_t *buf, size_t size) {
+  if (rlp->staged + size <= sizeof(rlp->staging)) {
+    memcpy(rlp->staging + rlp->staged, buf, size);
+    rlp->staged += size;
+    return;
+  }
+  rlp_hash_flush(rlp);
+  if (size >= sizeof(rlp->staging)) {
+    sha3_Update(&rlp->ctx, buf, size);
+  } else {
+    memcpy(rlp->staging, buf, size);
+    rlp->staged = size;
+  }
+}
+
+/*
+ * Encode a length header with the given short form offset (0x80 for
+ * strings, 0xc0 for lists).
+ */
+static void rlp_hash_header(RLP_HASH_CTX *rlp, uint32_t length,
+                            uint8_t offset) {
+  uint8_t buf[4] = {0};
+  size_t size = 1;
+  if (length <= 55) {
+    buf[0] = offset + length;
+  } else {
+    for (uint32_t l = length; l; l >>= 8) {
+      size++;
+    }
+    buf[0] = offset + 55 + (size - 1);
+    for (size_t i = size - 1; i > 0; i--) {
+      buf[i] = length & 0xff;
+      length >>= 8;
+    }
+  }
+  rlp_hash_data(rlp, buf, size);
+}
+
+/*
+ * Push an RLP encoded length to the hash buffer.
+ */
+void rlp_hash_length(RLP_HASH_CTX *rlp, uint32_t length, uint8_t firstbyte) {
+  if (length == 1 && firstbyte <= 0x7f) {
+    /* empty length header */
+    return;
+  }
+  rlp_hash_header(rlp, length, 0x80);
+}
+
+/*
+ * Push an RLP encoded list length to the hash buffer.
+ */
+void rlp_hash_list_length(RLP_HASH_CTX *rlp, uint32_t length) {
+  rlp_hash_header(rlp, length, 0xc0);
+}
+
+/*
+ * Push an RLP encoded length field and data to the hash buffer.
+ */
+void rlp_hash_field(RLP_HASH_CTX *rlp, const uint8_t *buf, size_t size) {
+  rlp_hash_length(rlp, size, size ? buf[0] : 0);
+  rlp_hash_data(rlp, buf, size);
+}
+
+/*
+ * Push an RLP encoded number to the hash buffer.
+ * Ethereum yellow paper says to convert to big endian and strip leading zeros,
+ * so zero is encoded as the empty string.
+ */
+void rlp_hash_number(RLP_HASH_CTX *rlp, uint64_t number) {
+  uint8_t data[8] = {0};
+  int offset = 8;
+  while (number) {
+    data[--offset] = number & 0xff;
+    number >>= 8;
+  }
+  rlp_hash_field(rlp, data + offset, 8 - offset);
+}
+
+void rlp_hash_final(RLP_HASH_CTX *rlp, uint8_t hash[32]) {
+  rlp_hash_flush(rlp);
+  keccak_Final(&rlp->ctx, hash);
+  memzero(rlp->staging, sizeof(rlp->staging));
+}
+
+/*
+ * Calculate the number of bytes needed for an RLP encoded string of the given
+ * length, header included.
+ */
+uint32_t rlp_calculate_length(uint32_t length, uint8_t firstbyte) {
+  if (length == 1 && firstbyte <= 0x7f) {
+    return 1;
+  } else if (length <= 55) {
+    return 1 + length;
+  } else if (length <= 0xff) {
+    return 2 + length;
+  } else if (length <= 0xffff) {
+    return 3 + length;
+  } else if (length <= 0xffffff) {
+    return 4 + length;
+  } else {
+    return 5 + length;
+  }
+}
+
+/* If number is less than 0x80 the RLP encoding is iteself (1 byte).
+ * If it is 0x80 or larger, RLP encoding is 1 + length in bytes.
+ */
+uint32_t rlp_calculate_number_length(uint64_t number) {
+  uint32_t length = 1;
+  if (number >= 0x80) {
+    while (number) {
+      length++;
+      number = number >> 8;
+    }
+  }
+  return length;
+}
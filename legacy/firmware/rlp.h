@@ -0,0 +1,50 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __RLP_H__
+#define __RLP_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "sha3.h"
+
+/*
+ * Streaming RLP encoder that feeds a Keccak-256 hash.
+ * Small header and field writes are collected in a staging buffer of one
+ * Keccak block, so the sponge is only updated with whole blocks or with
+ * large payloads that are passed through directly.
+ */
+typedef struct {
+  SHA3_CTX ctx;
+  size_t staged;
+  uint8_t staging[SHA3_256_BLOCK_LENGTH];
+} RLP_HASH_CTX;
+
+void rlp_hash_init(RLP_HASH_CTX *rlp);
+void rlp_hash_data(RLP_HASH_CTX *rlp, const uint8_t *buf, size_t size);
+void rlp_hash_length(RLP_HASH_CTX *rlp, uint32_t length, uint8_t firstbyte);
+void rlp_hash_list_length(RLP_HASH_CTX *rlp, uint32_t length);
+void rlp_hash_field(RLP_HASH_CTX *rlp, const uint8_t *buf, size_t size);
+void rlp_hash_number(RLP_HASH_CTX *rlp, uint64_t number);
+void rlp_hash_final(RLP_HASH_CTX *rlp, uint8_t hash[32]);
+
+uint32_t rlp_calculate_length(uint32_t length, uint8_t firstbyte);
+uint32_t rlp_calculate_number_length(uint64_t number);
+
+#endif
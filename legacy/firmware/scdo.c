@@ -5,6 +5,7 @@
 #include "../legacy/util.h"
 #include "address.h"
 #include "bignum.h"
+#include "chunk_signer.h"
 #include "crypto.h"
 #include "ecdsa.h"
 #include "ethereum.h"
@@ -16,6 +17,7 @@
 #include "messages.h"
 #include "messages.pb.h"
 #include "protect.h"
+#include "rlp.h"
 #include "scdo_tokens.h"
 #include "secp256k1.h"
 #include "sha3.h"
@@ -24,11 +26,10 @@
 
 #define SCDO_CHAIN_ID 541
 
-static bool scdo_signing = false;
-static uint32_t data_total, data_left;
 static ScdoSignedTx msg_tx_request;
 static CONFIDENTIAL HDNode *_node = NULL;
-struct SHA3_CTX keccak_ctx_scdo = {0};
+static ChunkSigner scdo_signer = {.name = "SCDO"};
+static RLP_HASH_CTX rlp_ctx;
 
 void scdo_eth_2_address(const uint8_t *pubkey, char *scdo_address,
                         size_t scdo_address_size) {
@@ -61,112 +62,15 @@ void scdo_eth_2_address(const uint8_t *pubkey, char *scdo_address,
   snprintf(scdo_address, scdo_address_size, "1S%s", hex_address);
 }
 
-static inline void hash_data(const uint8_t *buf, size_t size) {
-  sha3_Update(&keccak_ctx_scdo, buf, size);
+static void hash_data(const uint8_t *buf, size_t size) {
+  rlp_hash_data(&rlp_ctx, buf, size);
 }
 
-static void hash_rlp_list_length(uint32_t length) {
-  uint8_t buf[4] = {0};
-  if (length <= 55) {
-    buf[0] = 0xc0 + length;
-    hash_data(buf, 1);
-  } else if (length <= 0xff) {
-    buf[0] = 0xf7 + 1;
-    buf[1] = length;
-    hash_data(buf, 2);
-  } else if (length <= 0xffff) {
-    buf[0] = 0xf7 + 2;
-    buf[1] = length >> 8;
-    buf[2] = length & 0xff;
-    hash_data(buf, 3);
-  } else {
-    buf[0] = 0xf7 + 3;
-    buf[1] = length >> 16;
-    buf[2] = length >> 8;
-    buf[3] = length & 0xff;
-    hash_data(buf, 4);
-  }
-}
-
-static void hash_rlp_length(uint32_t length, uint8_t firstbyte) {
-  uint8_t buf[4] = {0};
-
-  if (length == 1 && firstbyte <= 0x7f) {
-    /* empty length header */
-  } else if (length <= 55) {
-    buf[0] = 0x80 + length;
-    hash_data(buf, 1);
-  } else if (length <= 0xff) {
-    buf[0] = 0xb7 + 1;
-    buf[1] = length;
-    hash_data(buf, 2);
-  } else if (length <= 0xffff) {
-    buf[0] = 0xb7 + 2;
-    buf[1] = length >> 8;
-    buf[2] = length & 0xff;
-    hash_data(buf, 3);
-  } else {
-    buf[0] = 0xb7 + 3;
-    buf[1] = length >> 16;
-    buf[2] = length >> 8;
-    buf[3] = length & 0xff;
-    hash_data(buf, 4);
-  }
-}
-
-static void hash_rlp_field(const uint8_t *buf, size_t size) {
-  hash_rlp_length(size, buf[0]);
-  hash_data(buf, size);
-}
-
-static void hash_rlp_number(uint32_t number) {
-  uint8_t data[4] = {0};
-  data[0] = (number >> 24) & 0xff;
-  data[1] = (number >> 16) & 0xff;
-  data[2] = (number >> 8) & 0xff;
-  data[3] = (number)&0xff;
-  int offset = 0;
-  while (!data[offset]) {
-    offset++;
-  }
-  hash_rlp_field(data + offset, 4 - offset);
-}
-
-static int rlp_calculate_length(int length, uint8_t firstbyte) {
-  if (length == 1 && firstbyte <= 0x7f) {
-    return 1;
-  } else if (length <= 55) {
-    return 1 + length;
-  } else if (length <= 0xff) {
-    return 2 + length;
-  } else if (length <= 0xffff) {
-    return 3 + length;
-  } else {
-    return 4 + length;
-  }
-}
-
-static int rlp_calculate_number_length(uint32_t number) {
-  if (number <= 0x7f) {
-    return 1;
-  } else if (number <= 0xff) {
-    return 2;
-  } else if (number <= 0xffff) {
-    return 3;
-  } else if (number <= 0xffffff) {
-    return 4;
-  } else {
-    return 5;
-  }
-}
-
-static void send_request_chunk(void) {
-  int progress = 1000 - (data_total > 1000000 ? data_left / (data_total / 800)
-                                              : data_left * 800 / data_total);
-  layoutProgressAdapter(_(C__SIGNING), progress);
+static void send_request_chunk(uint32_t size) {
+  layoutProgressAdapter(_(C__SIGNING), chunk_signer_progress(&scdo_signer));
   msg_tx_request.has_data_length = true;
   msg_tx_request.has_signature = false;
-  msg_tx_request.data_length = data_left <= 1024 ? data_left : 1024;
+  msg_tx_request.data_length = size;
   msg_write(MessageType_MessageType_ScdoSignedTx, &msg_tx_request);
 }
 
@@ -180,7 +84,7 @@ static void send_signature(void) {
   uint8_t v = 0;
   layoutProgressAdapter(_(C__SIGNING), 1000);
 
-  keccak_Final(&keccak_ctx_scdo, hash);
+  rlp_hash_final(&rlp_ctx, hash);
 
   if (hdnode_sign_digest(_node, hash, sig, &v, scdo_is_canonic) != 0) {
     fsm_sendFailure(FailureType_Failure_ProcessError, "Signing failed");
@@ -196,10 +100,21 @@ static void send_signature(void) {
   memcpy(msg_tx_request.signature.bytes, sig, 64);
   memcpy(msg_tx_request.signature.bytes + 64, &v, 1);
   msg_write(MessageType_MessageType_ScdoSignedTx, &msg_tx_request);
-
-  scdo_signing_abort();
 }
 
+static void clear_node(void) { _node = NULL; }
+
+static const ChunkSignerOps scdo_signer_ops = {
+    /* Our encoding only supports transactions up to 2^24 bytes.  To
+     * prevent exceeding the limit we use a stricter limit on data length.
+     */
+    .max_length = 16000000,
+    .update = hash_data,
+    .request = send_request_chunk,
+    .finish = send_signature,
+    .reset = clear_node,
+};
+
 static void scdoFormatAmount(const bignum256 *amnt, char *buf, int buflen,
                              const ScdoTokenType *token) {
   const char *suffix = NULL;
@@ -257,38 +172,16 @@ static bool layoutScdoConfirmTx(char *to_str, const char *signer,
 }
 
 void scdo_sign_tx(ScdoSignTx *msg, const HDNode *node, char *from_str) {
-  scdo_signing = true;
-  sha3_256_Init(&keccak_ctx_scdo);
+  chunk_signer_init(&scdo_signer, &scdo_signer_ops);
+  rlp_hash_init(&rlp_ctx);
 
   memzero(&msg_tx_request, sizeof(ScdoSignedTx));
 
   if (!msg->has_data_initial_chunk) msg->data_initial_chunk.size = 0;
+  if (!msg->has_data_length) msg->data_length = 0;
 
-  if (msg->has_data_length && msg->data_length > 0) {
-    if (!msg->has_data_initial_chunk || msg->data_initial_chunk.size == 0) {
-      fsm_sendFailure(FailureType_Failure_DataError,
-                      "Data length provided, but no initial chunk");
-      scdo_signing_abort();
-      return;
-    }
-
-    /* Our encoding only supports transactions up to 2^24 bytes.  To
-     * prevent exceeding the limit we use a stricter limit on data length.
-     */
-    if (msg->data_length > 16000000) {
-      fsm_sendFailure(FailureType_Failure_DataError,
-                      "Data length exceeds limit");
-      scdo_signing_abort();
-      return;
-    }
-    data_total = msg->data_length;
-  } else {
-    data_total = 0;
-  }
-  if (msg->data_initial_chunk.size > data_total) {
-    fsm_sendFailure(FailureType_Failure_DataError,
-                    "Invalid size of initial chunk");
-    scdo_signing_abort();
+  if (!chunk_signer_set_length(&scdo_signer, msg->data_length,
+                               msg->data_initial_chunk.size)) {
     return;
   }
 
@@ -296,7 +189,7 @@ void scdo_sign_tx(ScdoSignTx *msg, const HDNode *node, char *from_str) {
   const ScdoTokenType *token = NULL;
   char to_str[43] = {0};
 
-  if (msg->value.size == 0 && data_total == 68 &&
+  if (msg->value.size == 0 && scdo_signer.total == 68 &&
       msg->data_initial_chunk.size == 68 &&
       memcmp(msg->data_initial_chunk.bytes,
              "\xa9\x05\x9c\xbb\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00\x00",
@@ -355,71 +248,35 @@ void scdo_sign_tx(ScdoSignTx *msg, const HDNode *node, char *from_str) {
       rlp_calculate_length(msg->gas_limit.size, msg->gas_limit.bytes[0]);
   rlp_length +=
       rlp_calculate_length(msg->timestamp.size, msg->timestamp.bytes[0]);
-  rlp_length +=
-      rlp_calculate_length(data_total, msg->data_initial_chunk.bytes[0]);
+  rlp_length += rlp_calculate_length(scdo_signer.total,
+                                     msg->data_initial_chunk.bytes[0]);
 
   /* Stage 2: Store header fields */
-  hash_rlp_list_length(rlp_length);
+  rlp_hash_list_length(&rlp_ctx, rlp_length);
 
   layoutProgressAdapter(_(C__SIGNING), 100);
 
-  hash_rlp_number(msg->tx_type);
-  hash_rlp_field(from, 20);
-  hash_rlp_field(to, 20);
-  hash_rlp_field(msg->value.bytes, msg->value.size);
-  hash_rlp_field(msg->nonce.bytes, msg->nonce.size);
-  hash_rlp_field(msg->gas_price.bytes, msg->gas_price.size);
-  hash_rlp_field(msg->gas_limit.bytes, msg->gas_limit.size);
-  hash_rlp_field(msg->timestamp.bytes, msg->timestamp.size);
-  hash_rlp_length(data_total, msg->data_initial_chunk.bytes[0]);
-  hash_data(msg->data_initial_chunk.bytes, msg->data_initial_chunk.size);
-  data_left = data_total - msg->data_initial_chunk.size;
+  rlp_hash_number(&rlp_ctx, msg->tx_type);
+  rlp_hash_field(&rlp_ctx, from, 20);
+  rlp_hash_field(&rlp_ctx, to, 20);
+  rlp_hash_field(&rlp_ctx, msg->value.bytes, msg->value.size);
+  rlp_hash_field(&rlp_ctx, msg->nonce.bytes, msg->nonce.size);
+  rlp_hash_field(&rlp_ctx, msg->gas_price.bytes, msg->gas_price.size);
+  rlp_hash_field(&rlp_ctx, msg->gas_limit.bytes, msg->gas_limit.size);
+  rlp_hash_field(&rlp_ctx, msg->timestamp.bytes, msg->timestamp.size);
+  rlp_hash_length(&rlp_ctx, scdo_signer.total,
+                  msg->data_initial_chunk.bytes[0]);
   _node = (HDNode *)node;
-  if (data_left > 0) {
-    send_request_chunk();
-  } else {
-    send_signature();
-  }
+  chunk_signer_start(&scdo_signer, msg->data_initial_chunk.bytes,
+                     msg->data_initial_chunk.size);
 }
 
 void scdo_signing_txack(const ScdoTxAck *tx) {
-  if (!scdo_signing) {
-    fsm_sendFailure(FailureType_Failure_UnexpectedMessage,
-                    "Not in SCDO signing mode");
-    layoutHome();
-    return;
-  }
-
-  if (tx->data_chunk.size > data_left) {
-    fsm_sendFailure(FailureType_Failure_DataError, "Too much data");
-    scdo_signing_abort();
-    return;
-  }
-
-  if (data_left > 0 && (!tx->has_data_chunk || tx->data_chunk.size == 0)) {
-    fsm_sendFailure(FailureType_Failure_DataError, "Empty data chunk received");
-    scdo_signing_abort();
-    return;
-  }
-
-  hash_data(tx->data_chunk.bytes, tx->data_chunk.size);
-
-  data_left -= tx->data_chunk.size;
-
-  if (data_left > 0) {
-    send_request_chunk();
-  } else {
-    send_signature();
-  }
+  chunk_signer_txack(&scdo_signer, tx->data_chunk.bytes,
+                     tx->has_data_chunk ? tx->data_chunk.size : 0);
 }
 
-void scdo_signing_abort(void) {
-  if (scdo_signing) {
-    _node = NULL;
-    layoutHome();
-    scdo_signing = false;
-  }
-}
+void scdo_signing_abort(void) { chunk_signer_abort(&scdo_signer); }
 
 static void scdo_message_hash(const uint8_t *message, size_t message_len,
                               uint8_t hash[32]) {
@@ -90,6 +90,42 @@ typedef struct {
 
 se_state_cache_t se_state_cache = {0};
 
+// The streamed Ed25519 signature in progress. The SE signs it with the key it
+// derived last and keeps the nonce of the first pass until the signature, so
+// deriving or signing anything else in between ends it.
+static struct {
+  bool derived;
+  uint8_t public_key[33];  // of the key derived last
+  bool open;
+  bool sending;  // the stream's own commands
+} se_ed25519_stream;
+
+static void se_ed25519_stream_end(uint8_t ins, uint8_t p2) {
+  if (se_ed25519_stream.sending) {
+    return;
+  }
+  switch (ins) {
+    case SE_INS_SESSION:
+      // reading the state of the session seed keeps the key
+      if (p2 == 0x04 || p2 == 0x07) {
+        break;
+      }
+      memzero(&se_ed25519_stream, sizeof(se_ed25519_stream));
+      break;
+    case SE_INS_DERIVE:
+    case SE_INS_FIDO:
+      memzero(&se_ed25519_stream, sizeof(se_ed25519_stream));
+      break;
+    case SE_INS_SIGN:
+    case SE_INS_HASHR:
+    case SE_INS_HASHRAM:
+      se_ed25519_stream.open = false;
+      break;
+    default:
+      break;
+  }
+}
+
 static void xor_cal(uint8_t *data1, uint8_t *data2, uint16_t len,
                     uint8_t * xor) {
   uint16_t i;
@@ -144,32 +180,94 @@ static void cal_mac(uint8_t *data, uint32_t len, uint8_t *mac) {
   memcpy(mac, mac_buf, 4);
 }
 
+// se_random_encrypted_ex in two halves, see thd89_send
+static secbool se_random_encrypted_ex_send(uint16_t len) {
+  uint8_t cmd[7] = {0xa4, 0x84, 0x00, 0x00, 0x02};
+  cmd[5] = (len >> 8) & 0xff;
+  cmd[6] = len & 0xff;
+  return thd89_send(cmd, sizeof(cmd));
+}
+
+static secbool se_random_encrypted_ex_receive(uint8_t *rand, uint16_t len) {
+  uint16_t recv_len = SE_BUF_MAX_LEN;
+  uint8_t mac[4];
+  uint8_t pad_len;
+  if (!thd89_receive(se_recv_buffer, &recv_len)) {
+    return secfalse;
+  }
+
+  if (recv_len) {
+    if ((recv_len - 4) % AES_BLOCK_SIZE) {
+      return secfalse;
+    }
+
+    cal_mac(se_recv_buffer, recv_len - 4, mac);
+    if (memcmp(mac, se_recv_buffer + recv_len - 4, 4) != 0) {
+      return secfalse;
+    }
+
+    recv_len -= 4;
+
+    aes_decrypt_ctx dtxe;
+    aes_decrypt_key128(se_session_key, &dtxe);
+    aes_ecb_decrypt(se_recv_buffer, se_recv_buffer, recv_len, &dtxe);
+    pad_len = 1;
+    for (uint8_t i = 0; i < 16; i++) {
+      if (se_recv_buffer[recv_len - 1 - i] == 0x80) {
+        break;
+      } else if (se_recv_buffer[recv_len - 1 - i] == 0x00) {
+        pad_len++;
+      } else {
+        return secfalse;
+      }
+    }
+    recv_len -= pad_len;
+
+    if (recv_len != len) {
+      return secfalse;
+    }
+  }
+
+  memcpy(rand, se_recv_buffer, recv_len);
+
+  return sectrue;
+}
+
 secbool se_transmit_mac(uint8_t ins, uint8_t p1, uint8_t p2, uint8_t *data,
                         uint16_t data_len, uint8_t *recv, uint16_t *recv_len) {
   uint8_t mac[4], iv_random[16];
   uint16_t pad_len;
+  se_ed25519_stream_end(ins, p2);
   APDU_CLA = 0x84;
   APDU_INS = ins;
   APDU_P1 = p1;
   APDU_P2 = p2;
   APDU_P3 = 0x00;
 
-  if (!se_random_encrypted_ex(iv_random, 16)) {
-    return secfalse;
-  }
-
+  pad_len = 0;
   if (data != NULL && data_len != 0) {
     pad_len = AES_BLOCK_SIZE - (data_len % AES_BLOCK_SIZE);
-    memset(APDU_DATA + data_len, 0x00, pad_len);
-    APDU_DATA[data_len] = 0x80;
-    data_len += pad_len;
     // header + data + mac
-    if (data_len > SE_BUF_MAX_LEN - 7 - 4) {
+    if (data_len + pad_len > SE_BUF_MAX_LEN - 7 - 4) {
       return secfalse;
     }
+  }
 
-    memmove(APDU_DATA, data, data_len - pad_len);
+  // the payload is laid out while the SE generates the IV
+  if (!se_random_encrypted_ex_send(16)) {
+    return secfalse;
+  }
+  if (pad_len) {
+    memmove(APDU_DATA, data, data_len);
+    memset(APDU_DATA + data_len, 0x00, pad_len);
+    APDU_DATA[data_len] = 0x80;
+    data_len += pad_len;
+  }
+  if (!se_random_encrypted_ex_receive(iv_random, 16)) {
+    return secfalse;
+  }
 
+  if (pad_len) {
     aes_encrypt_ctx ctxe;
     uint8_t iv[16];
     memcpy(iv, iv_random, 16);
@@ -258,51 +356,11 @@ secbool se_random_encrypted(uint8_t *rand, uint16_t len) {
 }
 
 secbool se_random_encrypted_ex(uint8_t *rand, uint16_t len) {
-  uint16_t recv_len = SE_BUF_MAX_LEN;
-  uint8_t cmd[7] = {0xa4, 0x84, 0x00, 0x00, 0x02};
-  uint8_t mac[4];
-  uint8_t pad_len;
-  cmd[5] = (len >> 8) & 0xff;
-  cmd[6] = len & 0xff;
-  if (!thd89_transmit(cmd, sizeof(cmd), se_recv_buffer, &recv_len)) {
+  if (!se_random_encrypted_ex_send(len)) {
     return secfalse;
   }
-
-  if (recv_len) {
-    if ((recv_len - 4) % AES_BLOCK_SIZE) {
-      return secfalse;
-    }
-
-    cal_mac(se_recv_buffer, recv_len - 4, mac);
-    if (memcmp(mac, se_recv_buffer + recv_len - 4, 4) != 0) {
-      return secfalse;
-    }
-
-    recv_len -= 4;
-
-    aes_decrypt_ctx dtxe;
-    aes_decrypt_key128(se_session_key, &dtxe);
-    aes_ecb_decrypt(se_recv_buffer, se_recv_buffer, recv_len, &dtxe);
-    pad_len = 1;
-    for (uint8_t i = 0; i < 16; i++) {
-      if (se_recv_buffer[recv_len - 1 - i] == 0x80) {
-        break;
-      } else if (se_recv_buffer[recv_len - 1 - i] == 0x00) {
-        pad_len++;
-      } else {
-        return secfalse;
-      }
-    }
-    recv_len -= pad_len;
-
-    if (recv_len != len) {
-      return secfalse;
-    }
-  }
-
-  memcpy(rand, se_recv_buffer, recv_len);
-
-  return sectrue;
+  hal_delay(1);
+  return se_random_encrypted_ex_receive(rand, len);
 }
 
 secbool se_sync_session_key(void) {
@@ -432,6 +490,9 @@ secbool se_derive_keys(HDNode *out, const char *curve,
     memcpy(fingerprint, resp, 4);
   }
   memcpy((void *)out, resp + 4, sizeof(HDNode) - 4);
+  se_ed25519_stream.derived = true;
+  memcpy(se_ed25519_stream.public_key, out->public_key,
+         sizeof(se_ed25519_stream.public_key));
 
   return sectrue;
 }
@@ -957,20 +1018,13 @@ int se_nist256p1_sign_digest(const uint8_t *digest, uint8_t *sig,
 #define ED25519_HASH_EXT 1
 #define ED25519_HASH_KECCAK 2
 
-static int _se_ed25519_send_msg(uint8_t ins, uint8_t type, const uint8_t *msg,
-                                uint16_t msg_len) {
-  uint8_t flag = HASH_FLAG_INIT;
-  bool first = true;
-
+static int _se_ed25519_send_chunk(uint8_t ins, uint8_t type, const uint8_t *msg,
+                                  uint16_t msg_len, bool first, bool last) {
   while (msg_len) {
     uint16_t len = msg_len > MI2C_DATA_MAX_LEN ? MI2C_DATA_MAX_LEN : msg_len;
-    if (first) {
-      flag = HASH_FLAG_INIT;
-      first = false;
-    } else {
-      flag = HASH_FLAG_UPDATE;
-    }
-    if (msg_len - len == 0) {
+    uint8_t flag = first ? HASH_FLAG_INIT : HASH_FLAG_UPDATE;
+    first = false;
+    if (last && msg_len - len == 0) {
       flag |= HASH_FLAG_FINAL;
     }
     if (!se_transmit_mac(ins, type, flag, (uint8_t *)msg, len, NULL, NULL)) {
@@ -982,6 +1036,11 @@ static int _se_ed25519_send_msg(uint8_t ins, uint8_t type, const uint8_t *msg,
   return 0;
 }
 
+static int _se_ed25519_send_msg(uint8_t ins, uint8_t type, const uint8_t *msg,
+                                uint16_t msg_len) {
+  return _se_ed25519_send_chunk(ins, type, msg, msg_len, true, true);
+}
+
 static int _se_ed25519_sign_digest(uint8_t type, uint8_t *sig) {
   uint16_t resp_len = 64;
   if (!se_transmit_mac(SE_INS_SIGN, 0x00, 0x08, &type, 1, sig, &resp_len)) {
@@ -1055,6 +1114,41 @@ int se_ed25519_sign_keccak(const uint8_t *msg, uint16_t msg_len, uint8_t *sig) {
   return 0;
 }
 
+int se_ed25519_stream_begin(const uint8_t *public_key) {
+  se_ed25519_stream.open =
+      se_ed25519_stream.derived &&
+      memcmp(se_ed25519_stream.public_key, public_key,
+             sizeof(se_ed25519_stream.public_key)) == 0;
+  return se_ed25519_stream.open ? 0 : -1;
+}
+
+int se_ed25519_stream_update(bool hram, const uint8_t *msg, uint16_t msg_len,
+                             bool first, bool last) {
+  if (!se_ed25519_stream.open) {
+    return -1;
+  }
+  se_ed25519_stream.sending = true;
+  int ret = _se_ed25519_send_chunk(hram ? SE_INS_HASHRAM : SE_INS_HASHR,
+                                   ED25519_HASH_DEFAULT, msg, msg_len, first,
+                                   last);
+  se_ed25519_stream.sending = false;
+  if (ret != 0) {
+    se_ed25519_stream.open = false;
+  }
+  return ret;
+}
+
+int se_ed25519_stream_sign(uint8_t *sig) {
+  if (!se_ed25519_stream.open) {
+    return -1;
+  }
+  se_ed25519_stream.sending = true;
+  int ret = _se_ed25519_sign_digest(ED25519_HASH_DEFAULT, sig);
+  se_ed25519_stream.sending = false;
+  se_ed25519_stream.open = false;
+  return ret;
+}
+
 secbool se_get_session_seed_state(uint8_t *state) {
   uint16_t recv_len = 1;
 
@@ -1247,6 +1341,8 @@ secbool se_derive_tweak_private_keys(const uint8_t *root_hash) {
     data = (uint8_t *)root_hash;
     data_len = 32;
   }
+  // tweaks the key derived last
+  se_ed25519_stream_end(SE_INS_DERIVE, 0);
   if (!se_transmit_mac(SE_INS_SIGN, 0x00, 0x06, data, data_len, NULL, NULL)) {
     return secfalse;
   }
@@ -1602,6 +1698,7 @@ secbool se_u2f_register(const uint8_t app_id[32], const uint8_t challenge[32],
   memcpy(cmd + 5 + 32, challenge, 32);
 
   cmd[4] = 64;
+  se_ed25519_stream_end(SE_INS_FIDO, 0);
   if (!thd89_transmit(cmd, 5 + 64, (uint8_t *)recv, &recv_len)) {
     return secfalse;
   }
@@ -1641,6 +1738,7 @@ secbool se_u2f_authenticate(const uint8_t app_id[32],
   memcpy(cmd + 5 + 32 + 64, challenge, 32);
 
   cmd[4] = 128;
+  se_ed25519_stream_end(SE_INS_FIDO, 0);
   if (!thd89_transmit(cmd, 5 + 128, (uint8_t *)recv, &recv_len)) {
     return secfalse;
   }
@@ -1681,6 +1779,7 @@ secbool se_derive_fido_keys(HDNode *out, const char *curve,
 
   cmd[4] = len;
 
+  se_ed25519_stream_end(SE_INS_FIDO, 0);
   if (!thd89_transmit(cmd, 5 + len, (uint8_t *)resp, &resp_len)) {
     return secfalse;
   }
@@ -1700,6 +1799,7 @@ secbool se_fido_hdnode_sign_digest(const uint8_t *hash, uint8_t *sig) {
 
   memcpy(cmd + 5, hash, 32);
 
+  se_ed25519_stream_end(SE_INS_FIDO, 0);
   if (!thd89_transmit(cmd, 37, (uint8_t *)resp, &resp_len)) {
     return secfalse;
   }
@@ -1714,6 +1814,7 @@ secbool se_fido_att_sign_digest(const uint8_t *hash, uint8_t *sig) {
 
   memcpy(cmd + 5, hash, 32);
 
+  se_ed25519_stream_end(SE_INS_FIDO, 0);
   if (!thd89_transmit(cmd, 37, (uint8_t *)resp, &resp_len)) {
     return secfalse;
   }
@@ -1798,6 +1899,24 @@ int se_get_fido2_resident_credentials(uint32_t index, uint8_t *dest,
   return SE_FIDO2_SLOT_DATA_OK;
 }
 
+// Reads only the header and the rpIdHash of a slot, in one exchange.
+int se_get_fido2_resident_credential_rp_id_hash(uint32_t index,
+                                                uint8_t *rp_id_hash) {
+  if (index >= FIDO2_RESIDENT_CREDENTIALS_COUNT)
+    return SE_FIDO2_SLOT_DATA_INVALID;
+  uint8_t buffer[FIDO2_RESIDENT_CREDENTIALS_HEADER_LEN + RP_ID_HASH_LENGTH];
+  if (!se_get_fido2_data(index * FIDO2_RESIDENT_CREDENTIALS_SIZE, buffer,
+                         sizeof(buffer))) {
+    return SE_FIDO2_SLOT_DATA_INVALID;
+  }
+  if (memcmp(buffer, FIDO2_RESIDENT_CREDENTIALS_FLAGS, 4) != 0) {
+    return SE_FIDO2_SLOT_DATA_NULL;
+  }
+  memcpy(rp_id_hash, buffer + FIDO2_RESIDENT_CREDENTIALS_HEADER_LEN,
+         RP_ID_HASH_LENGTH);
+  return SE_FIDO2_SLOT_DATA_OK;
+}
+
 secbool se_set_fido2_resident_credentials(uint32_t index, const uint8_t *src,
                                           uint16_t len) {
   if (index >= FIDO2_RESIDENT_CREDENTIALS_COUNT) return secfalse;
@@ -107,6 +107,14 @@ int se_nist256p1_sign_digest(const uint8_t *digest, uint8_t *sig, uint8_t *pby);
 int se_ed25519_sign(const uint8_t *msg, uint16_t msg_len, uint8_t *sig);
 int se_ed25519_sign_ext(const uint8_t *msg, uint16_t msg_len, uint8_t *sig);
 int se_ed25519_sign_keccak(const uint8_t *msg, uint16_t msg_len, uint8_t *sig);
+// Ed25519 over a message that is sent twice, hram false for the nonce pass
+// and true for the challenge pass. first and last mark the ends of a pass.
+// begin checks the key derived last is the one of public_key, deriving or
+// signing anything else before the signature ends the stream.
+int se_ed25519_stream_begin(const uint8_t *public_key);
+int se_ed25519_stream_update(bool hram, const uint8_t *msg, uint16_t msg_len,
+                             bool first, bool last);
+int se_ed25519_stream_sign(uint8_t *sig);
 
 int se_get_shared_key(const char *curve, const uint8_t *peer_public_key,
                       uint8_t *session_key);
@@ -160,6 +168,8 @@ secbool se_fido_hdnode_sign_digest(const uint8_t *hash, uint8_t *sig);
 secbool se_fido_att_sign_digest(const uint8_t *hash, uint8_t *sig);
 int se_get_fido2_resident_credentials(uint32_t index, uint8_t *dest,
                                       uint16_t *dst_len);
+int se_get_fido2_resident_credential_rp_id_hash(uint32_t index,
+                                                uint8_t *rp_id_hash);
 int se_check_fido2_resident_credential_simple(uint32_t index);
 secbool se_set_fido2_resident_credentials(uint32_t index, const uint8_t *src,
                                           uint16_t len);
@@ -20,9 +20,11 @@
 #include <stdio.h>
 #include "buttons.h"
 #include "config.h"
+#include "ed25519_replay.h"
 #include "fsm.h"
 #include "gettext.h"
 #include "layout2.h"
+#include "memzero.h"
 #include "messages.h"
 #include "messages.pb.h"
 #include "protect.h"
@@ -51,6 +53,111 @@ void solana_get_address_from_public_key(const uint8_t *public_key,
   encode_base58(public_key, SIZE_PUBKEY, address, BASE58_PUBKEY_LENGTH);
 }
 
+// Shows the "Unrecognized format" summary, hash covers the message body
+// after the account keys and recent blockhash.
+static bool solana_set_blind_summary(const Hash *message_hash) {
+  if (!config_getCoinSwitch(COIN_SWITCH_SOLANA)) {
+    fsm_sendFailure(FailureType_Failure_DataError,
+                    "Please confirm the BlindSign enabled");
+    return false;
+  }
+  SummaryItem *item = transaction_summary_primary_item();
+  summary_item_set_string(item, "Unrecognized", "format");
+  item = transaction_summary_general_item();
+  summary_item_set_hash(item, "Message Hash", message_hash);
+  return true;
+}
+
+static void solana_body_hash(const uint8_t *body, size_t len, Hash *hash) {
+  struct SHA3_CTX ctx = {0};
+  sha3_256_Init(&ctx);
+  sha3_Update(&ctx, body, len);
+  keccak_Final(&ctx, (uint8_t *)hash);
+}
+
+// Walks the user through the transaction summary, false if it was rejected
+// (the failure has been sent).
+static bool solana_confirm_summary(void) {
+  enum SummaryItemKind summary_step_kinds[MAX_TRANSACTION_SUMMARY_ITEMS];
+  size_t num_summary_steps = 0;
+  size_t steps = 0;
+  uint8_t steps_list[MAX_TRANSACTION_SUMMARY_ITEMS];
+  char title_str[65] = {0};
+  snprintf(title_str, 65, "%s", _(T__STR_CHAIN_TRANSACTION));
+  bracket_replace(title_str, "Solana");
+  if (transaction_summary_finalize(summary_step_kinds, &num_summary_steps) !=
+      0) {
+    fsm_sendFailure(FailureType_Failure_DataError, "Parse error");
+    return false;
+  }
+  for (size_t i = 0; i < num_summary_steps; i++) {
+    if (transaction_summary_display_item(i, DisplayFlagAll)) {
+      fsm_sendFailure(FailureType_Failure_DataError, "Parse error");
+      layoutHome();
+      return false;
+    } else {
+      char *title = G_transaction_summary_title;
+      char *text = G_transaction_summary_text;
+
+      if (strcmp(title, "Create token acct") == 0) {
+        continue;
+      } else if (strcmp(title, "From mint") == 0) {
+        continue;
+      } else if (strcmp(title, "From") == 0) {
+        continue;
+      } else if (strcmp(title, "To") == 0) {
+        continue;
+      } else if (strcmp(title, "Funded by") == 0) {
+        continue;
+      } else if (strcmp(title, "Owner") == 0) {
+        title = "From";
+      } else if (strcmp(title, "Owned by") == 0) {
+        title = "To";
+      } else if (strcmp(title, "Transfer tokens") == 0 ||
+                 strcmp(title, "Transfer") == 0) {
+        title = "Amount";
+      }
+
+      char desc[64];
+      memset(desc, 0, sizeof(desc));
+      strcat(desc, title);
+      strcat(desc, ":");
+
+      steps_list[steps++] = i;
+
+      layoutDialogAdapterEx(
+          title_str, &bmp_bottom_left_close, NULL,
+          i < num_summary_steps - 1 ? &bmp_bottom_right_arrow
+                                    : &bmp_bottom_right_confirm,
+          NULL, NULL, gettext_from_en(desc), text, NULL, NULL);
+
+      uint8_t key;
+    button_scan:
+      key = protectWaitKeyValue(ButtonRequestType_ButtonRequest_ProtectCall,
+                                true, 0, 0);
+      if (key == KEY_CANCEL) {
+        fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
+        return false;
+      } else if (key == KEY_UP) {
+        if (steps == 1) {
+          goto button_scan;
+        } else {
+          i = steps_list[steps - 2] - 1;
+          steps -= 2;
+        }
+      } else if (key == KEY_DOWN) {
+        if (i == num_summary_steps - 1) {
+          goto button_scan;
+        }
+      } else if (key == KEY_NULL) {
+        fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
 void solana_sign_tx(const SolanaSignTx *msg, const HDNode *node,
                     SolanaSignedTx *resp) {
   Parser parser = {msg->raw_tx.bytes, msg->raw_tx.size};
@@ -81,20 +188,10 @@ void solana_sign_tx(const SolanaSignTx *msg, const HDNode *node,
                               .signer_pubkey = &header.pubkeys[0]};
   if (process_message_body(parser.buffer, parser.buffer_length,
                            &print_config)) {
-    if (config_getCoinSwitch(COIN_SWITCH_SOLANA)) {
-      SummaryItem *item = transaction_summary_primary_item();
-      summary_item_set_string(item, "Unrecognized", "format");
-      struct SHA3_CTX ctx = {0};
-      sha3_256_Init(&ctx);
-      sha3_Update(&ctx, parser.buffer, parser.buffer_length);
-      Hash UnrecognizedMessageHash;
-      keccak_Final(&ctx, (uint8_t *)&UnrecognizedMessageHash);
-
-      item = transaction_summary_general_item();
-      summary_item_set_hash(item, "Message Hash", &UnrecognizedMessageHash);
-    } else {
-      fsm_sendFailure(FailureType_Failure_DataError,
-                      "Please confirm the BlindSign enabled");
+    Hash UnrecognizedMessageHash;
+    solana_body_hash(parser.buffer, parser.buffer_length,
+                     &UnrecognizedMessageHash);
+    if (!solana_set_blind_summary(&UnrecognizedMessageHash)) {
       return;
     }
   }
@@ -102,94 +199,542 @@ void solana_sign_tx(const SolanaSignTx *msg, const HDNode *node,
   // the transaction printer
   transaction_summary_set_fee_payer_pubkey(&header.pubkeys[0]);
 
-  enum SummaryItemKind summary_step_kinds[MAX_TRANSACTION_SUMMARY_ITEMS];
-  size_t num_summary_steps = 0;
-  size_t steps = 0;
-  uint8_t steps_list[MAX_TRANSACTION_SUMMARY_ITEMS];
-  char title_str[65] = {0};
-  snprintf(title_str, 65, "%s", _(T__STR_CHAIN_TRANSACTION));
-  bracket_replace(title_str, "Solana");
-  if (transaction_summary_finalize(summary_step_kinds, &num_summary_steps) ==
-      0) {
-    for (size_t i = 0; i < num_summary_steps; i++) {
-      if (transaction_summary_display_item(i, DisplayFlagAll)) {
-        fsm_sendFailure(FailureType_Failure_DataError, "Parse error");
-        layoutHome();
-        return;
-      } else {
-        char *title = G_transaction_summary_title;
-        char *text = G_transaction_summary_text;
-
-        if (strcmp(title, "Create token acct") == 0) {
-          continue;
-        } else if (strcmp(title, "From mint") == 0) {
-          continue;
-        } else if (strcmp(title, "From") == 0) {
-          continue;
-        } else if (strcmp(title, "To") == 0) {
-          continue;
-        } else if (strcmp(title, "Funded by") == 0) {
+  if (!solana_confirm_summary()) {
+    return;
+  }
+#if EMULATOR
+  ed25519_sign(msg->raw_tx.bytes, msg->raw_tx.size, node->private_key,
+               resp->signature.bytes);
+#else
+  hdnode_sign(node, msg->raw_tx.bytes, msg->raw_tx.size, 0,
+              resp->signature.bytes, NULL, NULL);
+#endif
+  resp->signature.size = 64;
+  msg_write(MessageType_MessageType_SolanaSignedTx, resp);
+}
+
+//=====================Chunked Transaction Signing=====================
+/*
+ * A message too big for SolanaSignTx.raw_tx is streamed in chunks. It is
+ * never held in memory: each chunk goes through a structural decoder that
+ * records what the summary needs in tx_index, and straight into the Ed25519
+ * replay signer. Once the user has confirmed, the device asks for the
+ * message again from offset 0 for the second signing pass.
+ *
+ * Messages up to _MAX_MESSAGE_LENGTH_WITH_PREAMBLE are also copied aside so
+ * libsol can print the instructions, larger ones are blind signed.
+ */
+#define SOLANA_CHUNK_SIZE 1024
+#define SOLANA_MAX_MESSAGE_LENGTH UINT16_MAX
+#define SOLANA_MAX_ACCOUNTS 256
+#define SOLANA_MAX_LOOKUP_TABLES 64
+
+typedef enum {
+  DECODE_PREFIX,
+  DECODE_HEADER,
+  DECODE_NUM_KEYS,
+  DECODE_KEY,
+  DECODE_BLOCKHASH,
+  DECODE_NUM_INSTRUCTIONS,
+  DECODE_PROGRAM_ID,
+  DECODE_NUM_ACCOUNTS,
+  DECODE_ACCOUNT,
+  DECODE_DATA_LENGTH,
+  DECODE_DATA,
+  DECODE_NUM_LOOKUPS,
+  DECODE_LOOKUP_KEY,
+  DECODE_NUM_WRITABLE,
+  DECODE_WRITABLE,
+  DECODE_NUM_READONLY,
+  DECODE_READONLY,
+  DECODE_DONE,
+} SolanaDecodeStep;
+
+typedef struct {
+  uint32_t key_offset;  // offset of the table address in the message
+  uint8_t num_writable;
+  uint8_t num_readonly;
+} SolanaLookupTable;
+
+// Everything the device learns about the message while it streams by.
+typedef struct {
+  bool versioned;
+  uint8_t num_required_signatures;
+  uint8_t num_readonly_signed;
+  uint8_t num_readonly_unsigned;
+  uint16_t num_keys;
+  uint32_t keys_offset;  // static account keys, 32 bytes each
+  uint32_t body_offset;  // instruction list, start of the blind sign hash
+  Pubkey fee_payer;
+  bool signer_found;
+  uint16_t num_instructions;
+  uint16_t max_account_index;
+  uint16_t num_lookup_tables;
+  uint16_t num_loaded_writable;
+  uint16_t num_loaded_readonly;
+  SolanaLookupTable lookup_tables[SOLANA_MAX_LOOKUP_TABLES];
+} SolanaMessageIndex;
+
+static struct {
+  SolanaDecodeStep step;
+  uint32_t pos;    // bytes consumed
+  uint32_t value;  // compact-u16 being read
+  uint8_t shift;
+  uint8_t header_pos;
+  uint16_t item;   // element of the current list
+  uint16_t items;  // length of the current list
+  uint16_t sub_item;
+  uint16_t sub_items;
+  uint32_t left;  // bytes left in the current fixed or data field
+  bool key_mismatch;
+} decoder;
+
+static bool solana_signing = false;
+static uint32_t data_total, data_left;
+static SolanaMessageIndex tx_index;
+static uint8_t signer_pubkey[SIZE_PUBKEY];
+static uint8_t message_copy[_MAX_MESSAGE_LENGTH_WITH_PREAMBLE];
+static struct SHA3_CTX body_hash_ctx;
+static SolanaTxRequest msg_tx_request;
+
+// Reads one byte of a compact-u16, rejects overlong and non-minimal forms.
+static bool decode_compact_u16(uint8_t byte, bool *complete) {
+  if (decoder.shift == 14 && byte > 0x03) return false;
+  if (decoder.shift > 0 && byte == 0) return false;
+  decoder.value |= (uint32_t)(byte & 0x7f) << decoder.shift;
+  *complete = (byte & 0x80) == 0;
+  decoder.shift = *complete ? 0 : decoder.shift + 7;
+  return true;
+}
+
+static uint16_t decode_take_value(void) {
+  uint16_t value = decoder.value;
+  decoder.value = 0;
+  return value;
+}
+
+static void decode_next_instruction(void) {
+  if (decoder.item < tx_index.num_instructions) {
+    decoder.step = DECODE_PROGRAM_ID;
+  } else if (tx_index.versioned) {
+    decoder.step = DECODE_NUM_LOOKUPS;
+  } else {
+    decoder.step = DECODE_DONE;
+  }
+}
+
+static void decode_next_lookup(void) {
+  if (decoder.item < tx_index.num_lookup_tables) {
+    decoder.step = DECODE_LOOKUP_KEY;
+    decoder.left = SIZE_PUBKEY;
+  } else {
+    decoder.step = DECODE_DONE;
+  }
+}
+
+// Ends the account index list of a lookup table.
+static void decode_end_lookup_list(void) {
+  if (decoder.step == DECODE_NUM_WRITABLE || decoder.step == DECODE_WRITABLE) {
+    decoder.step = DECODE_NUM_READONLY;
+  } else {
+    decoder.item++;
+    decode_next_lookup();
+  }
+}
+
+// Feeds the next bytes of the message to the decoder. Fixed size fields
+// are skipped in bulk, everything else is read a byte at a time.
+static bool solana_decode(const uint8_t *buf, size_t len) {
+  size_t i = 0;
+  bool complete = false;
+  while (i < len) {
+    uint8_t byte = buf[i];
+    switch (decoder.step) {
+      case DECODE_PREFIX:
+        decoder.step = DECODE_HEADER;
+        if ((byte & 0x80) == 0) {
+          // legacy message, this is already the header
           continue;
-        } else if (strcmp(title, "Owner") == 0) {
-          title = "From";
-        } else if (strcmp(title, "Owned by") == 0) {
-          title = "To";
-        } else if (strcmp(title, "Transfer tokens") == 0 ||
-                   strcmp(title, "Transfer") == 0) {
-          title = "Amount";
         }
-
-        char desc[64];
-        memset(desc, 0, sizeof(desc));
-        strcat(desc, title);
-        strcat(desc, ":");
-
-        steps_list[steps++] = i;
-
-        layoutDialogAdapterEx(
-            title_str, &bmp_bottom_left_close, NULL,
-            i < num_summary_steps - 1 ? &bmp_bottom_right_arrow
-                                      : &bmp_bottom_right_confirm,
-            NULL, NULL, gettext_from_en(desc), text, NULL, NULL);
-
-        uint8_t key;
-      button_scan:
-        key = protectWaitKeyValue(ButtonRequestType_ButtonRequest_ProtectCall,
-                                  true, 0, 0);
-        if (key == KEY_CANCEL) {
-          fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
-          return;
-        } else if (key == KEY_UP) {
-          if (steps == 1) {
-            goto button_scan;
-          } else {
-            i = steps_list[steps - 2] - 1;
-            steps -= 2;
-          }
-        } else if (key == KEY_DOWN) {
-          if (i == num_summary_steps - 1) {
-            goto button_scan;
+        // only version 0 is defined
+        if ((byte & 0x7f) != 0) return false;
+        tx_index.versioned = true;
+        break;
+      case DECODE_HEADER:
+        if (decoder.item == 0) {
+          tx_index.num_required_signatures = byte;
+        } else if (decoder.item == 1) {
+          tx_index.num_readonly_signed = byte;
+        } else {
+          tx_index.num_readonly_unsigned = byte;
+          if (tx_index.num_required_signatures == 0 ||
+              tx_index.num_readonly_signed >=
+                  tx_index.num_required_signatures) {
+            return false;
           }
-        } else if (key == KEY_NULL) {
-          fsm_sendFailure(FailureType_Failure_ActionCancelled, NULL);
-          return;
+          decoder.step = DECODE_NUM_KEYS;
+        }
+        decoder.item++;
+        break;
+      case DECODE_NUM_KEYS:
+        if (!decode_compact_u16(byte, &complete)) return false;
+        if (!complete) break;
+        tx_index.num_keys = decode_take_value();
+        if (tx_index.num_keys < tx_index.num_required_signatures ||
+            tx_index.num_keys > SOLANA_MAX_ACCOUNTS ||
+            tx_index.num_readonly_unsigned >
+                tx_index.num_keys - tx_index.num_required_signatures) {
+          return false;
+        }
+        tx_index.keys_offset = decoder.pos + 1;
+        decoder.item = 0;
+        decoder.key_mismatch = false;
+        decoder.step = DECODE_KEY;
+        decoder.left = SIZE_PUBKEY;
+        break;
+      case DECODE_KEY: {
+        size_t n = MIN(decoder.left, len - i);
+        size_t at = SIZE_PUBKEY - decoder.left;
+        if (decoder.item == 0) {
+          memcpy((uint8_t *)&tx_index.fee_payer + at, buf + i, n);
+        }
+        if (memcmp(signer_pubkey + at, buf + i, n) != 0) {
+          decoder.key_mismatch = true;
+        }
+        decoder.left -= n;
+        decoder.pos += n;
+        i += n;
+        if (decoder.left > 0) continue;
+        if (!decoder.key_mismatch &&
+            decoder.item < tx_index.num_required_signatures) {
+          tx_index.signer_found = true;
         }
+        decoder.key_mismatch = false;
+        decoder.left = SIZE_PUBKEY;
+        if (++decoder.item == tx_index.num_keys) {
+          decoder.step = DECODE_BLOCKHASH;
+        }
+        continue;
       }
+      case DECODE_BLOCKHASH:
+      case DECODE_DATA:
+      case DECODE_LOOKUP_KEY: {
+        if (decoder.step == DECODE_LOOKUP_KEY && decoder.left == SIZE_PUBKEY) {
+          tx_index.lookup_tables[decoder.item].key_offset = decoder.pos;
+        }
+        size_t n = MIN(decoder.left, len - i);
+        decoder.left -= n;
+        decoder.pos += n;
+        i += n;
+        if (decoder.left > 0) continue;
+        if (decoder.step == DECODE_BLOCKHASH) {
+          tx_index.body_offset = decoder.pos;
+          decoder.step = DECODE_NUM_INSTRUCTIONS;
+        } else if (decoder.step == DECODE_DATA) {
+          decoder.item++;
+          decode_next_instruction();
+        } else {
+          decoder.step = DECODE_NUM_WRITABLE;
+        }
+        continue;
+      }
+      case DECODE_NUM_INSTRUCTIONS:
+        if (!decode_compact_u16(byte, &complete)) return false;
+        if (!complete) break;
+        tx_index.num_instructions = decode_take_value();
+        decoder.item = 0;
+        decode_next_instruction();
+        break;
+      case DECODE_PROGRAM_ID:
+        // programs can not be loaded from lookup tables
+        if (byte >= tx_index.num_keys) return false;
+        decoder.step = DECODE_NUM_ACCOUNTS;
+        break;
+      case DECODE_NUM_ACCOUNTS:
+        if (!decode_compact_u16(byte, &complete)) return false;
+        if (!complete) break;
+        decoder.sub_items = decode_take_value();
+        decoder.sub_item = 0;
+        decoder.step = decoder.sub_items ? DECODE_ACCOUNT : DECODE_DATA_LENGTH;
+        break;
+      case DECODE_ACCOUNT:
+        if (byte > tx_index.max_account_index) {
+          tx_index.max_account_index = byte;
+        }
+        if (++decoder.sub_item == decoder.sub_items) {
+          decoder.step = DECODE_DATA_LENGTH;
+        }
+        break;
+      case DECODE_DATA_LENGTH:
+        if (!decode_compact_u16(byte, &complete)) return false;
+        if (!complete) break;
+        decoder.left = decode_take_value();
+        decoder.step = DECODE_DATA;
+        if (decoder.left == 0) {
+          decoder.item++;
+          decode_next_instruction();
+        }
+        break;
+      case DECODE_NUM_LOOKUPS:
+        if (!decode_compact_u16(byte, &complete)) return false;
+        if (!complete) break;
+        tx_index.num_lookup_tables = decode_take_value();
+        if (tx_index.num_lookup_tables > SOLANA_MAX_LOOKUP_TABLES) {
+          return false;
+        }
+        decoder.item = 0;
+        decode_next_lookup();
+        break;
+      case DECODE_NUM_WRITABLE:
+      case DECODE_NUM_READONLY: {
+        if (!decode_compact_u16(byte, &complete)) return false;
+        if (!complete) break;
+        SolanaLookupTable *table = &tx_index.lookup_tables[decoder.item];
+        decoder.sub_items = decode_take_value();
+        decoder.sub_item = 0;
+        if (decoder.step == DECODE_NUM_WRITABLE) {
+          tx_index.num_loaded_writable += decoder.sub_items;
+        } else {
+          tx_index.num_loaded_readonly += decoder.sub_items;
+        }
+        if (tx_index.num_keys + tx_index.num_loaded_writable +
+                tx_index.num_loaded_readonly >
+            SOLANA_MAX_ACCOUNTS) {
+          return false;
+        }
+        if (decoder.step == DECODE_NUM_WRITABLE) {
+          table->num_writable = decoder.sub_items;
+        } else {
+          table->num_readonly = decoder.sub_items;
+          // a table has to load something
+          if (table->num_writable + table->num_readonly == 0) return false;
+        }
+        if (decoder.sub_items == 0) {
+          decode_end_lookup_list();
+        } else {
+          decoder.step = decoder.step == DECODE_NUM_WRITABLE ? DECODE_WRITABLE
+                                                             : DECODE_READONLY;
+        }
+        break;
+      }
+      case DECODE_WRITABLE:
+      case DECODE_READONLY:
+        if (++decoder.sub_item == decoder.sub_items) {
+          decode_end_lookup_list();
+        }
+        break;
+      case DECODE_DONE:
+      default:
+        // trailing bytes
+        return false;
     }
-#if EMULATOR
-    ed25519_sign(msg->raw_tx.bytes, msg->raw_tx.size, node->private_key,
-                 resp->signature.bytes);
-#else
-    hdnode_sign(node, msg->raw_tx.bytes, msg->raw_tx.size, 0,
-                resp->signature.bytes, NULL, NULL);
-#endif
-    resp->signature.size = 64;
+    decoder.pos++;
+    i++;
+  }
+  return true;
+}
+
+// The decoder has seen a complete message: every account an instruction
+// refers to exists and the key we sign with is one of the signers.
+static bool solana_decode_finish(void) {
+  if (decoder.step != DECODE_DONE) return false;
+  uint16_t num_accounts = tx_index.num_keys + tx_index.num_loaded_writable +
+                          tx_index.num_loaded_readonly;
+  return tx_index.max_account_index < num_accounts;
+}
+
+void solana_signing_abort(void) {
+  if (solana_signing) {
+    ed25519_replay_clear(ED25519_REPLAY_SOLANA);
+    layoutHome();
+    solana_signing = false;
+  }
+}
+
+static void send_request_chunk(void) {
+  msg_tx_request.has_data_length = true;
+  msg_tx_request.data_length =
+      data_left <= SOLANA_CHUNK_SIZE ? data_left : SOLANA_CHUNK_SIZE;
+  msg_tx_request.has_data_offset = true;
+  msg_tx_request.data_offset = data_total - data_left;
+  msg_write(MessageType_MessageType_SolanaTxRequest, &msg_tx_request);
+}
+
+static bool hash_data(const uint8_t *buf, size_t size) {
+  uint32_t offset = data_total - data_left;
+
+  if (ed25519_replay_pass(ED25519_REPLAY_SOLANA) == 1) {
+    if (!solana_decode(buf, size)) {
+      fsm_sendFailure(FailureType_Failure_DataError, "Invalid message");
+      return false;
+    }
+    if (data_total <= sizeof(message_copy)) {
+      memcpy(message_copy + offset, buf, size);
+    }
+    // the decoder has already seen this chunk, so body_offset is known if
+    // the message body starts in it
+    if (decoder.step >= DECODE_NUM_INSTRUCTIONS &&
+        offset + size > tx_index.body_offset) {
+      uint32_t skip =
+          offset < tx_index.body_offset ? tx_index.body_offset - offset : 0;
+      sha3_Update(&body_hash_ctx, buf + skip, size - skip);
+    }
+  }
+  if (!ed25519_replay_update(ED25519_REPLAY_SOLANA, buf, size)) {
+    fsm_sendFailure(FailureType_Failure_ProcessError, "Signing failed");
+    return false;
+  }
+  data_left -= size;
+  return true;
+}
+
+// Summary of a message that was too large to keep a copy of.
+static bool solana_set_index_summary(void) {
+  Hash message_hash;
+  keccak_Final(&body_hash_ctx, (uint8_t *)&message_hash);
+  if (!solana_set_blind_summary(&message_hash)) {
+    return false;
+  }
+  SummaryItem *item = transaction_summary_general_item();
+  summary_item_set_u64(item, "Instructions", tx_index.num_instructions);
+  if (tx_index.num_lookup_tables > 0) {
+    item = transaction_summary_general_item();
+    summary_item_set_u64(item, "Lookup tables", tx_index.num_lookup_tables);
+  }
+  return true;
+}
+
+static bool solana_show_message(void) {
+  transaction_summary_reset();
+  if (data_total <= sizeof(message_copy)) {
+    Parser parser = {message_copy, data_total};
+    MessageHeader header;
+    if (parse_message_header(&parser, &header) == 0) {
+      PrintConfig print_config = {.header = header,
+                                  .expert_mode = true,
+                                  .signer_pubkey = &header.pubkeys[0]};
+      if (process_message_body(parser.buffer, parser.buffer_length,
+                               &print_config)) {
+        Hash UnrecognizedMessageHash;
+        solana_body_hash(parser.buffer, parser.buffer_length,
+                         &UnrecognizedMessageHash);
+        if (!solana_set_blind_summary(&UnrecognizedMessageHash)) {
+          return false;
+        }
+      }
+    } else if (!solana_set_index_summary()) {
+      return false;
+    }
+  } else if (!solana_set_index_summary()) {
+    return false;
+  }
+  transaction_summary_set_fee_payer_pubkey(&tx_index.fee_payer);
+  return solana_confirm_summary();
+}
+
+// End of the first pass: check and show the message, then ask for it again.
+static void finish_first_pass(void) {
+  if (!solana_decode_finish()) {
+    fsm_sendFailure(FailureType_Failure_DataError, "Invalid message");
+    solana_signing_abort();
+    return;
+  }
+  if (!tx_index.signer_found) {
+    fsm_sendFailure(FailureType_Failure_DataError, "Invalid params");
+    solana_signing_abort();
+    return;
+  }
+  if (!solana_show_message()) {
+    solana_signing_abort();
+    return;
+  }
+  if (!ed25519_replay_rewind(ED25519_REPLAY_SOLANA)) {
+    fsm_sendFailure(FailureType_Failure_ProcessError, "Signing failed");
+    solana_signing_abort();
+    return;
+  }
+  data_left = data_total;
+  send_request_chunk();
+}
+
+static void send_signature(void) {
+  SolanaSignedTx tx = {0};
+
+  if (!ed25519_replay_final(ED25519_REPLAY_SOLANA, tx.signature.bytes)) {
+    fsm_sendFailure(FailureType_Failure_DataError, "Transaction data changed");
+    solana_signing_abort();
+    return;
+  }
+  tx.signature.size = 64;
+  msg_write(MessageType_MessageType_SolanaSignedTx, &tx);
+  solana_signing_abort();
+}
+
+static void process_chunk_end(void) {
+  if (data_left > 0) {
+    send_request_chunk();
+  } else if (ed25519_replay_pass(ED25519_REPLAY_SOLANA) == 1) {
+    finish_first_pass();
   } else {
-    fsm_sendFailure(FailureType_Failure_DataError, "Parse error");
+    send_signature();
+  }
+}
+
+void solana_signing_init(const SolanaSignTx *msg, const HDNode *node) {
+  solana_signing = true;
+  memzero(&decoder, sizeof(decoder));
+  memzero(&tx_index, sizeof(tx_index));
+  memcpy(signer_pubkey, node->public_key + 1, SIZE_PUBKEY);
+
+  if (msg->data_length > SOLANA_MAX_MESSAGE_LENGTH ||
+      msg->data_initial_chunk.size > msg->data_length) {
+    fsm_sendFailure(FailureType_Failure_DataError, "Invalid data length");
+    solana_signing_abort();
     return;
   }
-  msg_write(MessageType_MessageType_SolanaSignedTx, resp);
+
+  sha3_256_Init(&body_hash_ctx);
+  if (!ed25519_replay_init(ED25519_REPLAY_SOLANA, node, msg->data_length)) {
+    fsm_sendFailure(FailureType_Failure_ProcessError, "Signing failed");
+    solana_signing_abort();
+    return;
+  }
+
+  data_total = msg->data_length;
+  data_left = data_total;
+  if (msg->data_initial_chunk.size > 0 &&
+      !hash_data(msg->data_initial_chunk.bytes,
+                 msg->data_initial_chunk.size)) {
+    solana_signing_abort();
+    return;
+  }
+  process_chunk_end();
+}
+
+void solana_signing_txack(const SolanaTxAck *tx) {
+  if (!solana_signing) {
+    fsm_sendFailure(FailureType_Failure_UnexpectedMessage,
+                    "Not in solana signing mode");
+    layoutHome();
+    return;
+  }
+  if (tx->data_chunk.size > data_left) {
+    fsm_sendFailure(FailureType_Failure_DataError, "Too much data");
+    solana_signing_abort();
+    return;
+  }
+  if (tx->data_chunk.size == 0) {
+    fsm_sendFailure(FailureType_Failure_DataError, "Empty data chunk received");
+    solana_signing_abort();
+    return;
+  }
+  if (!hash_data(tx->data_chunk.bytes, tx->data_chunk.size)) {
+    solana_signing_abort();
+    return;
+  }
+  process_chunk_end();
 }
+//=====================Chunked Transaction Signing=====================
 
 //=====================Offchain Message Signing=====================
 /**
@@ -33,6 +33,9 @@ void solana_get_address_from_public_key(const uint8_t *public_key,
                                         char *address);
 void solana_sign_tx(const SolanaSignTx *msg, const HDNode *node,
                     SolanaSignedTx *resp);
+void solana_signing_init(const SolanaSignTx *msg, const HDNode *node);
+void solana_signing_txack(const SolanaTxAck *tx);
+void solana_signing_abort(void);
 bool solana_sanitize_offchain_message(const SolanaSignOffChainMessage *msg);
 bool solana_sign_offchain_message(const SolanaSignOffChainMessage *msg,
                                   const HDNode *node,
@@ -1,4 +1,5 @@
 #include "sui.h"
+#include "chunk_signer.h"
 #include "fsm.h"
 #include "gettext.h"
 #include "layout2.h"
@@ -9,12 +10,11 @@
 #include "stdint.h"
 #include "util.h"
 
-static bool sui_signing = false;
-static uint32_t data_total, data_left;
 static uint8_t pubkey[32];
 static BLAKE2B_CTX hash_ctx = {0};
 static SuiTxRequest msg_tx_request;
 static CONFIDENTIAL HDNode node_cache;
+static ChunkSigner sui_signer = {.name = "sui"};
 
 void sui_get_address_from_public_key(const uint8_t *public_key, char *address) {
   uint8_t buf[32] = {0};
@@ -98,16 +98,14 @@ void sui_message_sign(const SuiSignMessage *msg, const HDNode *node,
   msg_write(MessageType_MessageType_SuiMessageSignature, resp);
 }
 
-void sui_signing_abort(void) {
-  if (sui_signing) {
-    memzero(&node_cache, sizeof(node_cache));
-    layoutHome();
-    sui_signing = false;
-  }
+static void hash_data(const uint8_t *buf, size_t size) {
+  blake2b_Update(&hash_ctx, buf, size);
 }
 
-static inline void hash_data(const uint8_t *buf, size_t size) {
-  blake2b_Update(&hash_ctx, buf, size);
+static void send_request_chunk(uint32_t size) {
+  msg_tx_request.has_data_length = true;
+  msg_tx_request.data_length = size;
+  msg_write(MessageType_MessageType_SuiTxRequest, &msg_tx_request);
 }
 
 static void send_signature(void) {
@@ -126,30 +124,27 @@ static void send_signature(void) {
   tx.signature.size = 64;
   tx.public_key.size = 32;
   msg_write(MessageType_MessageType_SuiSignedTx, &tx);
-
-  memzero(&node_cache, sizeof(node_cache));
-  sui_signing_abort();
 }
 
-static void send_request_chunk(void) {
-  msg_tx_request.has_data_length = true;
-  msg_tx_request.data_length = data_left <= 1024 ? data_left : 1024;
-  msg_write(MessageType_MessageType_SuiTxRequest, &msg_tx_request);
-}
+static void clear_node(void) { memzero(&node_cache, sizeof(node_cache)); }
+
+static const ChunkSignerOps sui_signer_ops = {
+    .update = hash_data,
+    .request = send_request_chunk,
+    .finish = send_signature,
+    .reset = clear_node,
+};
 
 void sui_signing_init(const SuiSignTx *msg, const HDNode *node) {
   char address[67] = {0};
 
-  sui_signing = true;
-  blake2b_Init(&hash_ctx, 32);
-
   sui_get_address_from_public_key(node->public_key + 1, address);
   // INTENT_BYTES = b'\x00\x00\x00'
   if ((msg->data_initial_chunk.bytes[0] != 0x00) &&
       ((msg->data_initial_chunk.bytes[1] != 0x00)) &&
       ((msg->data_initial_chunk.bytes[2] != 0x00))) {
     fsm_sendFailure(FailureType_Failure_DataError, "Invalid raw tx");
-    sui_signing_abort();
+    layoutHome();
     return;
   }
   if (!layoutBlindSign(
@@ -161,44 +156,19 @@ void sui_signing_init(const SuiSignTx *msg, const HDNode *node) {
     return;
   }
 
+  chunk_signer_init(&sui_signer, &sui_signer_ops);
+  if (!chunk_signer_set_length(&sui_signer, msg->data_length,
+                               msg->data_initial_chunk.size)) {
+    return;
+  }
+  blake2b_Init(&hash_ctx, 32);
   memcpy(&node_cache, node, sizeof(HDNode));
   memcpy(pubkey, node->public_key + 1, 32);
 
-  hash_data(msg->data_initial_chunk.bytes, msg->data_initial_chunk.size);
-
-  data_total = msg->data_length;
-  data_left = data_total - msg->data_initial_chunk.size;
-  if (data_left > 0) {
-    send_request_chunk();
-  } else {
-    send_signature();
-  }
+  chunk_signer_start(&sui_signer, msg->data_initial_chunk.bytes,
+                     msg->data_initial_chunk.size);
 }
 
 void sui_signing_txack(SuiTxAck *tx) {
-  if (!sui_signing) {
-    fsm_sendFailure(FailureType_Failure_UnexpectedMessage,
-                    "Not in sui signing mode");
-    layoutHome();
-    return;
-  }
-  if (tx->data_chunk.size > data_left) {
-    fsm_sendFailure(FailureType_Failure_DataError, "Too much data");
-    sui_signing_abort();
-    return;
-  }
-  if (data_left > 0 && tx->data_chunk.size == 0) {
-    fsm_sendFailure(FailureType_Failure_DataError, "Empty data chunk received");
-    sui_signing_abort();
-    return;
-  }
-  hash_data(tx->data_chunk.bytes, tx->data_chunk.size);
-
-  data_left -= tx->data_chunk.size;
-
-  if (data_left > 0) {
-    send_request_chunk();
-  } else {
-    send_signature();
-  }
-}
\ No newline at end of file
+  chunk_signer_txack(&sui_signer, tx->data_chunk.bytes, tx->data_chunk.size);
+}
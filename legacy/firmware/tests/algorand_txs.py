@@ -0,0 +1,212 @@
+#!/usr/bin/env python3
+"""
+Generates msgpack encoded Algorand transactions for bench_algorand, one hex
+encoded transaction per line.
+
+Every transaction type is covered with random optional fields. --big adds
+long notes, programs, app args and box references, --truncate and --trailing
+produce inputs that the parser has to reject.
+"""
+
+import argparse
+import random
+import struct
+
+
+def encode(value):
+    if isinstance(value, bool):
+        return b"\xc3" if value else b"\xc2"
+    if isinstance(value, int):
+        if value < 0x80:
+            return bytes([value])
+        if value < 0x100:
+            return b"\xcc" + bytes([value])
+        if value < 0x10000:
+            return b"\xcd" + struct.pack(">H", value)
+        if value < 0x100000000:
+            return b"\xce" + struct.pack(">I", value)
+        return b"\xcf" + struct.pack(">Q", value)
+    if isinstance(value, str):
+        data = value.encode()
+        if len(data) < 32:
+            return bytes([0xA0 + len(data)]) + data
+        return b"\xd9" + bytes([len(data)]) + data
+    if isinstance(value, bytes):
+        if len(value) < 0x100:
+            return b"\xc4" + bytes([len(value)]) + value
+        return b"\xc5" + struct.pack(">H", len(value)) + value
+    if isinstance(value, list):
+        if len(value) < 16:
+            header = bytes([0x90 + len(value)])
+        else:
+            header = b"\xdc" + struct.pack(">H", len(value))
+        return header + b"".join(encode(v) for v in value)
+    if isinstance(value, dict):
+        # canonical msgpack as signed by Algorand: keys sorted
+        keys = sorted(value)
+        if len(keys) < 16:
+            header = bytes([0x80 + len(keys)])
+        else:
+            header = b"\xde" + struct.pack(">H", len(keys))
+        return header + b"".join(encode(k) + encode(value[k]) for k in keys)
+    raise TypeError(value)
+
+
+class Generator:
+    def __init__(self, seed, big):
+        self.rand = random.Random(seed)
+        self.big = big
+
+    def bytes(self, n):
+        return bytes(self.rand.getrandbits(8) for _ in range(n))
+
+    def uint(self):
+        r = self.rand
+        return r.choice(
+            [
+                0,
+                1,
+                r.randrange(1, 1 << 7),
+                r.randrange(1 << 7, 1 << 16),
+                r.randrange(1 << 16, 1 << 32),
+                r.randrange(1 << 32, 1 << 64),
+            ]
+        )
+
+    def asset_params(self):
+        fields = [
+            ("t", self.uint),
+            ("dc", lambda: self.rand.randrange(1, 20)),
+            ("df", lambda: True),
+            ("un", lambda: "UNIT"),
+            ("an", lambda: "Some asset"),
+            ("au", lambda: "https://example.com/x"),
+            ("am", lambda: self.bytes(32)),
+            ("m", lambda: self.bytes(32)),
+            ("r", lambda: self.bytes(32)),
+            ("f", lambda: self.bytes(32)),
+            ("c", lambda: self.bytes(32)),
+        ]
+        return {k: gen() for k, gen in fields if self.rand.random() < 0.6}
+
+    def application(self, tx):
+        r = self.rand
+        tx["apid"] = r.randrange(0, 1 << 40)
+        if r.random() < 0.5:
+            tx["apan"] = r.randrange(0, 6)
+        # at most eight references in total
+        accounts = r.randrange(0, 5)
+        apps = r.randrange(0, 9 - accounts)
+        assets = r.randrange(0, 9 - accounts - apps)
+        if accounts:
+            tx["apat"] = [self.bytes(32) for _ in range(accounts)]
+        if apps:
+            tx["apfa"] = [r.randrange(1, 1 << 40) for _ in range(apps)]
+        if assets:
+            tx["apas"] = [r.randrange(1, 1 << 40) for _ in range(assets)]
+        if r.random() < 0.7:
+            n = r.randrange(1, 17)
+            arg_max = 2048 // n if self.big else 100
+            tx["apaa"] = [self.bytes(r.randrange(0, arg_max)) for _ in range(n)]
+        if r.random() < 0.5:
+            tx["apgs"] = {"nui": r.randrange(1, 64), "nbs": r.randrange(1, 64)}
+        if r.random() < 0.5:
+            tx["apls"] = {"nui": r.randrange(1, 16)}
+        if r.random() < 0.6:
+            tx["apap"] = self.bytes(r.randrange(1, 4000 if self.big else 128))
+        if r.random() < 0.6:
+            tx["apsu"] = self.bytes(r.randrange(1, 200 if self.big else 32))
+        if self.big and r.random() < 0.5:
+            tx["apbx"] = [{"i": 0, "n": b"box" + bytes([i])} for i in range(3)]
+        if self.big and r.random() < 0.5:
+            tx["apep"] = r.randrange(1, 4)
+
+    def transaction(self):
+        r = self.rand
+        tx_type = r.choice(["pay", "keyreg", "axfer", "afrz", "acfg", "appl"])
+        tx = {
+            "type": tx_type,
+            "snd": self.bytes(32),
+            "fee": r.randrange(1000, 10**6),
+            "fv": self.uint(),
+            "lv": self.uint(),
+            "gh": self.bytes(32),
+            "gen": "mainnet-v1.0",
+        }
+        if r.random() < 0.3:
+            tx["grp"] = self.bytes(32)
+        if r.random() < 0.3:
+            tx["note"] = self.bytes(r.randrange(1, 1024 if self.big else 100))
+        if r.random() < 0.2:
+            tx["rekey"] = self.bytes(32)
+
+        if tx_type == "pay":
+            tx["rcv"] = self.bytes(32)
+            tx["amt"] = self.uint()
+            if r.random() < 0.3:
+                tx["close"] = self.bytes(32)
+        elif tx_type == "keyreg":
+            if r.random() < 0.8:
+                tx["votekey"] = self.bytes(32)
+                tx["selkey"] = self.bytes(32)
+                tx["votefst"] = self.uint()
+                tx["votelst"] = self.uint()
+                tx["votekd"] = self.uint()
+                if r.random() < 0.5:
+                    tx["sprfkey"] = self.bytes(64)
+            else:
+                tx["nonpart"] = True
+        elif tx_type == "axfer":
+            tx["xaid"] = r.randrange(1, 1 << 40)
+            tx["arcv"] = self.bytes(32)
+            if r.random() < 0.7:
+                tx["aamt"] = self.uint()
+            if r.random() < 0.3:
+                tx["asnd"] = self.bytes(32)
+            if r.random() < 0.3:
+                tx["aclose"] = self.bytes(32)
+        elif tx_type == "afrz":
+            tx["faid"] = r.randrange(1, 1 << 40)
+            tx["fadd"] = self.bytes(32)
+            if r.random() < 0.5:
+                tx["afrz"] = True
+        elif tx_type == "acfg":
+            if r.random() < 0.7:
+                tx["caid"] = r.randrange(1, 1 << 40)
+            if r.random() < 0.8:
+                params = self.asset_params()
+                if params:
+                    tx["apar"] = params
+        else:
+            self.application(tx)
+        return encode(tx)
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--seed", type=int, default=1)
+    parser.add_argument("--count", type=int, default=400)
+    parser.add_argument("--big", action="store_true", help="large fields")
+    group = parser.add_mutually_exclusive_group()
+    group.add_argument(
+        "--truncate", action="store_true", help="drop the end of each tx"
+    )
+    group.add_argument(
+        "--trailing", action="store_true", help="append a byte to each tx"
+    )
+    args = parser.parse_args()
+
+    gen = Generator(args.seed, args.big)
+    for _ in range(args.count):
+        tx = gen.transaction()
+        if args.truncate:
+            tx = tx[: gen.rand.randrange(1, len(tx))]
+        elif args.trailing:
+            tx += b"\x00"
+        # the transaction buffer of the firmware
+        if len(tx) <= 8190:
+            print(tx.hex())
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,110 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Runs the Algorand transaction parser over the transactions of a file
+ * written by algorand_txs.py. Prints every displayed item of every page to
+ * stdout, so that two builds of the parser can be diffed, and the parse time
+ * per transaction to stderr.
+ *
+ * usage: bench_algorand <txs file> [repetitions]
+ */
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "algo/tx.h"
+
+#define MAX_TXS 1000
+#define MAX_TX_SIZE 8192
+
+static uint8_t txs[MAX_TXS][MAX_TX_SIZE];
+static size_t tx_lens[MAX_TXS];
+
+static bool parse(size_t i, bool print) {
+  const char *err = tx_parse(txs[i], tx_lens[i]);
+  if (err != NULL) {
+    if (print) printf("%zu error %s\n", i, err);
+    return false;
+  }
+
+  uint8_t num_items = 0;
+  tx_getNumItems(&num_items);
+  for (uint8_t item = 0; item < num_items; item++) {
+    uint8_t page_count = 1;
+    for (uint8_t page = 0; page < page_count; page++) {
+      char key[64] = {0};
+      char value[256] = {0};
+      zxerr_t res = tx_getItem(item, key, sizeof(key), value, sizeof(value),
+                               page, &page_count);
+      if (print) {
+        printf("%zu %u/%u %d %s=%s\n", i, item, page, res, key, value);
+      }
+      if (res != zxerr_ok) break;
+    }
+  }
+  return true;
+}
+
+static size_t load(const char *path) {
+  FILE *f = fopen(path, "r");
+  if (f == NULL) {
+    perror(path);
+    exit(1);
+  }
+  static char line[2 * MAX_TX_SIZE + 2];
+  size_t count = 0;
+  while (count < MAX_TXS && fgets(line, sizeof(line), f) != NULL) {
+    size_t len = strlen(line) / 2;
+    for (size_t j = 0; j < len; j++) {
+      sscanf(line + 2 * j, "%2hhx", &txs[count][j]);
+    }
+    tx_lens[count++] = len;
+  }
+  fclose(f);
+  return count;
+}
+
+int main(int argc, char **argv) {
+  if (argc < 2) {
+    fprintf(stderr, "usage: %s <txs file> [repetitions]\n", argv[0]);
+    return 1;
+  }
+  size_t count = load(argv[1]);
+  int reps = argc > 2 ? atoi(argv[2]) : 100;
+
+  size_t parsed = 0;
+  for (size_t i = 0; i < count; i++) {
+    parsed += parse(i, true);
+  }
+
+  clock_t start = clock();
+  for (int r = 0; r < reps; r++) {
+    for (size_t i = 0; i < count; i++) {
+      parse(i, false);
+    }
+  }
+  double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+  fprintf(stderr, "%zu of %zu parsed, %.3f us/tx\n", parsed, count,
+          elapsed * 1e6 / ((double)reps * count));
+  return 0;
+}
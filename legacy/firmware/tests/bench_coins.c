@@ -0,0 +1,185 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Looks up every coin and token of the coin and token tables, and a near
+ * miss of each, and prints the results to stdout, so that two builds of the
+ * tables can be diffed. Then times 100k lookups of each kind and prints the
+ * times to stderr.
+ *
+ * usage: bench_coins
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "coins.h"
+#include "neo_tokens.h"
+#include "ton_tokens.h"
+#include "tron_tokens.h"
+
+// the generated headers all define TOKENS_COUNT
+#include "ethereum_tokens_onekey.h"
+#undef TOKENS_COUNT
+#include "conflux_tokens.h"
+#undef TOKENS_COUNT
+#include "scdo_tokens.h"
+#undef TOKENS_COUNT
+
+#define LOOKUPS 100000
+#define COUNT(array) (sizeof(array) / sizeof(*(array)))
+
+// not declared in their headers, both end with an UNKN entry
+extern const TronTokenType tron_tokens[];
+extern const TonTokenType ton_tokens[];
+
+static volatile uintptr_t sink;
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+static void print_coins(void) {
+  for (size_t i = 0; i < COINS_COUNT; i++) {
+    const CoinInfo *coin = &coins[i];
+    printf("coin name %s -> %s\n", coin->coin_name,
+           coinByName(coin->coin_name)->coin_name);
+    printf("coin slip44 %u -> %s\n", coin->coin_type,
+           coinBySlip44(coin->coin_type)->coin_name);
+    printf("coin address type %u -> %s\n", coin->address_type,
+           coinByAddressType(coin->address_type)->coin_name);
+    printf("coin address type %u -> %d\n", coin->address_type + 100000,
+           coinByAddressType(coin->address_type + 100000) != NULL);
+  }
+  printf("coin misses %d %d\n", coinByName("Nope") != NULL,
+         coinBySlip44(12345) != NULL);
+}
+
+static void print_tokens(void) {
+  for (size_t i = 0; i < COUNT(tokens); i++) {
+    uint8_t address[20];
+    memcpy(address, tokens[i].address, sizeof(address));
+    uint64_t chain_id = tokens[i].chain_id;
+    for (int miss = 0; miss < 3; miss++) {
+      const TokenType *token = tokenByChainAddress(
+          chain_id + (miss == 2), address);
+      printf("erc20 %llu%s %02x..%02x -> %s\n", (unsigned long long)chain_id,
+             miss == 2 ? "+1" : "", address[0], address[19] ^ (miss == 1),
+             token->ticker);
+      address[19] ^= 1;
+    }
+  }
+
+  for (size_t i = 0; i < COUNT(conflux_tokens); i++) {
+    char address[64];
+    snprintf(address, sizeof(address), "%s", conflux_tokens[i].address);
+    printf("conflux %s -> %s\n", address, tokenByAddress(address)->symbol);
+    address[strlen(address) - 1] ^= 1;
+    printf("conflux %s -> %s\n", address, tokenByAddress(address)->symbol);
+  }
+
+  for (size_t i = 0; i < COUNT(scdo_tokens); i++) {
+    char address[64];
+    snprintf(address, sizeof(address), "%s", scdo_tokens[i].address);
+    printf("scdo %s -> %s\n", address, getTokenByAddress(address)->symbol);
+    address[strlen(address) - 1] ^= 1;
+    printf("scdo %s -> %s\n", address, getTokenByAddress(address)->symbol);
+  }
+
+  for (size_t i = 0; strncmp(tron_tokens[i].address, "FFFF", 4) != 0; i++) {
+    char address[36];
+    memcpy(address, tron_tokens[i].address, sizeof(address));
+    printf("tron %s -> %s\n", address,
+           get_tron_token_by_address(address)->ticker);
+    address[33] ^= 1;
+    printf("tron %s -> %s\n", address,
+           get_tron_token_by_address(address)->ticker);
+  }
+
+  for (size_t i = 0; strncmp(ton_tokens[i].address, "FFFF", 4) != 0; i++) {
+    char address[49];
+    memcpy(address, ton_tokens[i].address, sizeof(address));
+    printf("ton %s -> %s\n", address, ton_get_token_by_address(address)->name);
+    address[47] ^= 1;
+    printf("ton %s -> %s\n", address, ton_get_token_by_address(address)->name);
+  }
+
+  // NEO, GAS and a miss
+  static const uint8_t neo[][20] = {
+      {0xf5, 0x63, 0xea, 0x40, 0xbc, 0x28, 0x3d, 0x4d, 0x0e, 0x05,
+       0xc4, 0x8e, 0xa3, 0x05, 0xb3, 0xf2, 0xa0, 0x73, 0x40, 0xef},
+      {0xcf, 0x76, 0xe2, 0x8b, 0xd0, 0x06, 0x2c, 0x4a, 0x47, 0x8e,
+       0xe3, 0x55, 0x61, 0x01, 0x13, 0x19, 0xf3, 0xcf, 0xa4, 0xd2},
+      {0x01},
+  };
+  for (size_t i = 0; i < COUNT(neo); i++) {
+    printf("neo %02x -> %s\n", neo[i][0],
+           neo_token_by_contract_script_hash(neo[i])->symbol);
+  }
+}
+
+static void time_lookups(void) {
+  double start = now();
+  for (int i = 0; i < LOOKUPS; i++) {
+    const TokenType *token = &tokens[(i * 7919) % COUNT(tokens)];
+    sink += (uintptr_t)tokenByChainAddress(token->chain_id,
+                                           (const uint8_t *)token->address);
+  }
+  fprintf(stderr, "%zu onekey erc20 tokens: %.1f ms\n", COUNT(tokens),
+          (now() - start) * 1e3);
+
+  static const uint8_t miss[20] = {0xff};
+  start = now();
+  for (int i = 0; i < LOOKUPS; i++) {
+    sink += (uintptr_t)tokenByChainAddress(1 + i % 3, miss);
+  }
+  fprintf(stderr, "onekey erc20 misses: %.1f ms\n", (now() - start) * 1e3);
+
+  start = now();
+  for (int i = 0; i < LOOKUPS; i++) {
+    sink += (uintptr_t)coinByName(coins[(i * 31) % COINS_COUNT].coin_name);
+  }
+  fprintf(stderr, "coinByName, %d coins: %.1f ms\n", COINS_COUNT,
+          (now() - start) * 1e3);
+
+  start = now();
+  for (int i = 0; i < LOOKUPS; i++) {
+    sink += (uintptr_t)coinBySlip44(coins[(i * 31) % COINS_COUNT].coin_type);
+  }
+  fprintf(stderr, "coinBySlip44: %.1f ms\n", (now() - start) * 1e3);
+
+  start = now();
+  for (int i = 0; i < LOOKUPS; i++) {
+    sink += (uintptr_t)coinByAddressType(
+        coins[(i * 31) % COINS_COUNT].address_type);
+  }
+  fprintf(stderr, "coinByAddressType: %.1f ms\n", (now() - start) * 1e3);
+}
+
+int main(void) {
+  print_coins();
+  print_tokens();
+  fprintf(stderr, "%d lookups each:\n", LOOKUPS);
+  time_lookups();
+  return 0;
+}
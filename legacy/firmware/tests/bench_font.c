@@ -0,0 +1,115 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Lays out every string of the zh_cn locale with the extended font the way
+ * chinese.c does, first the width of each character, then its bitmap, and
+ * prints the widths and bitmaps to stdout, so that two builds of font_ex.c
+ * can be diffed. Then times the layout of the whole locale and prints the
+ * time per screen of text to stderr.
+ *
+ * The Makefile tells from the locale whether its strings are pooled,
+ * I18N_POOLED, or an array of pointers.
+ *
+ * usage: bench_font [repetitions]
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "font_ex.h"
+#include "i18n/locales/zh_cn.inc"
+
+#if I18N_POOLED
+#define FOR_EACH_STRING(text)                                          \
+  for (const char *text = languages_zh_cn_pool;                        \
+       text < languages_zh_cn_pool + sizeof(languages_zh_cn_pool) - 1; \
+       text += strlen(text) + 1)
+#else
+#define FOR_EACH_STRING(text)                                             \
+  for (size_t i_ = 0; i_ < sizeof(languages_zh_cn) / sizeof(char *); i_++) \
+    for (const char *text = languages_zh_cn[i_]; text != NULL; text = NULL)
+#endif
+
+static volatile uint32_t sink;
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+// lays out one string, returns the number of extended font characters
+static int layout(const char *text, int line, int print) {
+  const uint8_t *p = (const uint8_t *)text;
+  int count = 0;
+  int x = 0;
+  while (*p) {
+    int steps = utf8_get_size(*p);
+    if (*p >= 0x80) {
+      int width = font_get_width(p);
+      uint8_t data_width = 0;
+      const uint8_t *data = font_get_data(p, &data_width);
+      uint32_t sum = 0;
+      // the bitmap of a missing glyph is not specified
+      if (data != NULL && width > 0) {
+        int len = ((data_width + 7) / 8) * font_get_height();
+        for (int i = 0; i < len; i++) {
+          sum = sum * 31 + data[i];
+        }
+      }
+      if (print) {
+        printf("%d %d width %d %u %08x\n", line, x, width, data_width,
+               (unsigned)sum);
+      }
+      sink += sum;
+      x += width;
+      count++;
+    }
+    p += steps;
+  }
+  return count;
+}
+
+int main(int argc, char **argv) {
+  int reps = argc > 1 ? atoi(argv[1]) : 2000;
+
+  font_init();
+  if (!font_imported()) {
+    fprintf(stderr, "no font\n");
+    return 1;
+  }
+
+  int strings = 0;
+  int chars = 0;
+  FOR_EACH_STRING(text) { chars += layout(text, strings++, 1); }
+
+  double start = now();
+  for (int r = 0; r < reps; r++) {
+    FOR_EACH_STRING(text) { layout(text, 0, 0); }
+  }
+  double elapsed = now() - start;
+  // a screen of the 128x64 display holds about 60 characters
+  fprintf(stderr, "%d strings, %d characters: %.3f s, %.1f us/screen\n",
+          strings, chars, elapsed, elapsed * 1e6 * 60 / ((double)reps * chars));
+  return 0;
+}
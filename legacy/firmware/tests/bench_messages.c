@@ -0,0 +1,144 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Looks up all 2^18 (interface, direction, id) keys in the MessagesMap that
+ * protob/messages_map.py generates and prints the messages found to stdout,
+ * so that two layouts of the map can be diffed. Then times the lookup of the
+ * eight highest numbered inbound messages, the OneKey ones at the end of the
+ * proto, and prints the time per lookup to stderr.
+ *
+ * messages.c does not build on the host, so the lookup is repeated here.
+ * The Makefile tells from messages_map.h which layout it has:
+ * MESSAGES_MAP_HASHED for the perfect hash of MessageFind(), else the linear
+ * table.
+ *
+ * usage: bench_messages
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include "bench_messages_fsm.h"
+#include "messages.pb.h"
+
+#define LOOKUPS 2000000
+
+struct MessagesMap_t {
+  char type;  // n = normal, d = debug
+  char dir;   // i = in, o = out
+  uint16_t msg_id;
+  const pb_msgdesc_t *fields;
+  void (*process_func)(const void *ptr);
+};
+
+#if MESSAGES_MAP_HASHED
+
+#include "messages_map.h"
+
+static inline uint32_t messages_map_key(char type, char dir, uint16_t msg_id) {
+  return msg_id | (uint32_t)(type == 'd') << 16 | (uint32_t)(dir == 'o') << 17;
+}
+
+static inline uint32_t messages_map_hash(uint32_t seed, uint32_t key) {
+  uint32_t h = (key ^ seed) * 0x9E3779B1;
+  return h ^ (h >> 15);
+}
+
+__attribute__((noinline)) static const struct MessagesMap_t *MessageFind(
+    char type, char dir, uint16_t msg_id) {
+  uint32_t key = messages_map_key(type, dir, msg_id);
+  uint32_t seed =
+      MessagesMapSeeds[messages_map_hash(0, key) % MESSAGES_MAP_BUCKETS];
+  const struct MessagesMap_t *m =
+      &MessagesMap[messages_map_hash(seed, key) % MESSAGES_MAP_SLOTS];
+  if (type != m->type || dir != m->dir || msg_id != m->msg_id) {
+    return 0;
+  }
+  return m;
+}
+
+#else
+
+static const struct MessagesMap_t MessagesMap[] = {
+#include "messages_map.h"
+    // end
+    {0}};
+
+__attribute__((noinline)) static const struct MessagesMap_t *MessageFind(
+    char type, char dir, uint16_t msg_id) {
+  const struct MessagesMap_t *m = MessagesMap;
+  while (m->type) {
+    if (type == m->type && dir == m->dir && msg_id == m->msg_id) {
+      return m;
+    }
+    m++;
+  }
+  return 0;
+}
+
+#endif
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+int main(void) {
+  static const char types[] = {'n', 'd'};
+  static const char dirs[] = {'i', 'o'};
+  int found = 0;
+  for (int t = 0; t < 2; t++) {
+    for (int d = 0; d < 2; d++) {
+      for (uint32_t id = 0; id <= UINT16_MAX; id++) {
+        const struct MessagesMap_t *m = MessageFind(types[t], dirs[d], id);
+        if (m != 0) {
+          printf("%c%c %5u fields %d handler %d\n", m->type, m->dir,
+                 m->msg_id, m->fields != 0, m->process_func != 0);
+          found++;
+        }
+      }
+    }
+  }
+  fprintf(stderr, "%d messages, DEBUG_LINK %d\n", found, DEBUG_LINK);
+
+  uint16_t ids[8] = {0};
+  int count = 0;
+  for (uint32_t id = UINT16_MAX; id > 0 && count < 8; id--) {
+    if (MessageFind('n', 'i', id) != 0) {
+      ids[count++] = id;
+    }
+  }
+  volatile uintptr_t sink = 0;
+  double start = now();
+  for (int i = 0; i < LOOKUPS; i++) {
+    sink += (uintptr_t)MessageFind('n', 'i', ids[i % count]);
+  }
+  fprintf(stderr, "inbound ids %u..%u: %.1f ns/lookup\n", ids[count - 1],
+          ids[0], (now() - start) / LOOKUPS);
+
+  start = now();
+  for (int i = 0; i < LOOKUPS; i++) {
+    sink += (uintptr_t)MessageFind('n', 'i', 0);
+  }
+  fprintf(stderr, "Initialize: %.1f ns/lookup\n", (now() - start) / LOOKUPS);
+  return 0;
+}
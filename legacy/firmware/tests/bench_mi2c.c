@@ -0,0 +1,170 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*
+ * Runs thd89_transmit of the SE driver (mi2c.c, thd89.c) against a simulated
+ * I2C peripheral and SE. The SE NACKs its address until a command has been
+ * processed for the given latency, like the THD89 does. Time is simulated:
+ * only the delays of the driver advance the clock.
+ *
+ * Commands of a range of latencies are sent. The first response of each
+ * range is printed to stdout, so that two builds of the driver can be
+ * diffed. Printed to stderr are how late after the SE became ready the
+ * responses were collected, how many times the driver addressed the SE and
+ * how long it waited with interrupts disabled, per command.
+ *
+ * usage: bench_mi2c
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// timer.h pulls in the SVC calls of supervise.h, the driver needs only these
+#define __TIMER_H__
+void delay_ms(uint32_t ms);
+void delay_us(uint32_t us);
+
+#include "mi2c.c"
+#include "thd89.c"
+
+static uint64_t now_us;
+static uint64_t ready_us;    // the SE NACKs its address until then
+static uint64_t latency_us;  // to process a command
+static uint64_t irq_off_waited_us;
+static bool irq_off;
+static bool acked;
+static int polls;
+
+static uint8_t response[16];
+static int response_pos;
+
+uint32_t fake_i2c_sr1(void) {
+  return I2C_SR1_SB | I2C_SR1_RxNE | I2C_SR1_TxE | (acked ? I2C_SR1_ADDR : 0);
+}
+
+void fake_i2c_address(uint8_t mode) {
+  polls++;
+  acked = now_us >= ready_us;
+  if (acked && mode == MI2C_READ) {
+    response_pos = 0;
+  }
+}
+
+void fake_i2c_send(uint8_t data) {
+  (void)data;
+  // busy from the last byte of the command on
+  ready_us = now_us + latency_us;
+}
+
+uint8_t fake_i2c_get(void) {
+  if (response_pos >= (int)sizeof(response)) {
+    return 0;
+  }
+  return response[response_pos++];
+}
+
+void __disable_irq(void) { irq_off = true; }
+
+void __enable_irq(void) { irq_off = false; }
+
+static void wait_us(uint64_t us) {
+  if (irq_off) {
+    irq_off_waited_us += us;
+  }
+  now_us += us;
+}
+
+void delay_us(uint32_t us) { wait_us(us); }
+
+void delay_ms(uint32_t ms) { wait_us(ms * 1000ULL); }
+
+void hal_delay(uint32_t ms) { wait_us(ms * 1000ULL); }
+
+void __fatal_error(const char *expr, const char *msg, const char *file,
+                   int line, const char *func) {
+  (void)expr;
+  (void)file;
+  (void)line;
+  (void)func;
+  printf("fatal error: %s\n", msg);
+  exit(1);
+}
+
+// length, 4 data bytes and the status word 9000, then the xor of all
+static void set_response(void) {
+  static const uint8_t frame[] = {0x00, 0x06, 0x01, 0x02,
+                                  0x03, 0x04, 0x90, 0x00};
+  uint8_t xor = 0;
+  for (size_t i = 0; i < sizeof(frame); i++) {
+    response[i] = frame[i];
+    xor ^= frame[i];
+  }
+  response[sizeof(frame)] = xor;
+}
+
+// sends a command that takes latency us and collects the response
+static void transmit(uint32_t latency, bool print) {
+  uint8_t cmd[5] = {0x80, 0x84, 0x00, 0x00, 0x04};
+  uint8_t resp[16] = {0};
+  uint16_t resp_len = sizeof(resp);
+
+  now_us = 0;
+  ready_us = 0;
+  latency_us = latency;
+  secbool ret = thd89_transmit(cmd, sizeof(cmd), resp, &resp_len);
+  if (print) {
+    printf("latency %u us: %s,", (unsigned)latency,
+           ret == sectrue ? "ok" : "failed");
+    for (uint16_t i = 0; i < resp_len && i < sizeof(resp); i++) {
+      printf(" %02x", resp[i]);
+    }
+    printf("\n");
+  }
+}
+
+// sweeps the latencies of a range, as the phase of the polls to the moment
+// the SE becomes ready decides the delay of a single command
+static void sweep(const char *name, uint32_t from, uint32_t to, uint32_t step) {
+  uint64_t total_us = 0, max_us = 0, runs = 0;
+  polls = 0;
+  irq_off_waited_us = 0;
+  for (uint32_t latency = from; latency <= to; latency += step) {
+    transmit(latency, latency == from);
+    uint64_t late_us = now_us - ready_us;
+    total_us += late_us;
+    max_us = late_us > max_us ? late_us : max_us;
+    runs++;
+  }
+  fprintf(stderr,
+          "%-6s %7u-%7u us: %5.0f us late on average, %4llu at most, %6.1f "
+          "polls, %9.0f us with interrupts off\n",
+          name, (unsigned)from, (unsigned)to, (double)total_us / runs,
+          (unsigned long long)max_us, (double)polls / runs,
+          (double)irq_off_waited_us / runs);
+}
+
+int main(void) {
+  set_response();
+  // reading a counter, deriving a key, signing, generating a seed
+  sweep("short", 20, 2000, 10);
+  sweep("medium", 2000, 50000, 100);
+  sweep("long", 50000, 2000000, 9973);
+  return 0;
+}
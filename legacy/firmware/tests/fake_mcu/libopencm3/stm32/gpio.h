@@ -0,0 +1,12 @@
+// GPIO setup does nothing on the host.
+
+#ifndef FAKE_GPIO_H
+#define FAKE_GPIO_H
+
+#define gpio_set(...) ((void)0)
+#define gpio_clear(...) ((void)0)
+#define gpio_set_output_options(...) ((void)0)
+#define gpio_set_af(...) ((void)0)
+#define gpio_mode_setup(...) ((void)0)
+
+#endif
@@ -0,0 +1,35 @@
+// The I2C peripheral as bench_mi2c.c simulates it, see there.
+
+#ifndef FAKE_I2C_H
+#define FAKE_I2C_H
+
+#include <stdint.h>
+
+uint32_t fake_i2c_sr1(void);
+void fake_i2c_address(uint8_t mode);
+void fake_i2c_send(uint8_t data);
+uint8_t fake_i2c_get(void);
+
+#define I2C1 0x40005400U
+
+#define I2C_SR1(i2c) ((void)(i2c), fake_i2c_sr1())
+#define I2C_SR2(i2c) ((void)(i2c), 0U)
+#define I2C_SR1_SB (1 << 0)
+#define I2C_SR1_ADDR (1 << 1)
+#define I2C_SR1_RxNE (1 << 6)
+#define I2C_SR1_TxE (1 << 7)
+
+#define i2c_send_start(i2c) ((void)(i2c))
+#define i2c_send_stop(i2c) ((void)(i2c))
+#define i2c_enable_ack(i2c) ((void)(i2c))
+#define i2c_disable_ack(i2c) ((void)(i2c))
+#define i2c_send_7bit_address(i2c, addr, mode) ((void)(i2c), fake_i2c_address(mode))
+#define i2c_send_data(i2c, data) ((void)(i2c), fake_i2c_send(data))
+#define i2c_get_data(i2c) ((void)(i2c), fake_i2c_get())
+
+#define i2c_reset(...) ((void)0)
+#define i2c_peripheral_disable(...) ((void)0)
+#define i2c_peripheral_enable(...) ((void)0)
+#define i2c_set_speed(...) ((void)0)
+
+#endif
@@ -0,0 +1,8 @@
+// Clock setup does nothing on the host.
+
+#ifndef FAKE_RCC_H
+#define FAKE_RCC_H
+
+#define rcc_periph_clock_enable(...) ((void)0)
+
+#endif
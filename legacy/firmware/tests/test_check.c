@@ -0,0 +1,80 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <check.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define FROMHEX_MAXLEN 4096
+
+const uint8_t *fromhex(const char *str) {
+  static uint8_t buf[FROMHEX_MAXLEN];
+  size_t len = strlen(str) / 2;
+  if (len > FROMHEX_MAXLEN) len = FROMHEX_MAXLEN;
+  for (size_t i = 0; i < len; i++) {
+    uint8_t c = 0;
+    if (str[i * 2] >= '0' && str[i * 2] <= '9') c += (str[i * 2] - '0') << 4;
+    if ((str[i * 2] & ~0x20) >= 'A' && (str[i * 2] & ~0x20) <= 'F')
+      c += (10 + (str[i * 2] & ~0x20) - 'A') << 4;
+    if (str[i * 2 + 1] >= '0' && str[i * 2 + 1] <= '9')
+      c += (str[i * 2 + 1] - '0');
+    if ((str[i * 2 + 1] & ~0x20) >= 'A' && (str[i * 2 + 1] & ~0x20) <= 'F')
+      c += (10 + (str[i * 2 + 1] & ~0x20) - 'A');
+    buf[i] = c;
+  }
+  return buf;
+}
+
+#include "test_check_ton.h"
+#include "test_check_u2f_counter.h"
+
+// define test suite and cases
+Suite *test_suite(void) {
+  Suite *s = suite_create("firmware");
+  TCase *tc;
+
+  tc = tcase_create("ton_boc");
+  tcase_add_test(tc, test_ton_boc_hash);
+  tcase_add_test(tc, test_ton_boc_root_cell);
+  tcase_add_test(tc, test_ton_boc_invalid);
+  suite_add_tcase(s, tc);
+
+  tc = tcase_create("u2f_counter");
+  tcase_add_test(tc, test_u2f_counter_block);
+  tcase_add_test(tc, test_u2f_counter_reset);
+  tcase_add_test(tc, test_u2f_counter_set);
+  suite_add_tcase(s, tc);
+
+  return s;
+}
+
+// run suite
+int main(void) {
+  int number_failed;
+  Suite *s = test_suite();
+  SRunner *sr = srunner_create(s);
+  srunner_run_all(sr, CK_VERBOSE);
+  number_failed = srunner_ntests_failed(sr);
+  srunner_free(sr);
+  if (number_failed == 0) {
+    printf("PASSED ALL TESTS\n");
+  }
+  return number_failed;
+}
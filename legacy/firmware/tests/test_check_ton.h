@@ -0,0 +1,158 @@
+#include "ton_cell.h"
+
+// Wallet contract code as deployed on mainnet. The representation hashes are
+// the code hashes the TON explorers show for these wallets, the v4r2 one is
+// also TON_WALLET_CODE_HASH_V4R2 in ton.c.
+static const char *boc_wallet_v4r2_code =
+    "b5ee9c72410214010002d4000114ff00f4a413f4bcf2c80b010201200203020148040504"
+    "f8f28308d71820d31fd31fd31f02f823bbf264ed44d0d31fd31fd3fff404d15143baf2a1"
+    "5151baf2a205f901541064f910f2a3f80024a4c8cb1f5240cb1f5230cbff5210f400c9ed"
+    "54f80f01d30721c0009f6c519320d74a96d307d402fb00e830e021c001e30021c002e300"
+    "01c0039130e30d03a4c8cb1f12cb1fcbff1011121302e6d001d0d3032171b0925f04e022"
+    "d749c120925f04e002d31f218210706c7567bd22821064737472bdb0925f05e003fa4030"
+    "20fa4401c8ca07cbffc9d0ed44d0810140d721f404305c810108f40a6fa131b3925f07e0"
+    "05d33fc8258210706c7567ba923830e30d03821064737472ba925f06e30d060702012008"
+    "09007801fa00f40430f8276f2230500aa121bef2e0508210706c7567831eb17080185004"
+    "cb0526cf1658fa0219f400cb6917cb1f5260cb3f20c98040fb0006008a5004810108f459"
+    "30ed44d0810140d720c801cf16f400c9ed540172b08e23821064737472831eb170801850"
+    "05cb055003cf1623fa0213cb6acb1fcb3fc98040fb00925f03e20201200a0b0059bd242b"
+    "6f6a2684080a06b90fa0218470d4080847a4937d29910ce6903e9ff9837812801b781014"
+    "8987159f31840201580c0d0011b8c97ed44d0d70b1f8003db29dfb513420405035c87d01"
+    "0c00b23281f2fff274006040423d029be84c600201200e0f0019adce76a26840206b90eb"
+    "85ffc00019af1df6a26840106b90eb858fc0006ed207fa00d4d422f90005c8ca0715cbff"
+    "c9d077748018c8cb05cb0222cf165005fa0214cb6b12ccccc973fb00c84014810108f451"
+    "f2a7020070810108d718fa00d33fc8542047810108f451f2a782106e6f746570748018c8"
+    "cb05cb025006cf165004fa0214cb6a12cb1fcb3fc973fb0002006c810108d718fa00d33f"
+    "305224810108f459f2a782106473747270748018c8cb05cb025005cf165003fa0213cb6a"
+    "cb1f12cb3fc973fb00000af400c9ed54696225e5";
+static const char *boc_wallet_v3r2_code =
+    "b5ee9c724101010100710000deff0020dd2082014c97ba218201339cbab19f71b0ed44d0"
+    "d31fd31f31d70bffe304e0a4f2608308d71820d31fd31fd31ff82313bbf263ed44d0d31f"
+    "d31fd3ffd15132baf2a15144baf2a204f901541055f910f2a3f8009320d74a96d307d402"
+    "fb00e8d101a4c8cb1fcb1fcbffc9ed5410bd6dad";
+static const char *boc_wallet_v3r1_code =
+    "b5ee9c724101010100620000c0ff0020dd2082014c97ba9730ed44d0d70b1fe0a4f26083"
+    "08d71820d31fd31fd31ff82313bbf263ed44d0d31fd31fd3ffd15132baf2a15144baf2a2"
+    "04f901541055f910f2a3f8009320d74a96d307d402fb00e8d101a4c8cb1fcb1fcbffc9ed"
+    "543fbe6ee0";
+static const char *boc_wallet_v2r2_code =
+    "b5ee9c724101010100630000c2ff0020dd2082014c97ba218201339cbab19c71b0ed44d0"
+    "d31fd70bffe304e0a4f2608308d71820d31fd31f01f823bbf263ed44d0d31fd3ffd15131"
+    "baf2a103f901541042f910f2a2f800029320d74a96d307d402fb00e8d1a4c8cb1fcbffc9"
+    "ed54044cd7a1";
+static const char *boc_wallet_v3r2_code_indexed =
+    "b5ee9c72c10101010071007100deff0020dd2082014c97ba218201339cbab19f71b0ed44"
+    "d0d31fd31f31d70bffe304e0a4f2608308d71820d31fd31fd31ff82313bbf263ed44d0d3"
+    "1fd31fd3ffd15132baf2a15144baf2a204f901541055f910f2a3f8009320d74a96d307d4"
+    "02fb00e8d101a4c8cb1fcb1fcbffc9ed5489784a78";
+
+// A cell of four data bits, 1010, so the data byte carries a completion tag.
+static const char *boc_four_bits = "b5ee9c72010101010003000001a8";
+
+static size_t boc_from_hex(const char *hex, uint8_t *boc) {
+  size_t len = strlen(hex) / 2;
+  memcpy(boc, fromhex(hex), len);
+  return len;
+}
+
+START_TEST(test_ton_boc_hash) {
+  static const struct {
+    const char **boc;
+    const char *hash;
+    uint16_t depth;
+  } tests[] = {
+      {&boc_wallet_v4r2_code,
+       "feb5ff6820e2ff0d9483e7e0d62c817d846789fb4ae580c878866d959dabd5c0", 7},
+      {&boc_wallet_v3r2_code,
+       "84dafa449f98a6987789ba232358072bc0f76dc4524002a5d0918b9a75d2d599", 0},
+      {&boc_wallet_v3r1_code,
+       "b61041a58a7980b946e8fb9e198e3c904d24799ffa36574ea4251c41a566f581", 0},
+      {&boc_wallet_v2r2_code,
+       "fe9530d3243853083ef2ef0b4c2908c0abf6fa1c31ea243aacaa5bf8c7d753f1", 0},
+      // the same cell with the optional offset index
+      {&boc_wallet_v3r2_code_indexed,
+       "84dafa449f98a6987789ba232358072bc0f76dc4524002a5d0918b9a75d2d599", 0},
+      {&boc_four_bits,
+       "9eba78194991774d6df927866c21975bbee3685deed07e31c8d1a719b2c788e6", 0},
+  };
+
+  for (size_t i = 0; i < sizeof(tests) / sizeof(*tests); i++) {
+    uint8_t boc[TON_BOC_MAX_SIZE];
+    size_t len = boc_from_hex(*tests[i].boc, boc);
+    CellRef_t root;
+    memset(&root, 0, sizeof(root));
+
+    ck_assert(ton_parse_boc(boc, len, &root, NULL, NULL));
+    ck_assert_mem_eq(root.hash, fromhex(tests[i].hash), HASH_LEN);
+    ck_assert_uint_eq(root.max_depth, tests[i].depth);
+  }
+}
+END_TEST
+
+START_TEST(test_ton_boc_root_cell) {
+  uint8_t boc[TON_BOC_MAX_SIZE];
+  size_t len = boc_from_hex(boc_wallet_v4r2_code, boc);
+  CellRef_t root, first_ref;
+  BitString_t bits;
+
+  ck_assert(ton_parse_boc(boc, len, &root, &bits, &first_ref));
+  ck_assert_uint_eq(bits.data_cursor, 80);
+  ck_assert_mem_eq(bits.data, fromhex("ff00f4a413f4bcf2c80b"), 10);
+  ck_assert_mem_eq(
+      first_ref.hash,
+      fromhex(
+          "d814641364bd13e0a8a646226d7eb6e174cfd4f47235f8f8b29d1fd68c05a399"),
+      HASH_LEN);
+  ck_assert_uint_eq(first_ref.max_depth, 6);
+
+  // the completion tag is not part of the data
+  len = boc_from_hex(boc_four_bits, boc);
+  ck_assert(ton_parse_boc(boc, len, &root, &bits, &first_ref));
+  ck_assert_uint_eq(bits.data_cursor, 4);
+  ck_assert_uint_eq(bits.data[0], 0xa0);
+  ck_assert_uint_eq(first_ref.max_depth, 0);
+}
+END_TEST
+
+START_TEST(test_ton_boc_invalid) {
+  uint8_t boc[TON_BOC_MAX_SIZE + 1] = {0};
+  CellRef_t root;
+  size_t len = boc_from_hex(boc_wallet_v4r2_code, boc);
+
+  // every truncation
+  for (size_t i = 0; i < len; i++) {
+    ck_assert(!ton_parse_boc(boc, i, &root, NULL, NULL));
+  }
+  // a trailing byte
+  ck_assert(!ton_parse_boc(boc, len + 1, &root, NULL, NULL));
+
+  // wrong magic
+  boc[0] ^= 1;
+  ck_assert(!ton_parse_boc(boc, len, &root, NULL, NULL));
+  boc[0] ^= 1;
+
+  // the root refers to itself instead of cell 1
+  const size_t root_ref = 12 + 2 + 10;  // header, descriptors, data
+  ck_assert_uint_eq(boc[root_ref], 1);
+  boc[root_ref] = 0;
+  ck_assert(!ton_parse_boc(boc, len, &root, NULL, NULL));
+  boc[root_ref] = 1;
+
+  // a reference past the last cell
+  boc[root_ref] = 20;
+  ck_assert(!ton_parse_boc(boc, len, &root, NULL, NULL));
+  boc[root_ref] = 1;
+
+  // more cells than the index holds
+  boc[6] = TON_BOC_MAX_CELLS + 1;
+  ck_assert(!ton_parse_boc(boc, len, &root, NULL, NULL));
+  boc[6] = 20;
+
+  // a completion tag without its marker bit
+  len = boc_from_hex(boc_four_bits, boc);
+  boc[len - 1] = 0;
+  ck_assert(!ton_parse_boc(boc, len, &root, NULL, NULL));
+
+  ck_assert(!ton_parse_boc(boc, TON_BOC_MAX_SIZE + 1, &root, NULL, NULL));
+}
+END_TEST
@@ -0,0 +1,104 @@
+#include "se_chip.h"
+#include "u2f_counter.h"
+
+// The SE counter: next_counter increments and returns it, set stores it.
+static uint32_t se_counter;
+static uint32_t se_writes;
+static bool se_fail_write;
+
+secbool se_get_u2f_next_counter(uint32_t *u2fcounter) {
+  *u2fcounter = ++se_counter;
+  return sectrue;
+}
+
+secbool se_set_u2f_counter(uint32_t u2fcounter) {
+  if (se_fail_write) {
+    return secfalse;
+  }
+  se_counter = u2fcounter;
+  se_writes++;
+  return sectrue;
+}
+
+static void se_counter_reset(uint32_t u2fcounter) {
+  se_counter = u2fcounter;
+  se_writes = 0;
+  se_fail_write = false;
+  // a power loss: only the SE keeps its value
+  u2f_counter_drop_block();
+}
+
+START_TEST(test_u2f_counter_block) {
+  se_counter_reset(100);
+
+  ck_assert_uint_eq(u2f_counter_next(), 101);
+  // the end of the block is stored before the first value is used
+  ck_assert_uint_eq(se_counter, 101 + U2F_COUNTER_BLOCK - 1);
+  ck_assert_uint_eq(se_writes, 1);
+  for (uint32_t i = 1; i < U2F_COUNTER_BLOCK; i++) {
+    ck_assert_uint_eq(u2f_counter_next(), 101 + i);
+  }
+  ck_assert_uint_eq(se_writes, 1);
+  ck_assert_uint_eq(u2f_counter_next(), 101 + U2F_COUNTER_BLOCK);
+  ck_assert_uint_eq(se_writes, 2);
+}
+END_TEST
+
+START_TEST(test_u2f_counter_reset) {
+  se_counter_reset(0);
+  uint32_t last = 0;
+
+  // a power loss after every number of values in the block
+  for (uint32_t used = 1; used <= 2 * U2F_COUNTER_BLOCK; used++) {
+    for (uint32_t i = 0; i < used; i++) {
+      uint32_t counter = u2f_counter_next();
+      ck_assert(counter > last);
+      last = counter;
+    }
+    u2f_counter_drop_block();
+  }
+
+  // FIDO2 and U2F authentications, power losses and failed SE writes mixed
+  uint32_t seed = 1;
+  for (int i = 0; i < 100000; i++) {
+    seed = seed * 1103515245 + 12345;
+    uint32_t event = (seed >> 16) % 64;
+    se_fail_write = event == 0;
+    if (event == 1) {
+      u2f_counter_drop_block();
+      continue;
+    }
+    uint32_t counter = 0;
+    if (event == 2) {
+      // U2F counts on the SE by itself
+      se_get_u2f_next_counter(&counter);
+      u2f_counter_drop_block();
+    } else {
+      counter = u2f_counter_next();
+    }
+    ck_assert(counter > last);
+    last = counter;
+  }
+}
+END_TEST
+
+START_TEST(test_u2f_counter_set) {
+  se_counter_reset(0);
+  ck_assert_uint_eq(u2f_counter_next(), 1);
+
+  // a counter set from the host drops the rest of the block
+  u2f_counter_set(1000);
+  ck_assert_uint_eq(se_counter, 1000);
+  ck_assert_uint_eq(u2f_counter_next(), 1001);
+
+  // no block is taken where it would wrap
+  se_counter_reset(UINT32_MAX - U2F_COUNTER_BLOCK);
+  ck_assert_uint_eq(u2f_counter_next(), UINT32_MAX - U2F_COUNTER_BLOCK + 1);
+  ck_assert_uint_eq(se_counter, UINT32_MAX);
+  se_counter_reset(UINT32_MAX - U2F_COUNTER_BLOCK + 1);
+  for (uint32_t i = 2; i <= U2F_COUNTER_BLOCK; i++) {
+    ck_assert_uint_eq(u2f_counter_next(), UINT32_MAX - U2F_COUNTER_BLOCK + i);
+  }
+  ck_assert_uint_eq(se_writes, 0);
+}
+END_TEST
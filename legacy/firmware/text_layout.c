@@ -0,0 +1,93 @@
+#include "text_layout.h"
+#include <string.h>
+#include "chinese.h"
+#include "font_ex.h"
+
+static int char_size(const char *text) {
+  if ((uint8_t)*text < 0x80) return 1;
+  int size = utf8_get_size((uint8_t)*text);
+  if (size < 1) size = 1;
+  // never step over the terminator of a truncated sequence
+  for (int i = 1; i < size; i++) {
+    if (text[i] == '\0') return i;
+  }
+  return size;
+}
+
+static int char_width(const char *text, int size, uint8_t font) {
+  // oledStringWidthAdapter may step over a fixed number of bytes for
+  // multi-byte characters, keep the tail of the buffer zeroed
+  char c[8] = {0};
+  memcpy(c, text, size);
+  return oledStringWidthAdapter(c, font);
+}
+
+void text_layout_init(TextLayout *layout, const char *text, int width,
+                      uint8_t font) {
+  size_t pos = 0;
+  int x = 0;
+
+  layout->text = text;
+  layout->count = 0;
+  layout->truncated = false;
+  layout->start[0] = 0;
+
+  while (text[pos]) {
+    if (pos > UINT16_MAX - 8) {
+      layout->truncated = true;
+      break;
+    }
+    size_t next = pos;
+    if (text[pos] == '\n') {
+      next = pos + 1;
+    } else {
+      int size = char_size(text + pos);
+      int w = width > 0 ? char_width(text + pos, size, font) : 0;
+      if (x > 0 && x + w > width) {
+        next = pos;
+        x = 0;
+      } else {
+        x += w;
+        pos += size;
+        continue;
+      }
+    }
+    if (layout->count + 1 >= TEXT_LAYOUT_MAX_LINES) {
+      layout->truncated = true;
+      break;
+    }
+    layout->start[++layout->count] = next;
+    pos = next;
+    x = 0;
+  }
+  layout->start[++layout->count] = pos;
+}
+
+size_t text_layout_copy(const TextLayout *layout, int first, int count,
+                        char *buf, size_t size) {
+  if (size == 0) return 0;
+  buf[0] = '\0';
+  if (first < 0 || first >= layout->count || count <= 0) return 0;
+  int last = first + count;
+  if (last > layout->count) last = layout->count;
+
+  size_t begin = layout->start[first];
+  size_t end = layout->start[last];
+  // drop the line feed that ends the last copied line
+  if (end > begin && layout->text[end - 1] == '\n') end--;
+  size_t len = end - begin;
+  if (len > size - 1) len = size - 1;
+  memcpy(buf, layout->text + begin, len);
+  buf[len] = '\0';
+  return len;
+}
+
+void text_layout_draw(const TextLayout *layout, int x, int y, int first,
+                      int rows, int line_height, uint8_t font) {
+  char line[TEXT_LAYOUT_LINE_SIZE + 1];
+  for (int i = 0; i < rows; i++) {
+    if (text_layout_copy(layout, first + i, 1, line, sizeof(line))) {
+      oledDrawStringAdapter(x, y + i * line_height, line, font);
+    }
+  }
+}
@@ -0,0 +1,35 @@
+#ifndef __TEXT_LAYOUT_H__
+#define __TEXT_LAYOUT_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Line index of a text wrapped for the display. The text is measured once
+// when the layout is built; scrolling then only copies and draws the
+// visible lines. The text must stay valid while the layout is in use.
+// 512 lines hold a 5120 byte sign message shown as hex, 21 characters a line.
+#define TEXT_LAYOUT_MAX_LINES 512
+// longest line that text_layout_draw can render
+#define TEXT_LAYOUT_LINE_SIZE 128
+
+typedef struct {
+  const char *text;
+  uint16_t count;  // number of lines, at least 1
+  bool truncated;  // the text did not fit into TEXT_LAYOUT_MAX_LINES
+  // byte offset of each line, start[count] is the end of the laid out text
+  uint16_t start[TEXT_LAYOUT_MAX_LINES + 1];
+} TextLayout;
+
+// Breaks text at '\n' and wherever the next character would exceed width
+// pixels. A width <= 0 only breaks at '\n'.
+void text_layout_init(TextLayout *layout, const char *text, int width,
+                      uint8_t font);
+// Copies lines [first, first + count) as they appear in the text.
+size_t text_layout_copy(const TextLayout *layout, int first, int count,
+                        char *buf, size_t size);
+// Draws lines [first, first + rows), one every line_height pixels.
+void text_layout_draw(const TextLayout *layout, int x, int y, int first,
+                      int rows, int line_height, uint8_t font);
+
+#endif
@@ -147,6 +147,15 @@ bool ton_sign_message(const TonSignMessage *msg, const HDNode *node,
     return false;
   }
 
+  // a bag of cells may span many cells, a text comment has to fit in one
+  if (msg->has_comment && strlen(msg->comment) > TON_COMMENT_MAX_SIZE &&
+      (msg->jetton_amount_bytes.size != 0 ||
+       memcmp(msg->comment, "b5ee9c72", 8) != 0)) {
+    fsm_sendFailure(FailureType_Failure_ProcessError, "Comment too long");
+    layoutHome();
+    return false;
+  }
+
   // prepare body ref
   CellRef_t payload_data;
   CellRef_t *payload = &payload_data;
@@ -158,7 +167,7 @@ bool ton_sign_message(const TonSignMessage *msg, const HDNode *node,
   CellRef_t payload_ref_data;
   CellRef_t *payload_ref = &payload_ref_data;
 
-  unsigned char raw_data[1024];
+  static unsigned char raw_data[TON_BOC_MAX_SIZE];
   bool is_raw_data = false;
   size_t data_len = 0;
 
@@ -255,18 +264,25 @@ bool ton_sign_message(const TonSignMessage *msg, const HDNode *node,
       }
     }
 
+    bool body_created = false;
     if (!msg->has_comment) {
-      ton_create_jetton_transfer_body(
+      body_created = ton_create_jetton_transfer_body(
           parsed_dest.workchain, parsed_dest.hash,
           msg->jetton_amount_bytes.bytes, msg->jetton_amount_bytes.size, 0,
           NULL, parsed_resp.workchain, parsed_resp.hash, payload);
     } else {
-      ton_create_jetton_transfer_body(
+      body_created = ton_create_jetton_transfer_body(
           parsed_dest.workchain, parsed_dest.hash,
           msg->jetton_amount_bytes.bytes, msg->jetton_amount_bytes.size,
           msg->fwd_fee, msg->comment, parsed_resp.workchain, parsed_resp.hash,
           payload);
     }
+    if (!body_created) {
+      fsm_sendFailure(FailureType_Failure_ProcessError,
+                      "Failed to create jetton transfer body");
+      layoutHome();
+      return false;
+    }
   }
 
   const char *ext_destination_ptrs[3] = {NULL, NULL, NULL};
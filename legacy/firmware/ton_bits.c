@@ -9,7 +9,12 @@ void bitstring_init(BitString_t* self) {
   explicit_bzero(self->data, sizeof(self->data));
 }
 
-void bitstring_write_bit(BitString_t* self, int8_t v) {
+static bool bitstring_fits(const BitString_t* self, size_t bits) {
+  return self->data_cursor <= TON_CELL_MAX_BITS &&
+         bits <= (size_t)(TON_CELL_MAX_BITS - self->data_cursor);
+}
+
+static void bitstring_put_bit(BitString_t* self, int8_t v) {
   if (v > 0) {
     // this.#buffer[(n / 8) | 0] |= 1 << (7 - (n % 8));
     self->data[(self->data_cursor / 8) | 0] |=
@@ -22,14 +27,30 @@ void bitstring_write_bit(BitString_t* self, int8_t v) {
   self->data_cursor++;
 }
 
-void bitstring_write_uint(BitString_t* self, uint64_t v, uint8_t bits) {
+static void bitstring_put_uint(BitString_t* self, uint64_t v, uint8_t bits) {
   for (int i = 0; i < bits; i++) {
     int8_t b = (v >> (bits - i - 1)) & 0x01;
-    bitstring_write_bit(self, b);
+    bitstring_put_bit(self, b);
   }
 }
 
-void bitstring_write_coins(BitString_t* self, uint64_t v) {
+bool bitstring_write_bit(BitString_t* self, int8_t v) {
+  if (!bitstring_fits(self, 1)) {
+    return false;
+  }
+  bitstring_put_bit(self, v);
+  return true;
+}
+
+bool bitstring_write_uint(BitString_t* self, uint64_t v, uint8_t bits) {
+  if (!bitstring_fits(self, bits)) {
+    return false;
+  }
+  bitstring_put_uint(self, v, bits);
+  return true;
+}
+
+bool bitstring_write_coins(BitString_t* self, uint64_t v) {
   // Measure length
   uint8_t len = 0;
   uint64_t r = v;
@@ -41,44 +62,65 @@ void bitstring_write_coins(BitString_t* self, uint64_t v) {
       break;
     }
   }
+  if (!bitstring_fits(self, 4 + len * 8)) {
+    return false;
+  }
   // Write length
-  bitstring_write_uint(self, len, 4);
+  bitstring_put_uint(self, len, 4);
 
   // Write remaining
   for (int i = 0; i < len; i++) {
-    bitstring_write_uint(self, v >> ((len - i - 1) * 8), 8);
+    bitstring_put_uint(self, v >> ((len - i - 1) * 8), 8);
   }
+  return true;
 }
 
-void bitstring_write_coins_bytes(BitString_t* self, const uint8_t* v,
+bool bitstring_write_coins_bytes(BitString_t* self, const uint8_t* v,
                                  uint8_t length) {
   uint8_t effective_length = length;
   while (effective_length > 0 && v[length - effective_length] == 0) {
     effective_length--;
   }
+  // the length prefix is 4 bits wide
+  if (effective_length > 15 ||
+      !bitstring_fits(self, 4 + effective_length * 8)) {
+    return false;
+  }
 
-  bitstring_write_uint(self, effective_length, 4);
+  bitstring_put_uint(self, effective_length, 4);
 
   for (int i = 0; i < effective_length; i++) {
-    bitstring_write_uint(self, v[length - effective_length + i], 8);
+    bitstring_put_uint(self, v[length - effective_length + i], 8);
   }
+  return true;
 }
 
-void bitstring_write_buffer(BitString_t* self, uint8_t* v, uint8_t length) {
-  for (int i = 0; i < length; i++) {
-    bitstring_write_uint(self, v[i], 8);
+bool bitstring_write_buffer(BitString_t* self, const uint8_t* v,
+                            size_t length) {
+  if (length > TON_CELL_MAX_BITS / 8 || !bitstring_fits(self, length * 8)) {
+    return false;
   }
+  for (size_t i = 0; i < length; i++) {
+    bitstring_put_uint(self, v[i], 8);
+  }
+  return true;
 }
 
-void bitstring_write_address(BitString_t* self, uint8_t chain, uint8_t* hash) {
-  bitstring_write_uint(self, 2, 2);
-  bitstring_write_uint(self, 0, 1);
-  bitstring_write_uint(self, chain, CHAIN_LEN * 8);
-  bitstring_write_buffer(self, hash, HASH_LEN);
+bool bitstring_write_address(BitString_t* self, uint8_t chain, uint8_t* hash) {
+  if (!bitstring_fits(self, 2 + 1 + CHAIN_LEN * 8 + HASH_LEN * 8)) {
+    return false;
+  }
+  bitstring_put_uint(self, 2, 2);
+  bitstring_put_uint(self, 0, 1);
+  bitstring_put_uint(self, chain, CHAIN_LEN * 8);
+  for (int i = 0; i < HASH_LEN; i++) {
+    bitstring_put_uint(self, hash[i], 8);
+  }
+  return true;
 }
 
-void bitstring_write_null_address(BitString_t* self) {
-  bitstring_write_uint(self, 0, 2);
+bool bitstring_write_null_address(BitString_t* self) {
+  return bitstring_write_uint(self, 0, 2);
 }
 
 void bitstring_final(BitString_t* self) {
@@ -86,10 +128,10 @@ void bitstring_final(BitString_t* self) {
   if (padBytes > 0) {
     padBytes = 8 - padBytes;
     padBytes = padBytes - 1;
-    bitstring_write_bit(self, 1);
+    bitstring_put_bit(self, 1);
     while (padBytes > 0) {
       padBytes = padBytes - 1;
-      bitstring_write_bit(self, 0);
+      bitstring_put_bit(self, 0);
     }
   }
 }
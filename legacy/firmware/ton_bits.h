@@ -7,6 +7,8 @@
 
 #define CHAIN_LEN 1
 #define HASH_LEN 32
+// A cell holds at most 1023 data bits, data[] has room for the end marker.
+#define TON_CELL_MAX_BITS 1023
 
 typedef struct BitString_t {
   uint8_t data[128];
@@ -14,16 +16,19 @@ typedef struct BitString_t {
 } BitString_t;
 
 void bitstring_init(BitString_t* self);
-void bitstring_write_bit(BitString_t* self, int8_t v);
-void bitstring_write_uint(BitString_t* self, uint64_t v, uint8_t bits);
+// The writers return false and leave the cursor unchanged when the bits do
+// not fit in the cell.
+bool bitstring_write_bit(BitString_t* self, int8_t v);
+bool bitstring_write_uint(BitString_t* self, uint64_t v, uint8_t bits);
 
-void bitstring_write_coins(BitString_t* self, uint64_t v);
-void bitstring_write_coins_bytes(BitString_t* self, const uint8_t* v,
+bool bitstring_write_coins(BitString_t* self, uint64_t v);
+bool bitstring_write_coins_bytes(BitString_t* self, const uint8_t* v,
                                  uint8_t length);
-void bitstring_write_buffer(BitString_t* self, uint8_t* v, uint8_t length);
+bool bitstring_write_buffer(BitString_t* self, const uint8_t* v,
+                            size_t length);
 
-void bitstring_write_address(BitString_t* self, uint8_t chain, uint8_t* hash);
-void bitstring_write_null_address(BitString_t* self);
+bool bitstring_write_address(BitString_t* self, uint8_t chain, uint8_t* hash);
+bool bitstring_write_null_address(BitString_t* self);
 
 void bitstring_final(BitString_t* self);
 
@@ -0,0 +1,203 @@
+#include <string.h>
+
+#include "sha2.h"
+#include "ton_cell.h"
+
+static const uint8_t REACH_BOC_MAGIC_PREFIX[4] = {0xb5, 0xee, 0x9c, 0x72};
+
+// Bag of cells as produced by the TON SDKs: one root, no absent cells,
+// ordinary level 0 cells stored so that every reference points to a cell
+// further down. The index is built in one pass over the BOC and the cells
+// are then hashed from the last to the first, so each representation hash
+// is computed exactly once and read by its parents from the index.
+typedef struct {
+  uint16_t offset;  // cell descriptors in the BOC
+  uint8_t refs_count;
+  uint8_t refs[4];
+  CellRef_t cell_ref;  // depth and representation hash
+} BocCell_t;
+
+static BocCell_t boc_cells[TON_BOC_MAX_CELLS];
+
+static bool boc_read_uint(const uint8_t* boc, size_t boc_len, size_t* index,
+                          uint8_t size, uint32_t* out) {
+  if (size > boc_len - *index) {
+    return false;
+  }
+  *out = 0;
+  for (int i = 0; i < size; i++) {
+    *out = (*out << 8) | boc[(*index)++];
+  }
+  return true;
+}
+
+// Number of data bits of a cell, the last byte of an odd d2 holds the
+// completion tag.
+static bool boc_cell_bits(const uint8_t* data, uint8_t d2, uint16_t* bits) {
+  uint16_t data_bytes = (d2 + 1) / 2;
+  *bits = data_bytes * 8;
+  if ((d2 & 1) == 0) {
+    return true;
+  }
+  uint8_t last = data[data_bytes - 1];
+  if (last == 0) {
+    return false;
+  }
+  while ((last & 1) == 0) {
+    last >>= 1;
+    (*bits)--;
+  }
+  (*bits)--;
+  return true;
+}
+
+static void boc_hash_cell(const uint8_t* boc, BocCell_t* cell) {
+  const uint8_t* d = boc + cell->offset;
+  SHA256_CTX ctx;
+
+  // the serialized descriptors and data are the representation of an
+  // ordinary cell, completion tag included
+  sha256_Init(&ctx);
+  sha256_Update(&ctx, d, 2 + (d[1] + 1) / 2);
+
+  cell->cell_ref.max_depth = 0;
+  for (int i = 0; i < cell->refs_count; i++) {
+    uint16_t depth = boc_cells[cell->refs[i]].cell_ref.max_depth;
+    uint8_t mdd[2] = {depth / 256, depth % 256};
+    sha256_Update(&ctx, mdd, 2);
+    if (depth + 1 > cell->cell_ref.max_depth) {
+      cell->cell_ref.max_depth = depth + 1;
+    }
+  }
+  for (int i = 0; i < cell->refs_count; i++) {
+    sha256_Update(&ctx, boc_cells[cell->refs[i]].cell_ref.hash, HASH_LEN);
+  }
+  sha256_Final(&ctx, cell->cell_ref.hash);
+}
+
+bool ton_parse_boc(const uint8_t* input_boc, size_t input_boc_len,
+                   CellRef_t* payload, BitString_t* payload_bits,
+                   CellRef_t* payload_ref) {
+  const uint8_t* boc = input_boc;
+  size_t boc_len = input_boc_len;
+  size_t index = 0;
+
+  if (boc_len < 6 || boc_len > TON_BOC_MAX_SIZE) {
+    return false;
+  }
+
+  // Compare BOC with magic prefix
+  if (memcmp(boc, REACH_BOC_MAGIC_PREFIX, 4) != 0) {
+    return false;  // Does not match
+  }
+  index += 4;
+
+  // Parse BOC header
+  uint8_t flags_byte = boc[index++];
+  bool has_idx = flags_byte & 0x80;
+  bool has_crc32 = flags_byte & 0x40;
+  uint8_t size_bytes = flags_byte & 0x07;
+  uint8_t offset_bytes = boc[index++];
+  if (size_bytes < 1 || size_bytes > 4 || offset_bytes < 1 ||
+      offset_bytes > 4) {
+    return false;
+  }
+
+  uint32_t cells_num = 0, roots_num = 0, absent_num = 0;
+  uint32_t tot_cells_size = 0, root_cell_index = 0;
+  if (!boc_read_uint(boc, boc_len, &index, size_bytes, &cells_num) ||
+      !boc_read_uint(boc, boc_len, &index, size_bytes, &roots_num) ||
+      !boc_read_uint(boc, boc_len, &index, size_bytes, &absent_num) ||
+      !boc_read_uint(boc, boc_len, &index, offset_bytes, &tot_cells_size)) {
+    return false;
+  }
+  if (cells_num == 0 || cells_num > TON_BOC_MAX_CELLS) {
+    return false;
+  }
+  if (roots_num != 1 || absent_num != 0 ||
+      !boc_read_uint(boc, boc_len, &index, size_bytes, &root_cell_index) ||
+      root_cell_index >= cells_num) {
+    return false;
+  }
+  if (has_idx) {
+    // the offsets are recomputed while the cells are read
+    if ((size_t)cells_num * offset_bytes > boc_len - index) {
+      return false;
+    }
+    index += cells_num * offset_bytes;
+  }
+  if (tot_cells_size > boc_len - index ||
+      boc_len - index - tot_cells_size != (has_crc32 ? 4u : 0u)) {
+    return false;
+  }
+  size_t cells_end = index + tot_cells_size;
+
+  // First pass: index the cells
+  for (uint32_t i = 0; i < cells_num; i++) {
+    BocCell_t* cell = &boc_cells[i];
+    if (cells_end - index < 2) {
+      return false;
+    }
+    uint8_t d1 = boc[index];
+    uint8_t d2 = boc[index + 1];
+    // only ordinary level 0 cells without stored hashes
+    if (d1 > 4) {
+      return false;
+    }
+    uint16_t data_bytes = (d2 + 1) / 2;
+    if (data_bytes > cells_end - index - 2) {
+      return false;
+    }
+    uint16_t bits = 0;
+    if (!boc_cell_bits(boc + index + 2, d2, &bits)) {
+      return false;
+    }
+    cell->offset = index;
+    cell->refs_count = d1;
+    index += 2 + data_bytes;
+
+    for (int j = 0; j < cell->refs_count; j++) {
+      uint32_t ref_index = 0;
+      if (!boc_read_uint(boc, cells_end, &index, size_bytes, &ref_index)) {
+        return false;
+      }
+      // references only point forward, which also rules out cycles
+      if (ref_index <= i || ref_index >= cells_num) {
+        return false;
+      }
+      cell->refs[j] = ref_index;
+    }
+  }
+  if (index != cells_end) {
+    return false;
+  }
+
+  // Second pass: hash from the end, children are always done first
+  for (int i = cells_num - 1; i >= (int)root_cell_index; i--) {
+    boc_hash_cell(boc, &boc_cells[i]);
+  }
+
+  BocCell_t* root = &boc_cells[root_cell_index];
+  memcpy(payload, &root->cell_ref, sizeof(CellRef_t));
+  if (payload_bits != NULL) {
+    const uint8_t* d = boc + root->offset;
+    uint16_t data_bytes = (d[1] + 1) / 2;
+    bitstring_init(payload_bits);
+    memcpy(payload_bits->data, d + 2, data_bytes);
+    boc_cell_bits(d + 2, d[1], &payload_bits->data_cursor);
+    if (d[1] & 1) {
+      // drop the completion tag
+      uint16_t bits = payload_bits->data_cursor;
+      payload_bits->data[bits / 8] &= ~(0x80 >> (bits % 8));
+    }
+  }
+  if (payload_ref != NULL) {
+    if (root->refs_count > 0) {
+      memcpy(payload_ref, &boc_cells[root->refs[0]].cell_ref,
+             sizeof(CellRef_t));
+    } else {
+      memset(payload_ref, 0, sizeof(CellRef_t));
+    }
+  }
+  return true;
+}
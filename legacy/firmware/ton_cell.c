@@ -9,8 +9,6 @@
 #include "ton_cell.h"
 #include "util.h"
 
-static const uint8_t REACH_BOC_MAGIC_PREFIX[4] = {0xb5, 0xee, 0x9c, 0x72};
-
 bool ton_hash_cell(BitString_t* bits, CellRef_t* refs, uint8_t refs_count,
                    CellRef_t* out) {
   SHA256_CTX ctx;
@@ -66,7 +64,9 @@ bool ton_create_transfer_body(const char* memo, CellRef_t* payload) {
 
   bitstring_init(&bits);
   bitstring_write_uint(&bits, 0, 32);  // text comment tag
-  bitstring_write_buffer(&bits, (uint8_t*)memo, strlen(memo));
+  if (!bitstring_write_buffer(&bits, (const uint8_t*)memo, strlen(memo))) {
+    return false;  // does not fit in one cell
+  }
 
   ton_hash_cell(&bits, NULL, 0, payload);
 
@@ -88,7 +88,9 @@ bool ton_create_jetton_transfer_body(uint8_t dest_workchain, uint8_t* dest_hash,
   bitstring_init(&bits);
   bitstring_write_uint(&bits, 0xf8a7ea5, 32);  // jetton transfer op-code
   bitstring_write_uint(&bits, 0, 64);          // query id
-  bitstring_write_coins_bytes(&bits, jetton_value, jetton_value_len);
+  if (!bitstring_write_coins_bytes(&bits, jetton_value, jetton_value_len)) {
+    return false;
+  }
 
   bitstring_write_address(&bits, dest_workchain, dest_hash);  // to addr
   bitstring_write_address(&bits, resp_workchain, resp_hash);  // response addr
@@ -97,8 +99,10 @@ bool ton_create_jetton_transfer_body(uint8_t dest_workchain, uint8_t* dest_hash,
   bitstring_write_bit(&bits, 0);  // forward payload in this cell, not separate
   if (forward_payload != NULL && strlen(forward_payload) > 0) {
     bitstring_write_uint(&bits, 0x00000000, 32);  // text comment op-code
-    bitstring_write_buffer(&bits, (uint8_t*)forward_payload,
-                           strlen(forward_payload));
+    if (!bitstring_write_buffer(&bits, (const uint8_t*)forward_payload,
+                                strlen(forward_payload))) {
+      return false;
+    }
   }
   ton_hash_cell(&bits, NULL, 0, payload);
   return true;
@@ -131,14 +135,19 @@ bool build_message_ref(bool is_bounceable, uint8_t dest_workchain,
 
     bitstring_write_uint(&bits, 0x00000000,
                          32);  // text comment transfer op-code
-    bitstring_write_buffer(&bits, (uint8_t*)payload_str, strlen(payload_str));
+    if (!bitstring_write_buffer(&bits, (const uint8_t*)payload_str,
+                                strlen(payload_str))) {
+      return false;
+    }
 
     return ton_hash_cell(&bits, NULL, 0, out_message_ref);
 
   } else if (payload != NULL) {
     // check if raw data inline
     // if (false) {
-    if (bits.data_cursor + payload_bits->data_cursor <= 1023 && !is_jetton) {
+    if (bits.data_cursor + 2 + payload_bits->data_cursor <=
+            TON_CELL_MAX_BITS &&
+        !is_jetton) {
       bitstring_write_bit(&bits, 0);  // no state-init
       bitstring_write_bit(&bits, 0);  // body in line
 
@@ -265,165 +274,3 @@ bool ton_create_message_digest(
   memcpy(digest, orderRef.hash, HASH_LEN);
   return true;
 }
-
-void set_top_upped_array(uint8_t* array, size_t array_len,
-                         bool fullfilled_bytes, uint16_t* cursor) {
-  *cursor =
-      array_len * 8;  // Initialize cursor to the length of the array times 8
-
-  if (fullfilled_bytes || array_len == 0) {
-    return;  // If it's a fully filled byte or the array is empty, return
-             // directly
-  }
-
-  // Start from the end, check up to 7 bits
-  for (int i = 0; i < 7; i++) {
-    (*cursor)--;
-    size_t byte_index = *cursor / 8;
-
-    if ((array[byte_index] & (1 << i)) != 0) {
-      // Found a bit set to 1, set it to 0
-      array[byte_index] &= ~(1 << i);
-
-      return;
-    }
-  }
-
-  // If no bit set to 1 is found within 7 bits, throw an error
-  fsm_sendFailure(FailureType_Failure_ProcessError, "Invalid top-upped array");
-}
-
-bool ton_parse_boc(const uint8_t* input_boc, size_t input_boc_len,
-                   CellRef_t* payload, BitString_t* payload_bits,
-                   CellRef_t* payload_ref) {
-  if (input_boc_len < 5 || input_boc_len > 1024) {
-    return false;
-  }
-
-  // Compare BOC with magic prefix
-  if (memcmp(input_boc, REACH_BOC_MAGIC_PREFIX, 4) != 0) {
-    return false;  // Does not match
-  }
-
-  // Record BOC data
-  uint8_t boc[input_boc_len];
-  memcpy(boc, input_boc, input_boc_len);
-
-  size_t index = 0;
-  index += 4;  // Remove the first four bytes of the BOC prefix
-
-  // Parse BOC header
-  uint8_t flags_byte = boc[index++];
-  bool has_idx = flags_byte & 0x80;
-  // bool hash_crc32 = flags_byte & 0x40;
-  // bool has_cache_bits = flags_byte & 0x20;
-  // uint8_t flags = ((flags_byte & 0x10) << 1) | (flags_byte & 0x08);
-  uint8_t size_bytes = flags_byte & 0x07;
-
-  // Read offset_bytes
-  uint8_t offset_bytes = boc[index++];
-
-  // Read cells_num
-  uint32_t cells_num = 0;
-  for (int i = 0; i < size_bytes; i++) {
-    cells_num = (cells_num << 8) | boc[index++];
-  }
-
-  if (cells_num > 4) {
-    fsm_sendFailure(FailureType_Failure_ProcessError, "Invalid cells number");
-    return false;
-  }
-
-  // Read roots_num
-  uint32_t roots_num = 0;
-  for (int i = 0; i < size_bytes; i++) {
-    roots_num = (roots_num << 8) | boc[index++];
-  }
-
-  // Read absent_num
-  uint32_t absent_num = 0;
-  for (int i = 0; i < size_bytes; i++) {
-    absent_num = (absent_num << 8) | boc[index++];
-  }
-
-  // Read tot_cells_size
-  uint32_t tot_cells_size = 0;
-  for (int i = 0; i < offset_bytes; i++) {
-    tot_cells_size = (tot_cells_size << 8) | boc[index++];
-  }
-
-  // Read root list (always zero)
-  uint32_t root_cell_index = 0;
-  if (roots_num > 0) {
-    for (int i = 0; i < size_bytes; i++) {
-      root_cell_index = (root_cell_index << 8) | boc[index++];
-    }
-  }
-
-  if (has_idx) index += cells_num * offset_bytes;
-
-  // First pass: Record data and references for each cell
-  CellData_t cell_data[cells_num];
-  for (uint32_t i = 0; i < cells_num; i++) {
-    bitstring_init(&cell_data[i].bits);
-    uint8_t d1 = boc[index++];
-    uint8_t d2 = boc[index++];
-
-    cell_data[i].refs_count = d1 & 0x07;
-    uint16_t data_bytes = (d2 + 1) / 2;
-    bool is_fullfilled_bytes = !(d2 & 1);
-
-    // Read cell data
-    memcpy(cell_data[i].bits.data, &boc[index], data_bytes);
-    index += data_bytes;
-
-    uint16_t data_cursor;
-    set_top_upped_array(cell_data[i].bits.data, data_bytes, is_fullfilled_bytes,
-                        &data_cursor);
-    cell_data[i].bits.data_cursor = data_cursor;
-
-    if (i == 0) {
-      memcpy(payload_bits->data, cell_data[i].bits.data, data_bytes);
-      payload_bits->data_cursor = data_cursor;
-    }
-
-    // Read reference indices
-    for (int j = 0; j < cell_data[i].refs_count; j++) {
-      uint32_t ref_index = 0;
-      for (int k = 0; k < offset_bytes; k++) {
-        ref_index = (ref_index << 8) | boc[index++];
-      }
-      cell_data[i].ref_indices[j] = ref_index;
-    }
-  }
-
-  // Second pass: Calculate hash from the end
-  for (int i = cells_num - 1; i >= 0; i--) {
-    CellRef_t refs[cell_data[i].refs_count];
-    for (int j = 0; j < cell_data[i].refs_count; j++) {
-      refs[j] = cell_data[cell_data[i].ref_indices[j]].cell_ref;
-    }
-
-    if (!ton_hash_cell(&cell_data[i].bits, refs, cell_data[i].refs_count,
-                       &cell_data[i].cell_ref)) {
-      fsm_sendFailure(FailureType_Failure_ProcessError, "Hash cell failed");
-      return false;
-    }
-
-    if (i == 1) {
-      memcpy(payload_ref, &cell_data[i].cell_ref, sizeof(CellRef_t));
-    }
-  }
-
-  // Assign the value of cell[0] to payload
-  if (cells_num > 0) {
-    CellRef_t temp_payload = cell_data[0].cell_ref;
-    memcpy(payload, &temp_payload, sizeof(CellRef_t));
-  } else {
-    // If no cells found in BOC, return false to indicate failure
-    fsm_sendFailure(FailureType_Failure_ProcessError, "No cells found in BOC");
-    return false;
-  }
-
-  return true;
-}
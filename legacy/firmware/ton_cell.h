@@ -5,12 +5,11 @@ typedef struct CellRef_t {
   uint8_t hash[HASH_LEN];
 } CellRef_t;
 
-typedef struct {
-  BitString_t bits;
-  uint32_t ref_indices[4];  // max ref = 4
-  uint8_t refs_count;
-  CellRef_t cell_ref;
-} CellData_t;
+// Largest bag of cells ton_parse_boc accepts.
+#define TON_BOC_MAX_SIZE 4096
+#define TON_BOC_MAX_CELLS 64
+// Text comments are sent in a single cell after the 32-bit comment tag.
+#define TON_COMMENT_MAX_SIZE ((TON_CELL_MAX_BITS - 32) / 8)
 
 bool ton_create_transfer_body(const char* memo, CellRef_t* payload);
 
@@ -3,15 +3,25 @@
 
 #define TON_TOKENS_COUNT 2
 const TonTokenType ton_tokens[TON_TOKENS_COUNT + 1] = {
-    {"EQCxE6mUtQJKFnGfaROTKOt1lZbDiiX1kCixRv7Nw2Id_sDs", " USDT", 6},
     {"EQAvlWFDxGF2lXm67y4yzC17wYKD9A0guwPkMs1gOsM__NOT", " NOT", 9},
+    {"EQCxE6mUtQJKFnGfaROTKOt1lZbDiiX1kCixRv7Nw2Id_sDs", " USDT", 6},
     {"FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFF", " UNKN", 0},
 };
 
+// ton_tokens[] is sorted by address, the UNKN entry stays last
 ConstTonTokenPtr ton_get_token_by_address(const char *address) {
-  for (int i = 0; i < TON_TOKENS_COUNT; i++) {
-    if (memcmp(address, ton_tokens[i].address, 48) != 0) continue;
-    return &ton_tokens[i];
+  int lo = 0, hi = TON_TOKENS_COUNT;
+  while (lo < hi) {
+    int mid = (lo + hi) / 2;
+    if (memcmp(ton_tokens[mid].address, address, 48) < 0) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo < TON_TOKENS_COUNT &&
+      memcmp(address, ton_tokens[lo].address, 48) == 0) {
+    return &ton_tokens[lo];
   }
 
   return &ton_tokens[TON_TOKENS_COUNT];  // UNKN TOKEN
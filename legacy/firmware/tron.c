@@ -28,6 +28,7 @@
 #include "gettext.h"
 #include "layout2.h"
 #include "memzero.h"
+#include "message_signer.h"
 #include "messages.h"
 #include "protect.h"
 #include "se_chip.h"
@@ -54,6 +55,24 @@ void tron_message_hash(const uint8_t *message, size_t message_len,
   keccak_Final(&ctx, hash);
 }
 
+static bool tron_message_sign_digest(const HDNode *node, const uint8_t hash[32],
+                                     uint8_t signature[65]) {
+  uint8_t v;
+#if EMULATOR
+  if (ecdsa_sign_digest(&secp256k1, node->private_key, hash, signature, &v,
+                        ethereum_is_canonic) != 0) {
+#else
+  if (hdnode_sign_digest((HDNode *)node, hash, signature, &v,
+                         ethereum_is_canonic) != 0) {
+#endif
+    fsm_sendFailure(FailureType_Failure_ProcessError, "Signing failed");
+    return false;
+  }
+
+  signature[64] = 27 + v;
+  return true;
+}
+
 void tron_message_sign(TronSignMessage *msg, const HDNode *node,
                        TronMessageSignature *resp) {
   uint8_t hash[32];
@@ -67,23 +86,46 @@ void tron_message_sign(TronSignMessage *msg, const HDNode *node,
 
   tron_message_hash(msg_hash, 32, hash);
 
-  uint8_t v;
-#if EMULATOR
-  if (ecdsa_sign_digest(&secp256k1, node->private_key, hash,
-                        resp->signature.bytes, &v, ethereum_is_canonic) != 0) {
-#else
-  if (hdnode_sign_digest(node, hash, resp->signature.bytes, &v,
-                         ethereum_is_canonic) != 0) {
-#endif
-    fsm_sendFailure(FailureType_Failure_ProcessError, "Signing failed");
+  if (!tron_message_sign_digest(node, hash, resp->signature.bytes)) {
     return;
   }
-
-  resp->signature.bytes[64] = 27 + v;
   resp->signature.size = 65;
   msg_write(MessageType_MessageType_TronMessageSignature, resp);
 }
 
+// The message signer has hashed the message, sign the hash of that.
+static void tron_message_digest(uint8_t hash[32]) {
+  uint8_t msg_hash[32];
+  memcpy(msg_hash, hash, sizeof(msg_hash));
+  tron_message_hash(msg_hash, sizeof(msg_hash), hash);
+}
+
+static void send_message_signature(const HDNode *node, const char *signer_str,
+                                   const uint8_t digest[32]) {
+  TronMessageSignature resp = {0};
+  if (!tron_message_sign_digest(node, digest, resp.signature.bytes)) {
+    return;
+  }
+  resp.signature.size = 65;
+  resp.address.size = strlen(signer_str);
+  memcpy(resp.address.bytes, signer_str, resp.address.size);
+  msg_write(MessageType_MessageType_TronMessageSignature, &resp);
+}
+
+static const MessageSignerOps tron_message_signer_ops = {
+    .chain_name = "Tron",
+    .hasher = HASHER_SHA3K,
+    .digest = tron_message_digest,
+    .sign = send_message_signature,
+};
+
+void tron_message_sign_init(const TronSignMessage *msg, const HDNode *node,
+                            const char *address) {
+  message_signer_init(&tron_message_signer_ops, node, address, NULL, 0,
+                      msg->data_length, msg->message.bytes,
+                      msg->message.size);
+}
+
 int tron_eth_2_trx_address(const uint8_t eth_address[20], char *str,
                            int strsize) {
   uint8_t address_bytes[21];
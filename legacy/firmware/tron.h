@@ -28,6 +28,9 @@
 
 void tron_message_sign(TronSignMessage *msg, const HDNode *node,
                        TronMessageSignature *resp);
+// Signs a message sent in chunks, see message_signer.h.
+void tron_message_sign_init(const TronSignMessage *msg, const HDNode *node,
+                            const char *address);
 int tron_eth_2_trx_address(const uint8_t eth_address[20], char *str,
                            int strsize);
 bool tron_sign_tx(TronSignTx *msg, const char *owner_address,
@@ -0,0 +1,50 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "u2f_counter.h"
+#include "se_chip.h"
+#include "secbool.h"
+
+static uint32_t u2f_counter_value = 0;
+static uint32_t u2f_counter_left = 0;
+
+uint32_t u2f_counter_next(void) {
+  uint32_t u2fcounter = 0;
+  if (u2f_counter_left > 0) {
+    u2f_counter_left--;
+    return u2f_counter_value++;
+  }
+  if (sectrue != se_get_u2f_next_counter(&u2fcounter)) {
+    return u2fcounter;
+  }
+  // The end of the block goes to the SE before any of it is handed out.
+  if (u2fcounter <= UINT32_MAX - (U2F_COUNTER_BLOCK - 1) &&
+      sectrue == se_set_u2f_counter(u2fcounter + (U2F_COUNTER_BLOCK - 1))) {
+    u2f_counter_value = u2fcounter + 1;
+    u2f_counter_left = U2F_COUNTER_BLOCK - 1;
+  }
+  return u2fcounter;
+}
+
+void u2f_counter_set(uint32_t u2fcounter) {
+  u2f_counter_left = 0;
+  se_set_u2f_counter(u2fcounter);
+}
+
+void u2f_counter_drop_block(void) { u2f_counter_left = 0; }
@@ -0,0 +1,38 @@
+/*
+ * This file is part of the OneKey project, https://onekey.so/
+ *
+ * Copyright (C) 2024 OneKey Team <core@onekey.so>
+ *
+ * This library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this library.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __U2F_COUNTER_H__
+#define __U2F_COUNTER_H__
+
+#include <stdint.h>
+
+/*
+ * FIDO counter values are reserved from the SE in blocks, so that most
+ * authentications do not write the SE. The SE holds the last value of the
+ * current block, so after a power loss counting resumes above every value
+ * that was handed out.
+ */
+#define U2F_COUNTER_BLOCK 32
+
+uint32_t u2f_counter_next(void);
+void u2f_counter_set(uint32_t u2fcounter);
+// Forgets the rest of the block, the next value comes from the SE again.
+void u2f_counter_drop_block(void);
+
+#endif
@@ -1,146 +1,146 @@
 // clang-format off
 #include "bitmaps.h"
 
-const uint8_t bmp_Icon_bc_data[] = { 0x00, 0x00, 0xff, 0x00, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x00, 0x3f, 0x81, 0xfc, 0x00, 0x00, 0x70, 0x00, 0x0e, 0x00, 0x01, 0xc0, 0x00, 0x03, 0x80, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x0e, 0x00, 0x00, 0x00, 0x70, 0x0c, 0x00, 0x00, 0x00, 0x30, 0x1c, 0x00, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x00, 0x1c, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x60, 0xff, 0x00, 0x78, 0x06, 0x60, 0xff, 0x81, 0xfe, 0x06, 0x60, 0xc1, 0xc3, 0x8f, 0x06, 0xe0, 0xc0, 0xc7, 0x03, 0x87, 0xc0, 0xc0, 0xc6, 0x01, 0x03, 0xc0, 0xc1, 0xce, 0x00, 0x03, 0xc0, 0xff, 0x0c, 0x00, 0x03, 0xc0, 0xff, 0x8c, 0x00, 0x03, 0xc0, 0xc1, 0xce, 0x00, 0x03, 0xc0, 0xc0, 0xc6, 0x01, 0x03, 0xe0, 0xc0, 0xc7, 0x03, 0x87, 0x60, 0xc1, 0xc3, 0x87, 0x06, 0x60, 0xff, 0x81, 0xfe, 0x06, 0x60, 0xff, 0x00, 0x78, 0x06, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x30, 0x00, 0x00, 0x00, 0x0c, 0x38, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x38, 0x0c, 0x00, 0x00, 0x00, 0x30, 0x0e, 0x00, 0x00, 0x00, 0x70, 0x07, 0x00, 0x00, 0x00, 0xe0, 0x03, 0x80, 0x00, 0x01, 0xc0, 0x01, 0xc0, 0x00, 0x03, 0x80, 0x00, 0x70, 0x00, 0x0e, 0x00, 0x00, 0x3f, 0x81, 0xfc, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, };
-const uint8_t bmp_Icon_ce_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc0, 0x01, 0xf0, 0x00, 0x1f, 0xc0, 0x07, 0xf0, 0x00, 0x7f, 0xc0, 0x1f, 0xf0, 0x00, 0xfc, 0x00, 0x3f, 0x00, 0x01, 0xf0, 0x00, 0x7c, 0x00, 0x01, 0xe0, 0x00, 0x78, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x0e, 0x00, 0x03, 0x80, 0x00, 0x0e, 0x00, 0x03, 0xff, 0x80, 0x0e, 0x00, 0x03, 0xff, 0x80, 0x0e, 0x00, 0x03, 0xff, 0x80, 0x0f, 0x00, 0x03, 0x80, 0x00, 0x07, 0x00, 0x01, 0xc0, 0x00, 0x07, 0x80, 0x01, 0xe0, 0x00, 0x03, 0x80, 0x00, 0xe0, 0x00, 0x03, 0xc0, 0x00, 0xf0, 0x00, 0x01, 0xf0, 0x00, 0x7c, 0x00, 0x00, 0xfc, 0x00, 0x3f, 0x00, 0x00, 0x7f, 0xc0, 0x1f, 0xf0, 0x00, 0x1f, 0xc0, 0x07, 0xf0, 0x00, 0x07, 0xc0, 0x01, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
-const uint8_t bmp_Icon_fc_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xfe, 0x00, 0xf8, 0x00, 0x07, 0xfe, 0x03, 0xfe, 0x00, 0x07, 0xfe, 0x0f, 0xff, 0x00, 0x0f, 0xfe, 0x1f, 0x0f, 0xc0, 0x0f, 0x00, 0x3c, 0x03, 0xe0, 0x0f, 0x00, 0x78, 0xf8, 0xf0, 0x0f, 0x00, 0xf3, 0xfc, 0x70, 0x0f, 0x00, 0xf7, 0x8f, 0x00, 0x0f, 0x01, 0xe6, 0x03, 0x80, 0x0f, 0x01, 0xce, 0x00, 0x00, 0x0f, 0xff, 0xcc, 0x00, 0x00, 0x0f, 0xff, 0xdc, 0x00, 0x00, 0x0f, 0xff, 0xdc, 0x00, 0x00, 0x0f, 0x01, 0xce, 0x00, 0x00, 0x0f, 0x01, 0xce, 0x03, 0x80, 0x0f, 0x00, 0xe7, 0x07, 0x00, 0x0f, 0x00, 0xf3, 0xfe, 0x70, 0x0f, 0x00, 0x71, 0xf8, 0xf0, 0x0f, 0x00, 0x78, 0x01, 0xe0, 0x0f, 0x00, 0x3e, 0x07, 0xc0, 0x0f, 0x00, 0x1f, 0xff, 0x80, 0x0f, 0x00, 0x07, 0xfe, 0x00, 0x0f, 0x00, 0x01, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
-const uint8_t bmp_Icon_weee_data[] = { 0x80, 0x00, 0x00, 0x00, 0x02, 0x40, 0x00, 0x00, 0x00, 0x04, 0x20, 0x00, 0x3e, 0x00, 0x08, 0x10, 0x07, 0xf3, 0xe0, 0x10, 0x08, 0x0f, 0x3f, 0x70, 0x20, 0x04, 0x16, 0x00, 0x0e, 0x40, 0x02, 0x3f, 0xff, 0xfe, 0x80, 0x01, 0x10, 0x00, 0x09, 0x00, 0x00, 0x90, 0x00, 0x0a, 0x00, 0x00, 0x50, 0x00, 0x0e, 0x00, 0x00, 0x30, 0x00, 0x0c, 0x00, 0x00, 0x10, 0x00, 0x18, 0x00, 0x00, 0x18, 0x00, 0x2e, 0x00, 0x00, 0x1c, 0x3f, 0x48, 0x00, 0x00, 0x1a, 0x3f, 0x88, 0x00, 0x00, 0x19, 0x01, 0x08, 0x00, 0x00, 0x08, 0x82, 0x18, 0x00, 0x00, 0x08, 0x44, 0x18, 0x00, 0x00, 0x08, 0x28, 0x10, 0x00, 0x00, 0x08, 0x10, 0x10, 0x00, 0x00, 0x08, 0x28, 0x10, 0x00, 0x00, 0x08, 0x44, 0x10, 0x00, 0x00, 0x08, 0x82, 0x10, 0x00, 0x00, 0x09, 0x01, 0x10, 0x00, 0x00, 0x0e, 0x00, 0x90, 0x00, 0x00, 0x04, 0x00, 0x50, 0x00, 0x00, 0x0c, 0x00, 0x30, 0x00, 0x00, 0x14, 0x00, 0x10, 0x00, 0x00, 0x24, 0x00, 0x18, 0x00, 0x00, 0x44, 0x00, 0x74, 0x00, 0x00, 0x84, 0x00, 0xda, 0x00, 0x01, 0x04, 0x01, 0x8d, 0x00, 0x02, 0x04, 0x01, 0x24, 0x80, 0x04, 0x07, 0xff, 0x8c, 0x40, 0x08, 0x02, 0x00, 0xd8, 0x20, 0x10, 0x02, 0x00, 0x70, 0x10, 0x20, 0x00, 0x00, 0x00, 0x08, 0x40, 0x00, 0x00, 0x00, 0x04, 0x80, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, };
-const uint8_t bmp_anatel_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x00, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x03, 0xcf, 0xfe, 0x00, 0x00, 0x06, 0x03, 0xff, 0x00, 0x00, 0x08, 0x01, 0xff, 0x80, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x1e, 0x00, 0x7f, 0xe0, 0x00, 0x7f, 0x80, 0x7f, 0xf0, 0x00, 0xff, 0xc0, 0x7f, 0xf0, 0x00, 0xff, 0xc0, 0xff, 0xf0, 0x01, 0xff, 0xe0, 0xff, 0xe0, 0x03, 0xff, 0xf0, 0xff, 0xe0, 0x03, 0xff, 0xf0, 0xff, 0xc0, 0x03, 0xff, 0xf1, 0xff, 0xc0, 0x01, 0xff, 0xe1, 0xff, 0xc0, 0x00, 0xff, 0xc3, 0xff, 0xc0, 0x00, 0xff, 0xc7, 0xff, 0xc0, 0x00, 0x7f, 0x8f, 0xff, 0x80, 0x00, 0x1e, 0x1f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x11, 0x09, 0xf7, 0xd8, 0x07, 0x11, 0x18, 0x46, 0x10, 0x0b, 0x3b, 0x2c, 0xc4, 0x30, 0x19, 0x2a, 0x64, 0xcf, 0x30, 0x1f, 0x6e, 0x4c, 0x8c, 0x20, 0x33, 0x46, 0xfd, 0x98, 0x60, 0x63, 0x45, 0x8d, 0x9f, 0x7c, };
-const uint8_t bmp_arrow_down_w5_data[] = { 0x44, 0x28, 0x10, };
-const uint8_t bmp_arrow_up_w5_data[] = { 0x10, 0x28, 0x44, };
-const uint8_t bmp_boot_icon_data[] = { 0x01, 0xff, 0x80, 0x07, 0xff, 0xe0, 0x1f, 0xff, 0xf8, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0x7f, 0xc7, 0xfe, 0x7f, 0x87, 0xfe, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0x81, 0xff, 0xff, 0x98, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x18, 0xff, 0x7f, 0x81, 0xfe, 0x7f, 0xc3, 0xfe, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0x1f, 0xff, 0xf8, 0x07, 0xff, 0xe0, 0x01, 0xff, 0x80, };
-const uint8_t bmp_bottom_left_arrow_data[] = { 0x1f, 0xf8, 0x7f, 0xf8, 0x7c, 0xf8, 0xf9, 0xf8, 0xf3, 0xf8, 0xe0, 0x18, 0xf3, 0xf8, 0xf9, 0xf8, 0x7c, 0xf8, 0x7f, 0xf8, 0x1f, 0xf8, };
-const uint8_t bmp_bottom_left_close_data[] = { 0x1f, 0xfc, 0x7f, 0xfc, 0x7b, 0xbc, 0xf1, 0x1c, 0xf8, 0x3c, 0xfc, 0x7c, 0xf8, 0x3c, 0xf1, 0x1c, 0x7b, 0xbc, 0x7f, 0xfc, 0x1f, 0xfc, };
-const uint8_t bmp_bottom_left_delete_data[] = { 0x1f, 0xfe, 0x7f, 0xfe, 0x78, 0x0e, 0xf2, 0x2e, 0xe1, 0x4e, 0xc0, 0x8e, 0xe1, 0x4e, 0xf2, 0x2e, 0x78, 0x0e, 0x7f, 0xfe, 0x1f, 0xfe, };
-const uint8_t bmp_bottom_left_qrcode_data[] = { 0x1f, 0xfc, 0x7f, 0xfc, 0x70, 0x5c, 0xf7, 0x5c, 0xf5, 0x3c, 0xf7, 0x5c, 0xf0, 0x3c, 0xfd, 0x5c, 0x72, 0x9c, 0x7f, 0xfc, 0x1f, 0xfc, };
-const uint8_t bmp_bottom_middle_arrow_down_data[] = { 0x82, 0x44, 0x28, 0x10, };
-const uint8_t bmp_bottom_middle_arrow_up_data[] = { 0x08, 0x14, 0x22, 0x41, };
-const uint8_t bmp_bottom_right_arrow_data[] = { 0x1f, 0xf8, 0x1f, 0xfe, 0x1f, 0x3e, 0x1f, 0x9f, 0x1f, 0xcf, 0x18, 0x07, 0x1f, 0xcf, 0x1f, 0x9f, 0x1f, 0x3e, 0x1f, 0xfe, 0x1f, 0xf8, };
-const uint8_t bmp_bottom_right_arrow_off_data[] = { 0x15, 0x50, 0x00, 0x04, 0x10, 0xc2, 0x00, 0x60, 0x10, 0x31, 0x07, 0xf8, 0x10, 0x31, 0x00, 0x60, 0x10, 0xc2, 0x00, 0x04, 0x15, 0x50, };
-const uint8_t bmp_bottom_right_change_data[] = { 0x3f, 0xf8, 0x3f, 0xfe, 0x3f, 0xbe, 0x3c, 0x1f, 0x3b, 0x8f, 0x3e, 0xbf, 0x38, 0xef, 0x3c, 0x1f, 0x3e, 0xfe, 0x3f, 0xfe, 0x3f, 0xf8, };
-const uint8_t bmp_bottom_right_confirm_data[] = { 0x3f, 0xf8, 0x3f, 0xfe, 0x3f, 0xee, 0x3f, 0xc7, 0x3b, 0x8f, 0x31, 0x1f, 0x38, 0x3f, 0x3c, 0x7f, 0x3e, 0xfe, 0x3f, 0xfe, 0x3f, 0xf8, };
-const uint8_t bmp_bottom_right_confirm_off_data[] = { 0x2a, 0xa8, 0x00, 0x02, 0x20, 0x10, 0x00, 0x39, 0x24, 0x70, 0x0e, 0xe1, 0x27, 0xc0, 0x03, 0x81, 0x21, 0x00, 0x00, 0x02, 0x2a, 0xa8, };
-const uint8_t bmp_bottom_right_next_data[] = { 0x3f, 0xf8, 0x3f, 0xfe, 0x3f, 0xbe, 0x3f, 0x9f, 0x3e, 0x0f, 0x38, 0x07, 0x30, 0x0f, 0x33, 0x9f, 0x37, 0xbe, 0x3f, 0xfe, 0x3f, 0xf8, };
-const uint8_t bmp_bottom_right_power_off_data[] = { 0x0f, 0xf8, 0x0f, 0xfe, 0x0f, 0xbe, 0x0e, 0xaf, 0x0d, 0xb7, 0x0d, 0xb7, 0x0d, 0xf7, 0x0e, 0xef, 0x0f, 0x1e, 0x0f, 0xfe, 0x0f, 0xf8, };
-const uint8_t bmp_bottom_right_retry_data[] = { 0x1f, 0xf8, 0x1f, 0xfe, 0x1e, 0xfe, 0x1c, 0xff, 0x18, 0x0f, 0x1c, 0xf7, 0x1e, 0xf7, 0x1f, 0xf7, 0x1f, 0x0e, 0x1f, 0xfe, 0x1f, 0xf8, };
-const uint8_t bmp_btn_back_data[] = { 0x00, 0x0c, 0x1c, 0x3c, 0x7c, 0x3c, 0x1c, 0x0c, };
+const uint8_t bmp_Icon_bc_data[] = { 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0e, 0x0c, 0x18, 0x30, 0x30, 0x20, 0x60, 0x60, 0x60, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0x60, 0x60, 0x60, 0x20, 0x30, 0x30, 0x18, 0x0c, 0x0e, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x3f, 0x78, 0xe0, 0xc0, 0x00, 0x00, 0x07, 0x07, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x06, 0x06, 0x06, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00, 0xc0, 0xe0, 0x78, 0x3f, 0x07, 0x00, 0xff, 0xff, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0xef, 0xe7, 0x00, 0x00, 0x3c, 0xff, 0xe7, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xc3, 0x81, 0x00, 0x00, 0x00, 0x00, 0x81, 0xff, 0xff, 0x00, 0xe0, 0xfc, 0x1e, 0x07, 0x03, 0x00, 0x00, 0xe0, 0xe0, 0x60, 0x60, 0x60, 0x60, 0x60, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0x60, 0x60, 0x60, 0x60, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x03, 0x07, 0x1e, 0xfc, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xe0, 0x70, 0x30, 0x18, 0x0c, 0x0c, 0x04, 0x06, 0x06, 0x06, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0x06, 0x06, 0x06, 0x04, 0x0c, 0x0c, 0x18, 0x30, 0x70, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x00, };
+const uint8_t bmp_Icon_ce_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x1f, 0x3c, 0x3c, 0x78, 0x70, 0xf0, 0xe0, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x1f, 0x3c, 0x3c, 0x78, 0x70, 0xf0, 0xe0, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xc3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0xff, 0xff, 0xdd, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf0, 0xf8, 0x3c, 0x1c, 0x1e, 0x0e, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf0, 0xf8, 0x3c, 0x1c, 0x1e, 0x0e, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
+const uint8_t bmp_Icon_fc_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x7f, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0x00, 0x03, 0x07, 0x0f, 0x1f, 0x3c, 0x39, 0x73, 0x73, 0xe7, 0xe6, 0xe6, 0xe6, 0xf7, 0x73, 0x79, 0x39, 0x1c, 0x1e, 0x0e, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0x38, 0xfe, 0xff, 0xff, 0x81, 0x18, 0x7e, 0xff, 0xc7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0x83, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfe, 0xfe, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xe0, 0xf0, 0xf8, 0x38, 0x1c, 0x9c, 0xce, 0xce, 0xce, 0xce, 0xce, 0xce, 0x9c, 0x9c, 0x38, 0x78, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
+const uint8_t bmp_Icon_weee_data[] = { 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, 0x00, 0x02, 0x07, 0x0a, 0x1e, 0x1e, 0x1a, 0x12, 0x12, 0x3a, 0x3a, 0x2a, 0x2a, 0x3a, 0x1a, 0x12, 0x1a, 0x1a, 0x0a, 0x07, 0x06, 0x06, 0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x40, 0x20, 0xff, 0x0f, 0x04, 0x02, 0x01, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06, 0x07, 0x02, 0x04, 0x08, 0x10, 0xff, 0x68, 0xc8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x00, 0x00, 0x01, 0x82, 0x44, 0x28, 0x10, 0x28, 0x44, 0x82, 0x01, 0x00, 0x00, 0x00, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0xa0, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x83, 0x46, 0x24, 0xfe, 0x0b, 0x05, 0x02, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x70, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0x40, 0xc0, 0x60, 0x30, 0x90, 0x30, 0x60, 0xc0, 0x00, 0x00, 0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, };
+const uint8_t bmp_anatel_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x04, 0x0c, 0x08, 0x18, 0x18, 0x30, 0x30, 0x38, 0x78, 0x7c, 0x7e, 0x7f, 0x7f, 0x7f, 0x3f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x0f, 0x0f, 0x1f, 0x1f, 0x1f, 0x1f, 0x0f, 0x0f, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xf0, 0xe1, 0x03, 0x07, 0x0f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0e, 0x1c, 0x24, 0x77, 0x3f, 0x00, 0x07, 0x1c, 0x70, 0x1c, 0x07, 0x1e, 0x71, 0x03, 0x0e, 0x1a, 0x22, 0x77, 0x1f, 0x00, 0x43, 0x5f, 0x78, 0x40, 0x43, 0x0f, 0x7d, 0x69, 0x49, 0x40, 0x43, 0x1f, 0x79, 0x41, 0x01, 0x00, 0x00, };
+const uint8_t bmp_arrow_down_w5_data[] = { 0x00, 0x80, 0x40, 0x20, 0x40, 0x80, 0x00, 0x00, };
+const uint8_t bmp_arrow_up_w5_data[] = { 0x00, 0x20, 0x40, 0x80, 0x40, 0x20, 0x00, 0x00, };
+const uint8_t bmp_boot_icon_data[] = { 0x01, 0x07, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0xff, 0xff, 0xfd, 0xf9, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x3f, 0x1f, 0x07, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xf0, 0xf3, 0x07, 0x07, 0xf3, 0xf0, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xe0, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 0xff, 0x7f, 0x3f, 0x1f, 0x9f, 0x9f, 0x1f, 0x3f, 0x7f, 0xff, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xe0, 0x80, };
+const uint8_t bmp_bottom_left_arrow_data[] = { 0x1f, 0x7f, 0x7f, 0xfb, 0xf1, 0xe0, 0xca, 0xdb, 0xfb, 0xfb, 0xfb, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xe0, 0xe0, 0xe0, 0x60, 0x60, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, };
+const uint8_t bmp_bottom_left_close_data[] = { 0x1f, 0x7f, 0x7f, 0xff, 0xee, 0xc4, 0xe0, 0xf1, 0xe0, 0xc4, 0xee, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xe0, 0xe0, 0x60, 0xe0, 0xe0, 0xe0, 0x60, 0xe0, 0xe0, 0xe0, 0xe0, 0x00, 0x00, };
+const uint8_t bmp_bottom_left_delete_data[] = { 0x1f, 0x7f, 0x7b, 0xf1, 0xe0, 0xc0, 0xd1, 0xca, 0xc4, 0xca, 0xd1, 0xc0, 0xff, 0xff, 0xff, 0x00, 0x00, 0xc0, 0xc0, 0xe0, 0xe0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0xe0, 0xe0, 0xe0, 0x00, };
+const uint8_t bmp_bottom_left_qrcode_data[] = { 0x1f, 0x7f, 0x7f, 0xff, 0xc1, 0xdd, 0xd4, 0xdd, 0xc0, 0xf5, 0xca, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xe0, 0x60, 0x60, 0xe0, 0x60, 0xe0, 0x60, 0x60, 0xe0, 0xe0, 0xe0, 0x00, 0x00, };
+const uint8_t bmp_bottom_middle_arrow_down_data[] = { 0x80, 0x40, 0x20, 0x10, 0x20, 0x40, 0x80, 0x00, };
+const uint8_t bmp_bottom_middle_arrow_up_data[] = { 0x00, 0x10, 0x20, 0x40, 0x80, 0x40, 0x20, 0x10, };
+const uint8_t bmp_bottom_right_arrow_data[] = { 0x00, 0x00, 0x00, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0xdb, 0xca, 0xe0, 0xf1, 0xfb, 0x7f, 0x7f, 0x1f, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x60, 0x60, 0xe0, 0xe0, 0xe0, 0xc0, 0xc0, 0x00, };
+const uint8_t bmp_bottom_right_arrow_off_data[] = { 0x00, 0x00, 0x00, 0xaa, 0x00, 0x84, 0x04, 0x84, 0x24, 0xb5, 0x1f, 0x8e, 0x04, 0x40, 0x20, 0x0a, 0x00, 0x00, 0x00, 0xa0, 0x00, 0x20, 0x00, 0x20, 0x80, 0xa0, 0x00, 0x20, 0x00, 0x40, 0x80, 0x00, };
+const uint8_t bmp_bottom_right_change_data[] = { 0x00, 0x00, 0xff, 0xff, 0xff, 0xf5, 0xec, 0xe8, 0xee, 0xc2, 0xe6, 0xf5, 0xff, 0x7f, 0x7f, 0x1f, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x60, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xc0, 0xc0, 0x00, };
+const uint8_t bmp_bottom_right_confirm_data[] = { 0x00, 0x00, 0xff, 0xff, 0xfb, 0xf1, 0xf8, 0xfc, 0xf8, 0xf1, 0xe3, 0xc7, 0xef, 0x7f, 0x7f, 0x1f, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x60, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xc0, 0xc0, 0x00, };
+const uint8_t bmp_bottom_right_confirm_off_data[] = { 0x00, 0x00, 0xaa, 0x00, 0x84, 0x0e, 0x87, 0x03, 0x87, 0x0e, 0x9c, 0x38, 0x90, 0x00, 0x40, 0x15, 0x00, 0x00, 0xa0, 0x00, 0x20, 0x00, 0x20, 0x80, 0x20, 0x00, 0x20, 0x00, 0x20, 0x00, 0x40, 0x00, };
+const uint8_t bmp_bottom_right_next_data[] = { 0x00, 0x00, 0xff, 0xff, 0xfc, 0xf8, 0xf9, 0xf1, 0xf1, 0xc0, 0xe0, 0xf1, 0xfb, 0x7f, 0x7f, 0x1f, 0x00, 0x00, 0xe0, 0xe0, 0x60, 0xe0, 0xe0, 0xe0, 0xe0, 0x60, 0xe0, 0xe0, 0xe0, 0xc0, 0xc0, 0x00, };
+const uint8_t bmp_bottom_right_power_off_data[] = { 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xf1, 0xee, 0xff, 0xc3, 0xff, 0xee, 0xf1, 0x7f, 0x7f, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xe0, 0x60, 0x60, 0x60, 0xe0, 0xe0, 0xc0, 0xc0, 0x00, };
+const uint8_t bmp_bottom_right_retry_data[] = { 0x00, 0x00, 0x00, 0xff, 0xff, 0xf7, 0xe3, 0xc1, 0xf7, 0xf7, 0xf7, 0xf7, 0xf8, 0x7f, 0x7f, 0x1f, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0x60, 0x60, 0x60, 0x60, 0xe0, 0xc0, 0xc0, 0x00, };
+const uint8_t bmp_btn_back_data[] = { 0x00, 0x08, 0x1c, 0x3e, 0x7f, 0x7f, 0x00, 0x00, };
 const uint8_t bmp_btn_cancel_data[] = { 0x44, 0xee, 0x7c, 0x38, 0x7c, 0xee, 0x44, 0x00, };
-const uint8_t bmp_btn_confirm_data[] = { 0x02, 0x04, 0x08, 0xd8, 0xf0, 0x60, 0x20, 0x00, };
-const uint8_t bmp_btn_down_data[] = { 0x00, 0x00, 0x82, 0x44, 0x28, 0x10, 0x00, 0x00, };
-const uint8_t bmp_btn_forward_data[] = { 0x00, 0x30, 0x38, 0x3c, 0x3e, 0x3c, 0x38, 0x30, };
-const uint8_t bmp_btn_retry_data[] = { 0x20, 0x60, 0xfc, 0x62, 0x21, 0x01, 0x02, 0x7c, };
-const uint8_t bmp_btn_switch_data[] = { 0x00, 0x08, 0x7c, 0x8e, 0x28, 0xe2, 0x7c, 0x20, };
-const uint8_t bmp_btn_up_data[] = { 0x00, 0x00, 0x10, 0x28, 0x44, 0x82, 0x00, 0x00, };
-const uint8_t bmp_button_back_data[] = { 0x00, 0x08, 0x18, 0x30, 0x60, 0x30, 0x18, 0x08, };
-const uint8_t bmp_button_down_data[] = { 0x00, 0x00, 0x00, 0xc6, 0x6c, 0x38, 0x10, 0x00, };
-const uint8_t bmp_button_forward_data[] = { 0x00, 0x20, 0x30, 0x18, 0x0c, 0x18, 0x30, 0x20, };
-const uint8_t bmp_button_up_data[] = { 0x00, 0x00, 0x10, 0x38, 0x6c, 0xc6, 0x00, 0x00, };
-const uint8_t bmp_digit0_data[] = { 0xff, 0xff, 0xf8, 0x1f, 0xf0, 0x0f, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xf0, 0x0f, 0xf8, 0x1f, 0xff, 0xff, };
-const uint8_t bmp_digit1_data[] = { 0xff, 0xff, 0xfc, 0x3f, 0xf8, 0x3f, 0xf0, 0x3f, 0xf0, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xfc, 0x3f, 0xff, 0xff, };
-const uint8_t bmp_digit2_data[] = { 0xff, 0xff, 0xe0, 0x1f, 0xe0, 0x0f, 0xff, 0x87, 0xff, 0x87, 0xff, 0x87, 0xff, 0x87, 0xf8, 0x0f, 0xf0, 0x1f, 0xe1, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe1, 0xff, 0xe0, 0x07, 0xe0, 0x07, 0xff, 0xff, };
-const uint8_t bmp_digit3_data[] = { 0xff, 0xff, 0xe0, 0x1f, 0xe0, 0x0f, 0xff, 0x87, 0xff, 0x87, 0xff, 0x87, 0xff, 0x87, 0xf8, 0x0f, 0xf8, 0x0f, 0xff, 0x87, 0xff, 0x87, 0xff, 0x87, 0xff, 0x87, 0xe0, 0x0f, 0xe0, 0x1f, 0xff, 0xff, };
-const uint8_t bmp_digit4_data[] = { 0xff, 0xff, 0xff, 0x0f, 0xfe, 0x0f, 0xfc, 0x0f, 0xf8, 0x0f, 0xf1, 0x0f, 0xe3, 0x0f, 0xc7, 0x0f, 0xcf, 0x0f, 0xc0, 0x0f, 0xc0, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0xff, 0xff, };
-const uint8_t bmp_digit5_data[] = { 0xff, 0xff, 0xe0, 0x0f, 0xe0, 0x0f, 0xe1, 0xff, 0xe1, 0xff, 0xe0, 0x1f, 0xe0, 0x0f, 0xff, 0x87, 0xff, 0x87, 0xff, 0x87, 0xff, 0x87, 0xff, 0x87, 0xff, 0x87, 0xe0, 0x0f, 0xe0, 0x1f, 0xff, 0xff, };
-const uint8_t bmp_digit6_data[] = { 0xff, 0xff, 0xf8, 0x1f, 0xf0, 0x1f, 0xe1, 0xff, 0xe1, 0xff, 0xe0, 0x1f, 0xe0, 0x0f, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xf0, 0x0f, 0xf8, 0x1f, 0xff, 0xff, };
-const uint8_t bmp_digit7_data[] = { 0xff, 0xff, 0xe0, 0x07, 0xe0, 0x07, 0xff, 0x87, 0xff, 0x87, 0xff, 0x0f, 0xfe, 0x1f, 0xfc, 0x1f, 0xfc, 0x3f, 0xf8, 0x7f, 0xf8, 0x7f, 0xf8, 0x7f, 0xf8, 0x7f, 0xf8, 0x7f, 0xf8, 0x7f, 0xff, 0xff, };
-const uint8_t bmp_digit8_data[] = { 0xff, 0xff, 0xf8, 0x1f, 0xf0, 0x0f, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xf0, 0x0f, 0xf0, 0x0f, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xf0, 0x0f, 0xf8, 0x1f, 0xff, 0xff, };
-const uint8_t bmp_digit9_data[] = { 0xff, 0xff, 0xf8, 0x1f, 0xf0, 0x0f, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xe1, 0x87, 0xf0, 0x07, 0xf8, 0x07, 0xff, 0x87, 0xff, 0x87, 0xf8, 0x0f, 0xf8, 0x1f, 0xff, 0xff, };
-const uint8_t bmp_gears0_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x0c, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x1e, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x01, 0xf8, 0x3e, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x1f, 0xe0, 0x00, 0x00, 0x1f, 0xf0, 0x1f, 0xe0, 0x00, 0x00, 0x1f, 0xf0, 0x1f, 0xe0, 0x00, 0x00, 0x1f, 0xf0, 0x1f, 0xc0, 0x00, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x00, 0xf8, 0x3e, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfc, 0xc0, 0x18, 0x00, 0x00, 0x7f, 0xfd, 0xe0, 0x3c, 0x00, 0x00, 0x7f, 0xfd, 0xe0, 0x7c, 0x00, 0x00, 0xff, 0xfd, 0xff, 0xf8, 0x00, 0x00, 0xf8, 0x7e, 0xff, 0xf8, 0x00, 0x00, 0xf0, 0x1e, 0xff, 0xf0, 0x00, 0x00, 0x60, 0x0d, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x7c, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x3e, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xe0, 0x3f, 0xc0, 0x00, 0x00, 0x3f, 0xe0, 0x3f, 0xc0, 0x00, 0x00, 0x07, 0xe0, 0x3e, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x7c, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x7c, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x3c, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
-const uint8_t bmp_gears1_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x07, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xcf, 0x80, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x1f, 0xf8, 0x3e, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x1e, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x1f, 0x80, 0x00, 0x00, 0x01, 0xf0, 0x1f, 0xe0, 0x00, 0x00, 0x01, 0xf0, 0x1f, 0xe0, 0x00, 0x00, 0x01, 0xf8, 0x3f, 0xe1, 0xc0, 0x00, 0x00, 0xff, 0xfc, 0xc1, 0xc0, 0x00, 0x00, 0xff, 0xfb, 0x03, 0xc0, 0x00, 0x01, 0xff, 0xf7, 0xc3, 0xc0, 0x00, 0x03, 0xff, 0xf7, 0xff, 0xc0, 0x00, 0x03, 0xc7, 0xf7, 0xff, 0xe0, 0x00, 0x01, 0x81, 0xf3, 0xff, 0xf0, 0x00, 0x00, 0x00, 0xf1, 0xff, 0xff, 0x80, 0x00, 0x00, 0xe1, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x01, 0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x03, 0xe0, 0x3f, 0x80, 0x00, 0x00, 0x03, 0xe0, 0x3e, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x3e, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x3e, 0x00, 0x00, 0x00, 0x1f, 0xe0, 0x3c, 0x00, 0x00, 0x00, 0x1f, 0xf0, 0x7c, 0x00, 0x00, 0x00, 0x01, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x06, 0x00, 0x00, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
-const uint8_t bmp_gears2_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xc1, 0x80, 0x00, 0x00, 0x07, 0x3f, 0xf7, 0xc0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x07, 0xff, 0xff, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x3e, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x1e, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x1e, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x1e, 0x00, 0x00, 0x00, 0x01, 0xf0, 0x1e, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x1e, 0x00, 0x00, 0x00, 0x03, 0xf8, 0x3f, 0x0e, 0x00, 0x00, 0x07, 0xff, 0xff, 0x8f, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xcf, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xcf, 0x00, 0x00, 0x06, 0x1f, 0xe1, 0x9f, 0x83, 0x00, 0x00, 0x0f, 0xce, 0x7f, 0xef, 0x80, 0x00, 0x07, 0x9f, 0xff, 0xff, 0x80, 0x00, 0x07, 0x9f, 0xff, 0xff, 0x00, 0x00, 0x03, 0x8f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x7c, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x3c, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x3c, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x3c, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x3c, 0x00, 0x00, 0x00, 0x07, 0xe0, 0x3c, 0x00, 0x00, 0x00, 0x07, 0xf0, 0x7e, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x0c, 0x3f, 0xc7, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
-const uint8_t bmp_gears3_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x01, 0x81, 0xe0, 0x00, 0x00, 0x00, 0x03, 0xe1, 0xe0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0xff, 0xff, 0xe0, 0x00, 0x00, 0x00, 0xf8, 0x3f, 0xe0, 0x00, 0x00, 0x01, 0xf0, 0x1f, 0xc0, 0x00, 0x00, 0x01, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x03, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x1f, 0x00, 0x00, 0x00, 0x0f, 0xf0, 0x1e, 0x00, 0x00, 0x00, 0x0f, 0xf8, 0x3e, 0x70, 0x00, 0x00, 0x00, 0xff, 0xff, 0x78, 0x00, 0x00, 0x00, 0x7f, 0xff, 0x78, 0x00, 0x00, 0x00, 0x3f, 0xff, 0x7c, 0x0e, 0x00, 0x00, 0x1f, 0xff, 0x7f, 0x9f, 0x00, 0x00, 0x1f, 0x87, 0x7f, 0xff, 0x00, 0x00, 0x1e, 0x00, 0xff, 0xfe, 0x00, 0x00, 0x1e, 0x01, 0xff, 0xfc, 0x00, 0x00, 0x0c, 0x1f, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x3f, 0xf0, 0x7c, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x3c, 0x00, 0x00, 0x00, 0x3f, 0xe0, 0x3e, 0x00, 0x00, 0x00, 0x0f, 0xe0, 0x3f, 0x00, 0x00, 0x00, 0x03, 0xe0, 0x3f, 0xc0, 0x00, 0x00, 0x03, 0xe0, 0x3f, 0xc0, 0x00, 0x00, 0x03, 0xf0, 0x7f, 0xc0, 0x00, 0x00, 0x01, 0xff, 0xff, 0x80, 0x00, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf0, 0x00, 0x00, 0x00, 0x07, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x07, 0x8f, 0xe0, 0x00, 0x00, 0x00, 0x03, 0x03, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
-const uint8_t bmp_icon_down_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x10, 0x08, 0x20, 0x04, 0x40, 0x02, 0x80, 0x01, 0x00, 0x00, 0x00, };
-const uint8_t bmp_icon_enter_data[] = { 0x07, 0xc0, 0x08, 0x20, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x08, 0x20, 0x07, 0xc0, };
-const uint8_t bmp_icon_error_data[] = { 0x07, 0xe0, 0x1f, 0xf8, 0x3f, 0xfc, 0x77, 0xee, 0x63, 0xc6, 0xf1, 0x8f, 0xf8, 0x9f, 0xfc, 0x7f, 0xfe, 0x3f, 0xf9, 0x1f, 0xf1, 0x8f, 0x63, 0xc6, 0x77, 0xee, 0x3f, 0xfc, 0x1f, 0xf8, 0x07, 0xe0, };
-const uint8_t bmp_icon_exit_data[] = { 0x01, 0x00, 0x09, 0x20, 0x11, 0x10, 0x11, 0x10, 0x11, 0x10, 0x11, 0x10, 0x10, 0x10, 0x08, 0x20, 0x07, 0xc0, };
-const uint8_t bmp_icon_info_data[] = { 0x07, 0xe0, 0x1f, 0xf8, 0x3e, 0x7c, 0x7e, 0x7e, 0x7f, 0xfe, 0xff, 0xff, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0xfe, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x3f, 0xfc, 0x1f, 0xf8, 0x07, 0xe0, };
-const uint8_t bmp_icon_ok_data[] = { 0x07, 0xe0, 0x1f, 0xf8, 0x3f, 0xfc, 0x7f, 0xfe, 0x7f, 0xee, 0xff, 0xc7, 0xff, 0x8f, 0xf7, 0x1f, 0xe2, 0x3f, 0xf0, 0x7f, 0xf8, 0xff, 0x7d, 0xfe, 0x7f, 0xfe, 0x3f, 0xfc, 0x1f, 0xf8, 0x07, 0xe0, };
-const uint8_t bmp_icon_question_data[] = { 0x07, 0xe0, 0x1f, 0xf8, 0x3c, 0x3c, 0x78, 0x1e, 0x73, 0xce, 0xf3, 0xcf, 0xf3, 0xcf, 0xff, 0xcf, 0xff, 0x1f, 0xfe, 0x7f, 0xfe, 0x7f, 0x7f, 0xfe, 0x7e, 0x7e, 0x3e, 0x7c, 0x1f, 0xf8, 0x07, 0xe0, };
-const uint8_t bmp_icon_up_data[] = { 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x80, 0x04, 0x40, 0x08, 0x20, 0x10, 0x10, 0x00, 0x00, 0x00, 0x00, };
-const uint8_t bmp_icon_warning_data[] = { 0x01, 0x80, 0x01, 0x80, 0x03, 0xc0, 0x03, 0xc0, 0x07, 0xe0, 0x07, 0xe0, 0x0e, 0x70, 0x0e, 0x70, 0x1e, 0x78, 0x1e, 0x78, 0x3e, 0x7c, 0x3f, 0xfc, 0x7e, 0x7e, 0x7e, 0x7e, 0xff, 0xff, 0xff, 0xff, };
-const uint8_t bmp_input_submit_data[] = { 0x03, 0x06, 0x0c, 0xd8, 0x70, 0x20, };
-const uint8_t bmp_onekey_logo_data[] = { 0x01, 0xff, 0x80, 0x07, 0xff, 0xe0, 0x1f, 0xff, 0xf8, 0x3f, 0xff, 0xfc, 0x3f, 0xc7, 0xfc, 0x7f, 0x87, 0xfe, 0x7f, 0xe7, 0xfe, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc3, 0xff, 0xff, 0x81, 0xff, 0xff, 0x18, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x18, 0xff, 0x7f, 0x81, 0xfe, 0x7f, 0xc3, 0xfe, 0x3f, 0xff, 0xfc, 0x3f, 0xff, 0xfc, 0x1f, 0xff, 0xf8, 0x07, 0xff, 0xe0, 0x01, 0xff, 0x80, };
-const uint8_t bmp_pin_filled_data[] = { 0x38, 0x7c, 0x7c, 0x7c, 0x38, };
-const uint8_t bmp_status_battery_0_data[] = { 0x3f, 0xfc, 0x20, 0x04, 0x20, 0x05, 0x20, 0x05, 0x20, 0x05, 0x20, 0x04, 0x3f, 0xfc, 0x00, 0x00, };
-const uint8_t bmp_status_battery_1_data[] = { 0x3f, 0xfc, 0x20, 0x04, 0x2c, 0x05, 0x2c, 0x05, 0x2c, 0x05, 0x20, 0x04, 0x3f, 0xfc, 0x00, 0x00, };
-const uint8_t bmp_status_battery_2_data[] = { 0x3f, 0xfc, 0x20, 0x04, 0x2f, 0x05, 0x2f, 0x05, 0x2f, 0x05, 0x20, 0x04, 0x3f, 0xfc, 0x00, 0x00, };
-const uint8_t bmp_status_battery_3_data[] = { 0x3f, 0xfc, 0x20, 0x04, 0x2f, 0xc5, 0x2f, 0xc5, 0x2f, 0xc5, 0x20, 0x04, 0x3f, 0xfc, 0x00, 0x00, };
-const uint8_t bmp_status_battery_4_data[] = { 0x3f, 0xfc, 0x20, 0x04, 0x2f, 0xf5, 0x2f, 0xf5, 0x2f, 0xf5, 0x20, 0x04, 0x3f, 0xfc, 0x00, 0x00, };
-const uint8_t bmp_status_ble_data[] = { 0x04, 0x16, 0x0d, 0x06, 0x0d, 0x16, 0x04, 0x00, };
-const uint8_t bmp_status_ble_connect_data[] = { 0x24, 0xb2, 0x69, 0x31, 0x69, 0xb2, 0x24, 0x00, };
-const uint8_t bmp_status_charge_data[] = { 0x04, 0x0c, 0x1c, 0x3f, 0x0e, 0x0c, 0x08, 0x00, };
-const uint8_t bmp_status_locked_data[] = { 0x18, 0x24, 0x24, 0x7e, 0x7e, 0x7e, 0x7e, 0x00, };
-const uint8_t bmp_status_usb_data[] = { 0x1e, 0x12, 0x3f, 0x21, 0x21, 0x3f, 0x0c, 0x00, };
-const uint8_t bmp_webauthn_data[] = { 0x00, 0x00, 0x1f, 0x80, 0x00, 0x00, 0x7f, 0xe0, 0x00, 0x01, 0xff, 0xf8, 0x00, 0x03, 0xfe, 0x1c, 0x00, 0x03, 0xfc, 0x0c, 0x00, 0x07, 0xf8, 0x06, 0x00, 0x07, 0xf8, 0x06, 0x00, 0x0f, 0xf8, 0x06, 0x00, 0x0f, 0xf8, 0x07, 0x00, 0x0f, 0xfc, 0x0f, 0x00, 0x0f, 0xfe, 0x1f, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x0f, 0xff, 0xff, 0x00, 0x07, 0xff, 0xfe, 0x00, 0x0f, 0xff, 0xfe, 0x00, 0x1f, 0xff, 0xfc, 0x00, 0x3f, 0xff, 0xfc, 0x00, 0x7f, 0xff, 0xf8, 0x00, 0xff, 0xff, 0xe0, 0x01, 0xff, 0xdf, 0x80, 0x03, 0xff, 0x80, 0x00, 0x07, 0xff, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x1f, 0xfc, 0x00, 0x00, 0x3f, 0xf8, 0x00, 0x00, 0x7f, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xff, 0x80, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x00, };
+const uint8_t bmp_btn_confirm_data[] = { 0x18, 0x1c, 0x0e, 0x18, 0x30, 0x40, 0x80, 0x00, };
+const uint8_t bmp_btn_down_data[] = { 0x20, 0x10, 0x08, 0x04, 0x08, 0x10, 0x20, 0x00, };
+const uint8_t bmp_btn_forward_data[] = { 0x00, 0x00, 0x7f, 0x7f, 0x3e, 0x1c, 0x08, 0x00, };
+const uint8_t bmp_btn_retry_data[] = { 0x20, 0x71, 0xf9, 0x21, 0x21, 0x21, 0x12, 0x0c, };
+const uint8_t bmp_btn_switch_data[] = { 0x14, 0x26, 0x2f, 0x22, 0x7a, 0x32, 0x14, 0x00, };
+const uint8_t bmp_btn_up_data[] = { 0x04, 0x08, 0x10, 0x20, 0x10, 0x08, 0x04, 0x00, };
+const uint8_t bmp_button_back_data[] = { 0x00, 0x08, 0x1c, 0x36, 0x63, 0x00, 0x00, 0x00, };
+const uint8_t bmp_button_down_data[] = { 0x10, 0x18, 0x0c, 0x06, 0x0c, 0x18, 0x10, 0x00, };
+const uint8_t bmp_button_forward_data[] = { 0x00, 0x00, 0x63, 0x36, 0x1c, 0x08, 0x00, 0x00, };
+const uint8_t bmp_button_up_data[] = { 0x04, 0x0c, 0x18, 0x30, 0x18, 0x0c, 0x04, 0x00, };
+const uint8_t bmp_digit0_data[] = { 0xff, 0xff, 0xff, 0xe0, 0xc0, 0x80, 0x80, 0x9f, 0x9f, 0x80, 0x80, 0xc0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x03, 0x01, 0x01, 0xf9, 0xf9, 0x01, 0x01, 0x03, 0x07, 0xff, 0xff, 0xff, };
+const uint8_t bmp_digit1_data[] = { 0xff, 0xff, 0xff, 0xff, 0xe7, 0xc7, 0x80, 0x80, 0x80, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x01, 0x01, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, };
+const uint8_t bmp_digit2_data[] = { 0xff, 0xff, 0xff, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x80, 0x80, 0xc0, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x01, 0x01, 0x01, 0x79, 0x79, 0x79, 0x79, 0xf9, 0xf9, 0xff, 0xff, 0xff, };
+const uint8_t bmp_digit3_data[] = { 0xff, 0xff, 0xff, 0x9f, 0x9f, 0x9e, 0x9e, 0x9e, 0x9e, 0x80, 0x80, 0xc0, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0x79, 0x79, 0x79, 0x79, 0x01, 0x01, 0x03, 0x87, 0xff, 0xff, 0xff, };
+const uint8_t bmp_digit4_data[] = { 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf1, 0xe3, 0xc7, 0x80, 0x80, 0x80, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1f, 0x1f, 0x9f, 0x9f, 0x9f, 0x9f, 0x01, 0x01, 0x01, 0x01, 0xff, 0xff, 0xff, 0xff, };
+const uint8_t bmp_digit5_data[] = { 0xff, 0xff, 0xff, 0x81, 0x81, 0x81, 0x81, 0x99, 0x99, 0x98, 0x98, 0x9c, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0xf9, 0x01, 0x01, 0x03, 0x07, 0xff, 0xff, 0xff, };
+const uint8_t bmp_digit6_data[] = { 0xff, 0xff, 0xff, 0xe0, 0xc0, 0x80, 0x80, 0x99, 0x99, 0x98, 0x98, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x03, 0x01, 0x01, 0xf9, 0xf9, 0x01, 0x01, 0x03, 0x07, 0xff, 0xff, 0xff, };
+const uint8_t bmp_digit7_data[] = { 0xff, 0xff, 0xff, 0x9f, 0x9f, 0x9f, 0x9e, 0x9c, 0x98, 0x80, 0x80, 0x83, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x81, 0x01, 0x01, 0x01, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, };
+const uint8_t bmp_digit8_data[] = { 0xff, 0xff, 0xff, 0xe1, 0xc0, 0x80, 0x80, 0x9e, 0x9e, 0x80, 0x80, 0xc0, 0xe1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0x03, 0x01, 0x01, 0x79, 0x79, 0x01, 0x01, 0x03, 0x87, 0xff, 0xff, 0xff, };
+const uint8_t bmp_digit9_data[] = { 0xff, 0xff, 0xff, 0xe0, 0xc0, 0x80, 0x80, 0x9f, 0x9f, 0x80, 0x80, 0xc0, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x19, 0x19, 0x99, 0x99, 0x01, 0x01, 0x03, 0x07, 0xff, 0xff, 0xff, };
+const uint8_t bmp_gears0_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc1, 0xf7, 0xff, 0xff, 0x7f, 0x3f, 0x3e, 0x3e, 0x3e, 0x3e, 0x3e, 0x7f, 0xff, 0xff, 0xf7, 0xc1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x70, 0x70, 0x70, 0xf8, 0xfe, 0xff, 0xff, 0xff, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0xff, 0xff, 0xff, 0xfc, 0xf9, 0xf3, 0xf3, 0xe1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xf8, 0xf8, 0xf0, 0xe0, 0xc0, 0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0xf0, 0xf8, 0xf8, 0x33, 0xcf, 0xff, 0xff, 0xff, 0x7e, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0xfe, 0xff, 0xff, 0xef, 0x87, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xe0, 0xe0, 0xf0, 0xf0, 0xfc, 0xff, 0xff, 0xff, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0f, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0xe0, 0xe0, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xf0, 0xf0, 0xe0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
+const uint8_t bmp_gears1_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x03, 0x03, 0x03, 0x07, 0x0f, 0xff, 0xff, 0xff, 0xfe, 0x7e, 0x3e, 0x3e, 0x3e, 0x1f, 0x1f, 0x3f, 0x7f, 0x7f, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xc0, 0xe0, 0xe0, 0xfc, 0xff, 0xff, 0xff, 0xff, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0xff, 0xff, 0xfe, 0xfd, 0x7d, 0x3e, 0x1e, 0x1c, 0x00, 0x00, 0x00, 0x01, 0x07, 0x07, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xf0, 0xf0, 0xe0, 0xc0, 0xc0, 0xc0, 0xe0, 0xe0, 0xf0, 0xfc, 0xfc, 0xfc, 0xf8, 0x00, 0xe0, 0xf1, 0xff, 0xff, 0xff, 0x7f, 0x7e, 0x7c, 0x7c, 0xfc, 0xfc, 0xfc, 0xfe, 0x3f, 0x1f, 0x0f, 0x0f, 0x0f, 0x0f, 0x0f, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x78, 0xf8, 0xfc, 0xfe, 0xff, 0xff, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xe7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xf8, 0xf8, 0xf0, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xe0, 0xe0, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
+const uint8_t bmp_gears2_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x1e, 0x1f, 0x1f, 0x0f, 0x0f, 0x1f, 0x1f, 0x3f, 0xfe, 0xfe, 0xfe, 0xfe, 0x3e, 0x1f, 0x1f, 0x0f, 0x1f, 0x1f, 0x3e, 0x3c, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x03, 0x0f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff, 0x07, 0x03, 0x01, 0x00, 0x00, 0x07, 0x07, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xc0, 0x80, 0x80, 0x80, 0x80, 0xc0, 0xe0, 0xf8, 0xfc, 0xfc, 0xfc, 0xe0, 0xc0, 0x98, 0xbc, 0xbe, 0xbf, 0xdf, 0xdf, 0xbf, 0x3f, 0x7e, 0xfc, 0xfc, 0xfc, 0xfc, 0x7c, 0x3e, 0x3f, 0x1f, 0x3f, 0x3f, 0x7c, 0x78, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x07, 0x1f, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0f, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x80, 0xc0, 0xf0, 0xf8, 0xf8, 0xf8, 0xc0, 0x80, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
+const uint8_t bmp_gears3_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xf8, 0xff, 0x7f, 0x7f, 0x3f, 0x3f, 0x3e, 0x3e, 0xfe, 0xfe, 0xfe, 0xff, 0x1f, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0x1c, 0x3c, 0xfc, 0xfe, 0xff, 0xff, 0xff, 0x07, 0x03, 0x03, 0x03, 0x03, 0x03, 0x07, 0xff, 0xff, 0xff, 0xff, 0xf3, 0x80, 0x87, 0x07, 0x07, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xf8, 0xfc, 0xfc, 0xf8, 0xe0, 0xe0, 0xc0, 0xc3, 0xc7, 0xc7, 0xe7, 0xe7, 0xef, 0x1f, 0xff, 0xff, 0xfe, 0xfc, 0xfc, 0x7c, 0x7c, 0x7c, 0x3e, 0x3f, 0x7f, 0xff, 0xff, 0xf0, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0xc0, 0xc0, 0xf9, 0xff, 0xff, 0xff, 0xff, 0x0f, 0x07, 0x07, 0x07, 0x07, 0x07, 0x0f, 0xff, 0xff, 0xfe, 0xfc, 0xfc, 0x7c, 0x3c, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0xe0, 0xe0, 0xc0, 0x80, 0x80, 0x80, 0xc0, 0xc0, 0xe0, 0xf8, 0xf8, 0xf8, 0xf0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
+const uint8_t bmp_icon_down_data[] = { 0x00, 0x00, 0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
+const uint8_t bmp_icon_enter_data[] = { 0x00, 0x00, 0x00, 0x3e, 0x41, 0x80, 0x80, 0x80, 0x80, 0x80, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
+const uint8_t bmp_icon_error_data[] = { 0x07, 0x1f, 0x3f, 0x77, 0x63, 0xf1, 0xf8, 0xfc, 0xfe, 0xf9, 0xf1, 0x63, 0x77, 0x3f, 0x1f, 0x07, 0xe0, 0xf8, 0xfc, 0xee, 0xc6, 0x8f, 0x9f, 0x7f, 0x3f, 0x1f, 0x8f, 0xc6, 0xee, 0xfc, 0xf8, 0xe0, };
+const uint8_t bmp_icon_exit_data[] = { 0x00, 0x00, 0x00, 0x3e, 0x41, 0x00, 0x00, 0xfc, 0x00, 0x00, 0x41, 0x3e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
+const uint8_t bmp_icon_info_data[] = { 0x07, 0x1f, 0x3f, 0x7f, 0x7f, 0xff, 0xff, 0xcc, 0xcc, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x1f, 0x07, 0xe0, 0xf8, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0x07, 0x07, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xf8, 0xe0, };
+const uint8_t bmp_icon_ok_data[] = { 0x07, 0x1f, 0x3f, 0x7f, 0x7e, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0x71, 0x7b, 0x3f, 0x1f, 0x07, 0xe0, 0xf8, 0xfc, 0x7e, 0x3e, 0x1f, 0x8f, 0x1f, 0x3f, 0x7f, 0xff, 0xfe, 0xfe, 0xfc, 0xf8, 0xe0, };
+const uint8_t bmp_icon_question_data[] = { 0x07, 0x1f, 0x3f, 0x7f, 0x71, 0xe1, 0xcf, 0xcf, 0xcf, 0xcf, 0xe0, 0x70, 0x7f, 0x3f, 0x1f, 0x07, 0xe0, 0xf8, 0xfc, 0xfe, 0xfe, 0xff, 0xff, 0x93, 0x13, 0x7f, 0x7f, 0xfe, 0xfe, 0xfc, 0xf8, 0xe0, };
+const uint8_t bmp_icon_up_data[] = { 0x00, 0x00, 0x00, 0x02, 0x04, 0x08, 0x10, 0x20, 0x10, 0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
+const uint8_t bmp_icon_warning_data[] = { 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0xfc, 0xfc, 0x3f, 0x0f, 0x03, 0x00, 0x00, 0x00, 0x00, 0x03, 0x0f, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x13, 0x13, 0xff, 0xff, 0xff, 0xff, 0x3f, 0x0f, 0x03, };
+const uint8_t bmp_input_submit_data[] = { 0x10, 0x18, 0x0c, 0x18, 0x30, 0x60, 0xc0, 0x80, };
+const uint8_t bmp_onekey_logo_data[] = { 0x01, 0x07, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0xff, 0xff, 0xfb, 0xf3, 0xf0, 0xf0, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x7f, 0x3f, 0x3f, 0x1f, 0x07, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf0, 0xe3, 0x27, 0x27, 0xe3, 0xf0, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0xe0, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 0xff, 0x7f, 0x3f, 0x1f, 0x9f, 0x9f, 0x1f, 0x3f, 0x7f, 0xff, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xe0, 0x80, };
+const uint8_t bmp_pin_filled_data[] = { 0x00, 0x70, 0xf8, 0xf8, 0xf8, 0x70, 0x00, 0x00, };
+const uint8_t bmp_status_battery_0_data[] = { 0x00, 0x00, 0xfe, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x00, 0x38, };
+const uint8_t bmp_status_battery_1_data[] = { 0x00, 0x00, 0xfe, 0x82, 0xba, 0xba, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x00, 0x38, };
+const uint8_t bmp_status_battery_2_data[] = { 0x00, 0x00, 0xfe, 0x82, 0xba, 0xba, 0xba, 0xba, 0x82, 0x82, 0x82, 0x82, 0x82, 0xfe, 0x00, 0x38, };
+const uint8_t bmp_status_battery_3_data[] = { 0x00, 0x00, 0xfe, 0x82, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0x82, 0x82, 0x82, 0xfe, 0x00, 0x38, };
+const uint8_t bmp_status_battery_4_data[] = { 0x00, 0x00, 0xfe, 0x82, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0xba, 0x82, 0xfe, 0x00, 0x38, };
+const uint8_t bmp_status_ble_data[] = { 0x00, 0x00, 0x00, 0x44, 0x28, 0xfe, 0x54, 0x28, };
+const uint8_t bmp_status_ble_connect_data[] = { 0x44, 0x28, 0xfe, 0x54, 0x28, 0x82, 0x44, 0x38, };
+const uint8_t bmp_status_charge_data[] = { 0x00, 0x00, 0x10, 0x30, 0x7e, 0xfc, 0x18, 0x10, };
+const uint8_t bmp_status_locked_data[] = { 0x00, 0x1e, 0x7e, 0x9e, 0x9e, 0x7e, 0x1e, 0x00, };
+const uint8_t bmp_status_usb_data[] = { 0x00, 0x00, 0x3c, 0xe4, 0xa6, 0xa6, 0xe4, 0x3c, };
+const uint8_t bmp_webauthn_data[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x07, 0x1f, 0x3f, 0x3f, 0x7f, 0x7f, 0xff, 0xff, 0xf8, 0xf0, 0xe0, 0xe0, 0x60, 0x60, 0x30, 0x38, 0x1f, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x3f, 0x1f, 0x1f, 0x1f, 0x1f, 0x3f, 0x7f, 0xff, 0xfe, 0xf8, 0x00, 0x00, 0x00, 0x01, 0x03, 0x07, 0x0f, 0x1f, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfc, 0xf8, 0xf0, 0xe0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x80, 0x00, 0x00, 0x3f, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xf0, 0xf0, 0xf0, 0x80, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, };
 
-const BITMAP bmp_Icon_bc = {40, 40, bmp_Icon_bc_data};
-const BITMAP bmp_Icon_ce = {40, 40, bmp_Icon_ce_data};
-const BITMAP bmp_Icon_fc = {40, 40, bmp_Icon_fc_data};
-const BITMAP bmp_Icon_weee = {40, 40, bmp_Icon_weee_data};
-const BITMAP bmp_anatel = {40, 32, bmp_anatel_data};
-const BITMAP bmp_arrow_down_w5 = {8, 3, bmp_arrow_down_w5_data};
-const BITMAP bmp_arrow_up_w5 = {8, 3, bmp_arrow_up_w5_data};
-const BITMAP bmp_boot_icon = {24, 24, bmp_boot_icon_data};
-const BITMAP bmp_bottom_left_arrow = {16, 11, bmp_bottom_left_arrow_data};
-const BITMAP bmp_bottom_left_close = {16, 11, bmp_bottom_left_close_data};
-const BITMAP bmp_bottom_left_delete = {16, 11, bmp_bottom_left_delete_data};
-const BITMAP bmp_bottom_left_qrcode = {16, 11, bmp_bottom_left_qrcode_data};
-const BITMAP bmp_bottom_middle_arrow_down = {8, 4, bmp_bottom_middle_arrow_down_data};
-const BITMAP bmp_bottom_middle_arrow_up = {8, 4, bmp_bottom_middle_arrow_up_data};
-const BITMAP bmp_bottom_right_arrow = {16, 11, bmp_bottom_right_arrow_data};
-const BITMAP bmp_bottom_right_arrow_off = {16, 11, bmp_bottom_right_arrow_off_data};
-const BITMAP bmp_bottom_right_change = {16, 11, bmp_bottom_right_change_data};
-const BITMAP bmp_bottom_right_confirm = {16, 11, bmp_bottom_right_confirm_data};
-const BITMAP bmp_bottom_right_confirm_off = {16, 11, bmp_bottom_right_confirm_off_data};
-const BITMAP bmp_bottom_right_next = {16, 11, bmp_bottom_right_next_data};
-const BITMAP bmp_bottom_right_power_off = {16, 11, bmp_bottom_right_power_off_data};
-const BITMAP bmp_bottom_right_retry = {16, 11, bmp_bottom_right_retry_data};
-const BITMAP bmp_btn_back = {8, 8, bmp_btn_back_data};
-const BITMAP bmp_btn_cancel = {8, 8, bmp_btn_cancel_data};
-const BITMAP bmp_btn_confirm = {8, 8, bmp_btn_confirm_data};
-const BITMAP bmp_btn_down = {8, 8, bmp_btn_down_data};
-const BITMAP bmp_btn_forward = {8, 8, bmp_btn_forward_data};
-const BITMAP bmp_btn_retry = {8, 8, bmp_btn_retry_data};
-const BITMAP bmp_btn_switch = {8, 8, bmp_btn_switch_data};
-const BITMAP bmp_btn_up = {8, 8, bmp_btn_up_data};
-const BITMAP bmp_button_back = {8, 8, bmp_button_back_data};
-const BITMAP bmp_button_down = {8, 8, bmp_button_down_data};
-const BITMAP bmp_button_forward = {8, 8, bmp_button_forward_data};
-const BITMAP bmp_button_up = {8, 8, bmp_button_up_data};
-const BITMAP bmp_digit0 = {16, 16, bmp_digit0_data};
-const BITMAP bmp_digit1 = {16, 16, bmp_digit1_data};
-const BITMAP bmp_digit2 = {16, 16, bmp_digit2_data};
-const BITMAP bmp_digit3 = {16, 16, bmp_digit3_data};
-const BITMAP bmp_digit4 = {16, 16, bmp_digit4_data};
-const BITMAP bmp_digit5 = {16, 16, bmp_digit5_data};
-const BITMAP bmp_digit6 = {16, 16, bmp_digit6_data};
-const BITMAP bmp_digit7 = {16, 16, bmp_digit7_data};
-const BITMAP bmp_digit8 = {16, 16, bmp_digit8_data};
-const BITMAP bmp_digit9 = {16, 16, bmp_digit9_data};
-const BITMAP bmp_gears0 = {48, 48, bmp_gears0_data};
-const BITMAP bmp_gears1 = {48, 48, bmp_gears1_data};
-const BITMAP bmp_gears2 = {48, 48, bmp_gears2_data};
-const BITMAP bmp_gears3 = {48, 48, bmp_gears3_data};
-const BITMAP bmp_icon_down = {16, 9, bmp_icon_down_data};
-const BITMAP bmp_icon_enter = {16, 9, bmp_icon_enter_data};
-const BITMAP bmp_icon_error = {16, 16, bmp_icon_error_data};
-const BITMAP bmp_icon_exit = {16, 9, bmp_icon_exit_data};
-const BITMAP bmp_icon_info = {16, 16, bmp_icon_info_data};
-const BITMAP bmp_icon_ok = {16, 16, bmp_icon_ok_data};
-const BITMAP bmp_icon_question = {16, 16, bmp_icon_question_data};
-const BITMAP bmp_icon_up = {16, 9, bmp_icon_up_data};
-const BITMAP bmp_icon_warning = {16, 16, bmp_icon_warning_data};
-const BITMAP bmp_input_submit = {8, 6, bmp_input_submit_data};
-const BITMAP bmp_onekey_logo = {24, 24, bmp_onekey_logo_data};
-const BITMAP bmp_pin_filled = {8, 5, bmp_pin_filled_data};
-const BITMAP bmp_status_battery_0 = {16, 8, bmp_status_battery_0_data};
-const BITMAP bmp_status_battery_1 = {16, 8, bmp_status_battery_1_data};
-const BITMAP bmp_status_battery_2 = {16, 8, bmp_status_battery_2_data};
-const BITMAP bmp_status_battery_3 = {16, 8, bmp_status_battery_3_data};
-const BITMAP bmp_status_battery_4 = {16, 8, bmp_status_battery_4_data};
-const BITMAP bmp_status_ble = {8, 8, bmp_status_ble_data};
-const BITMAP bmp_status_ble_connect = {8, 8, bmp_status_ble_connect_data};
-const BITMAP bmp_status_charge = {8, 8, bmp_status_charge_data};
-const BITMAP bmp_status_locked = {8, 8, bmp_status_locked_data};
-const BITMAP bmp_status_usb = {8, 8, bmp_status_usb_data};
-const BITMAP bmp_webauthn = {32, 32, bmp_webauthn_data};
+const BITMAP bmp_Icon_bc = {40, 40, bmp_Icon_bc_data, BITMAP_COLUMNS};
+const BITMAP bmp_Icon_ce = {40, 40, bmp_Icon_ce_data, BITMAP_COLUMNS};
+const BITMAP bmp_Icon_fc = {40, 40, bmp_Icon_fc_data, BITMAP_COLUMNS};
+const BITMAP bmp_Icon_weee = {40, 40, bmp_Icon_weee_data, BITMAP_COLUMNS};
+const BITMAP bmp_anatel = {40, 32, bmp_anatel_data, BITMAP_COLUMNS};
+const BITMAP bmp_arrow_down_w5 = {8, 3, bmp_arrow_down_w5_data, BITMAP_COLUMNS};
+const BITMAP bmp_arrow_up_w5 = {8, 3, bmp_arrow_up_w5_data, BITMAP_COLUMNS};
+const BITMAP bmp_boot_icon = {24, 24, bmp_boot_icon_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_left_arrow = {16, 11, bmp_bottom_left_arrow_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_left_close = {16, 11, bmp_bottom_left_close_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_left_delete = {16, 11, bmp_bottom_left_delete_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_left_qrcode = {16, 11, bmp_bottom_left_qrcode_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_middle_arrow_down = {8, 4, bmp_bottom_middle_arrow_down_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_middle_arrow_up = {8, 4, bmp_bottom_middle_arrow_up_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_right_arrow = {16, 11, bmp_bottom_right_arrow_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_right_arrow_off = {16, 11, bmp_bottom_right_arrow_off_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_right_change = {16, 11, bmp_bottom_right_change_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_right_confirm = {16, 11, bmp_bottom_right_confirm_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_right_confirm_off = {16, 11, bmp_bottom_right_confirm_off_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_right_next = {16, 11, bmp_bottom_right_next_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_right_power_off = {16, 11, bmp_bottom_right_power_off_data, BITMAP_COLUMNS};
+const BITMAP bmp_bottom_right_retry = {16, 11, bmp_bottom_right_retry_data, BITMAP_COLUMNS};
+const BITMAP bmp_btn_back = {8, 8, bmp_btn_back_data, BITMAP_COLUMNS};
+const BITMAP bmp_btn_cancel = {8, 8, bmp_btn_cancel_data, BITMAP_COLUMNS};
+const BITMAP bmp_btn_confirm = {8, 8, bmp_btn_confirm_data, BITMAP_COLUMNS};
+const BITMAP bmp_btn_down = {8, 8, bmp_btn_down_data, BITMAP_COLUMNS};
+const BITMAP bmp_btn_forward = {8, 8, bmp_btn_forward_data, BITMAP_COLUMNS};
+const BITMAP bmp_btn_retry = {8, 8, bmp_btn_retry_data, BITMAP_COLUMNS};
+const BITMAP bmp_btn_switch = {8, 8, bmp_btn_switch_data, BITMAP_COLUMNS};
+const BITMAP bmp_btn_up = {8, 8, bmp_btn_up_data, BITMAP_COLUMNS};
+const BITMAP bmp_button_back = {8, 8, bmp_button_back_data, BITMAP_COLUMNS};
+const BITMAP bmp_button_down = {8, 8, bmp_button_down_data, BITMAP_COLUMNS};
+const BITMAP bmp_button_forward = {8, 8, bmp_button_forward_data, BITMAP_COLUMNS};
+const BITMAP bmp_button_up = {8, 8, bmp_button_up_data, BITMAP_COLUMNS};
+const BITMAP bmp_digit0 = {16, 16, bmp_digit0_data, BITMAP_COLUMNS};
+const BITMAP bmp_digit1 = {16, 16, bmp_digit1_data, BITMAP_COLUMNS};
+const BITMAP bmp_digit2 = {16, 16, bmp_digit2_data, BITMAP_COLUMNS};
+const BITMAP bmp_digit3 = {16, 16, bmp_digit3_data, BITMAP_COLUMNS};
+const BITMAP bmp_digit4 = {16, 16, bmp_digit4_data, BITMAP_COLUMNS};
+const BITMAP bmp_digit5 = {16, 16, bmp_digit5_data, BITMAP_COLUMNS};
+const BITMAP bmp_digit6 = {16, 16, bmp_digit6_data, BITMAP_COLUMNS};
+const BITMAP bmp_digit7 = {16, 16, bmp_digit7_data, BITMAP_COLUMNS};
+const BITMAP bmp_digit8 = {16, 16, bmp_digit8_data, BITMAP_COLUMNS};
+const BITMAP bmp_digit9 = {16, 16, bmp_digit9_data, BITMAP_COLUMNS};
+const BITMAP bmp_gears0 = {48, 48, bmp_gears0_data, BITMAP_COLUMNS};
+const BITMAP bmp_gears1 = {48, 48, bmp_gears1_data, BITMAP_COLUMNS};
+const BITMAP bmp_gears2 = {48, 48, bmp_gears2_data, BITMAP_COLUMNS};
+const BITMAP bmp_gears3 = {48, 48, bmp_gears3_data, BITMAP_COLUMNS};
+const BITMAP bmp_icon_down = {16, 9, bmp_icon_down_data, BITMAP_COLUMNS};
+const BITMAP bmp_icon_enter = {16, 9, bmp_icon_enter_data, BITMAP_COLUMNS};
+const BITMAP bmp_icon_error = {16, 16, bmp_icon_error_data, BITMAP_COLUMNS};
+const BITMAP bmp_icon_exit = {16, 9, bmp_icon_exit_data, BITMAP_COLUMNS};
+const BITMAP bmp_icon_info = {16, 16, bmp_icon_info_data, BITMAP_COLUMNS};
+const BITMAP bmp_icon_ok = {16, 16, bmp_icon_ok_data, BITMAP_COLUMNS};
+const BITMAP bmp_icon_question = {16, 16, bmp_icon_question_data, BITMAP_COLUMNS};
+const BITMAP bmp_icon_up = {16, 9, bmp_icon_up_data, BITMAP_COLUMNS};
+const BITMAP bmp_icon_warning = {16, 16, bmp_icon_warning_data, BITMAP_COLUMNS};
+const BITMAP bmp_input_submit = {8, 6, bmp_input_submit_data, BITMAP_COLUMNS};
+const BITMAP bmp_onekey_logo = {24, 24, bmp_onekey_logo_data, BITMAP_COLUMNS};
+const BITMAP bmp_pin_filled = {8, 5, bmp_pin_filled_data, BITMAP_COLUMNS};
+const BITMAP bmp_status_battery_0 = {16, 8, bmp_status_battery_0_data, BITMAP_COLUMNS};
+const BITMAP bmp_status_battery_1 = {16, 8, bmp_status_battery_1_data, BITMAP_COLUMNS};
+const BITMAP bmp_status_battery_2 = {16, 8, bmp_status_battery_2_data, BITMAP_COLUMNS};
+const BITMAP bmp_status_battery_3 = {16, 8, bmp_status_battery_3_data, BITMAP_COLUMNS};
+const BITMAP bmp_status_battery_4 = {16, 8, bmp_status_battery_4_data, BITMAP_COLUMNS};
+const BITMAP bmp_status_ble = {8, 8, bmp_status_ble_data, BITMAP_COLUMNS};
+const BITMAP bmp_status_ble_connect = {8, 8, bmp_status_ble_connect_data, BITMAP_COLUMNS};
+const BITMAP bmp_status_charge = {8, 8, bmp_status_charge_data, BITMAP_COLUMNS};
+const BITMAP bmp_status_locked = {8, 8, bmp_status_locked_data, BITMAP_COLUMNS};
+const BITMAP bmp_status_usb = {8, 8, bmp_status_usb_data, BITMAP_COLUMNS};
+const BITMAP bmp_webauthn = {32, 32, bmp_webauthn_data, BITMAP_COLUMNS};
@@ -3,9 +3,16 @@
 
 #include <stdint.h>
 
+// BITMAP_ROWS: row-major, 1 bit per pixel, MSB is the leftmost pixel.
+// BITMAP_COLUMNS: pre-rotated into 8-row bands, one byte per column with the
+// top pixel in the MSB (the SSD1306 page layout used by _oledbuffer).
+#define BITMAP_ROWS 0
+#define BITMAP_COLUMNS 1
+
 typedef struct {
   uint8_t width, height;
   const uint8_t *data;
+  uint8_t format;
 } BITMAP;
 
 extern const BITMAP bmp_Icon_bc;
@@ -9,12 +9,17 @@ data = []
 imgs = []
 
 
-def encode_pixels(img):
+def encode_columns(img, w, h):
+    # Pre-rotate into the OLED page layout: for every band of 8 rows emit one
+    # byte per column, top pixel in the MSB, so oled.c can blit whole bytes.
     r = ""
     img = ["1" if x >= 128 else "0" for x in img]
-    for i in range(len(img) // 8):
-        c = "".join(img[i * 8 : i * 8 + 8])
-        r += "0x%02x, " % int(c, 2)
+    for band in range(0, h, 8):
+        for x in range(w):
+            c = "".join(
+                img[(band + k) * w + x] if band + k < h else "0" for k in range(8)
+            )
+            r += "0x%02x, " % int(c, 2)
     return r
 
 
@@ -28,8 +33,12 @@ for fn in sorted(glob.glob("*.png")):
         raise Exception(f"Width must be divisible by 8! ({fn} is {w}x{h})")
     img = list(im.getdata())
     hdrs.append(f"extern const BITMAP bmp_{name};\n")
-    imgs.append(f"const BITMAP bmp_{name} = {{{w}, {h}, bmp_{name}_data}};\n")
-    data.append(f"const uint8_t bmp_{name}_data[] = {{ {encode_pixels(img)}}};\n")
+    imgs.append(
+        f"const BITMAP bmp_{name} = {{{w}, {h}, bmp_{name}_data, BITMAP_COLUMNS}};\n"
+    )
+    data.append(
+        f"const uint8_t bmp_{name}_data[] = {{ {encode_columns(img, w, h)}}};\n"
+    )
     cnt += 1
 
 with open("../bitmaps.c", "wt") as f:
@@ -49,9 +58,16 @@ with open("../bitmaps.h", "wt") as f:
 
 #include <stdint.h>
 
+// BITMAP_ROWS: row-major, 1 bit per pixel, MSB is the leftmost pixel.
+// BITMAP_COLUMNS: pre-rotated into 8-row bands, one byte per column with the
+// top pixel in the MSB (the SSD1306 page layout used by _oledbuffer).
+#define BITMAP_ROWS 0
+#define BITMAP_COLUMNS 1
+
 typedef struct {
   uint8_t width, height;
   const uint8_t *data;
+  uint8_t format;
 } BITMAP;
 
 """
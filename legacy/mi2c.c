@@ -27,19 +27,21 @@ static uint8_t ucXorCheck(uint8_t ucInputXor, uint8_t *pucSrc, uint16_t usLen) {
   return ucXor;
 }
 
-static int bMI2CDRV_ReadBytes(uint32_t i2c, uint8_t *res, uint16_t *pusOutLen) {
-  uint8_t ucLenBuf[2], ucSW[2], ucXor = 0, ucXor1 = 0;
-  uint16_t i, usRevLen, usRealLen = 0, usTimeout = 0;
+// Addresses the SE, which NACKs while it is still busy with the previous
+// command. Polls again after a backoff that starts short, so that quick
+// commands are collected early, and doubles up to MI2C_BACKOFF_MAX_US for
+// the slow ones (signing, seed generation). Called with interrupts
+// disabled; they are let through during the waits.
+static bool bMI2CDRV_Address(uint32_t i2c, uint8_t mode) {
+  uint32_t backoff = MI2C_BACKOFF_MIN_US, waited = 0;
+  uint16_t usTimeout = 0;
 
   i2c_retry_cnts = 0;
   while (1) {
-    if (i2c_retry_cnts > MI2C_RETRYCNTS) {
-      return -1;
-    }
-
-    // send start
     i2c_send_start(i2c);
-    i2c_enable_ack(i2c);
+    if (mode == MI2C_READ) {
+      i2c_enable_ack(i2c);
+    }
     usTimeout = 0;
     while (!(I2C_SR1(i2c) & I2C_SR1_SB)) {
       usTimeout++;
@@ -47,27 +49,43 @@ static int bMI2CDRV_ReadBytes(uint32_t i2c, uint8_t *res, uint16_t *pusOutLen) {
         break;
       }
     }
-    // send read address
-    i2c_send_7bit_address(i2c, MI2C_ADDR, MI2C_READ);
+    i2c_send_7bit_address(i2c, MI2C_ADDR, mode);
     usTimeout = 0;
     // Waiting for address is transferred.
     while (!(I2C_SR1(i2c) & I2C_SR1_ADDR)) {
       usTimeout++;
-      if (usTimeout > MI2C_ADDR_ACK_TIMEOUT) {  // setup timeout is 5ms once
+      if (usTimeout > MI2C_ADDR_ACK_TIMEOUT) {
         break;
       }
     }
-    if (usTimeout > MI2C_ADDR_ACK_TIMEOUT) {
-      usTimeout = 0;
-      i2c_retry_cnts++;
+    if (usTimeout <= MI2C_ADDR_ACK_TIMEOUT) {
+      /* Clearing ADDR condition sequence. */
+      (void)I2C_SR1(i2c);
+      (void)I2C_SR2(i2c);
+      return true;
+    }
+    if (mode == MI2C_READ) {
       i2c_send_stop(i2c);  // it will release i2c bus
-      delay_ms(2);
-      continue;
     }
-    /* Clearing ADDR condition sequence. */
-    (void)I2C_SR1(i2c);
-    (void)I2C_SR2(i2c);
-    break;
+    if (waited >= MI2C_BUSY_TIMEOUT_US) {
+      return false;
+    }
+    i2c_retry_cnts++;
+    __enable_irq();
+    delay_us(backoff);
+    __disable_irq();
+    waited += backoff;
+    backoff = backoff * 2 > MI2C_BACKOFF_MAX_US ? MI2C_BACKOFF_MAX_US
+                                                : backoff * 2;
+  }
+}
+
+static int bMI2CDRV_ReadBytes(uint32_t i2c, uint8_t *res, uint16_t *pusOutLen) {
+  uint8_t ucLenBuf[2], ucSW[2], ucXor = 0, ucXor1 = 0;
+  uint16_t i, usRevLen, usRealLen = 0;
+
+  if (!bMI2CDRV_Address(i2c, MI2C_READ)) {
+    return -1;
   }
   // rev len
   for (i = 0; i < 2; i++) {
@@ -148,39 +166,8 @@ static bool bMI2CDRV_WriteBytes(uint32_t i2c, uint8_t *data,
   uint8_t ucLenBuf[2], ucXor = 0;
   uint16_t i, usTimeout = 0;
 
-  i2c_retry_cnts = 0;
-  while (1) {
-    if (i2c_retry_cnts > MI2C_RETRYCNTS) {
-      return false;
-    }
-
-    i2c_send_start(i2c);
-    usTimeout = 0;
-    while (!(I2C_SR1(i2c) & I2C_SR1_SB)) {
-      usTimeout++;
-      if (usTimeout > MI2C_TIMEOUT) {
-        break;
-      }
-    }
-
-    i2c_send_7bit_address(i2c, MI2C_ADDR, MI2C_WRITE);
-    usTimeout = 0;
-    // Waiting for address is transferred.
-    while (!(I2C_SR1(i2c) & I2C_SR1_ADDR)) {
-      usTimeout++;
-      if (usTimeout > MI2C_ADDR_ACK_TIMEOUT) {
-        break;
-      }
-    }
-    if (usTimeout > MI2C_ADDR_ACK_TIMEOUT) {
-      i2c_retry_cnts++;
-      usTimeout = 0;
-      continue;
-    }
-    /* Clearing ADDR condition sequence. */
-    (void)I2C_SR1(i2c);
-    (void)I2C_SR2(i2c);
-    break;
+  if (!bMI2CDRV_Address(i2c, MI2C_WRITE)) {
+    return false;
   }
   // send L + V + xor
   ucLenBuf[0] = ((ucSendLen >> 8) & 0xFF);
@@ -44,6 +44,8 @@
 #define OLED_SETHIGHCOLUMN 0x10
 #define OLED_SETSTARTLINE 0x40
 #define OLED_MEMORYMODE 0x20
+#define OLED_COLUMNADDR 0x21
+#define OLED_PAGEADDR 0x22
 #define OLED_COMSCANINC 0xC0
 #define OLED_COMSCANDEC 0xC8
 #define OLED_SEGREMAP 0xA0
@@ -61,12 +63,41 @@ static uint8_t _oledbuffer[OLED_BUFSIZE];
 static uint8_t _oledbuffer_bak[OLED_BUFSIZE];
 static bool is_debug_link = 0;
 
+/* oledRefresh only transfers what changed since the previous refresh.
+ * Every write to _oledbuffer widens the dirty column span [lo, hi) of the
+ * touched page (pages and columns in buffer order, hi == 0 means clean), and
+ * the refresh trims those spans further against _oledbuffer_shown, the
+ * content the display currently holds.
+ */
+static uint8_t _oledbuffer_shown[OLED_BUFSIZE];
+static uint8_t _oled_dirty_lo[OLED_HEIGHT / 8];
+static uint8_t _oled_dirty_hi[OLED_HEIGHT / 8];
+static bool _oled_shown_valid = false;
+static uint32_t _oled_refresh_bytes = 0;
+
 /*
  * macros to convert coordinate to bit position
  */
 #define OLED_OFFSET(x, y) (OLED_BUFSIZE - 1 - (x) - ((y) / 8) * OLED_WIDTH)
 #define OLED_MASK(x, y) (1 << (7 - (y) % 8))
 
+/*
+ * Mark the buffer bytes first..last (inclusive) as changed
+ */
+static void oled_mark_dirty(int first, int last) {
+  for (int page = first / OLED_WIDTH; page <= last / OLED_WIDTH; page++) {
+    uint8_t lo = MAX(first - page * OLED_WIDTH, 0);
+    uint8_t hi = MIN(last - page * OLED_WIDTH, OLED_WIDTH - 1) + 1;
+    if (_oled_dirty_hi[page] == 0) {
+      _oled_dirty_lo[page] = lo;
+      _oled_dirty_hi[page] = hi;
+    } else {
+      _oled_dirty_lo[page] = MIN(_oled_dirty_lo[page], lo);
+      _oled_dirty_hi[page] = MAX(_oled_dirty_hi[page], hi);
+    }
+  }
+}
+
 /*
  * Return the state of the pixel at x, y
  */
@@ -82,6 +113,7 @@ void oledDrawPixel(int x, int y) {
     return;
   }
   _oledbuffer[OLED_OFFSET(x, y)] |= OLED_MASK(x, y);
+  oled_mark_dirty(OLED_OFFSET(x, y), OLED_OFFSET(x, y));
 }
 
 /*
@@ -92,6 +124,7 @@ void oledClearPixel(int x, int y) {
     return;
   }
   _oledbuffer[OLED_OFFSET(x, y)] &= ~OLED_MASK(x, y);
+  oled_mark_dirty(OLED_OFFSET(x, y), OLED_OFFSET(x, y));
 }
 
 /*
@@ -102,6 +135,68 @@ void oledInvertPixel(int x, int y) {
     return;
   }
   _oledbuffer[OLED_OFFSET(x, y)] ^= OLED_MASK(x, y);
+  oled_mark_dirty(OLED_OFFSET(x, y), OLED_OFFSET(x, y));
+}
+
+/*
+ * Blit up to 8 vertical pixels into column x, starting at row y.  Bit 7 of
+ * bits/mask is the top pixel, the same order as the bytes of _oledbuffer, so
+ * a glyph or bitmap column lands in at most two pages with two shifts.  Only
+ * pixels selected by mask are written.  Rows outside the display are
+ * clipped here; the caller must clip x.
+ */
+static inline void oled_blit_column(int x, int y, uint8_t bits, uint8_t mask) {
+  int page = (y >= 0) ? (y / 8) : -((7 - y) / 8);
+  int shift = y - page * 8;
+  uint8_t *col = _oledbuffer + OLED_BUFSIZE - 1 - x;
+
+  if (page >= 0 && page < OLED_HEIGHT / 8) {
+    uint8_t m = mask >> shift;
+    uint8_t *dst = col - page * OLED_WIDTH;
+    *dst = (*dst & ~m) | ((bits >> shift) & m);
+    oled_mark_dirty(dst - _oledbuffer, dst - _oledbuffer);
+  }
+  page++;
+  if (shift && page >= 0 && page < OLED_HEIGHT / 8) {
+    uint8_t m = (uint8_t)(mask << (8 - shift));
+    uint8_t *dst = col - page * OLED_WIDTH;
+    *dst = (*dst & ~m) | ((uint8_t)(bits << (8 - shift)) & m);
+    oled_mark_dirty(dst - _oledbuffer, dst - _oledbuffer);
+  }
+}
+
+#define OLED_OP_CLEAR 0
+#define OLED_OP_SET 1
+#define OLED_OP_INVERT 2
+
+/*
+ * Apply op to the box between (x1,y1) and (x2,y2) inclusive, one page mask
+ * per 8-row band instead of one bounds check per pixel.
+ */
+static void oled_box_op(int x1, int y1, int x2, int y2, int op) {
+  x1 = MAX(x1, 0);
+  y1 = MAX(y1, 0);
+  x2 = MIN(x2, OLED_WIDTH - 1);
+  y2 = MIN(y2, OLED_HEIGHT - 1);
+  if (x1 > x2 || y1 > y2) {
+    return;
+  }
+  for (int page = y1 / 8; page <= y2 / 8; page++) {
+    int top = MAX(y1 - page * 8, 0);
+    int bottom = MIN(y2 - page * 8, 7);
+    uint8_t mask = (0xFF >> top) & (uint8_t)(0xFF << (7 - bottom));
+    uint8_t *dst = _oledbuffer + OLED_BUFSIZE - 1 - page * OLED_WIDTH - x1;
+    oled_mark_dirty(dst - x2 + x1 - _oledbuffer, dst - _oledbuffer);
+    for (int x = x1; x <= x2; x++, dst--) {
+      if (op == OLED_OP_SET) {
+        *dst |= mask;
+      } else if (op == OLED_OP_CLEAR) {
+        *dst &= ~mask;
+      } else {
+        *dst ^= mask;
+      }
+    }
+  }
 }
 
 #if !EMULATOR
@@ -184,15 +279,23 @@ void oledUpdateClk(void) {
 /*
  * Clears the display buffer (sets all pixels to black)
  */
-void oledClear() { memzero(_oledbuffer, sizeof(_oledbuffer)); }
+void oledClear() {
+  memzero(_oledbuffer, sizeof(_oledbuffer));
+  oled_mark_dirty(0, OLED_BUFSIZE - 1);
+}
 
 void oledClearFrom_x_y(int x, int y) {
-  memzero(_oledbuffer, sizeof(_oledbuffer) -
-                           (OLED_OFFSET(OLED_WIDTH - x, OLED_HEIGHT - y - 8)));
+  int len =
+      sizeof(_oledbuffer) - (OLED_OFFSET(OLED_WIDTH - x, OLED_HEIGHT - y - 8));
+  memzero(_oledbuffer, len);
+  if (len > 0) {
+    oled_mark_dirty(0, MIN(len, OLED_BUFSIZE) - 1);
+  }
 }
 void oledClearPart() {
   // do not clear logo status,logo line 12
   memzero(_oledbuffer, sizeof(_oledbuffer) - (OLED_WIDTH * (LOGO_HEIGHT / 8)));
+  oled_mark_dirty(0, OLED_BUFSIZE - OLED_WIDTH * (LOGO_HEIGHT / 8) - 1);
 }
 
 void oledInvertDebugLink() {
@@ -215,19 +318,58 @@ void oledInvertDebugLink() {
 #endif
 }
 
+/*
+ * Collect the parts of the buffer that differ from what the display shows
+ * and record them as shown.  For every page (in buffer order) spans gets the
+ * first and last changed column, or first > last when the page is unchanged.
+ * Returns the number of bytes to transfer.
+ */
+uint32_t oledTakeDirtySpans(OledSpan spans[OLED_HEIGHT / 8]) {
+  uint32_t bytes = 0;
+  for (int page = 0; page < OLED_HEIGHT / 8; page++) {
+    int lo = _oled_dirty_lo[page];
+    int hi = _oled_dirty_hi[page];
+    const uint8_t *cur = _oledbuffer + page * OLED_WIDTH;
+    uint8_t *shown = _oledbuffer_shown + page * OLED_WIDTH;
+    if (!_oled_shown_valid) {
+      lo = 0;
+      hi = OLED_WIDTH;
+    } else {
+      while (lo < hi && cur[lo] == shown[lo]) lo++;
+      while (hi > lo && cur[hi - 1] == shown[hi - 1]) hi--;
+    }
+    _oled_dirty_hi[page] = 0;
+    if (lo < hi) {
+      memcpy(shown + lo, cur + lo, hi - lo);
+      spans[page].first = lo;
+      spans[page].last = hi - 1;
+      bytes += hi - lo;
+    } else {
+      spans[page].first = 1;
+      spans[page].last = 0;
+    }
+  }
+  _oled_shown_valid = true;
+  _oled_refresh_bytes = bytes;
+  return bytes;
+}
+
+/*
+ * Number of bytes the last refresh sent to the display
+ */
+uint32_t oledGetRefreshBytes(void) { return _oled_refresh_bytes; }
+
 /*
  * Refresh the display. This copies the buffer to the display to show the
  * contents.  This must be called after every operation to the buffer to
  * make the change visible.  All other operations only change the buffer
- * not the content of the display.
+ * not the content of the display.  Only the columns of each page that
+ * changed since the previous refresh are sent.
  */
 #if !EMULATOR
 void oledRefresh() {
-  static const uint8_t s[3] = {OLED_SETLOWCOLUMN | 0x00,
-                               OLED_SETHIGHCOLUMN | 0x00,
-                               OLED_SETSTARTLINE | 0x00};
-
   static bool refreshing = false;
+  OledSpan spans[OLED_HEIGHT / 8];
 
   if (refreshing == true) return;
   refreshing = true;
@@ -235,15 +377,30 @@ void oledRefresh() {
   // draw triangle in upper right corner
   oledInvertDebugLink();
 
-  gpio_clear(OLED_CS_PORT, OLED_CS_PIN);  // SPI select
-  SPISend(OLED_SPI_BASE, s, 3);
-  gpio_set(OLED_CS_PORT, OLED_CS_PIN);  // SPI deselect
-
-  gpio_set(OLED_DC_PORT, OLED_DC_PIN);    // set to DATA
-  gpio_clear(OLED_CS_PORT, OLED_CS_PIN);  // SPI select
-  SPISend(OLED_SPI_BASE, _oledbuffer, sizeof(_oledbuffer));
-  gpio_set(OLED_CS_PORT, OLED_CS_PIN);    // SPI deselect
-  gpio_clear(OLED_DC_PORT, OLED_DC_PIN);  // set to CMD
+  oledTakeDirtySpans(spans);
+  for (int page = 0; page < OLED_HEIGHT / 8; page++) {
+    if (spans[page].first > spans[page].last) {
+      continue;
+    }
+    const uint8_t s[7] = {OLED_SETSTARTLINE | 0x00,
+                          OLED_COLUMNADDR,
+                          spans[page].first,
+                          spans[page].last,
+                          OLED_PAGEADDR,
+                          page,
+                          page};
+
+    gpio_clear(OLED_CS_PORT, OLED_CS_PIN);  // SPI select
+    SPISend(OLED_SPI_BASE, s, sizeof(s));
+    gpio_set(OLED_CS_PORT, OLED_CS_PIN);  // SPI deselect
+
+    gpio_set(OLED_DC_PORT, OLED_DC_PIN);    // set to DATA
+    gpio_clear(OLED_CS_PORT, OLED_CS_PIN);  // SPI select
+    SPISend(OLED_SPI_BASE, _oledbuffer + page * OLED_WIDTH + spans[page].first,
+            spans[page].last - spans[page].first + 1);
+    gpio_set(OLED_CS_PORT, OLED_CS_PIN);    // SPI deselect
+    gpio_clear(OLED_DC_PORT, OLED_DC_PIN);  // set to CMD
+  }
 
   refreshing = false;
   // return it back
@@ -256,6 +413,7 @@ const uint8_t *oledGetBuffer() { return _oledbuffer; }
 
 void oledSetBuffer(uint8_t *buf) {
   memcpy(_oledbuffer, buf, sizeof(_oledbuffer));
+  oled_mark_dirty(0, OLED_BUFSIZE - 1);
 }
 
 void oledSetDebugLink(bool set) {
@@ -266,6 +424,7 @@ void oledSetDebugLink(bool set) {
 void oledBufferBak(void) { memcpy(_oledbuffer_bak, _oledbuffer, OLED_BUFSIZE); }
 void oledBufferResume(void) {
   memcpy(_oledbuffer, _oledbuffer_bak, OLED_BUFSIZE);
+  oled_mark_dirty(0, OLED_BUFSIZE - 1);
 }
 
 void oledBufferLoad(uint8_t *buffer) {
@@ -274,15 +433,32 @@ void oledBufferLoad(uint8_t *buffer) {
 
 void oledBufferRestore(uint8_t *buffer) {
   memcpy(_oledbuffer, buffer, OLED_BUFSIZE);
+  oled_mark_dirty(0, OLED_BUFSIZE - 1);
 }
 
 void oledclearLine(uint8_t line) {
   if (line < (OLED_HEIGHT / 8)) {
     memzero(_oledbuffer + OLED_WIDTH * (OLED_HEIGHT / 8 - line - 1),
             OLED_WIDTH);
+    oled_mark_dirty(OLED_WIDTH * (OLED_HEIGHT / 8 - line - 1),
+                    OLED_WIDTH * (OLED_HEIGHT / 8 - line) - 1);
   }
 }
 
+/*
+ * Stretch the 4 pixels in the high nibble of bits to 8 pixels, for the
+ * FONT_DOUBLE glyphs.
+ */
+static inline uint8_t oled_double_bits(uint8_t bits) {
+  uint8_t r = 0;
+  for (int i = 0; i < 4; i++) {
+    if (bits & (0x80 >> i)) {
+      r |= 0xC0 >> (i * 2);
+    }
+  }
+  return r;
+}
+
 void oledDrawChar(int x, int y, char c, uint8_t font) {
   if (x >= OLED_WIDTH || y >= OLED_HEIGHT || y <= -FONT_HEIGHT) {
     return;
@@ -295,14 +471,22 @@ void oledDrawChar(int x, int y, char c, uint8_t font) {
   if (x <= -char_width) {
     return;
   }
+  // glyph columns are already stored in page order (top pixel in the MSB)
   for (int xo = 0; xo < char_width; xo++) {
-    for (int yo = 0; yo < FONT_HEIGHT; yo++) {
-      if (char_data[xo] & (1 << (FONT_HEIGHT - 1 - yo))) {
-        if (zoom <= 1) {
-          oledDrawPixel(x + xo, y + yo);
-        } else {
-          oledBox(x + xo * zoom, y + yo * zoom, x + (xo + 1) * zoom - 1,
-                  y + (yo + 1) * zoom - 1, true);
+    uint8_t bits = char_data[xo];
+    if (zoom <= 1) {
+      int cx = x + xo;
+      if (cx >= 0 && cx < OLED_WIDTH) {
+        oled_blit_column(cx, y, bits, bits);
+      }
+    } else {
+      uint8_t upper = oled_double_bits(bits);
+      uint8_t lower = oled_double_bits(bits << 4);
+      for (int i = 0; i < zoom; i++) {
+        int cx = x + xo * zoom + i;
+        if (cx >= 0 && cx < OLED_WIDTH) {
+          oled_blit_column(cx, y, upper, upper);
+          oled_blit_column(cx, y + 8, lower, lower);
         }
       }
     }
@@ -387,15 +571,35 @@ void oledDrawStringRight(int x, int y, const char *text, uint8_t font) {
   oledDrawString(x, y, text, font);
 }
 
+/*
+ * Fetch the 8-row band starting at row band of column i.  BITMAP_COLUMNS data
+ * is read as is, BITMAP_ROWS data (e.g. the user homescreen) is gathered from
+ * 8 rows.
+ */
+static inline uint8_t oled_bitmap_column(const BITMAP *bmp, int i, int band) {
+  if (bmp->format == BITMAP_COLUMNS) {
+    return bmp->data[(band / 8) * bmp->width + i];
+  }
+  uint8_t bits = 0;
+  const uint8_t *row = bmp->data + (i / 8) + band * (bmp->width / 8);
+  for (int k = 0; k < 8 && band + k < bmp->height; k++) {
+    if (row[k * (bmp->width / 8)] & (1 << (7 - i % 8))) {
+      bits |= 0x80 >> k;
+    }
+  }
+  return bits;
+}
+
 static void oled_draw_bitmap_flip(int x, int y, const BITMAP *bmp, bool flip) {
-  for (int i = 0; i < bmp->width; i++) {
-    int ii = flip ? (bmp->width - 1 - i) : i;
-    for (int j = 0; j < bmp->height; j++) {
-      if (bmp->data[(ii / 8) + j * bmp->width / 8] & (1 << (7 - ii % 8))) {
-        oledDrawPixel(x + i, y + j);
-      } else {
-        oledClearPixel(x + i, y + j);
-      }
+  int i0 = MAX(-x, 0);
+  int i1 = MIN(bmp->width, OLED_WIDTH - x);
+  for (int band = 0; band < bmp->height; band += 8) {
+    int rows = MIN(bmp->height - band, 8);
+    uint8_t mask = (uint8_t)(0xFF << (8 - rows));
+    for (int i = i0; i < i1; i++) {
+      int ii = flip ? (bmp->width - 1 - i) : i;
+      oled_blit_column(x + i, y + band, oled_bitmap_column(bmp, ii, band),
+                       mask);
     }
   }
 }
@@ -409,49 +613,27 @@ void oledDrawBitmapFlip(int x, int y, const BITMAP *bmp) {
 }
 
 void oledClearBitmap(int x, int y, const BITMAP *bmp) {
-  for (int i = 0; i < bmp->width; i++) {
-    for (int j = 0; j < bmp->height; j++) {
-      oledClearPixel(x + i, y + j);
-    }
-  }
+  oled_box_op(x, y, x + bmp->width - 1, y + bmp->height - 1, OLED_OP_CLEAR);
 }
 /*
  * Inverts box between (x1,y1) and (x2,y2) inclusive.
  */
 void oledInvert(int x1, int y1, int x2, int y2) {
-  x1 = MAX(x1, 0);
-  y1 = MAX(y1, 0);
-  x2 = MIN(x2, OLED_WIDTH - 1);
-  y2 = MIN(y2, OLED_HEIGHT - 1);
-  for (int x = x1; x <= x2; x++) {
-    for (int y = y1; y <= y2; y++) {
-      oledInvertPixel(x, y);
-    }
-  }
+  oled_box_op(x1, y1, x2, y2, OLED_OP_INVERT);
 }
 
 /*
  * Draw a filled rectangle.
  */
 void oledBox(int x1, int y1, int x2, int y2, bool set) {
-  x1 = MAX(x1, 0);
-  y1 = MAX(y1, 0);
-  x2 = MIN(x2, OLED_WIDTH - 1);
-  y2 = MIN(y2, OLED_HEIGHT - 1);
-  for (int x = x1; x <= x2; x++) {
-    for (int y = y1; y <= y2; y++) {
-      set ? oledDrawPixel(x, y) : oledClearPixel(x, y);
-    }
-  }
+  oled_box_op(x1, y1, x2, y2, set ? OLED_OP_SET : OLED_OP_CLEAR);
 }
 
 void oledHLine(int y) {
   if (y < 0 || y >= OLED_HEIGHT) {
     return;
   }
-  for (int x = 0; x < OLED_WIDTH; x++) {
-    oledDrawPixel(x, y);
-  }
+  oled_box_op(0, y, OLED_WIDTH - 1, y, OLED_OP_SET);
 }
 
 /*
@@ -480,6 +662,7 @@ void oledSwipeLeft(void) {
       }
       _oledbuffer[j * OLED_WIDTH] = 0;
     }
+    oled_mark_dirty(0, OLED_BUFSIZE - 1);
     oledRefresh();
   }
 }
@@ -506,6 +689,7 @@ void oledSwipeRight(void) {
       _oledbuffer[j * OLED_WIDTH + OLED_WIDTH - 3] = 0;
       _oledbuffer[j * OLED_WIDTH + OLED_WIDTH - 4] = 0;
     }
+    oled_mark_dirty(0, OLED_BUFSIZE - 1);
     oledRefresh();
   }
 }
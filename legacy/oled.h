@@ -36,6 +36,11 @@
 #define OLED_HEIGHT 64
 #define OLED_BUFSIZE (OLED_WIDTH * OLED_HEIGHT / 8)
 
+// changed columns of one display page, in buffer order; empty if first > last
+typedef struct {
+  uint8_t first, last;
+} OledSpan;
+
 void oledInit(void);
 void oledClear(void);
 void oledClearPart(void);
@@ -43,6 +48,8 @@ void oledClearPart(void);
 void oledUpdateClk(void);
 
 void oledRefresh(void);
+uint32_t oledTakeDirtySpans(OledSpan spans[OLED_HEIGHT / 8]);
+uint32_t oledGetRefreshBytes(void);
 
 void oledInvertDebugLink(void);
 
@@ -43,16 +43,104 @@ def write_keys(parsed):
         f.write("// clang-format on\n")
 
 
+def c_unescape(text):
+    # bytes the C compiler stores for the body of a string literal
+    out = bytearray()
+    i = 0
+    raw = text.encode("UTF-8")
+    while i < len(raw):
+        c = raw[i]
+        if c == ord("\\") and i + 1 < len(raw):
+            i += 1
+            c = {ord("n"): 10, ord("t"): 9}.get(raw[i], raw[i])
+        out.append(c)
+        i += 1
+    return bytes(out)
+
+
 def write_lang(parsed, lang_iso):
-    content = f"const char *const languages_{lang_iso.lower()}[] = " + "{"
-    content = [content]
-    for key in parsed:
-        text = key["translations"][lang_iso]
-        text = text.replace('"', '\\"')
-        text = f'    "{text}",'
-        content.append(text)
+    texts = [key["translations"][lang_iso].replace('"', '\\"') for key in parsed]
+    write_lang_pool(texts, lang_iso.lower())
+
+
+def write_lang_pool(texts, name):
+    # All strings of a language in one pool, addressed by 16-bit offsets
+    # instead of an array of pointers; identical strings are stored once.
+    pool = [f"const char languages_{name}_pool[] ="]
+    offsets = []
+    seen = {}
+    size = 0
+    for text in texts:
+        if text not in seen:
+            seen[text] = size
+            pool.append(f'    "{text}\\0"')
+            size += len(c_unescape(text)) + 1
+        offsets.append(seen[text])
+    if size > 0xFFFF:
+        raise ValueError(f"{name}: string pool too large for 16-bit offsets")
+    pool[-1] += ";"
+    content = pool + [f"const uint16_t languages_{name}_offsets[] = {{"]
+    for i in range(0, len(offsets), 10):
+        content.append("    " + " ".join(f"{o}," for o in offsets[i : i + 10]))
+    content.append("};")
+    with open(f"{BASE_PATH}/locales/{name}.inc", "w") as f:
+        f.write("\n".join(content) + "\n")
+
+
+def en_hash(seed, data):
+    # FNV-1a with the seed folded into the offset basis, same as gettext.c
+    h = 0x811C9DC5 ^ seed
+    for c in data:
+        h = ((h ^ c) * 0x01000193) & 0xFFFFFFFF
+    return h
+
+
+def write_en_index(texts):
+    # Minimal perfect hash (hash and displace) from an English string to its
+    # msgid, used by gettext_from_en.  For bucket en_hash(0, s) % n, seeds
+    # holds either the seed that spreads the bucket over free slots, or
+    # -(slot + 1) for buckets with a single string.  A string used by several
+    # msgids is indexed once and maps to the first of them.
+    keys = [c_unescape(t) for t in texts]
+    n = len(keys)
+    buckets = [[] for _ in range(n)]
+    first_msgid = {}
+    for msgid, key in enumerate(keys):
+        if key not in first_msgid:
+            first_msgid[key] = msgid
+            buckets[en_hash(0, key) % n].append(msgid)
+    seeds = [0] * n
+    slots = [None] * n
+    order = sorted(range(n), key=lambda b: -len(buckets[b]))
+    for b in order:
+        if len(buckets[b]) <= 1:
+            break
+        for seed in range(1, 0x8000):
+            taken = [en_hash(seed, keys[m]) % n for m in buckets[b]]
+            if len(set(taken)) == len(taken) and all(slots[t] is None for t in taken):
+                break
+        else:
+            strings = [keys[m] for m in buckets[b]]
+            raise ValueError(f"no 16-bit seed places the English strings {strings}")
+        seeds[b] = seed
+        for m, t in zip(buckets[b], taken):
+            slots[t] = m
+    free = [i for i in range(n) if slots[i] is None]
+    for b in order:
+        if len(buckets[b]) == 1:
+            slot = free.pop()
+            seeds[b] = -slot - 1
+            slots[slot] = buckets[b][0]
+    slots = [0 if m is None else m for m in slots]
+
+    content = [f"#define I18N_EN_INDEX_SIZE {n}", "const int16_t i18n_en_seeds[] = {"]
+    for i in range(0, n, 10):
+        content.append("    " + " ".join(f"{v}," for v in seeds[i : i + 10]))
+    content += ["};", "const uint16_t i18n_en_slots[] = {"]
+    for i in range(0, n, 10):
+        content.append("    " + " ".join(f"{v}," for v in slots[i : i + 10]))
     content.append("};")
-    with open(f"{BASE_PATH}/locales/{lang_iso.lower()}.inc", "w") as f:
+    with open(f"{BASE_PATH}/locales/en_index.inc", "w") as f:
         f.write("\n".join(content) + "\n")
 
 
@@ -116,6 +204,9 @@ def main():
 
     for lang in languages_map.keys():
         write_lang(parsed, lang)
+    write_en_index(
+        [key["translations"]["en"].replace('"', '\\"') for key in parsed]
+    )
 
     for chars in ((CHARS_TITLE, 36), (CHARS_SUBTITLE, 24), (CHARS_NORMAL, 20)):
         chars_list = list(chars[0])
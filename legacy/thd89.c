@@ -2,17 +2,28 @@
 #include "common.h"
 #include "usart.h"
 
-secbool thd89_transmit(uint8_t *cmd, uint16_t len, uint8_t *resp,
-                       uint16_t *resp_len) {
+secbool thd89_send(uint8_t *cmd, uint16_t len) {
   if (secfalse == bMI2CDRV_SendData(cmd, len)) {
     return secfalse;
   }
+  return sectrue;
+}
 
-  hal_delay(1);
+secbool thd89_receive(uint8_t *resp, uint16_t *resp_len) {
   if (secfalse == bMI2CDRV_ReceiveData(resp, resp_len)) {
     return secfalse;
   }
   return sectrue;
 }
 
+secbool thd89_transmit(uint8_t *cmd, uint16_t len, uint8_t *resp,
+                       uint16_t *resp_len) {
+  if (secfalse == thd89_send(cmd, len)) {
+    return secfalse;
+  }
+
+  hal_delay(1);
+  return thd89_receive(resp, resp_len);
+}
+
 uint16_t thd89_last_error() { return get_lasterror(); };
@@ -10,6 +10,12 @@
 
 secbool thd89_transmit(uint8_t *cmd, uint16_t len, uint8_t *resp,
                        uint16_t *resp_len);
+// thd89_transmit in two halves. Once thd89_send returns the SE works on the
+// command by itself and cmd may be reused, so the caller can get on with
+// work that does not need the response before collecting it with
+// thd89_receive. Nothing else may be sent to the SE in between.
+secbool thd89_send(uint8_t *cmd, uint16_t len);
+secbool thd89_receive(uint8_t *resp, uint16_t *resp_len);
 uint16_t thd89_last_error(void);
 
 #endif
@@ -4982,6 +4982,7 @@ class DebugLinkState(protobuf.MessageType):
         11: protobuf.Field("reset_word_pos", "uint32", repeated=False, required=False, default=None),
         12: protobuf.Field("mnemonic_type", "BackupType", repeated=False, required=False, default=None),
         13: protobuf.Field("layout_lines", "string", repeated=True, required=False, default=None),
+        500: protobuf.Field("oled_refresh_bytes", "uint32", repeated=False, required=False, default=None),
     }
 
     def __init__(
@@ -5000,6 +5001,7 @@ class DebugLinkState(protobuf.MessageType):
         recovery_word_pos: Optional["int"] = None,
         reset_word_pos: Optional["int"] = None,
         mnemonic_type: Optional["BackupType"] = None,
+        oled_refresh_bytes: Optional["int"] = None,
     ) -> None:
         self.layout_lines: Sequence["str"] = layout_lines if layout_lines is not None else []
         self.layout = layout
@@ -5014,6 +5016,7 @@ class DebugLinkState(protobuf.MessageType):
         self.recovery_word_pos = recovery_word_pos
         self.reset_word_pos = reset_word_pos
         self.mnemonic_type = mnemonic_type
+        self.oled_refresh_bytes = oled_refresh_bytes
 
 
 class DebugLinkStop(protobuf.MessageType):
@@ -27,7 +27,6 @@ SHOW_MORE = (143, 167)
 pytestmark = [pytest.mark.altcoin, pytest.mark.ethereum]
 
 
-@pytest.mark.skip_t1
 @parametrize_using_common_fixtures("ethereum/sign_typed_data.json")
 def test_ethereum_sign_typed_data(client: Client, parameters, result):
     with client: